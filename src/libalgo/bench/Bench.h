@@ -0,0 +1,60 @@
+// Description: Helpers shared by the benchmark programs (wall clock timer, command line arguments)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef Bench_H
+#define Bench_H
+
+#include <cstdio>
+#include <cstdlib>
+#include <sys/time.h>
+
+
+//Wall clock time in seconds
+inline double benchTime()
+{
+        timeval t;
+        gettimeofday ( &t, NULL );
+
+        return t.tv_sec + 1.0e-6 * t.tv_usec;
+}
+
+
+//Get the i-th command line argument as an unsigned integer, the default value is used when it is missing
+inline unsigned int benchArg ( const int argc, char * argv[], const int i, const unsigned int default_val )
+{
+        return ( i < argc ? ( unsigned int ) atoi ( argv[i] ) : default_val );
+}
+
+
+//Print one line of the results
+inline void benchPrint ( const char * name, const double t, const double t_ref )
+{
+        printf ( "%-40s %10.4f s %8.1fx\n", name, t, ( t > 0 ? t_ref / t : 0.0 ) );
+}
+
+
+//Print one line of the results without the speedup
+inline void benchPrint ( const char * name, const double t )
+{
+        printf ( "%-40s %10.4f s\n", name, t );
+}
+
+#endif
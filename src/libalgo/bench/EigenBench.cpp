@@ -0,0 +1,191 @@
+// Description: Benchmark of the symmetric eigensolver (Householder tridiagonalization and implicit QL)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Usage: eig_bench [size = 200]
+
+#include <cmath>
+
+#include "libalgo/source/structures/matrix/Matrix.h"
+#include "libalgo/source/algorithms/matrixoperations/MatrixOperations.h"
+
+#include "Bench.h"
+
+
+//Reference QR algorithm with the Wilkinson shift on the Lanczos tridiagonal matrix (the former implementation of MatrixOperations::eig)
+//Rotations are accumulated in the columns of V, eigenvalues are sorted in the ascending order
+static void eigRef ( const Matrix <double> &A, Matrix <double> &V, Matrix <double> &L, const unsigned int max_iter = 1000, const double tolerance = 1.0e-15 )
+{
+        const unsigned int m = A.rows();
+
+        //Create tridiagonal matrix
+        Matrix <double> LV ( m, 1, 1 ), RV ( m, 1, 1 );
+        const Matrix <double> AT = MatrixOperations::tridiag ( A, LV, RV );
+
+        //Get diagonal and lower diagonal, first element twice
+        Matrix <double> B = MatrixOperations::diag ( AT );
+        const Matrix <double> CT = MatrixOperations::diag ( AT, -1 );
+        const unsigned int mb = B.rows();
+
+        Matrix <double> C ( mb, 1 );
+        C ( 0, 0 ) = CT ( 0, 0 );
+        C.submat ( CT ( 0, mb - 2, 0, 0 ), 1, 0 );
+
+        short index = mb - 1;
+        double w_shift = 0;
+        Matrix <double> S ( mb, 1 ), D ( mb, 1 );
+
+        //Perform iterations
+        for ( unsigned int iter = 0; ( iter < max_iter ) && ( index != 0 ); iter++ )
+        {
+                //Wilkinson shift: root of the trailing 2 x 2 block closer to its last diagonal element
+                const double trace = B ( index - 1, 0 ) + B ( index, 0 );
+                const double deter = B ( index - 1, 0 ) * B ( index, 0 ) - C ( index, 0 ) * C ( index, 0 );
+                const double discriminant = sqrt ( trace * trace - 4 * deter );
+                const double m1 = ( trace + discriminant ) / 2;
+                const double m2 = ( trace - discriminant ) / 2;
+
+                S ( 0, 0 ) = ( fabs ( m1 - B ( index, 0 ) ) < fabs ( m2 - B ( index, 0 ) ) ? m1 : m2 );
+                w_shift += S ( 0, 0 );
+
+                for ( int i = 0; i <= index; i++ ) B ( i, 0 ) -= S ( 0, 0 );
+
+                double c_old = C ( 1, 0 );
+
+                //QR step
+                for ( int i = 1; i <= index; i++ )
+                {
+                        const int j = i - 1;
+                        const double r = sqrt ( B ( j, 0 ) * B ( j, 0 ) + c_old * c_old );
+                        D ( i, 0 ) = B ( j, 0 ) / r;
+                        S ( i, 0 ) = c_old / r;
+                        B ( j, 0 ) = r;
+
+                        const double t1 = D ( i, 0 ) * C ( i, 0 ) + S ( i, 0 ) * B ( i, 0 );
+                        const double t2 = -S ( i, 0 ) * C ( i, 0 ) + D ( i, 0 ) * B ( i, 0 );
+                        C ( i, 0 ) = t1;
+                        B ( i, 0 ) = t2;
+
+                        if ( i != index )
+                        {
+                                c_old = C ( i + 1, 0 );
+                                C ( i + 1, 0 ) *= D ( i, 0 );
+                        }
+                }
+
+                B ( 0, 0 ) = D ( 1, 0 ) * B ( 0, 0 ) + S ( 1, 0 ) * C ( 1, 0 );
+                C ( 1, 0 ) = S ( 1, 0 ) * B ( 1, 0 );
+
+                for ( int i = 1; i <= index - 1; i++ )
+                {
+                        B ( i, 0 ) = S ( i + 1, 0 ) * C ( i + 1, 0 ) + D ( i, 0 ) * D ( i + 1, 0 ) * B ( i, 0 );
+                        C ( i + 1, 0 ) = S ( i + 1, 0 ) * B ( i + 1, 0 );
+                }
+
+                B ( index, 0 ) *= D ( index, 0 );
+
+                //Accumulate rotations
+                for ( int i = 1; i <= index; i++ )
+                {
+                        const Matrix <double> CO = V ( 0, mb - 1, i - 1, i - 1 ) * D ( i, 0 ) + V ( 0, mb - 1, i, i ) * S ( i, 0 );
+                        V.submat ( V ( 0, mb - 1, i - 1, i - 1 ) * ( -S ( i, 0 ) ) + V ( 0, mb - 1, i, i ) * D ( i, 0 ), 0, i );
+                        V.submat ( CO, 0, i - 1 );
+                }
+
+                //Eigenvalue has converged
+                if ( fabs ( C ( index, 0 ) ) < tolerance )
+                {
+                        L ( index, 0 ) = B ( index, 0 ) + w_shift;
+                        index--;
+                }
+        }
+
+        L ( 0, 0 ) = B ( 0, 0 ) + w_shift;
+
+        //Sort eigenvalues and permute rows of V
+        Matrix <unsigned int> IX ( m, 1 );
+        MatrixOperations::sortrows ( L, IX, 0 );
+
+        Matrix <double> VP = V;
+
+        for ( unsigned int i = 0; i < m; i++ ) VP.submat ( V ( IX ( i, 0 ), IX ( i, 0 ), 0, m - 1 ), i, 0 );
+
+        V = VP;
+}
+
+
+int main ( int argc, char * argv[] )
+{
+        const unsigned int n = benchArg ( argc, argv, 1, 200 );
+
+        srand ( 1 );
+
+        //Random symmetric (indefinite) matrix
+        Matrix <double> A ( n, n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                for ( unsigned int j = 0; j <= i; j++ ) A ( i, j ) = A ( j, i ) = rand() / ( double ) RAND_MAX - 0.5;
+        }
+
+        printf ( "A: %u x %u, symmetric\n", n, n );
+
+        //Reduction only
+        Matrix <double> T = A, D ( n, 1 ), E ( n, 1 );
+        double t = benchTime();
+        MatrixOperations::tridiagSym ( T, D, E, false );
+        benchPrint ( "tridiagSym, without Q", benchTime() - t );
+
+        //Eigenvalues only
+        t = benchTime();
+        const Matrix <double> L0 = MatrixOperations::eigvals ( A );
+        benchPrint ( "eigvals", benchTime() - t );
+
+        //Eigenvalues and eigenvectors, reference implementation
+        Matrix <double> V_ref ( n, n, 0, 1 ), L_ref ( n, 1 );
+        t = benchTime();
+        eigRef ( A, V_ref, L_ref );
+        const double t_ref = benchTime() - t;
+        benchPrint ( "eig, reference (Lanczos + QR)", t_ref, t_ref );
+
+        //Eigenvalues and eigenvectors
+        Matrix <double> V ( n, n ), L ( n, 1 );
+        t = benchTime();
+        MatrixOperations::eig ( A, V, L );
+        benchPrint ( "eig", benchTime() - t, t_ref );
+
+        //Residual || A * V - V * diag ( L ) ||, the trace error and the difference of both eigenvalue computations
+        Matrix <double> LD ( n, n );
+        double trace_a = 0, trace_l = 0, trace_l_ref = 0, diff = 0, diff_ref = 0;
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                LD ( i, i ) = L ( i, 0 );
+                trace_a += A ( i, i );
+                trace_l += L ( i, 0 );
+                trace_l_ref += L_ref ( i, 0 );
+                diff = std::max ( diff, fabs ( L ( i, 0 ) - L0 ( i, 0 ) ) );
+                diff_ref = std::max ( diff_ref, fabs ( L ( i, 0 ) - L_ref ( i, 0 ) ) );
+        }
+
+        printf ( "|| A * V - V * L || = %g, trace error = %g, eig - eigvals = %g\n", MatrixOperations::norm ( Matrix <double> ( A * V - V * LD ) ), fabs ( trace_a - trace_l ), diff );
+        printf ( "reference: trace error = %g, eig - reference = %g\n", fabs ( trace_a - trace_l_ref ), diff_ref );
+
+        return 0;
+}
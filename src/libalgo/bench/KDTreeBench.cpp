@@ -0,0 +1,124 @@
+// Description: Benchmark of the pointer-based KDTree2D and of the flat array-backed FlatKDTree2D (build, NN and k-NN queries)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Usage: kdtree_bench [points_count = 200000] [queries_count = 200000] [k = 10]
+
+#include "libalgo/source/structures/point/Point3DCartesian.h"
+#include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/tree/KDTree.h"
+#include "libalgo/source/structures/tree/FlatKDTree.h"
+
+#include "Bench.h"
+
+
+int main ( int argc, char * argv[] )
+{
+        const unsigned int n = benchArg ( argc, argv, 1, 200000 ), q = benchArg ( argc, argv, 2, 200000 ), k = benchArg ( argc, argv, 3, 10 );
+
+        srand ( 1 );
+
+        //Uniformly distributed points and a dense strip
+        Container <Point3DCartesian <double> *> pl, ql;
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                if ( i % 4 == 0 ) pl.push_back ( new Point3DCartesian <double> ( 1000.0 * rand() / RAND_MAX, 500.0 + 10.0 * rand() / RAND_MAX ) );
+                else pl.push_back ( new Point3DCartesian <double> ( 1000.0 * rand() / RAND_MAX, 1000.0 * rand() / RAND_MAX ) );
+        }
+
+        for ( unsigned int i = 0; i < q; i++ )
+        {
+                ql.push_back ( new Point3DCartesian <double> ( 1000.0 * rand() / RAND_MAX, 1000.0 * rand() / RAND_MAX ) );
+        }
+
+        printf ( "points: %u, queries: %u, k = %u\n", n, q, k );
+
+        //Build
+        KDTree2D <Point3DCartesian <double> > tree;
+        double t = benchTime();
+        tree.createKDTree2D ( pl );
+        const double t_build = benchTime() - t;
+        benchPrint ( "KDTree2D, build", t_build, t_build );
+
+        FlatKDTree2D <Point3DCartesian <double> > flat_tree;
+        t = benchTime();
+        flat_tree.createKDTree2D ( pl );
+        benchPrint ( "FlatKDTree2D, build", benchTime() - t, t_build );
+
+        //Nearest neighbours
+        std::vector <Point3DCartesian <double> *> nn1 ( q ), nn2 ( q );
+        t = benchTime();
+
+        for ( unsigned int i = 0; i < q; i++ ) nn1[i] = tree.findNN ( ql[i] );
+
+        const double t_nn = benchTime() - t;
+        benchPrint ( "KDTree2D, findNN", t_nn, t_nn );
+
+        t = benchTime();
+
+        for ( unsigned int i = 0; i < q; i++ ) nn2[i] = flat_tree.findNN ( ql[i] );
+
+        benchPrint ( "FlatKDTree2D, findNN", benchTime() - t, t_nn );
+
+        //k nearest neighbours
+        unsigned int knn_diff = 0;
+        Container <Point3DCartesian <double> *, NonDestructable> knn1, knn2;
+        t = benchTime();
+
+        for ( unsigned int i = 0; i < q; i++ )
+        {
+                knn1.clear();
+                tree.findAllKNN ( ql[i], knn1, k );
+        }
+
+        const double t_knn = benchTime() - t;
+        benchPrint ( "KDTree2D, findAllKNN", t_knn, t_knn );
+
+        t = benchTime();
+
+        for ( unsigned int i = 0; i < q; i++ )
+        {
+                knn2.clear();
+                flat_tree.findAllKNN ( ql[i], knn2, k );
+        }
+
+        benchPrint ( "FlatKDTree2D, findAllKNN", benchTime() - t, t_knn );
+
+        //Compare results of both trees (equidistant points may be found in a different order)
+        unsigned int nn_diff = 0;
+
+        for ( unsigned int i = 0; i < q; i++ )
+        {
+                if ( nn1[i] != nn2[i] ) nn_diff++;
+        }
+
+        for ( unsigned int i = 0; i < std::min ( q, 1000u ); i++ )
+        {
+                knn1.clear(); knn2.clear();
+                tree.findAllKNN ( ql[i], knn1, k );
+                flat_tree.findAllKNN ( ql[i], knn2, k );
+
+                if ( knn1.size() != knn2.size() || knn1[knn1.size() - 1] != knn2[knn2.size() - 1] ) knn_diff++;
+        }
+
+        printf ( "different results: NN %u, k-NN %u\n", nn_diff, knn_diff );
+
+        return 0;
+}
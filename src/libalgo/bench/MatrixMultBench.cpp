@@ -0,0 +1,131 @@
+// Description: Benchmark of the matrix multiplication kernels: trans(J) * W * J of the least squares adjustment and the square product
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Usage: matrix_mult_bench [points_count = 2000] [square_size = 500]
+
+#include <cmath>
+
+#include "libalgo/source/structures/matrix/Matrix.h"
+#include "libalgo/source/algorithms/matrixoperations/MatrixOperations.h"
+
+#include "Bench.h"
+
+
+//Reference i-j-k product over the rows of the items (the former implementation of Matrix::operator*)
+static Matrix <double> multNaive ( const Matrix <double> &A, const Matrix <double> &B )
+{
+        const unsigned int m = A.rows(), n = B.cols(), k = A.cols();
+        Matrix <double> C ( m, n );
+
+        for ( unsigned int i = 0; i < m; i++ )
+        {
+                for ( unsigned int j = 0; j < n; j++ )
+                {
+                        double s = 0;
+
+                        for ( unsigned int p = 0; p < k; p++ )
+                        {
+                                s += A ( i, p ) * B ( p, j );
+                        }
+
+                        C ( i, j ) = s;
+                }
+        }
+
+        return C;
+}
+
+
+static double maxDiff ( const Matrix <double> &A, const Matrix <double> &B )
+{
+        double d = 0;
+
+        for ( unsigned int i = 0; i < A.rows(); i++ )
+        {
+                for ( unsigned int j = 0; j < A.cols(); j++ )
+                {
+                        d = std::max ( d, fabs ( A ( i, j ) - B ( i, j ) ) );
+                }
+        }
+
+        return d;
+}
+
+
+int main ( int argc, char * argv[] )
+{
+        const unsigned int m = benchArg ( argc, argv, 1, 2000 ), n = benchArg ( argc, argv, 2, 500 );
+
+        srand ( 1 );
+
+        //Jacobian (2m x 8) and the diagonal weight matrix (2m x 2m) of the cartometric analysis
+        Matrix <double> J ( 2 * m, 8 ), W ( 2 * m, 2 * m );
+
+        for ( unsigned int i = 0; i < 2 * m; i++ )
+        {
+                for ( unsigned int j = 0; j < 8; j++ ) J ( i, j ) = rand() / ( double ) RAND_MAX - 0.5;
+
+                W ( i, i ) = 1.0 + rand() / ( double ) RAND_MAX;
+        }
+
+        printf ( "trans(J) * W * J, J: %u x 8\n", 2 * m );
+
+        double t = benchTime();
+        const Matrix <double> N1 = multNaive ( multNaive ( MatrixOperations::trans ( J ), W ), J );
+        const double t_naive = benchTime() - t;
+        benchPrint ( "naive i-j-k", t_naive, t_naive );
+
+        t = benchTime();
+        const Matrix <double> N2 = MatrixOperations::trans ( J ) * W * J;
+        benchPrint ( "operator *", benchTime() - t, t_naive );
+
+        t = benchTime();
+        const Matrix <double> N3 = MatrixOperations::tmult ( J, W * J );
+        benchPrint ( "tmult ( J, W * J )", benchTime() - t, t_naive );
+
+        printf ( "max difference: %g %g\n\n", maxDiff ( N1, N2 ), maxDiff ( N1, N3 ) );
+
+        //Square product
+        Matrix <double> A ( n, n ), B ( n, n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                for ( unsigned int j = 0; j < n; j++ )
+                {
+                        A ( i, j ) = rand() / ( double ) RAND_MAX;
+                        B ( i, j ) = rand() / ( double ) RAND_MAX;
+                }
+        }
+
+        printf ( "A * B, A, B: %u x %u\n", n, n );
+
+        t = benchTime();
+        const Matrix <double> C1 = multNaive ( A, B );
+        const double t_naive_sq = benchTime() - t;
+        benchPrint ( "naive i-j-k", t_naive_sq, t_naive_sq );
+
+        t = benchTime();
+        const Matrix <double> C2 = A * B;
+        benchPrint ( "operator *", benchTime() - t, t_naive_sq );
+
+        printf ( "max difference: %g\n", maxDiff ( C1, C2 ) );
+
+        return 0;
+}
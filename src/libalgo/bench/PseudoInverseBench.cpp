@@ -0,0 +1,100 @@
+// Description: Benchmark of the QR and SVD decompositions and of the pseudoinverse of tall Jacobians
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+// Usage: pinv_bench [rows = 2000] [columns = 8]
+
+#include "libalgo/source/structures/matrix/Matrix.h"
+#include "libalgo/source/algorithms/matrixoperations/MatrixOperations.h"
+
+#include "Bench.h"
+
+
+//Residual of the pseudoinverse: || A * X * A - A ||
+static double pinvResidual ( const Matrix <double> &A, const Matrix <double> &X )
+{
+        return MatrixOperations::norm ( Matrix <double> ( A * X * A - A ) );
+}
+
+
+int main ( int argc, char * argv[] )
+{
+        const unsigned int m = benchArg ( argc, argv, 1, 2000 ), n = benchArg ( argc, argv, 2, 8 );
+
+        srand ( 1 );
+
+        Matrix <double> A ( m, n );
+
+        for ( unsigned int i = 0; i < m; i++ )
+        {
+                for ( unsigned int j = 0; j < n; j++ ) A ( i, j ) = rand() / ( double ) RAND_MAX - 0.5;
+        }
+
+        printf ( "A: %u x %u\n", m, n );
+
+        //Full Q (m x m) against the compact WY form
+        Matrix <double> Q ( m, m ), R ( m, n ), tau ( n, 1 );
+        Matrix <unsigned int> P ( n, n );
+
+        double t = benchTime();
+        MatrixOperations::qr ( A, Q, R, P );
+        const double t_qr = benchTime() - t;
+        benchPrint ( "qr, pivoted, full Q", t_qr, t_qr );
+
+        Matrix <double> QR = A;
+        t = benchTime();
+        MatrixOperations::qrWY ( QR, tau );
+        benchPrint ( "qrWY, compact WY", benchTime() - t, t_qr );
+
+        //Full Demmel-Kahan SVD (U is m x m) against the thin one-sided Jacobi SVD
+        Matrix <double> UF ( m, m ), BF ( m, n ), VF ( n, n );
+        t = benchTime();
+        MatrixOperations::svd ( A, UF, BF, VF, 1000 );
+        const double t_svd = benchTime() - t;
+        benchPrint ( "svd, full U", t_svd, t_svd );
+
+        Matrix <double> U ( m, 1 ), S ( 1, 1 ), V ( n, 1 );
+        t = benchTime();
+        MatrixOperations::svdJacobi ( A, U, S, V );
+        benchPrint ( "svdJacobi, thin", benchTime() - t, t_svd );
+
+        Matrix <double> SD ( S.rows(), S.rows() );
+
+        for ( unsigned int i = 0; i < S.rows(); i++ ) SD ( i, i ) = S ( i, 0 );
+
+        printf ( "svdJacobi: || A - U * S * V' || = %g\n\n", MatrixOperations::norm ( Matrix <double> ( A - U * SD * MatrixOperations::trans ( V ) ) ) );
+
+        //Pseudoinverses
+        t = benchTime();
+        const Matrix <double> X0 = MatrixOperations::pinv ( A );
+        const double t_pinv = benchTime() - t;
+        benchPrint ( "pinv, normal equations", t_pinv, t_pinv );
+
+        t = benchTime();
+        const Matrix <double> X1 = MatrixOperations::pinv1 ( A );
+        benchPrint ( "pinv1, QR + pivoted QR of R", benchTime() - t, t_pinv );
+
+        t = benchTime();
+        const Matrix <double> X2 = MatrixOperations::pinvs ( A );
+        benchPrint ( "pinvs, Jacobi SVD", benchTime() - t, t_pinv );
+
+        printf ( "|| A * X * A - A ||: pinv %g, pinv1 %g, pinvs %g\n", pinvResidual ( A, X0 ), pinvResidual ( A, X1 ), pinvResidual ( A, X2 ) );
+
+        return 0;
+}
@@ -47,6 +47,9 @@ class Projection;
 template <typename T>
 class Projection;
 
+template <typename Point>
+class FlatKDTree2D;
+
 template <typename T >
 class Sample;
 
@@ -308,7 +311,8 @@ class CartAnalysis
 
                 template <typename T>
                 static T computeAnalysisForOneSample ( Container <Node3DCartesian <T> *> &nl_test, Container <Point3DGeographic <T> *> &pl_reference, typename TMeridiansList <T> ::Type &meridians, typename TParallelsList <T> ::Type &parallels,
-                                                       const Container <Face <T> *> &faces_test, Projection <T> *proj, const TAnalysisParameters <T> & analysis_parameters, Sample <T> &sample_res, bool singular_points_found, unsigned int & created_samples, std::ostream * output );
+                                                       const Container <Face <T> *> &faces_test, Projection <T> *proj, const TAnalysisParameters <T> & analysis_parameters, Sample <T> &sample_res, bool singular_points_found, unsigned int & created_samples, std::ostream * output,
+                                                       const FlatKDTree2D <Node3DCartesian <T> > * kd_tree_test = NULL );
 
                 template <typename T>
                 static void printResults ( const Container <Sample <T> > &sl, const Container < Node3DCartesian <T> *> &nl_test, const Container <Point3DGeographic <T> *> &nl_reference,
@@ -375,7 +379,8 @@ class CartAnalysis
                                 typename TParallelsList <T> ::Type & parallels_corr, typename TDevIndexPairs<T>::Type & point_pairs_new, bool &uncorrect_points_found );
 
                 template <typename T>
-                static void analyzeSampleCrossNearestNeighbourDistance ( Sample <T> &s, const Container <Node3DCartesian <T> *> &nl_test, const Container <Node3DCartesianProjected  <T> *> &nl_projected, const float mult_ratio );
+                static void analyzeSampleCrossNearestNeighbourDistance ( Sample <T> &s, const Container <Node3DCartesian <T> *> &nl_test, const Container <Node3DCartesianProjected  <T> *> &nl_projected, const float mult_ratio,
+                                const FlatKDTree2D <Node3DCartesian <T> > * kd_tree_test = NULL );
 
                 template <typename T>
                 static void analyzeSampleHomotheticTransformationDeviation ( Sample <T> &s, const Container <Node3DCartesian <T> *> &nl_test, const Container <Node3DCartesianProjected  <T> *> &nl_projected, const TMatchPointsType match_type, const float mult_ratio );
@@ -110,6 +110,11 @@ void CartAnalysis::computeAnalysisForAllSamplesGS(Container <Sample <T> > &sl, C
     //Total successfully computed analysis for one cartographic projection
     unsigned int total_created_and_analyzed_samples_projection = 0;
 
+    //KD tree of test points shared by the cross nearest neighbour distance of all samples
+    FlatKDTree2D <Node3DCartesian <T> > kd_tree_test;
+
+    if (analysis_parameters.analysis_type.a_cnd && nl_test.size() > 0) kd_tree_test.createKDTree2D(nl_test);
+
     //Create sample for analyzed projection from command line and set flag for this sample
     if (analysis_parameters.analyzed_projections.size() > 0)
     {
@@ -167,7 +172,8 @@ void CartAnalysis::computeAnalysisForAllSamplesGS(Container <Sample <T> > &sl, C
             try
             {
                 Sample <T> analyzed_sample;
-                (void) computeAnalysisForOneSample(*p_nl_test, *p_pl_reference, meridians, parallels, faces_test, analyzed_proj, analysis_parameters, analyzed_sample, singular_points_found, total_created_and_analyzed_samples_projection, output);
+                (void) computeAnalysisForOneSample(*p_nl_test, *p_pl_reference, meridians, parallels, faces_test, analyzed_proj, analysis_parameters, analyzed_sample, singular_points_found, total_created_and_analyzed_samples_projection, output,
+                                                   (p_nl_test == &nl_test ? &kd_tree_test : NULL));
 
                 //Add result to the list
                 if (total_created_and_analyzed_samples_projection) sl.push_back(analyzed_sample);
@@ -317,7 +323,8 @@ void CartAnalysis::computeAnalysisForAllSamplesGS(Container <Sample <T> > &sl, C
 				//Analyze normal aspect
 				Sample <T> analyzed_sample;
 
-				computeAnalysisForOneSample(*p_nl_test_non_sing, *p_pl_reference_non_sing, meridians, parallels, faces_test, *i_projections, analysis_parameters, analyzed_sample, singular_points_found, created_samples, output);
+				computeAnalysisForOneSample(*p_nl_test_non_sing, *p_pl_reference_non_sing, meridians, parallels, faces_test, *i_projections, analysis_parameters, analyzed_sample, singular_points_found, created_samples, output,
+					(p_nl_test_non_sing == &nl_test ? &kd_tree_test : NULL));
 
 				//Add result to the list
 				if (total_created_and_analyzed_samples_projection) sl.push_back(analyzed_sample);
@@ -363,6 +370,11 @@ void CartAnalysis::computeAnalysisForAllSamplesSim(Container <Sample <T> > &sl,
 	//Total successfully computed analysis for one cartographic projection
 	unsigned int total_created_and_analyzed_samples_projection = 0;
 
+	//KD tree of test points shared by the cross nearest neighbour distance of all samples
+	FlatKDTree2D <Node3DCartesian <T> > kd_tree_test;
+
+	if (analysis_parameters.analysis_type.a_cnd && m > 0) kd_tree_test.createKDTree2D(nl_test);
+
 	//Find extreme values
 	const TMinMax <T> lon_interval((*std::min_element(pl_reference.begin(), pl_reference.end(), sortPointsByLon()))->getLon(),
 		(*std::max_element(pl_reference.begin(), pl_reference.end(), sortPointsByLon()))->getLon());
@@ -431,7 +443,8 @@ void CartAnalysis::computeAnalysisForAllSamplesSim(Container <Sample <T> > &sl,
 			//Compute analysis
 			try
 			{
-				(void)computeAnalysisForOneSample(*p_nl_test, *p_pl_reference, meridians, parallels, faces_test, analyzed_proj, analysis_parameters, analyzed_sample, singular_points_found, total_created_and_analyzed_samples_projection, output);
+				(void)computeAnalysisForOneSample(*p_nl_test, *p_pl_reference, meridians, parallels, faces_test, analyzed_proj, analysis_parameters, analyzed_sample, singular_points_found, total_created_and_analyzed_samples_projection, output,
+					(p_nl_test == &nl_test ? &kd_tree_test : NULL));
 			}
 
 			//Throw error
@@ -743,6 +756,11 @@ void CartAnalysis::computeAnalysisForAllSamplesDE(Container <Sample <T> > &sl, C
 	//Total successfully computed analysis for one cartographic projection
 	unsigned int total_created_and_analyzed_samples_projection = 0;
 
+	//KD tree of test points shared by the cross nearest neighbour distance of all samples
+	FlatKDTree2D <Node3DCartesian <T> > kd_tree_test;
+
+	if (analysis_parameters.analysis_type.a_cnd && m > 0) kd_tree_test.createKDTree2D(nl_test);
+
 	//Find extreme values
 	const TMinMax <T> lon_interval((*std::min_element(pl_reference.begin(), pl_reference.end(), sortPointsByLon()))->getLon(),
 		(*std::max_element(pl_reference.begin(), pl_reference.end(), sortPointsByLon()))->getLon());
@@ -811,7 +829,8 @@ void CartAnalysis::computeAnalysisForAllSamplesDE(Container <Sample <T> > &sl, C
 			//Compute analysis
 			try
 			{
-				(void)computeAnalysisForOneSample(*p_nl_test, *p_pl_reference, meridians, parallels, faces_test, analyzed_proj, analysis_parameters, analyzed_sample, singular_points_found, total_created_and_analyzed_samples_projection, output);
+				(void)computeAnalysisForOneSample(*p_nl_test, *p_pl_reference, meridians, parallels, faces_test, analyzed_proj, analysis_parameters, analyzed_sample, singular_points_found, total_created_and_analyzed_samples_projection, output,
+					(p_nl_test == &nl_test ? &kd_tree_test : NULL));
 			}
 
 			//Throw exception
@@ -1116,6 +1135,11 @@ void CartAnalysis::computeAnalysisForAllSamplesNLS(Container <Sample <T> > &sl,
 	//Total successfully computed analysis for one cartographic projection
 	unsigned int total_created_and_analyzed_samples_projection = 0;
 
+	//KD tree of test points shared by the cross nearest neighbour distance of all samples
+	FlatKDTree2D <Node3DCartesian <T> > kd_tree_test;
+
+	if (analysis_parameters.analysis_type.a_cnd && m > 0) kd_tree_test.createKDTree2D(nl_test);
+
 	//Find extreme values
 	const TMinMax <T> lon_interval((*std::min_element(pl_reference.begin(), pl_reference.end(), sortPointsByLon()))->getLon(),
 		(*std::max_element(pl_reference.begin(), pl_reference.end(), sortPointsByLon()))->getLon());
@@ -1184,7 +1208,8 @@ void CartAnalysis::computeAnalysisForAllSamplesNLS(Container <Sample <T> > &sl,
 			//Compute analysis
 			try
 			{
-				(void)computeAnalysisForOneSample(*p_nl_test, *p_pl_reference, meridians, parallels, faces_test, analyzed_proj, analysis_parameters, analyzed_sample, singular_points_found, total_created_and_analyzed_samples_projection, output);
+				(void)computeAnalysisForOneSample(*p_nl_test, *p_pl_reference, meridians, parallels, faces_test, analyzed_proj, analysis_parameters, analyzed_sample, singular_points_found, total_created_and_analyzed_samples_projection, output,
+					(p_nl_test == &nl_test ? &kd_tree_test : NULL));
 			}
 
 			//Throw error
@@ -2168,9 +2193,14 @@ void CartAnalysis::findLatPLonPIntervals(const Container <Point3DGeographic <T>
 
 template <typename T>
 T CartAnalysis::computeAnalysisForOneSample(Container <Node3DCartesian <T> *> &nl_test, Container <Point3DGeographic <T> *> &pl_reference, typename TMeridiansList <T> ::Type & meridians, typename TParallelsList <T> ::Type & parallels,
-	const Container <Face <T> *> &faces_test, Projection <T> *proj, const TAnalysisParameters <T> & analysis_parameters, Sample <T> &sample_res, bool singular_points_found, unsigned int & created_samples, std::ostream * output)
+	const Container <Face <T> *> &faces_test, Projection <T> *proj, const TAnalysisParameters <T> & analysis_parameters, Sample <T> &sample_res, bool singular_points_found, unsigned int & created_samples, std::ostream * output,
+	const FlatKDTree2D <Node3DCartesian <T> > * kd_tree_test)
 {
-	//Compute all cartometric analysis for one sample
+	//Compute all cartometric analysis for one sample, the KD tree of nl_test (if given) is shared by all samples
+	//Points created for the sample are allocated in its own arena, their blocks are released at once when the sample is finished
+	MemoryArena sample_arena;
+	MemoryArenaScope sample_arena_scope(sample_arena);
+
 	unsigned int n_nsing = nl_test.size(), n_best = n_nsing;
 	bool outliers_found = false;
 
@@ -2518,9 +2548,9 @@ T CartAnalysis::computeAnalysisForOneSample(Container <Node3DCartesian <T> *> &n
 			if (analysis_parameters.analysis_type.a_homt)
 				analyzeSampleHomotheticTransformationDeviation(*p_sample, *p_nl_test_best, *p_nl_projected_best, analysis_parameters.match_method, mult_ratio);
 
-			//Cross nearest distance
+			//Cross nearest distance: the KD tree of test points is valid only if no singular point has been removed
 			if (analysis_parameters.analysis_type.a_cnd)
-				analyzeSampleCrossNearestNeighbourDistance(*p_sample, *p_nl_test_best, *p_nl_projected_best, mult_ratio);
+				analyzeSampleCrossNearestNeighbourDistance(*p_sample, *p_nl_test_best, *p_nl_projected_best, mult_ratio, (p_nl_test_best == &nl_test ? kd_tree_test : NULL));
 
 			//Analysis of graticule: turning function
 			if (analysis_parameters.analysis_type.a_gn_tf)
@@ -3006,9 +3036,12 @@ void CartAnalysis::correctPointsMeridiansAndParrallels(const Container <Node3DCa
 
 //Each sample analysis
 template <typename T>
-void CartAnalysis::analyzeSampleCrossNearestNeighbourDistance(Sample <T> &s, const Container <Node3DCartesian <T> *> &nl_test, const Container <Node3DCartesianProjected  <T> *> &nl_projected, const float mult_ratio)
+void CartAnalysis::analyzeSampleCrossNearestNeighbourDistance(Sample <T> &s, const Container <Node3DCartesian <T> *> &nl_test, const Container <Node3DCartesianProjected  <T> *> &nl_projected, const float mult_ratio,
+	const FlatKDTree2D <Node3DCartesian <T> > * kd_tree_test)
 {
 	//Analyze all samples using cross nearest distance ratio
+	//Both sets are compared with the coincident centers of mass: projected points are shifted to the center of mass of test points,
+	//so that the KD tree of test points does not depend on the sample and may be built once for all samples
 	try
 	{
 		const unsigned int n = nl_test.size();
@@ -3031,21 +3064,31 @@ void CartAnalysis::analyzeSampleCrossNearestNeighbourDistance(Sample <T> &s, con
 		x_mass_reference = x_mass_reference / n;
 		y_mass_reference = y_mass_reference / n;
 
-		//Reduce coordinates
-		Container <Node3DCartesian <T> *> nl_test_red;
+		//Shift projected points
 		Container <Node3DCartesianProjected <T> *> nl_projected_red;
 
 		for (unsigned int i = 0; i < n; i++)
 		{
-			Node3DCartesian <T> *point_test = new Node3DCartesianProjected <T>(nl_test[i]->getX() - x_mass_test, nl_test[i]->getY() - y_mass_test);
-			Node3DCartesianProjected <T> *point_proj = new Node3DCartesianProjected <T>(nl_projected[i]->getX() - x_mass_reference, nl_projected[i]->getY() - y_mass_reference);
+			Node3DCartesianProjected <T> *point_proj = new Node3DCartesianProjected <T>(nl_projected[i]->getX() - x_mass_reference + x_mass_test, nl_projected[i]->getY() - y_mass_reference + y_mass_test);
 
-			nl_test_red.push_back(point_test);
 			nl_projected_red.push_back(point_proj);
 		}
 
-		//Compute cross nearest distance ratio
-		const T cross_nearest_neighbour_distance_ratio = NNDistance::getCrossNearestNeighbourDistance(nl_test_red, nl_projected_red);
+		//Compute cross nearest distance ratio: use the shared KD tree of test points or build it for this sample
+		T cross_nearest_neighbour_distance_ratio = 0;
+
+		if ((kd_tree_test != NULL) && (kd_tree_test->getPointsCount() == n))
+		{
+			cross_nearest_neighbour_distance_ratio = NNDistance::getCrossNearestNeighbourDistance(*kd_tree_test, nl_projected_red);
+		}
+
+		else
+		{
+			FlatKDTree2D <Node3DCartesian <T> > kd_tree;
+			kd_tree.createKDTree2D(nl_test);
+
+			cross_nearest_neighbour_distance_ratio = NNDistance::getCrossNearestNeighbourDistance(kd_tree, nl_projected_red);
+		}
 
 		s.setCrossNearestNeighbourDistanceRatio(cross_nearest_neighbour_distance_ratio * mult_ratio);
 		s.setCrossNearestNeighbourDistanceRatioPosition(1);
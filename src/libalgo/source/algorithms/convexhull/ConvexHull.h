@@ -23,6 +23,7 @@
 #define ConvexHull_H
 
 #include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/PointArray.h"
 
 //Forward declaration
 class TIndexList;
@@ -32,12 +33,27 @@ class TIndexList;
 class ConvexHull
 {
         public:
-                template <typename Point>
-                static void getConvexHull ( const Container <Point> &nl, Container <Point, NonDestructable > &ch, const bool print_exception = true, std::ostream * output = &std::cout );
+                template <typename Point, TDestructable destructable>
+                static void getConvexHull ( const Container <Point *, destructable> &nl, Container <Point *, NonDestructable > &hull, const bool print_exception = true, std::ostream * output = &std::cout );
+
+                template <typename T>
+                static void getConvexHull ( const PointArray <T> &pa, TIndexList &hull, const bool print_exception = true, std::ostream * output = &std::cout );
 
         private:
-                template <typename Point>
-                static void QHULL ( const unsigned int p1, const unsigned int p2, const Container <Point> &nl, const TIndexList & il , Container <Point, NonDestructable > &hull, const unsigned int n );
+                template <typename T>
+                static void QHULL ( const unsigned int p1, const unsigned int p2, const PointArray <T> &pa, const TIndexList & il, TIndexList &hull );
+
+                template <typename T>
+                static void removeNonConvexVertices ( const PointArray <T> &pa, TIndexList &hull );
+
+                template <typename T>
+                static bool isRightFromEdge ( const PointArray <T> &pa, const unsigned int p, const unsigned int p1, const unsigned int p2 );
+
+                template <typename T>
+                static double getOrientation ( const PointArray <T> &pa, const unsigned int p1, const unsigned int p2, const unsigned int p3 );
+
+                template <typename T>
+                static bool isEqual ( const PointArray <T> &pa, const unsigned int p1, const unsigned int p2 );
 
 };
 
@@ -23,129 +23,110 @@
 #define ConvexHull_HPP
 
 #include <algorithm>
+#include <vector>
 
-#include "libalgo/source/algorithms/pointlineposition/PointLinePosition.h"
-#include "libalgo/source/algorithms/pointlinedistance/PointLineDistance.h"
+#include "libalgo/source/structures/list/IndexLists.h"
 
-#include "libalgo/source/comparators/sortPointsByX.h"
-#include "libalgo/source/comparators/sortPointsByY.h"
+#include "libalgo/source/algorithms/robustpredicates/RobustPredicates.h"
 
 #include "libalgo/source/exceptions/ErrorBadData.h"
 
 
-template <typename Point>
-void ConvexHull::getConvexHull ( const Container <Point> &nl, Container <Point, NonDestructable > &hull, const bool print_exception, std::ostream * output )
+template <typename Point, TDestructable destructable>
+void ConvexHull::getConvexHull ( const Container <Point *, destructable> &nl, Container <Point *, NonDestructable > &hull, const bool print_exception, std::ostream * output )
 {
-        //Construct Convex Hull using Q-HULL algorithm
+        //Construct Convex Hull of points using Q-HULL algorithm, coordinates are scanned in the point array
+        const PointArray <typename Point::Type> pa ( nl );
+
+        TIndexList il;
+        getConvexHull ( pa, il, print_exception, output );
+
+        //Add hull points
+        for ( unsigned int i = 0; i < il.size(); i++ )
+        {
+                hull.push_back ( nl [il[i]] );
+        }
+}
+
+
+template <typename T>
+void ConvexHull::getConvexHull ( const PointArray <T> &pa, TIndexList &hull, const bool print_exception, std::ostream * output )
+{
+        //Construct Convex Hull using Q-HULL algorithm, indices of hull points are stored in the counterclockwise order
         try
         {
+                const unsigned int n = pa.size();
+
                 //More than 2 points, it could be possible to create convex hull
-                if ( nl.size() > 2 )
+                if ( n > 2 )
                 {
                         //Find MBR points
-                        const unsigned int pos_p_x_max = std::max_element ( nl.begin(), nl.end(), sortPointsByX () ) - nl.begin();
-                        const unsigned int pos_p_x_min = std::min_element ( nl.begin(), nl.end(), sortPointsByX () ) - nl.begin();
-                        const unsigned int pos_p_y_max = std::max_element ( nl.begin(), nl.end(), sortPointsByY () ) - nl.begin();
-                        const unsigned int pos_p_y_min = std::min_element ( nl.begin(), nl.end(), sortPointsByY () ) - nl.begin();
+                        const T * x = pa.getX(), * y = pa.getY();
+                        const unsigned int pos_p_x_max = std::max_element ( x, x + n ) - x;
+                        const unsigned int pos_p_x_min = std::min_element ( x, x + n ) - x;
+                        const unsigned int pos_p_y_max = std::max_element ( y, y + n ) - y;
+                        const unsigned int pos_p_y_min = std::min_element ( y, y + n ) - y;
 
-                        //Create four indices lists
-                        TIndexList il1, il2, il3, il4;
-                        unsigned int n1 = 0, n2 = 0, n3 = 0, n4 = 0;
+                        //Vertices of the MBR quadrilateral in the counterclockwise order, identical vertices are merged
+                        const unsigned int extremes[4] = {pos_p_x_min, pos_p_y_min, pos_p_x_max, pos_p_y_max};
+                        TIndexList mbr;
 
-                        //Split nl to 4 nl inices lists an add points
-                        for ( unsigned int i = 0; i < nl.size(); i++ )
+                        for ( unsigned int i = 0; i < 4; i++ )
                         {
-                                //Point is right from existing edge (x_min, y_min)
-                                if ( ( PointLinePosition::getPointLinePosition2D ( nl [i], nl [pos_p_x_min], nl [pos_p_y_min], 0 ) == 0 ) )
-                                {
-                                        //Add to the nl1
-                                        il1.push_back ( i );
-                                        n1++;
-                                }
-
-                                //Point is right from existing edge  (y_min, x_max)
-                                if ( ( PointLinePosition::getPointLinePosition2D ( nl [i], nl [pos_p_y_min], nl [pos_p_x_max], 0 ) == 0 ) )
-                                {
-                                        //Add to the nl2
-                                        il2.push_back ( i );
-                                        n2++;
-                                }
-
-                                //Point is right from existing edge  (x_max, y_max)
-                                if ( ( PointLinePosition::getPointLinePosition2D ( nl [i], nl [pos_p_x_max], nl [pos_p_y_max], 0 ) == 0 ) )
-                                {
-                                        //Add to the nl3
-                                        il3.push_back ( i );
-                                        n3++;
-                                }
-
-                                //Point is right from existing edge (y_max, x_mmin)
-                                if ( ( PointLinePosition::getPointLinePosition2D ( nl [i], nl [pos_p_y_max], nl [pos_p_x_min], 0 ) == 0 ) )
-                                {
-                                        //Add to the nl4
-                                        il4.push_back ( i );
-                                        n4++;
-                                }
+                                if ( mbr.empty() || !isEqual ( pa, mbr.back(), extremes[i] ) ) mbr.push_back ( extremes[i] );
                         }
 
+                        if ( mbr.size() > 1 && isEqual ( pa, mbr.back(), mbr.front() ) ) mbr.pop_back();
 
-                        //Throw error, only two extremal points and no other point right from their straight line (i.e. all points lies on the line) has been found
-                        if ( ( n1 + n2 + n3 + n4 < 1 ) && ( ( pos_p_x_min == pos_p_y_min ) && ( pos_p_x_max  == pos_p_y_max )  ||
-                                                            ( pos_p_x_min == pos_p_y_max ) && ( pos_p_x_max  == pos_p_y_min ) ) )
+                        //Remove vertices collinear with their neighbours, they are not vertices of the hull
+                        for ( unsigned int i = 0; ( mbr.size() > 2 ) && ( i < mbr.size() ); )
                         {
-                                throw ErrorBadData ( "ErrorBadData, can not create convex hull, ", "all points lies on the straight line." );
-                        }
+                                const unsigned int m = mbr.size();
 
-                        //Approximation of the Convex Hull using quadrilateral connecting MBR (call Q-HULL for the first edge)
-                        if ( pos_p_x_min != pos_p_y_min )
-                        {
-                                //Add point to the CH
-                                hull.push_back ( nl [pos_p_x_min] ) ;
+                                if ( getOrientation ( pa, mbr[ ( i + m - 1 ) % m], mbr[i], mbr[ ( i + 1 ) % m] ) == 0 ) mbr.erase ( mbr.begin() + i );
 
-                                //Call Q-HULL for the first edge
-                                if ( n1 > 0 )
-                                {
-                                        QHULL ( pos_p_x_min, pos_p_y_min, nl, il1, hull, n1 );
-                                }
+                                else i++;
                         }
 
-                        //Approximation of the Convex Hull using quadrilateral connecting MBR (call Q-HULL for the second edge)
-                        if ( pos_p_y_min != pos_p_x_max )
+                        //Throw error, all points are identical
+                        if ( mbr.size() < 2 )
                         {
-                                //Add point to the CH
-                                hull->push_back ( nl [pos_p_y_min] );
+                                throw ErrorBadData ( "ErrorBadData, can not create convex hull, ", "all points are identical." );
+                        }
 
-                                //Call Q-HULL for the second edge
-                                if ( n2 > 0 )
+                        //Split points to the indices lists of the MBR edges: point is right from the edge (mbr[i], mbr[i + 1])
+                        const unsigned int m = mbr.size();
+                        std::vector <TIndexList> il ( m );
+
+                        for ( unsigned int i = 0; i < n; i++ )
+                        {
+                                for ( unsigned int j = 0; j < m; j++ )
                                 {
-                                        QHULL ( pos_p_y_min, pos_p_x_max, nl, il2, hull, n2 );
+                                        if ( isRightFromEdge ( pa, i, mbr[j], mbr[ ( j + 1 ) % m] ) )
+                                        {
+                                                il[j].push_back ( i );
+                                                break;
+                                        }
                                 }
                         }
 
-                        //Approximation of the Convex Hull using quadrilateral connecting MBR (call Q-HULL for the third edge)
-                        if ( pos_p_x_max != pos_p_y_max )
+                        //Approximation of the Convex Hull using polygon connecting MBR vertices (call Q-HULL for each edge)
+                        for ( unsigned int i = 0; i < m; i++ )
                         {
                                 //Add point to the CH
-                                hull.push_back ( nl [pos_p_x_max] );
+                                hull.push_back ( mbr[i] );
 
-                                //Call Q-HULL for the third edge
-                                if ( n3 > 0 )
-                                {
-                                        QHULL ( pos_p_x_max, pos_p_y_max, nl, il3, hull, n3 );
-                                }
+                                //Call Q-HULL for the edge
+                                QHULL ( mbr[i], mbr[ ( i + 1 ) % m], pa, il[i], hull );
                         }
 
-                        //Approximation of the Convex Hull using quadrilateral connecting MBR (call Q-HULL for the fourth edge)
-                        if ( pos_p_y_max != pos_p_x_min )
-                        {
-                                //Add point to the CH
-                                hull.push_back ( nl [pos_p_y_max] );
+                        //Remove collinear vertices (ties of the furthest points, MBR vertices inside the hull edges)
+                        removeNonConvexVertices ( pa, hull );
 
-                                //Call Q-HULL for the fourth edge
-                                if ( n4 > 0 )
-                                {
-                                        QHULL ( pos_p_y_max, pos_p_x_min, nl, il4, hull, n4 );
-                                }
+                        //Throw error, no point right from the straight line of two extremal points has been found (i.e. all points lies on the line)
+                        if ( hull.size() < 3 )
+                        {
+                                throw ErrorBadData ( "ErrorBadData, can not create convex hull, ", "all points lies on the straight line." );
                         }
                 }
 
@@ -166,8 +147,8 @@ void ConvexHull::getConvexHull ( const Container <Point> &nl, Container <Point,
                         *output << "Can not create convex hull ... '\n' ";
                 }
 
-                //Clear hu;;
-                hull->clear();
+                //Clear hull
+                hull.clear();
 
                 //Throw exception
                 throw;
@@ -175,12 +156,11 @@ void ConvexHull::getConvexHull ( const Container <Point> &nl, Container <Point,
 }
 
 
-template <typename Point>
-void ConvexHull::QHULL ( const unsigned int p1, const unsigned int p2, const Container <Point> &nl, const TIndexList & il, Container <Point, NonDestructable > &hull, const unsigned int n )
+template <typename T>
+void ConvexHull::QHULL ( const unsigned int p1, const unsigned int p2, const PointArray <T> &pa, const TIndexList & il, TIndexList &hull )
 {
-
-        //Construct Convex hull using modified Q-HULL
-        typename Point::Type max_dist_point_line = 0;
+        //Construct Convex hull using modified Q-HULL, points between p1 and p2 are added in the order of the hull
+        const unsigned int n = il.size();
 
         //No point between p1 and p2, stop recursion, no further split
         if ( n == 0 )
@@ -192,78 +172,102 @@ void ConvexHull::QHULL ( const unsigned int p1, const unsigned int p2, const Con
         else if ( n == 1 )
         {
                 //Add point to the hull
-                hull.push_back ( nl [ il [0]] );
+                hull.push_back ( il [0] );
 
                 return;
         }
 
         //More than 1 point between p1 and p2, split set
-        else
+        //Find the furthest point on the right side of the edge (p1 - p2), all points of il are on the right side (negative orientation)
+        double max_dist_point_line = 0;
+        unsigned int p3 = il [0];
+
+        for ( unsigned int i = 0; i < n; i++ )
         {
-                //Initialize point index right from the edge (p1, p2)
-                int p3 = -1;
+                const double dist_point_line = - getOrientation ( pa, p1, p2, il [i] );
 
-                //Find the furthest point on the right side of the edge (p1 - p2)
-                for ( unsigned int i = 0; i < n; i++ )
+                if ( dist_point_line > max_dist_point_line )
                 {
-                        //Point is on the right side of the edge (p1, p2)
-                        if ( ( PointLinePosition::getPointLinePosition2D ( nl [ il [i]], nl [p1], nl [p2], 0 ) == 0 ) )
-                        {
-                                //Get point - line distance
-                                typename Point::Type dist_point_line = PointLineDistance::getPointLineDistance2D ( nl [ il [i] ], nl [p1], nl [p2] );
-
-                                //Find points with min distance
-                                if ( dist_point_line > max_dist_point_line )
-                                {
-                                        max_dist_point_line = dist_point_line;
-                                        p3 = il [i];
-                                }
-                        }
+                        max_dist_point_line = dist_point_line;
+                        p3 = il [i];
                 }
+        }
 
-                //No point on the right to the edge (p1, p2) has been found, no further split
-                if ( p3 == -1 )
-                {
-                        return;
-                }
+        //Split set into two subsets located on the right sides of edges (p1, p3) or (p3, p2)
+        TIndexList il_first, il_second;
 
-                //Add found point p3 to the Convex hull
-                hull.push_back ( nl [p3] );
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                if ( isRightFromEdge ( pa, il [i], p1, p3 ) ) il_first.push_back ( il [i] );
 
-                //Split set into two subsets located on the right sides of edges
-                TIndexList il_first, il_second;
-                unsigned int n_first = 0, n_second = 0;
+                else if ( isRightFromEdge ( pa, il [i], p3, p2 ) ) il_second.push_back ( il [i] );
+        }
 
-                //Find points right from (p1, p3) or (p3, p2)
-                for ( unsigned int i = 0; i < n; i++ )
-                {
-                        //Point is right from the edge (p1, p3)
-                        if ( PointLinePosition::getPointLinePosition2D ( nl [ il [i]], nl [p1], nl [p3], 0 ) == 0 )
-                        {
-                                il_first.push_back ( il [i] );
-                                n_first ++;
-                        }
+        //Recursive calling of the Q-HULL for both intervals, found point p3 is added between them
+        QHULL ( p1, p3, pa, il_first, hull );
 
-                        //Point is right from the edge (p3, p2)
-                        if ( PointLinePosition::getPointLinePosition2D ( nl [ il [i]], nl [p3], nl [p2], 0 ) == 0 )
-                        {
-                                il_second.push_back ( il [i] );
-                                n_second ++;
-                        }
-                }
+        hull.push_back ( p3 );
 
-                //Recursive calling of the Q-HULL for both intervals
-                if ( n_first > 0 ) //Process left subset
-                {
-                        QHULL ( p1, p3, nl, il_first, hull, n_first );
-                }
+        QHULL ( p3, p2, pa, il_second, hull );
+}
 
-                if ( n_second > 0 ) //Process right subset
-                {
 
-                        QHULL ( p3, p2, nl, il_second, hull, n_second );
-                }
+template <typename T>
+void ConvexHull::removeNonConvexVertices ( const PointArray <T> &pa, TIndexList &hull )
+{
+        //Remove vertices of the counterclockwise hull polygon which do not make a left turn
+        const unsigned int n = hull.size();
+
+        if ( n < 3 ) return;
+
+        //Start from the lexicographically smallest vertex, it is always a vertex of the hull
+        unsigned int i_start = 0;
+
+        for ( unsigned int i = 1; i < n; i++ )
+        {
+                if ( ( pa.getX ( hull[i] ) < pa.getX ( hull[i_start] ) ) || ( ( pa.getX ( hull[i] ) == pa.getX ( hull[i_start] ) ) && ( pa.getY ( hull[i] ) < pa.getY ( hull[i_start] ) ) ) ) i_start = i;
         }
+
+        //Scan the vertices, remove the last vertex while it does not make a left turn
+        TIndexList hull_convex;
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                const unsigned int p = hull[ ( i_start + i ) % n];
+
+                while ( ( hull_convex.size() > 1 ) && ( getOrientation ( pa, hull_convex[hull_convex.size() - 2], hull_convex.back(), p ) <= 0 ) ) hull_convex.pop_back();
+
+                hull_convex.push_back ( p );
+        }
+
+        //Close the polygon
+        while ( ( hull_convex.size() > 2 ) && ( getOrientation ( pa, hull_convex[hull_convex.size() - 2], hull_convex.back(), hull_convex[0] ) <= 0 ) ) hull_convex.pop_back();
+
+        hull.swap ( hull_convex );
+}
+
+
+template <typename T>
+bool ConvexHull::isRightFromEdge ( const PointArray <T> &pa, const unsigned int p, const unsigned int p1, const unsigned int p2 )
+{
+        //Point p lies in the right half plane of the edge (p1, p2), points on the edge are not right
+        return getOrientation ( pa, p1, p2, p ) < 0;
+}
+
+
+template <typename T>
+double ConvexHull::getOrientation ( const PointArray <T> &pa, const unsigned int p1, const unsigned int p2, const unsigned int p3 )
+{
+        //Orientation of the points evaluated exactly: positive = counterclockwise, negative = clockwise, zero = colinear
+        return RobustPredicates::getOrientation2D ( pa.getX ( p1 ), pa.getY ( p1 ), pa.getX ( p2 ), pa.getY ( p2 ), pa.getX ( p3 ), pa.getY ( p3 ) );
+}
+
+
+template <typename T>
+bool ConvexHull::isEqual ( const PointArray <T> &pa, const unsigned int p1, const unsigned int p2 )
+{
+        //Points have the same coordinates
+        return ( pa.getX ( p1 ) == pa.getX ( p2 ) ) && ( pa.getY ( p1 ) == pa.getY ( p2 ) );
 }
 
 #endif
@@ -25,6 +25,7 @@
 #include <cmath>
 
 #include "libalgo/source/structures/point/Point3DCartesian.h"
+#include "libalgo/source/structures/list/PointArray.h"
 
 
 //Euclidian distance of 2 points
@@ -42,7 +43,20 @@ class EuclDistance
 
                 template <typename T>
                 static T getEuclDistance2D ( const T x1, const T y1, const T x2, const T y2 ) { return getEuclDistance ( x1, y1, ( T ) 0, x2, y2, ( T ) 0 ); }
+
+        public:
+                //Distances of all points of the point array (unit stride loops)
+                template <typename T>
+                static void getEuclDistances ( const PointArray <T> &pa, const T x, const T y, const T z, T * distances );
+
+                template <typename T>
+                static void getEuclDistances2D ( const PointArray <T> &pa, const T x, const T y, T * distances );
+
+                template <typename T>
+                static void getEuclDistances2D ( const PointArray <T> &pa1, const PointArray <T> &pa2, T * distances );
 };
 
+#include "EuclDistance.hpp"
+
 #endif
 
@@ -0,0 +1,79 @@
+// Description: Compute Euclidian distance
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef EuclDistance_HPP
+#define EuclDistance_HPP
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+
+
+template <typename T>
+void EuclDistance::getEuclDistances ( const PointArray <T> &pa, const T x, const T y, const T z, T * distances )
+{
+        //Distances of all points of the array to the point (x, y, z)
+        const unsigned int n = pa.size();
+        const T * px = pa.getX(), * py = pa.getY(), * pz = pa.getZ();
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                const T dx = px[i] - x, dy = py[i] - y, dz = pz[i] - z;
+                distances[i] = sqrt ( dx * dx + dy * dy + dz * dz );
+        }
+}
+
+
+template <typename T>
+void EuclDistance::getEuclDistances2D ( const PointArray <T> &pa, const T x, const T y, T * distances )
+{
+        //2D distances of all points of the array to the point (x, y)
+        const unsigned int n = pa.size();
+        const T * px = pa.getX(), * py = pa.getY();
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                const T dx = px[i] - x, dy = py[i] - y;
+                distances[i] = sqrt ( dx * dx + dy * dy );
+        }
+}
+
+
+template <typename T>
+void EuclDistance::getEuclDistances2D ( const PointArray <T> &pa1, const PointArray <T> &pa2, T * distances )
+{
+        //2D distances of the corresponding points of both arrays
+        const unsigned int n = pa1.size();
+
+        if ( n != pa2.size() )
+        {
+                throw ErrorBadData ( "ErrorBadData: can not compute distances of points, ", "point arrays have different sizes." );
+        }
+
+        const T * px1 = pa1.getX(), * py1 = pa1.getY(), * px2 = pa2.getX(), * py2 = pa2.getY();
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                const T dx = px2[i] - px1[i], dy = py2[i] - py1[i];
+                distances[i] = sqrt ( dx * dx + dy * dy );
+        }
+}
+
+#endif
@@ -23,6 +23,7 @@
 #define GraphAlgorithms_HPP
 
 #include <algorithm>
+#include <map>
 
 #include "libalgo/source/const/Const.h"
 
@@ -287,31 +288,41 @@ void GraphAlgorithms::createKNNGraph ( const Container <Point *> *points, const
                                         ( * std::min_element ( points->begin(), points->end(), sortPointsByX () ) )->getX();
         const typename Point::Type dy = ( * std::max_element ( points->begin(), points->end(), sortPointsByY () ) )->getY()  -
                                         ( * std::min_element ( points->begin(), points->end(), sortPointsByY () ) )->getY();
-        const unsigned int min_point_id = ( * std::min_element ( points->begin(), points->end(), sortPointsByID <Point>() ) )->getPointID();
 
         const typename Point::Type norm =  std::max ( dx, dy );
 
+        //Indices of points by their IDs, the container does not have to be sorted by ID
+        std::map <unsigned int, unsigned int> indices;
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                indices[ ( *points ) [i]->getPointID()] = i;
+        }
+
         //Get matrices
         Matrix <int> V ( n, n );
         Matrix <typename Point::Type> W ( n, n );
 
         //Create KD tree
         KDTree2D <Point> tree;
-        tree.createKDTree2D ( points );
+        tree.createKDTree2D ( *points );
+
+        //Find all k-nearest neighbours of all points
+        std::vector <Point *> knn;
+        const unsigned int k_nn = tree.findAllKNN ( *points, knn, k );
 
         //Process all points
         for ( unsigned int i = 0; i < points ->size(); i++ )
         {
-                //All k-nearest neighbours container, non-destructable
-                Container <Point *, NonDestructable > knn;
-
-                //Find all k-narest neighbours
-                tree.findAllKNN ( ( *points ) [i], &knn, k );
-
                 //Create edges of the graph
-                for ( unsigned int j = 1; j < k; j++ )
+                for ( unsigned int j = 1; j < k_nn; j++ )
                 {
-                        const unsigned int j_nn = knn[j]->getPointID() - min_point_id;
+                        const std::map <unsigned int, unsigned int>::const_iterator i_nn = indices.find ( knn[i * k_nn + j]->getPointID() );
+
+                        //Neighbour is not a point of the container
+                        if ( i_nn == indices.end() ) continue;
+
+                        const unsigned int j_nn = i_nn->second;
                         typename Point::Type dist = EuclDistance::getEuclDistance2D ( ( *points ) [i], ( *points ) [j_nn] );
 
                         //Set matrix V
@@ -339,10 +350,17 @@ void GraphAlgorithms::createNNNGraph ( const Container <Point *> *points, GraphM
                                         ( * std::min_element ( points->begin(), points->end(), sortPointsByX () ) )->getX();
         const typename Point::Type dy = ( * std::max_element ( points->begin(), points->end(), sortPointsByY () ) )->getY()  -
                                         ( * std::min_element ( points->begin(), points->end(), sortPointsByY () ) )->getY();
-        const unsigned int min_point_id = ( * std::min_element ( points->begin(), points->end(), sortPointsByID <Point *> () ) )->getPointID();
 
         const typename Point::Type norm =  std::max ( dx, dy );
 
+        //Indices of points by their IDs, the container does not have to be sorted by ID
+        std::map <unsigned int, unsigned int> indices;
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                indices[ ( *points ) [i]->getPointID()] = i;
+        }
+
         //Get matrices
         Matrix <int> V ( n, n );
         Matrix <typename Point::Type> W ( n, n );
@@ -374,7 +392,16 @@ void GraphAlgorithms::createNNNGraph ( const Container <Point *> *points, GraphM
                                         //There is neighbouring and bounded Voronoi cell
                                         if ( ( vor_cell_adjacent != NULL ) && ( vor_cell_adjacent->getBounded() ) )
                                         {
-                                                const unsigned int j_nnn = vor_cell_adjacent->getGenerator()->getPointID() - min_point_id;
+                                                const std::map <unsigned int, unsigned int>::const_iterator i_nnn = indices.find ( vor_cell_adjacent->getGenerator()->getPointID() );
+
+                                                //Generator is not a point of the container
+                                                if ( i_nnn == indices.end() )
+                                                {
+                                                        e = e->getNextEdge();
+                                                        continue;
+                                                }
+
+                                                const unsigned int j_nnn = i_nnn->second;
 
                                                 //Compute distance beween 2 generators: actual Voronoi cell and adjacent Voronoi cell
                                                 const typename Point::Type dist_gen_gen = EuclDistance::getEuclDistance2D ( ( *points ) [i], ( *points ) [j_nnn] );
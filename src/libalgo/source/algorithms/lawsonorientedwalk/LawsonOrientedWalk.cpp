@@ -1 +1,15 @@
 #include "LawsonOrientedWalk.h"
+
+#include <algorithm>
+
+
+void LawsonOrientedWalk::addWalk ( TWalkStatistics * statistics, const unsigned int steps )
+{
+        //Add the walk to the statistics
+        if ( statistics != NULL )
+        {
+                statistics->walks++;
+                statistics->steps += steps;
+                statistics->max_steps = ( std::max ) ( statistics->max_steps, steps );
+        }
+}
@@ -24,6 +24,8 @@
 
 #include "libalgo/source/algorithms/pointlineposition/PointLinePosition.h"
 
+#include "libalgo/source/structures/list/TriangleMesh.h"
+
 
 //Forward declarations
 template <typename T>
@@ -36,6 +38,19 @@ template <typename T>
 class Face;
 
 
+//Statistics of the walks over the triangle mesh
+struct TWalkStatistics
+{
+        unsigned int walks;			//Count of performed walks
+        unsigned long steps;			//Total count of visited triangles
+        unsigned int max_steps;			//Maximum count of triangles visited by one walk
+
+        TWalkStatistics() : walks ( 0 ), steps ( 0 ), max_steps ( 0 ) {}
+
+        double getAverageSteps() const {return walks > 0 ? ( double ) steps / walks : 0.0;}
+};
+
+
 //Lawson oriented walk: find incident triangle / Face using walking
 class LawsonOrientedWalk
 {
@@ -49,6 +64,15 @@ class LawsonOrientedWalk
                 template <typename T>
                 static HalfEdge <T> *findFaceWalk2 ( const Node3DCartesian <T> *p, short * status, HalfEdge <T> *e, const T max_steps );
 
+                template <typename T>
+                static unsigned int findTriangleWalk ( const Node3DCartesian <T> *p, short * status, const TriangleMesh <T> &mesh, unsigned int e );
+
+                template <typename T>
+                static unsigned int findFaceWalk2 ( const Node3DCartesian <T> *p, short * status, const TriangleMesh <T> &mesh, unsigned int e, const T max_steps, TWalkStatistics * statistics = NULL );
+
+        private:
+                static void addWalk ( TWalkStatistics * statistics, const unsigned int steps );
+
 };
 
 #include "LawsonOrientedWalk.hpp"
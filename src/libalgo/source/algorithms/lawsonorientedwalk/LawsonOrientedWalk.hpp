@@ -354,4 +354,242 @@ HalfEdge <T> *LawsonOrientedWalk::findFaceWalk2 ( const Node3DCartesian <T> *p,
         return NULL;
 }
 
+template <typename T>
+unsigned int LawsonOrientedWalk::findTriangleWalk ( const Node3DCartesian <T> *p, short * status, const TriangleMesh <T> &mesh, unsigned int e )
+{
+        /*
+         * Find triangle, inside that lies the point p = [xp,yp] using Lawson oriented search ;
+         * status=1: point lies inside the triangle, status=2: point lies on the edge of
+         * the triangle ;
+         * Used heuristic: finding starts from the last triangle defined by edge e
+         */
+
+        unsigned short  t1 = 0, t2 = 0, t3 = 0;
+
+        // Check first edge
+        t1 = PointLinePosition::getPointLinePosition2D ( p, mesh.getPoint ( e ), mesh.getPoint ( TriangleMesh <T>::getNextEdge ( e ) ) );
+
+        if ( t1 > 0 )
+        {
+                // Check next edge, move pointer
+                e = TriangleMesh <T>::getNextEdge ( e );
+        }
+
+        // Change orientation of the half plane
+        else
+        {
+                // Set new orientation
+                t1 = 1;
+
+                // Change orientation of the edge, increment edge
+                e = mesh.getTwinEdge ( e );
+
+                // Triangle lies on the boundary
+                if ( e == NO_HALF_EDGE )
+                {
+                        return NO_HALF_EDGE;
+                }
+
+                // Set next edge
+                e = TriangleMesh <T>::getNextEdge ( e );
+        }
+
+        //Run until any suitable triangle is found
+        for ( ;; )
+        {
+                // Lies the point in the intersection of two half planes?
+                t2 = PointLinePosition::getPointLinePosition2D ( p, mesh.getPoint ( e ), mesh.getPoint ( TriangleMesh <T>::getNextEdge ( e ) ) );
+
+                if ( t2 > 0 )
+                {
+                        // Check the third edge, move pointer
+                        e = TriangleMesh <T>::getNextEdge ( e );
+
+                        // Points lies inside a triangle (intersection of three half planes)
+                        t3 = PointLinePosition::getPointLinePosition2D ( p, mesh.getPoint ( e ), mesh.getPoint ( TriangleMesh <T>::getNextEdge ( e ) ) );
+
+                        if ( t3 > 0 )
+                        {
+                                // Point inside triangle
+                                if ( t1 * t2 * t3 == 1 )
+                                {
+                                        *status = 1;
+                                }
+
+                                // Point lies on the edge of the triangle
+                                else
+                                {
+                                        *status = 2;
+
+                                        // Return edge point lies on
+                                        if ( t3 == 2 )
+                                        {
+                                                // Actual edge
+                                                return e;
+                                        }
+
+                                        if ( t1 == 2 )
+                                        {
+                                                // First edge
+                                                return TriangleMesh <T>::getNextEdge ( e );
+                                        }
+
+                                        if ( t2 == 2 )
+                                        {
+                                                // Second edge
+                                                return TriangleMesh <T>::getPreviousEdge ( e );
+                                        }
+                                }
+
+                                // Triangle was found, return half edge
+                                return e;
+                        }
+
+                        // Change orientation of the half plane
+                        else
+                        {
+                                // This edge becomes first edge, move pointer
+                                e = mesh.getTwinEdge ( e );
+
+                                // No triangle found
+                                if ( e == NO_HALF_EDGE )
+                                {
+                                        return NO_HALF_EDGE;
+                                }
+
+                                // But we test the next edge, move pointer
+                                e = TriangleMesh <T>::getNextEdge ( e );
+
+                                // Set orientation
+                                t1 = 1;
+                        }
+                }
+
+                // Change orientation of the half plane
+                else
+                {
+                        // This edge becomes first edge
+                        e = mesh.getTwinEdge ( e );
+
+                        // Triangle lies on the boundary
+                        if ( e == NO_HALF_EDGE )
+                        {
+                                return NO_HALF_EDGE;
+                        }
+
+                        // But we test the next edge
+                        e = TriangleMesh <T>::getNextEdge ( e );
+
+                        // Set orientation for this edge
+                        t1 = 1;
+                }
+        }
+
+        //No triangle was found;
+        return NO_HALF_EDGE;
+}
+
+
+template <typename T>
+unsigned int LawsonOrientedWalk::findFaceWalk2 ( const Node3DCartesian <T> *p, short * status, const TriangleMesh <T> &mesh, unsigned int e, const T max_steps, TWalkStatistics * statistics )
+{
+        /*
+         * Find CONVEX Face, inside that lies the point p = [xp,yp] using Lawson oriented search ;
+         * status = 0: point lies outside of Face,
+         * status = 1: point lies inside the Face,
+         * status = 2: point lies on the edge of the Face ;
+         * Used heuristic: searching begins from the last Face defined by edge e ;
+         * Count of visited triangles is added to the statistics, if available
+         */
+        *status = 0;
+
+        //Visited triangles
+        unsigned int steps = 1;
+
+        //Start edge of the Face
+        unsigned int e_start = e;
+
+        //Process all halfedges of all Faces
+        for ( unsigned int i = 0; i < max_steps; i++)
+        {
+                //Compute half plane test
+                *status = PointLinePosition::getPointLinePosition2D ( p, mesh.getPoint ( e ), mesh.getPoint ( TriangleMesh <T>::getNextEdge ( e ) ) );
+
+                //Point colinear with some edge
+                if ( *status == 2 )
+                {
+                        //Point lies on the edge, perform aditional test:
+                        //a) to avoid the test of next edges of the triangle
+                        //b) to avoid the numerical inacuracy
+
+                        const Node3DCartesian <T> *p_start = mesh.getPoint ( e );
+                        const Node3DCartesian <T> *p_end = mesh.getPoint ( TriangleMesh <T>::getNextEdge ( e ) );
+
+                        //Distance (p, e->start)
+                        T dist_p_start = EuclDistance::getEuclDistance2D ( p->getX(), p->getY(), p_start->getX(), p_start->getY() );
+
+                        //Distance (p, e->end)
+                        T dist_p_end = EuclDistance::getEuclDistance2D ( p->getX(), p->getY(), p_end->getX(), p_end->getY() );
+
+                        //Distance (e->start, e->end)
+                        T dist_start_end = EuclDistance::getEuclDistance2D ( p_start->getX(), p_start->getY(), p_end->getX(), p_end->getY() );
+
+                        //Does a point lie on the line (e->start, e->end)
+                        if ( ( dist_p_start <= dist_start_end ) && ( dist_p_end  <= dist_start_end ) )
+                        {
+                                addWalk ( statistics, steps );
+                                return e;
+                        }
+
+                        //Point lies on the line of the edge outside of the edge: it lies right to other edge of the Face, test the next edge
+                        e = TriangleMesh <T>::getNextEdge ( e );
+
+                        continue;
+                }
+
+                //Point lefts to the edge
+                else if ( *status == 1 )
+                {
+                        //Increment edge
+                        e = TriangleMesh <T>::getNextEdge ( e );
+                }
+
+                //Point rights to the edge
+                else if ( *status == 0 )
+                {
+                        //Change Face
+                        e = mesh.getTwinEdge ( e );
+
+                        //We reach boundary edge, return NULL
+                        if ( e == NO_HALF_EDGE )
+                        {
+                                *status = 0;
+
+                                //No Face has been found
+                                addWalk ( statistics, steps );
+                                return NO_HALF_EDGE;
+                        }
+
+                        //Remeber this edge, new start edge of the Face
+                        e_start = e;
+                        steps++;
+
+                        //Increment edge
+                        e = TriangleMesh <T>::getNextEdge ( e );
+                }
+
+                //We reach start edge of the Face, return e;
+                if ( e == e_start )
+                {
+                        //Return half edge
+                        addWalk ( statistics, steps );
+                        return e ;
+                }
+        }
+
+        //Return null
+        addWalk ( statistics, steps );
+        return NO_HALF_EDGE;
+}
+
 #endif
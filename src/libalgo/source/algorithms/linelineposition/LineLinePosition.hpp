@@ -22,7 +22,9 @@
 #ifndef LineLinePosition_HPP
 #define LineLinePosition_HPP
 
+#include "libalgo/source/algorithms/pointlinedistance/PointLineDistance.h"
 #include "libalgo/source/algorithms/pointbetweenpoints/PointBetweenPoints.h"
+#include "libalgo/source/algorithms/robustpredicates/RobustPredicates.h"
 
 
 template <typename T>
@@ -93,17 +95,26 @@ unsigned short LineLinePosition::get2LineSegmentsPosition ( const T x1, const T
                 intersection_code =  2;
         }
 
-        //Segments do not intersect: do not compute any intersection
-        else if ( ( s < 0.0 ) || ( s > 1 ) ||
-                        ( t < 0.0 ) || ( t > 1 ) )
+        else
         {
-                return  0;
-        }
-
-        //Segments intersect, but not in end points
-        else if ( ( s > 0.0 ) && ( s < 1.0 ) && ( t > 0.0 ) && ( t < 1.0 ) )
-        {
-                intersection_code =  1;
+                //Positions of the end points to the other segment given by the exact orientation predicate
+                const double o1 = RobustPredicates::getOrientation2D ( ( double ) x3, ( double ) y3, ( double ) x4, ( double ) y4, ( double ) x1, ( double ) y1 );
+                const double o2 = RobustPredicates::getOrientation2D ( ( double ) x3, ( double ) y3, ( double ) x4, ( double ) y4, ( double ) x2, ( double ) y2 );
+                const double o3 = RobustPredicates::getOrientation2D ( ( double ) x1, ( double ) y1, ( double ) x2, ( double ) y2, ( double ) x3, ( double ) y3 );
+                const double o4 = RobustPredicates::getOrientation2D ( ( double ) x1, ( double ) y1, ( double ) x2, ( double ) y2, ( double ) x4, ( double ) y4 );
+
+                //Segments do not intersect: both end points of any segment lie strictly on the same side of the other segment
+                if ( ( o1 > 0 ) && ( o2 > 0 ) || ( o1 < 0 ) && ( o2 < 0 ) ||
+                                ( o3 > 0 ) && ( o4 > 0 ) || ( o3 < 0 ) && ( o4 < 0 ) )
+                {
+                        return  0;
+                }
+
+                //Segments intersect, but not in end points
+                else if ( ( ( o1 > 0 ) && ( o2 < 0 ) || ( o1 < 0 ) && ( o2 > 0 ) ) && ( ( o3 > 0 ) && ( o4 < 0 ) || ( o3 < 0 ) && ( o4 > 0 ) ) )
+                {
+                        intersection_code =  1;
+                }
         }
 
         //Compute intersection
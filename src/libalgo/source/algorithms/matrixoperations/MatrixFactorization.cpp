@@ -0,0 +1 @@
+#include "MatrixFactorization.h"
\ No newline at end of file
@@ -0,0 +1,131 @@
+// Description: Reusable LU, QR and Cholesky factorizations with rank-1 updates
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef MatrixFactorization_H
+#define MatrixFactorization_H
+
+#include "libalgo/source/structures/matrix/Matrix.h"
+#include "libalgo/source/structures/matrix/TriangularMatrix.h"
+#include "libalgo/source/structures/matrix/SymmetricMatrix.h"
+
+#include "libalgo/source/algorithms/matrixoperations/MatrixOperations.h"
+
+
+//Factorizations are computed once and applied to many right-hand sides stored as columns of B
+//Slightly changed systems A + u * v' are handled by rank-1 modifications of the factors in O(n^2) instead of O(n^3)
+
+
+//LU decomposition P * A = L * U with partial pivoting
+template <typename T>
+class LUFactorization
+{
+	private:
+		Matrix <T> A;				//Factorized matrix, refactorized when the rank-1 update is unstable
+		Matrix <T> LU;				//L (unit diagonal is not stored) and U
+		Matrix <unsigned int> PR;		//Row i of L * U corresponds to the row PR(0, i) of A
+
+	public:
+		LUFactorization(const Matrix <T> &A_) : A(A_), LU(A_), PR(1, A_.rows()) {factorize();}
+
+	public:
+		unsigned int size() const {return LU.rows();}
+		const Matrix <T> & getLU() const {return LU;}
+		const Matrix <unsigned int> & getPR() const {return PR;}
+
+		//Solve A * X = B
+		Matrix <T> solve(const Matrix <T> &B) const;
+		void solveInPlace(Matrix <T> &B) const;
+
+		T det() const;
+		Matrix <T> inv() const;
+
+		//A = A + u * v', u, v are column vectors
+		void update(const Matrix <T> &u, const Matrix <T> &v);
+
+	private:
+		void factorize();
+};
+
+
+//Householder QR decomposition A = Q * R, A (m, n), m >= n, Q stored in the compact form
+template <typename T>
+class QRFactorization
+{
+	private:
+		Matrix <T> QR;				//R and Householder vectors
+		Matrix <T> tau;				//Coefficients of the Householder reflectors
+
+	public:
+		QRFactorization(const Matrix <T> &A);
+
+	public:
+		unsigned int rows() const {return QR.rows();}
+		unsigned int cols() const {return QR.cols();}
+
+		//Get R (n, n)
+		TriangularMatrix <T> getR() const;
+
+		//C = Q * C or C = Q' * C
+		void multQ(Matrix <T> &C, const bool transposed) const {MatrixOperations::qrMultQ(QR, tau, C, transposed);}
+
+		//Least squares solution min ||A * X - B||
+		Matrix <T> solve(const Matrix <T> &B) const;
+};
+
+
+//Cholesky decomposition A = L * L' of the symmetric positive definite matrix
+template <typename T>
+class CholeskyFactorization
+{
+	private:
+		TriangularMatrix <T> L;			//Lower triangular factor
+
+	public:
+		CholeskyFactorization(const unsigned int n) : L(n, LowerTriangular) {}
+		CholeskyFactorization(const SymmetricMatrix <T> &A);
+		CholeskyFactorization(const TriangularMatrix <T> &F);
+
+	public:
+		unsigned int size() const {return L.rows();}
+		const TriangularMatrix <T> & getL() const {return L;}
+
+		//Factorize A, returns false if A is not positive definite
+		bool factorize(const SymmetricMatrix <T> &A) {return A.chol(L);}
+
+		//Solve A * X = B, L * X = B
+		Matrix <T> solve(const Matrix <T> &B) const;
+		void solveInPlace(Matrix <T> &B) const {L.solve(B); L.solveTrans(B);}
+		void solveLInPlace(Matrix <T> &B) const {L.solve(B);}
+
+		//A = A + x * x'
+		void update(const Matrix <T> &x);
+
+		//A = A - x * x', returns false and keeps the factor if the result is not positive definite
+		bool downdate(const Matrix <T> &x);
+
+		//A = A + alpha * x * x'
+		bool rankUpdate(const Matrix <T> &x, const T alpha);
+};
+
+#include "MatrixFactorization.hpp"
+
+#endif
@@ -0,0 +1,391 @@
+// Description: Reusable LU, QR and Cholesky factorizations with rank-1 updates
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef MatrixFactorization_HPP
+#define MatrixFactorization_HPP
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+#include "libalgo/source/exceptions/ErrorMathMatrixDifferentSize.h"
+#include "libalgo/source/exceptions/ErrorMathMatrixNotPositiveDefinite.h"
+
+
+template <typename T>
+void LUFactorization <T> ::factorize()
+{
+	//Compute LU decomposition of A
+	LU = A;
+	MatrixOperations::luInPlace(LU, PR);
+}
+
+
+template <typename T>
+Matrix <T> LUFactorization <T> ::solve(const Matrix <T> &B) const
+{
+	Matrix <T> X(B);
+	solveInPlace(X);
+
+	return X;
+}
+
+
+template <typename T>
+void LUFactorization <T> ::solveInPlace(Matrix <T> &B) const
+{
+	const unsigned int n = LU.rows(), p = B.cols();
+
+	//Matrix dimemension invalid, throw exception
+	if (B.rows() != n)
+	{
+		throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " different rows count. Cannot solve A * X = B. ", LU, B);
+	}
+
+	//Permute rows of B
+	Matrix <T> Y(n, p);
+	const T * lu = LU.data(), * b = B.data();
+	T * y = Y.data();
+
+	for (unsigned int i = 0; i < n; i++)
+		std::copy(b + PR(0, i) * p, b + PR(0, i) * p + p, y + i * p);
+
+	//Forward substitution L * Z = P * B, all right-hand sides at once
+	for (unsigned int i = 1; i < n; i++)
+	{
+		T * yi = y + i * p;
+
+		for (unsigned int k = 0; k < i; k++)
+		{
+			const T lik = lu[i * n + k];
+			const T * yk = y + k * p;
+
+			for (unsigned int l = 0; l < p; l++)
+				yi[l] -= lik * yk[l];
+		}
+	}
+
+	//Backward substitution U * X = Z
+	for (int i = n - 1; i >= 0; i--)
+	{
+		T * yi = y + i * p;
+
+		for (unsigned int k = i + 1; k < n; k++)
+		{
+			const T uik = lu[i * n + k];
+			const T * yk = y + k * p;
+
+			for (unsigned int l = 0; l < p; l++)
+				yi[l] -= uik * yk[l];
+		}
+
+		const T uii = 1.0 / lu[i * n + i];
+
+		for (unsigned int l = 0; l < p; l++)
+			yi[l] *= uii;
+	}
+
+	B.swap(Y);
+}
+
+
+template <typename T>
+T LUFactorization <T> ::det() const
+{
+	//Product of the diagonal items of U
+	const unsigned int n = LU.rows();
+	T d = 1;
+
+	for (unsigned int i = 0; i < n; i++)
+		d *= LU(i, i);
+
+	//Sign of the permutation: count cycles
+	std::vector <bool> visited(n, false);
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		if (visited[i])
+			continue;
+
+		unsigned int j = i, length = 0;
+
+		while (!visited[j])
+		{
+			visited[j] = true;
+			j = PR(0, j);
+			length++;
+		}
+
+		//Cycle of even length changes the sign
+		if (length % 2 == 0)
+			d = -d;
+	}
+
+	return d;
+}
+
+
+template <typename T>
+Matrix <T> LUFactorization <T> ::inv() const
+{
+	//Solve A * X = I
+	Matrix <T> X(LU.rows(), LU.rows(), 0.0, 1.0);
+	solveInPlace(X);
+
+	return X;
+}
+
+
+template <typename T>
+void LUFactorization <T> ::update(const Matrix <T> &u, const Matrix <T> &v)
+{
+	const unsigned int n = LU.rows();
+
+	//Matrix dimemension invalid, throw exception
+	if ((u.rows() != n) || (v.rows() != n) || (u.cols() != 1) || (v.cols() != 1))
+	{
+		throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " u, v must be column vectors (n, 1). Cannot compute A + u * v'. ", u, v);
+	}
+
+	//Actualize A
+	T * a = A.data();
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		for (unsigned int j = 0; j < n; j++)
+			a[i * n + j] += u(i, 0) * v(j, 0);
+	}
+
+	//Bennett algorithm: L * U + x * y', x = P * u
+	std::vector <T> x(n), y(n);
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		x[i] = u(PR(0, i), 0);
+		y[i] = v(i, 0);
+	}
+
+	T * lu = LU.data();
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		const T uii = lu[i * n + i], d = x[i] * y[i];
+		lu[i * n + i] += d;
+
+		//Small pivot without pivoting: compute the decomposition again
+		if (fabs(lu[i * n + i]) <= 1.0e-8 * (fabs(uii) + fabs(d)))
+		{
+			factorize();
+			return;
+		}
+
+		y[i] /= lu[i * n + i];
+
+		//Actualize column i of L
+		for (unsigned int j = i + 1; j < n; j++)
+		{
+			x[j] -= x[i] * lu[j * n + i];
+			lu[j * n + i] += y[i] * x[j];
+		}
+
+		//Actualize row i of U
+		for (unsigned int j = i + 1; j < n; j++)
+		{
+			lu[i * n + j] += x[i] * y[j];
+			y[j] -= y[i] * lu[i * n + j];
+		}
+	}
+}
+
+
+template <typename T>
+QRFactorization <T> ::QRFactorization(const Matrix <T> &A) : QR(A), tau(1, 1)
+{
+	//Bad dimensions of A
+	if (A.rows() < A.cols())
+	{
+		throw ErrorBadData("ErrorBadData: invalid dimension of the matrix A, m < n.", "Can not compute QR decomposition.");
+	}
+
+	MatrixOperations::qrWY(QR, tau);
+}
+
+
+template <typename T>
+TriangularMatrix <T> QRFactorization <T> ::getR() const
+{
+	//Copy the upper triangle
+	const unsigned int n = QR.cols();
+	TriangularMatrix <T> R(n, UpperTriangular);
+
+	for (unsigned int i = 0; i < n; i++)
+	{
+		for (unsigned int j = i; j < n; j++)
+			R(i, j) = QR(i, j);
+	}
+
+	return R;
+}
+
+
+template <typename T>
+Matrix <T> QRFactorization <T> ::solve(const Matrix <T> &B) const
+{
+	const unsigned int n = QR.cols(), p = B.cols();
+
+	//Q' * B
+	Matrix <T> C(B);
+	MatrixOperations::qrMultQ(QR, tau, C, true);
+
+	//Solve R * X = (Q' * B)(0 : n - 1, :)
+	Matrix <T> X(n, p);
+	std::copy(C.data(), C.data() + n * p, X.data());
+	getR().solve(X);
+
+	return X;
+}
+
+
+template <typename T>
+CholeskyFactorization <T> ::CholeskyFactorization(const SymmetricMatrix <T> &A) : L(A.rows(), LowerTriangular)
+{
+	//Matrix is not positive definite
+	if (!A.chol(L))
+	{
+		throw ErrorMathMatrixNotPositiveDefinite <Matrix <T> >("ErrorMathMatrixNotPositiveDefinite: ", " can not compute Cholesky decomposition:  ", A.full());
+	}
+}
+
+
+template <typename T>
+CholeskyFactorization <T> ::CholeskyFactorization(const TriangularMatrix <T> &F) : L(F.getType() == LowerTriangular ? F : F.trans())
+{
+	//Use the existing factor: A = F * F' (lower) or A = F' * F (upper)
+}
+
+
+template <typename T>
+Matrix <T> CholeskyFactorization <T> ::solve(const Matrix <T> &B) const
+{
+	Matrix <T> X(B);
+	solveInPlace(X);
+
+	return X;
+}
+
+
+template <typename T>
+void CholeskyFactorization <T> ::update(const Matrix <T> &x)
+{
+	const unsigned int n = L.rows();
+
+	//Matrix dimemension invalid, throw exception
+	if ((x.rows() != n) || (x.cols() != 1))
+	{
+		throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " x must be column vector (n, 1). Cannot compute A + x * x'. ", L.full(), x);
+	}
+
+	//Givens rotations of the columns of L, LINPACK dchud
+	std::vector <T> w(x.data(), x.data() + n);
+	T * l = L.data();
+
+	for (unsigned int k = 0; k < n; k++)
+	{
+		T & lkk = l[k * (k + 1) / 2 + k];
+		const T r = sqrt(lkk * lkk + w[k] * w[k]);
+		const T c = r / lkk, s = w[k] / lkk;
+		lkk = r;
+
+		for (unsigned int i = k + 1; i < n; i++)
+		{
+			T & lik = l[i * (i + 1) / 2 + k];
+			lik = (lik + s * w[i]) / c;
+			w[i] = c * w[i] - s * lik;
+		}
+	}
+}
+
+
+template <typename T>
+bool CholeskyFactorization <T> ::downdate(const Matrix <T> &x)
+{
+	const unsigned int n = L.rows();
+
+	//Matrix dimemension invalid, throw exception
+	if ((x.rows() != n) || (x.cols() != 1))
+	{
+		throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " x must be column vector (n, 1). Cannot compute A - x * x'. ", L.full(), x);
+	}
+
+	//Hyperbolic rotations of the columns of the copy of L, LINPACK dchdd
+	TriangularMatrix <T> LD(L);
+	std::vector <T> w(x.data(), x.data() + n);
+	T * l = LD.data();
+
+	for (unsigned int k = 0; k < n; k++)
+	{
+		T & lkk = l[k * (k + 1) / 2 + k];
+		const T r2 = (lkk - w[k]) * (lkk + w[k]);
+
+		//A - x * x' is not positive definite
+		if (r2 <= 0)
+			return false;
+
+		const T r = sqrt(r2);
+		const T c = r / lkk, s = w[k] / lkk;
+		lkk = r;
+
+		for (unsigned int i = k + 1; i < n; i++)
+		{
+			T & lik = l[i * (i + 1) / 2 + k];
+			lik = (lik - s * w[i]) / c;
+			w[i] = c * w[i] - s * lik;
+		}
+	}
+
+	L = LD;
+
+	return true;
+}
+
+
+template <typename T>
+bool CholeskyFactorization <T> ::rankUpdate(const Matrix <T> &x, const T alpha)
+{
+	//A = A + alpha * x * x'
+	if (alpha > 0)
+	{
+		update(x * sqrt(alpha));
+		return true;
+	}
+
+	//A = A - |alpha| * x * x'
+	else if (alpha < 0)
+	{
+		return downdate(x * sqrt(-alpha));
+	}
+
+	return true;
+}
+
+#endif
@@ -55,7 +55,27 @@ namespace MatrixOperations
 	int sign(const T val);
 	
         template <typename T>
-	Matrix <T> trans(Matrix <T> A);
+	Matrix <T> trans(const Matrix <T> &A);
+
+	template <typename T>
+	void trans(const Matrix <T> &A, Matrix <T> &A_trans);
+
+	template <typename T>
+	void transInPlace(Matrix <T> &A);
+
+	template <typename T>
+	void mult(const Matrix <T> &A, const Matrix <T> &B, Matrix <T> &C);
+
+	template <typename T>
+	Matrix <T> tmult(const Matrix <T> &A, const Matrix <T> &B);
+
+	template <typename T>
+	void tmult(const Matrix <T> &A, const Matrix <T> &B, Matrix <T> &C);
+
+	//Lazy expressions evaluated once into the destination: Matrix <T> H = trans ( lazy ( J ) ) * W * J;
+	using ::lazy;
+	using ::trans;
+	using ::eval;
         
 	template <typename T, typename U>
 	bool isequal(const Matrix <T> &A, const Matrix <U> &B);
@@ -73,7 +93,7 @@ namespace MatrixOperations
 	T max(const Matrix <T> &A);
        
         template <typename T>
-	Matrix <T> abs(Matrix <T> A);
+	Matrix <T> abs(const Matrix <T> &A);
         
 	template <typename T>
 	T trace(const Matrix <T> &A);
@@ -124,7 +144,7 @@ namespace MatrixOperations
 	void sortrows(Matrix <T> &A, Matrix <unsigned int> &IX, const int c = -1);
 	
         template <typename T>
-	Matrix <T> gem(Matrix <T> A, Matrix <T> B);
+	Matrix <T> gem(const Matrix <T> &A, const Matrix <T> &B);
         
         template <typename T>
 	void gemF(Matrix <T> &A_triangle, Matrix <T> *B = NULL);
@@ -136,10 +156,13 @@ namespace MatrixOperations
 	void gemB(Matrix <T> &A, const Matrix <T> &B, Matrix <T> &X);
         
         template <typename T>
-	T det(Matrix <T> A);
+	T det(const Matrix <T> &A);
         
         template <typename T>
-	void lu(Matrix <T> A, Matrix <T> &L, Matrix <T> &U, Matrix <T> &P);
+	void lu(const Matrix <T> &A, Matrix <T> &L, Matrix <T> &U, Matrix <T> &P);
+
+        template <typename T>
+	void luInPlace(Matrix <T> &A, Matrix <unsigned int> &PR);
        
         template <typename T>
 	void qr(const Matrix <T> &A, Matrix <T> &Q, Matrix <T> &R);
@@ -151,7 +174,7 @@ namespace MatrixOperations
 	bool posdef(const Matrix <T> &A);
 	
 	template <typename T>
-	Matrix <T> chol(Matrix <T> A, const TCholeskyFactorization f);
+	Matrix <T> chol(const Matrix <T> &A, const TCholeskyFactorization f);
 	
 	template <typename T>
 	void gill(const Matrix <T> &A, Matrix <T> &R, Matrix <T> &E, bool &indefinite, const T max_error = 2.2204e-16);
@@ -160,7 +183,13 @@ namespace MatrixOperations
 	void gill(const Matrix <T> &A, Matrix <T> &L, Matrix <T> &d, Matrix <T> &e, Matrix <T> &v, const T max_error = 2.2204e-16);
 	
         template <typename T>
-	Matrix <T> inv(Matrix <T> A);
+	Matrix <T> inv(const Matrix <T> &A);
+
+        template <typename T>
+	void inv(const Matrix <T> &A, Matrix <T> &A_inv);
+
+        template <typename T>
+	void invInPlace(Matrix <T> &A);
         
         template <typename T>
 	Matrix <T> pinv(const Matrix <T> &A);
@@ -170,6 +199,15 @@ namespace MatrixOperations
        
 	template <typename T>
 	void eig(const Matrix <T> &A, Matrix<T> &V, Matrix<T> &L, const unsigned int max_iter = 1000, const T tolerance = 1.0e-15);
+
+	template <typename T>
+	Matrix <T> eigvals(const Matrix <T> &A, const unsigned int max_iter = 1000, const T tolerance = 1.0e-15);
+
+	template <typename T>
+	void tridiagSym(Matrix <T> &A, Matrix <T> &D, Matrix <T> &E, const bool accumulate);
+
+	template <typename T>
+	void eigTridiag(Matrix <T> &D, Matrix <T> &E, Matrix <T> *Z = NULL, const unsigned int max_iter = 1000, const T tolerance = 1.0e-15);
 	
         template <typename T>
 	Matrix <T> pinvs(const Matrix <T> &A, const T tolerance = MAX_FLOAT_OPER_ERROR);
@@ -200,9 +238,58 @@ namespace MatrixOperations
         
         template <typename T>
 	void updgivens(const T cs, const T sn, Matrix <T> & V1, Matrix <T> &V2);
+
+        template <typename T>
+	T housv(T * x, const unsigned int n, const unsigned int inc);
+
+        template <typename T>
+	void housWY(const Matrix <T> &QR, const Matrix <T> &tau, const unsigned int j0, const unsigned int jb, Matrix <T> &TW);
+
+        template <typename T>
+	void housApplyWY(const Matrix <T> &QR, const unsigned int j0, const unsigned int jb, const Matrix <T> &TW, const bool transposed, T * c, const unsigned int ldc, const unsigned int nc);
+
+        template <typename T>
+	void qrWY(Matrix <T> &A, Matrix <T> &tau, const unsigned int block_size = QR_BLOCK_SIZE);
+
+        template <typename T>
+	void qrMultQ(const Matrix <T> &QR, const Matrix <T> &tau, Matrix <T> &C, const bool transposed, const unsigned int block_size = QR_BLOCK_SIZE);
+
+        template <typename T>
+	void svdJacobi(const Matrix <T> &A, Matrix <T> &U, Matrix <T> &S, Matrix <T> &V, const unsigned int block_size = SVD_JACOBI_BLOCK_SIZE, const unsigned int max_sweeps = SVD_JACOBI_MAX_SWEEPS);
        
+	//Operations over the non-owning views of the matrices (slices are not copied, results are written through)
+	template <typename T>
+	MatrixView <T> trans(const MatrixView <T> &A);
+
+	template <typename T>
+	typename TMatrixViewItem <T>::Type sum(const MatrixView <T> &A);
+
+	template <typename T>
+	typename TMatrixViewItem <T>::Type sum2(const MatrixView <T> &A);
+
+	template <typename T>
+	typename TMatrixViewItem <T>::Type norm(const MatrixView <T> &A);
+
+	template <typename T, typename U>
+	typename TMatrixViewItem <T>::Type dot(const MatrixView <T> &A, const MatrixView <U> &B);
+
+	template <typename T, typename U>
+	void mult(const MatrixView <T> &A, const MatrixView <U> &B, const MatrixView <typename TMatrixViewItem <T>::Type> &C);
+
+	template <typename T>
+	void updgivens(const T cs, const T sn, const MatrixView <T> &V1, const MatrixView <T> &V2);
+
+	template <typename T>
+	void qr0Shift(const MatrixView <T> &D, const MatrixView <T> &E, const MatrixView <T> &U, const MatrixView <T> &V);
+
         template <typename T>
 	Matrix <T> load(const char *file, const bool print_exception = true, std::ostream * output = &std::cout);
+
+        template <typename T>
+	Matrix <T> loadBinary(const char *file, const bool print_exception = true, std::ostream * output = &std::cout);
+
+        template <typename T>
+	void saveBinary(const char *file, const Matrix <T> &A);
        
 };
 
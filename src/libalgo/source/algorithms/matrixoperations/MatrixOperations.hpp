@@ -23,12 +23,18 @@
 #define MatrixOperations_HPP
 
 #include <cmath>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <limits>
 
 #include "libalgo/source/structures/matrix/Matrix.h"
+#include "libalgo/source/structures/matrix/SymmetricMatrix.h"
 
 #include "libalgo/source/comparators/indexComp.h"
 
 #include "libalgo/source/io/File.h"
+#include "libalgo/source/io/MatrixFile.h"
 
 #include "libalgo/source/exceptions/ErrorMathOverflow.h"
 #include "libalgo/source/exceptions/ErrorMathMatrixDifferentSize.h"
@@ -66,22 +72,201 @@ namespace MatrixOperations
 
 	//Transpose matrix
 	template <typename T>
-	Matrix <T> trans(Matrix <T> A)
+	Matrix <T> trans(const Matrix <T> &A)
 	{
 		//Create trans matrix
+		Matrix <T> A_trans(A.cols(), A.rows());
+
+		trans(A, A_trans);
+
+		return A_trans;
+	}
+
+
+	//Transpose matrix into the existing matrix (no allocation)
+	template <typename T>
+	void trans(const Matrix <T> &A, Matrix <T> &A_trans)
+	{
 		const unsigned int m = A.rows(), n = A.cols();
-		Matrix <T> A_trans(n, m);
 
-		//Copy m to m_trans
-		for (unsigned int i = 0; i < m; i++)
+		//Invalid dimension of the transposed matrix
+		if ((A_trans.rows() != n) || (A_trans.cols() != m))
 		{
-			for (unsigned int j = 0; j < n; j++)
+			throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " invalid dimension of the output matrix. Cannot compute A'. ", A, A_trans);
+		}
+
+		//Same square matrix
+		if (&A == &A_trans)
+		{
+			transInPlace(A_trans);
+
+			return;
+		}
+
+		//Copy square blocks of A to A_trans: rows of both matrices stay in the cache
+		const T * a = A.data();
+		T * at = A_trans.data();
+
+		for (unsigned int ib = 0; ib < m; ib += MATRIX_TRANS_BLOCK)
+		{
+			const unsigned int ie = std::min(ib + MATRIX_TRANS_BLOCK, m);
+
+			for (unsigned int jb = 0; jb < n; jb += MATRIX_TRANS_BLOCK)
 			{
-				A_trans(j, i) = A(i, j);
+				const unsigned int je = std::min(jb + MATRIX_TRANS_BLOCK, n);
+
+				for (unsigned int i = ib; i < ie; i++)
+				{
+					for (unsigned int j = jb; j < je; j++)
+					{
+						at[j * m + i] = a[i * n + j];
+					}
+				}
 			}
 		}
+	}
 
-		return A_trans;
+
+	//Transpose matrix in place
+	template <typename T>
+	void transInPlace(Matrix <T> &A)
+	{
+		const unsigned int m = A.rows(), n = A.cols();
+		T * a = A.data();
+
+		//Square matrix: swap items symmetric to the main diagonal
+		if (m == n)
+		{
+			for (unsigned int i = 0; i < m; i++)
+			{
+				for (unsigned int j = i + 1; j < n; j++)
+				{
+					std::swap(a[i * n + j], a[j * n + i]);
+				}
+			}
+		}
+
+		//Rectangular matrix: follow cycles of the permutation, item at the index k moves to k * m mod (m * n - 1)
+		else if ((m > 1) && (n > 1))
+		{
+			const std::size_t mn1 = (std::size_t) m * n - 1;
+			std::vector <bool> moved(mn1 + 1, false);
+
+			for (std::size_t start = 1; start < mn1; start++)
+			{
+				//Item has already been moved within another cycle
+				if (moved[start])
+				{
+					continue;
+				}
+
+				//Move items along the cycle
+				T item = a[start];
+				std::size_t k = start;
+
+				do
+				{
+					k = k * m % mn1;
+					std::swap(a[k], item);
+					moved[k] = true;
+				} while (k != start);
+			}
+		}
+
+		//Set new dimensions
+		A.reshape(n, m);
+	}
+
+
+	//Multiply matrices into the existing matrix (no allocation): C = A * B
+	template <typename T>
+	void mult(const Matrix <T> &A, const Matrix <T> &B, Matrix <T> &C)
+	{
+		const unsigned int m1 = A.rows(), n1 = A.cols(), n2 = B.cols();
+
+		//Different rows count
+		if (n1 != B.rows())
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " different rows count. Cannot compute A * B. ", A, B);
+		}
+
+		//Invalid dimension of the output matrix
+		if ((C.rows() != m1) || (C.cols() != n2))
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " invalid dimension of the output matrix. Cannot compute A * B. ", A, C);
+		}
+
+		//Output matrix is one of the arguments
+		if ((&C == &A) || (&C == &B))
+		{
+			throw ErrorBadData("ErrorBadData: output matrix is one of the arguments. ", "Cannot compute A * B.");
+		}
+
+		//Reset the output matrix, kernels accumulate into C
+		std::fill(C.data(), C.data() + m1 * n2, T(0));
+
+		MatrixKernels::mult(m1, n2, n1, A.data(), n1, B.data(), n2, C.data(), n2);
+	}
+
+
+	//Multiply transposed matrix A' * B without creating A'
+	//Kernel is selected according to the shape: A' * A (normal matrix), A' * v, A' * B
+	template <typename T>
+	Matrix <T> tmult(const Matrix <T> &A, const Matrix <T> &B)
+	{
+		//Create matrix for results
+		Matrix <T> C(A.cols(), B.cols());
+
+		tmult(A, B, C);
+
+		return C;
+	}
+
+
+	//Multiply transposed matrix A' * B into the existing matrix (no allocation)
+	template <typename T>
+	void tmult(const Matrix <T> &A, const Matrix <T> &B, Matrix <T> &C)
+	{
+		const unsigned int m1 = A.rows(), n1 = A.cols(), m2 = B.rows(), n2 = B.cols();
+
+		//Different rows count
+		if (m1 != m2)
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " different rows count. Cannot compute A' * B. ", A, B);
+		}
+
+		//Invalid dimension of the output matrix
+		if ((C.rows() != n1) || (C.cols() != n2))
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " invalid dimension of the output matrix. Cannot compute A' * B. ", A, C);
+		}
+
+		//Output matrix is one of the arguments
+		if ((&C == &A) || (&C == &B))
+		{
+			throw ErrorBadData("ErrorBadData: output matrix is one of the arguments. ", "Cannot compute A' * B.");
+		}
+
+		//Reset the output matrix, kernels accumulate into C
+		std::fill(C.data(), C.data() + n1 * n2, T(0));
+
+		//A' * A: symmetric result, compute the upper triangle only
+		if (&A == &B)
+		{
+			MatrixKernels::syrkTN(n1, m1, A.data(), n1, C.data(), n2);
+		}
+
+		//A' * v
+		else if (n2 == 1)
+		{
+			MatrixKernels::gemvTN(n1, m1, A.data(), n1, B.data(), 1, C.data());
+		}
+
+		//A' * B
+		else
+		{
+			MatrixKernels::gemmTN(n1, n2, m1, A.data(), n1, B.data(), n2, C.data(), n2);
+		}
 	}
 
 
@@ -184,19 +369,19 @@ namespace MatrixOperations
 
 	//Abolute value of a matrix
 	template <typename T>
-	Matrix <T> abs(Matrix <T> A)
+	Matrix <T> abs(const Matrix <T> &A)
 	{
-		//Create trans matrix
+		//Create matrix of absolute values
 		const unsigned int m = A.rows(), n = A.cols();
 		Matrix <T> A_a(m, n);
 
-		//Copy m to m_trans
-		for (unsigned int i = 0; i < m; i++)
+		//Process items in the row-major order
+		const T * a = A.data();
+		T * aa = A_a.data();
+
+		for (unsigned int i = 0; i < m * n; i++)
 		{
-			for (unsigned int j = 0; j < n; j++)
-			{
-				A_a(i, j) = std::fabs(A(i, j));
-			}
+			aa[i] = std::fabs(a[i]);
 		}
 
 		return A_a;
@@ -578,11 +763,10 @@ namespace MatrixOperations
 
 
 	//Compute tridiagonal matrix using the Householder rotations
-	//Works for positive deinite matrices
+	//Works for symmetric matrices
 	template <typename T>
 	Matrix <T> tridiagh(Matrix <T> A)
 	{
-		//Slightly modified algorithm by Matt Fig, 2008
 		const unsigned int m = A.rows(), n = A.cols();
 
 		//Rectangular matrix
@@ -597,38 +781,25 @@ namespace MatrixOperations
 			throw ErrorBadData("ErrorBadData: Matrix A is not symmetric. ", "Can not compute tridiagonal matrix.");
 		}
 
-		//Auxilliary matrices
-		Matrix <T> V(m, 1);
-		Matrix <T> I(m, m, 0, 1);
-
-		//Perform tridiagonalization
-		for (unsigned int i = 0; i < m - 2; i++)
-		{
-			//Reset elements till the procesed index
-			for (unsigned int j = 0; j <= i; j++)
-				V(j, 0) = 0;
-
-			//Compute sum
-			const T sumA2 = sqrt(norm(trans(A(i + 1, m - 1, i, i)) * A(i + 1, m - 1, i, i)));
-
-			//Perform Householder rotations
-			V(i + 1, 0) = sqrt(.5 * (1 + fabs(A(i + 1, i)) / (sumA2 + 2 * MIN_FLOAT)));
+		//Reduce A to the tridiagonal form, O(4/3 n^3)
+		Matrix <T> D(m, 1), E(m, 1);
+		tridiagSym(A, D, E, false);
 
-			//Create temporary matrix
-			const Matrix <T> VT = A(i + 2, m - 1, i, i) * sign(A(i + 1, i)) / (2 * V(i + 1, 0) * sumA2 + 2 * MIN_FLOAT);
-
-			//Update V 
-			V.submat(VT, i + 2, 0);
+		//Create tridiagonal matrix
+		Matrix <T> TR(m, n);
 
-			//Compute rotation
-			const Matrix <T> P = I - V * trans(V) * (2);
+		for (unsigned int i = 0; i < m; i++)
+		{
+			TR(i, i) = D(i, 0);
 
-			//Upsate matrix
-			Matrix <T> AN = P * A * P;
-			A = AN;
+			if (i > 0)
+			{
+				TR(i, i - 1) = E(i, 0);
+				TR(i - 1, i) = E(i, 0);
+			}
 		}
 
-		return A;
+		return TR;
 	}
 
 
@@ -668,12 +839,8 @@ namespace MatrixOperations
 			//Get a column of a matrix
 			Matrix <T> col = trans(A(0, m1 - 1, i1, i1));
 
-			//Convert to 2D std::vector
-			typename TMatrix <T>::Type col2D = col.getItems();
-
 			//Convert to 1D vector
-			typename TVector <T>::Type  col1D;
-			col1D.insert(col1D.end(), col2D[0].begin(), col2D[0].end());
+			typename TVector <T>::Type  col1D = col.getItems();
 
 			//Create 1D vector of indices
 			std::vector <unsigned int> ix(m1);
@@ -722,12 +889,8 @@ namespace MatrixOperations
 		//Get a column of a matrix
 		Matrix <T> col = trans(A(0, m1 - 1, c, c));
 
-		//Convert to 2D std::vector
-		typename TMatrix <T>::Type col2D = col.getItems();
-
 		//Convert to 1D vector
-		typename TVector <T>::Type  col1D;
-		col1D.insert(col1D.end(), col2D[0].begin(), col2D[0].end());
+		typename TVector <T>::Type  col1D = col.getItems();
 
 		//Create 1D vector of indices
 		std::vector <unsigned int> ix(m1);
@@ -755,7 +918,7 @@ namespace MatrixOperations
 
 	//Gaussian elimination algorithm
 	template <typename T>
-	Matrix <T> gem(Matrix <T> A, Matrix <T> B)
+	Matrix <T> gem(const Matrix <T> &A, const Matrix <T> &B)
 	{
 		const unsigned int m1 = A.rows(), n1 = A.cols();
 		const unsigned int m2 = B.rows(), n2 = B.cols();
@@ -769,18 +932,18 @@ namespace MatrixOperations
 		//Rectangle matrix
 		if (m1 != n1)
 		{
-			throw ErrorMathMatrixNotSquare <Matrix <T> >("ErrorMathMatrixNotSquare: ", " invalid dimension of the matrix (rectangle matrix), can not perform GEM; (rows_count, columns_count):  ", A, B);
+			throw ErrorMathMatrixNotSquare <Matrix <T> >("ErrorMathMatrixNotSquare: ", " invalid dimension of the matrix (rectangle matrix), can not perform GEM; (rows_count, columns_count):  ", A);
 		}
 
 		//Create matrix X
 		Matrix <T> X(m1, 1);
 
-		//Forward step of the Gauss elimination: convert A to triangle matrix
-		Matrix <T> A_triangle(A);
-		gemF(A_triangle, &B);
+		//Forward step of the Gauss elimination: convert A to triangle matrix, rows of B are permuted
+		Matrix <T> A_triangle(A), B_perm(B);
+		gemF(A_triangle, &B_perm);
 
 		//Backward step of the Gaussian elimination: compute A * x = B
-		gemB(A_triangle, B, X);
+		gemB(A_triangle, B_perm, X);
 
 		//Return solution
 		return X;
@@ -914,7 +1077,7 @@ namespace MatrixOperations
 
 	//Determinant of the matrix
 	template <typename T>
-	T det(Matrix <T> A)
+	T det(const Matrix <T> &A)
 	{
 		const unsigned int m = A.rows(), n = A.cols();
 
@@ -945,7 +1108,7 @@ namespace MatrixOperations
 
 	//LU decomposition of the matrix
 	template <typename T>
-	void lu(Matrix <T> A, Matrix <T> &L, Matrix <T> &U, Matrix <T> &P)
+	void lu(const Matrix <T> &A, Matrix <T> &L, Matrix <T> &U, Matrix <T> &P)
 	{
 		//LU decomposition of A, L = lower triangular matrix, U = upper triangular matrix, P = permutation matrix
 		const unsigned int m = A.rows(), n = A.cols();
@@ -959,26 +1122,61 @@ namespace MatrixOperations
 		//Create row permutation vector
 		Matrix <unsigned int> PR(1, n);
 
-		//Create scale vector
-		Matrix <T> S(1, n);
+		//Compute LU decomposition stored in U
+		U = A;
+		luInPlace(U, PR);
 
-		//Set diagonal items of L to 1, otherwise to 0
-		//Set items of the row permutation matrix to <0; n-1>
-		for (unsigned int i = 0; i < m; i++)
+		//Process L matrix together with U matrix
+		for (unsigned int i = 0; i < n; i++)
 		{
-			L(i, i) = 1.0;
-			PR(0, i) = i;
-
-			for (unsigned int j = 0; j < m; j++)
+			for (unsigned int j = 0; j < n; j++)
 			{
-				if (j != i)  L(i, j) = 0;
+				//Items bellow the diagonal belong to L
+				if (j < i)
+				{
+					L(i, j) = U(i, j);
+					U(i, j) = 0.0;
+				}
+
+				//Diagonal items of L are 1, otherwise 0
+				else
+				{
+					L(i, j) = (i == j);
+				}
 
 				P(i, j) = 0;
 			}
+
+			//Actualize permutation matrix from the row permutation matrix
+			P(i, PR(0, i)) = 1.0;
 		}
+	}
 
-		//Initialize U = A
-		U = A;
+
+	//LU decomposition of the matrix in place: A = L * U (unit diagonal of L is not stored), PR = row permutations
+	//Row i of L * U corresponds to the row PR(0, i) of the input matrix
+	template <typename T>
+	void luInPlace(Matrix <T> &A, Matrix <unsigned int> &PR)
+	{
+		const unsigned int m = A.rows(), n = A.cols();
+
+		//Is A rectangular matrix ?
+		if (m != n)
+		{
+			throw ErrorMathMatrixNotSquare <Matrix <T> >("ErrorMathMatrixNotSquare: ", " invalid dimension of the matrix (rectangle matrix), can not perform LU decomposition; (rows_count, columns_count):  ", A);
+		}
+
+		//Set items of the row permutation matrix to <0; n-1>
+		PR.res(1, n);
+
+		for (unsigned int i = 0; i < n; i++)
+		{
+			PR(0, i) = i;
+		}
+
+		//Create scale vector
+		std::vector <T> S(n, 0);
+		T * a = A.data();
 
 		//Find max item in each row to compute the scale vector
 		for (unsigned int i = 0; i < n; i++)
@@ -987,13 +1185,13 @@ namespace MatrixOperations
 
 			for (unsigned int j = 0; j < n; j++)
 			{
-				if (fabs(U(i, j)) > max_val)
-					max_val = fabs(U(i, j));
+				if (fabs(a[i * n + j]) > max_val)
+					max_val = fabs(a[i * n + j]);
 			}
 
 			//Actualize scale vector
 			if (max_val > MIN_FLOAT)
-				S(0, i) = 1.0 / max_val;
+				S[i] = 1.0 / max_val;
 		}
 
 		//Start LU decomposition
@@ -1001,12 +1199,12 @@ namespace MatrixOperations
 		{
 			for (unsigned int i = 0; i < j; i++)
 			{
-				T sum = U(i, j);
+				T sum = a[i * n + j];
 
 				//Compute new U ( i, j ) item: multiply ith row and j-th column
-				for (unsigned int k = 0; k < i; k++) sum -= U(i, k) * U(k, j);
+				for (unsigned int k = 0; k < i; k++) sum -= a[i * n + k] * a[k * n + j];
 
-				U(i, j) = sum;
+				a[i * n + j] = sum;
 			}
 
 			//Initialize max_val and pivot index
@@ -1016,16 +1214,16 @@ namespace MatrixOperations
 			//Find row that will be swapped and actualize row index
 			for (unsigned int i = j; i < n; i++)
 			{
-				T sum = U(i, j);
+				T sum = a[i * n + j];
 
 				//Compute new U ( i, j ) item: multiply ith row and j-th column
-				for (unsigned int k = 0; k < j; k++) sum -= U(i, k) * U(k, j);
+				for (unsigned int k = 0; k < j; k++) sum -= a[i * n + k] * a[k * n + j];
 
 				//Compute new U (i, j)
-				U(i, j) = sum;
+				a[i * n + j] = sum;
 
 				//Compute index of the pivot
-				const T val = S(0, i) * fabs(sum);
+				const T val = S[i] * fabs(sum);
 
 				if (val >= max_val)
 				{
@@ -1034,13 +1232,11 @@ namespace MatrixOperations
 				}
 			}
 
-			//Perform row swaps in U,PR: j <-> i_pivot
+			//Perform row swaps in A, PR: j <-> i_pivot
 			if ((j != i_pivot) && (i_pivot < n))
 			{
-				//Perform swap in U matrix
-				const Matrix <T> U_temp = U(i_pivot, i_pivot, 0, n - 1);
-				U.submat(U(j, j, 0, n - 1), i_pivot, 0);
-				U.submat(U_temp, j, 0);
+				//Swap rows of A in place
+				std::swap_ranges(a + i_pivot * n, a + i_pivot * n + n, a + j * n);
 
 				//Perform swap in the row permutation matrix
 				const unsigned int perm_temp = PR(0, i_pivot);
@@ -1048,34 +1244,21 @@ namespace MatrixOperations
 				PR(0, j) = perm_temp;
 
 				//Actualize also the scale vector
-				S(0, i_pivot) = S(0, j);
+				S[i_pivot] = S[j];
 			}
 
 			//Change diagonal item U ( j, j ) = 0 to "small" value before the devision
-			if (U(j, j) == 0.0)
-				U(j, j) = MIN_FLOAT;
+			if (a[j * n + j] == 0.0)
+				a[j * n + j] = MIN_FLOAT;
 
 			//Actualize U (i, j) from diagonal items
 			if (j != n - 1)
 			{
-				const T val = 1.0 / U(j, j);
+				const T val = 1.0 / a[j * n + j];
 
 				for (unsigned int i = j + 1; i < n; i++)
-					U(i, j) *= val;
-			}
-		}
-
-		//Process L matrix together with U matrix
-		for (unsigned int i = 0; i < n; i++)
-		{
-			for (unsigned int j = 0; j < i; j++)
-			{
-				L(i, j) = U(i, j);
-				U(i, j) = 0.0;
+					a[i * n + j] *= val;
 			}
-
-			//Actualize permutation matrix from the row permutation matrix
-			P(i, PR(0, i)) = 1.0;
 		}
 	}
 
@@ -1094,8 +1277,11 @@ namespace MatrixOperations
 		//Perform QR decomposition
 		for (int i = 0; i < n; i++)
 		{
+			//Column of Q updated in place
+			const MatrixView <T> qi = Q.view(0, m - 1, i, i);
+
 			//Compute norm
-			T tt, t = norm(Q(0, m - 1, i, i));
+			T tt, t = norm(qi);
 
 			bool orthogonalize = true;
 
@@ -1104,17 +1290,20 @@ namespace MatrixOperations
 			{
 				for (int j = 0; j <= i - 1; j++)
 				{
-					//Compute norm
-					const Matrix <T> S = trans(Q(0, m - 1, j, j)) * Q(0, m - 1, i, i);
+					const MatrixView <T> qj = Q.view(0, m - 1, j, j);
+
+					//Compute projection
+					const T s = dot(qj, qi);
 
 					//Actualize R item
-					R(j, i) = R(j, i) + S(0, 0);
+					R(j, i) = R(j, i) + s;
 
-					Q.submat(Q(0, m - 1, i, i) - Q(0, m - 1, j, j) * S(0, 0), 0, i);
+					for (unsigned int l = 0; l < m; l++)
+						qi(l, 0) -= qj(l, 0) * s;
 				}
 
 				//Compute norm
-				tt = norm(Q(0, m - 1, i, i));
+				tt = norm(qi);
 
 				//Perform reorthogonalization
 				if ((tt > 10.0 * MIN_FLOAT * t) && (tt < t / 10.0))
@@ -1143,7 +1332,7 @@ namespace MatrixOperations
 				tt = 0.0;
 
 			//Update Q matrix
-			Q.submat(Q(0, m - 1, i, i)  * tt, 0, i);
+			qi *= tt;
 		}
 	}
 
@@ -1182,22 +1371,25 @@ namespace MatrixOperations
 
 		//First iteration: R = A, Q = E, P = E
 		R = A;
+		Q = Matrix <T>(m, m, 0.0, 1.0);
+		P = Matrix <unsigned int>(n, n, 0, 1);
 
-		for (unsigned int i = 0; i < m; i++) Q(i, i) = 1.0;
-
-		for (unsigned int i = 0; i < n; i++) P(i, i) = 1.0;
+		T * r = R.data(), * q = Q.data();
 
 		//Compute the norms
 		Matrix <T> col_norms(1, n);
 
-		for (unsigned int i = 0; i < n; i++)
+		for (unsigned int i = 0; i < m; i++)
 		{
-			const Matrix <T> col_norm = trans(R(0, m - 1, i, i)) * R(0, m - 1, i, i);
-			col_norms(0, i) = col_norm(0, 0);
+			for (unsigned int j = 0; j < n; j++)
+				col_norms(0, j) += r[i * n + j] * r[i * n + j];
 		}
 
+		//Householder vector and the projections of the columns
+		std::vector <T> v(m), w(std::max(m, n));
+
 		//Perform QR decomposition with columns pivoting
-		for (unsigned int i = 0; i < n - 1; i++)
+		for (unsigned int i = 0; i < std::min(n, m - 1); i++)
 		{
 			//Find max column norm
 			T max_col_norm = col_norms(0, i);
@@ -1220,34 +1412,74 @@ namespace MatrixOperations
 			//Performs pivoting
 			if (permut_index != i)
 			{
-				//Swap permutaion matrix
-				const Matrix <unsigned int> TMP = P(0, n - 1, i, i);
-				P.submat(P(0, n - 1, permut_index, permut_index), 0, i);
-				P.submat(TMP, 0, permut_index);
+				//Swap columns of the permutation matrix
+				for (unsigned int j = 0; j < n; j++)
+					std::swap(P(j, i), P(j, permut_index));
 
-				//Swap R matrix
-				const Matrix <T> TMP2 = R(0, m - 1, i, i);
-				R.submat(R(0, m - 1, permut_index, permut_index), 0, i);
-				R.submat(TMP2, 0, permut_index);
+				//Swap columns of R matrix
+				for (unsigned int j = 0; j < m; j++)
+					std::swap(r[j * n + i], r[j * n + permut_index]);
 
 				//Swap column norms matrix
-				const T tmp = col_norms(0, i);
-				col_norms(0, i) = col_norms(0, permut_index);
-				col_norms(0, permut_index) = tmp;
+				std::swap(col_norms(0, i), col_norms(0, permut_index));
 			}
 
-			//Compute Householder vector
-			Matrix <T> H = hous(R(0, m - 1, i, i), i, m - 1);
+			//Compute Householder vector H = I - tau * v * v' from the column i, reflectors are never formed
+			const unsigned int mi = m - i;
+
+			for (unsigned int j = 0; j < mi; j++)
+				v[j] = r[(i + j) * n + i];
+
+			const T tau = housv(&v[0], mi, 1);
+
+			//Set the column i of R
+			r[i * n + i] = v[0];
+			v[0] = 1;
+
+			for (unsigned int j = 1; j < mi; j++)
+				r[(i + j) * n + i] = 0;
+
+			if (tau != 0)
+			{
+				//Apply left Householder transformation to the remaining columns: R = R - tau * v * (v' * R)
+				std::fill(w.begin(), w.begin() + n, T(0));
+
+				for (unsigned int j = 0; j < mi; j++)
+				{
+					const T * rj = r + (i + j) * n;
+
+					for (unsigned int l = i + 1; l < n; l++)
+						w[l] += v[j] * rj[l];
+				}
+
+				for (unsigned int j = 0; j < mi; j++)
+				{
+					T * rj = r + (i + j) * n;
+					const T tv = tau * v[j];
+
+					for (unsigned int l = i + 1; l < n; l++)
+						rj[l] -= tv * w[l];
+				}
+
+				//Apply right Householder transformation: Q = Q - tau * (Q * v) * v'
+				for (unsigned int j = 0; j < m; j++)
+				{
+					T * qj = q + j * m + i;
+					T qv = 0;
+
+					for (unsigned int l = 0; l < mi; l++)
+						qv += qj[l] * v[l];
 
-			//Apply left Householder transformation
-			R = R - H * (trans(H) * R);
+					qv *= tau;
 
-			//Apply right Householder transformation
-			Q = Q - (Q * H) * trans(H);
+					for (unsigned int l = 0; l < mi; l++)
+						qj[l] -= qv * v[l];
+				}
+			}
 
-			//Norm downdate using Hadamard product
-			const Matrix <T> col_norm = R(i, i, i + 1, n - 1) % R(i, i, i + 1, n - 1);
-			col_norms.submat(col_norms(0, 0, i + 1, n - 1) - col_norm, 0, i + 1);
+			//Norm downdate
+			for (unsigned int j = i + 1; j < n; j++)
+				col_norms(0, j) -= r[i * n + j] * r[i * n + j];
 		}
 	}
 
@@ -1264,15 +1496,52 @@ namespace MatrixOperations
 			throw ErrorMathMatrixNotSquare <Matrix <T> >("ErrorMathMatrixNotSquare: ", " invalid dimension of the matrix (rectangle matrix), can not compute inverse matrix; (rows_count, columns_count):  ", A);
 		}
 
-		//Test of the submatrix
-		for (unsigned int i = 0; i < m; i++)
+		//Symmetric matrix: packed Cholesky decomposition succeeds
+		const T * a = A.data();
+		bool symmetric = true;
+
+		for (unsigned int i = 1; (i < m) && symmetric; i++)
+		{
+			for (unsigned int j = 0; j < i; j++)
+			{
+				if (a[i * n + j] != a[j * n + i])
+				{
+					symmetric = false;
+					break;
+				}
+			}
+		}
+
+		if (symmetric)
+		{
+			TriangularMatrix <T> L(m);
+			return SymmetricMatrix <T>(A).chol(L);
+		}
+
+		//Non-symmetric matrix: all leading principal minors are positive, so all pivots of the elimination without pivoting are positive
+		//Pivot k = det(A(0, k, 0, k)) / det(A(0, k - 1, 0, k - 1)), O(n^3) instead of the determinant of each submatrix
+		Matrix <T> U = A;
+		T * u = U.data();
+
+		for (unsigned int k = 0; k < m; k++)
 		{
-			//Create submatrix
-			Matrix <T> AS = A(0, i, 0, i);
+			const T pivot = u[k * n + k];
 
-			//Test determinant
-			if (det(AS) <= 0)
+			if (pivot <= 0)
 				return false;
+
+			for (unsigned int i = k + 1; i < m; i++)
+			{
+				const T f = u[i * n + k] / pivot;
+
+				if (f == 0)
+					continue;
+
+				for (unsigned int j = k + 1; j < n; j++)
+				{
+					u[i * n + j] -= f * u[k * n + j];
+				}
+			}
 		}
 
 		return true;
@@ -1282,7 +1551,7 @@ namespace MatrixOperations
 	//Perform Cholesky decomposition of the matrix
 	//Use chol (A, 'upper') or chol (A,'lower')
 	template <typename T>
-	Matrix <T> chol(Matrix <T> A, const TCholeskyFactorization f)
+	Matrix <T> chol(const Matrix <T> &A, const TCholeskyFactorization f)
 	{
 		//Is matrix positive definite?
 		const bool positive_definite = posdef(A);
@@ -1325,17 +1594,13 @@ namespace MatrixOperations
 			}
 		}
 
-		//Return lower triangular matrix
-		if (f == lower)
+		//Upper triangular matrix: transpose F without the copy
+		if (f == upper)
 		{
-			return F;
+			transInPlace(F);
 		}
 
-		//Return upper triangular matrix
-		else
-		{
-			return trans(F);
-		}
+		return F;
 	}
 
 
@@ -1539,7 +1804,32 @@ namespace MatrixOperations
 
 	//Inverse matrix calculation using LU decomposition
 	template <typename T>
-	Matrix <T> inv(Matrix <T> A)
+	Matrix <T> inv(const Matrix <T> &A)
+	{
+		//Create copy of A, compute the inverse in place
+		Matrix <T> A_inv(A);
+
+		invInPlace(A_inv);
+
+		return A_inv;
+	}
+
+
+	//Inverse matrix calculation into the existing matrix (no allocation of the result)
+	template <typename T>
+	void inv(const Matrix <T> &A, Matrix <T> &A_inv)
+	{
+		//Copy A, dimensions of both matrices are checked
+		A_inv = A;
+
+		invInPlace(A_inv);
+	}
+
+
+	//Inverse matrix calculation in place using LU decomposition
+	//A^-1 = U^-1 * L^-1 * P, U^-1 and L^-1 are computed over the LU factors stored in A
+	template <typename T>
+	void invInPlace(Matrix <T> &A)
 	{
 		const unsigned int m = A.rows(), n = A.cols();
 
@@ -1555,54 +1845,68 @@ namespace MatrixOperations
 		if (max_val > MAX_DOUBLE)
 			throw ErrorMathOverflow <T>("ErrorMathOverflow: bad scaled matrix, can not compute inverse matrix. ", "Max item > MAX_FLOAT.", max_val);
 
-		//Create LU decomposition
-		Matrix <T> L(m, m);
-		Matrix <T> U(m, m);
-		Matrix <T> P(m, m, 0, 1);
-		lu(A, L, U, P);
+		//Create LU decomposition in place
+		Matrix <unsigned int> PR(1, n);
+		luInPlace(A, PR);
 
-		//Compute X = L^-1 (lower triangular matrix)
-		Matrix <T> X(m, m);
+		T * a = A.data();
 
-		for (unsigned int j = 0; j < m; j++)
+		//Compute U^-1 (upper triangular matrix) in place, column by column
+		for (unsigned int j = 0; j < n; j++)
 		{
-			X(j, j) = 1.0;
+			a[j * n + j] = 1 / a[j * n + j];
+			const T ajj = -a[j * n + j];
 
-			for (unsigned int i = j + 1; i < m; i++)
+			//Column j: U^-1(0:j-1, 0:j-1) * U(0:j-1, j) * ajj
+			for (unsigned int i = 0; i < j; i++)
 			{
 				T sum = 0;
 
-				for (unsigned int k = j; k <= i - 1; k++)
+				for (unsigned int k = i; k < j; k++)
 				{
-					sum -= L(i, k) * X(k, j);
+					sum += a[i * n + k] * a[k * n + j];
 				}
 
-				X(i, j) = sum;
+				a[i * n + j] = sum * ajj;
 			}
 		}
 
-		//Compute Y = U^-1 (upper triangular matrix)
-		Matrix <T> Y(m, m);
+		//Solve X * L = U^-1 for X = U^-1 * L^-1, column by column from the last one
+		std::vector <T> work(n);
 
-		for (unsigned int j = 0; j < m; j++)
+		for (int j = n - 2; j >= 0; j--)
 		{
-			Y(j, j) = 1 / U(j, j);
+			//Store column j of L, reset items bellow the diagonal
+			for (unsigned int i = j + 1; i < n; i++)
+			{
+				work[i] = a[i * n + j];
+				a[i * n + j] = 0;
+			}
 
-			for (int i = j - 1; i >= 0; i--)
+			//X(:, j) = X(:, j) - X(:, j+1:n) * L(j+1:n, j)
+			for (unsigned int r = 0; r < n; r++)
 			{
-				T sum = 0.0;
+				T sum = 0;
 
-				for (unsigned int k = i + 1; k <= j; k++)
+				for (unsigned int i = j + 1; i < n; i++)
 				{
-					sum -= U(i, k) * Y(k, j) / U(i, i);
+					sum += a[r * n + i] * work[i];
 				}
 
-				Y(i, j) = sum;
+				a[r * n + j] -= sum;
 			}
 		}
 
-		//Compute inverse matrix A^-1 = U^-1 * L^-1 = X * Y * P
-		return Y * X * P;
+		//Compute A^-1 = X * P: column i of X is moved to the column PR(0, i)
+		for (unsigned int r = 0; r < n; r++)
+		{
+			std::copy(a + r * n, a + r * n + n, work.begin());
+
+			for (unsigned int i = 0; i < n; i++)
+			{
+				a[r * n + PR(0, i)] = work[i];
+			}
+		}
 	}
 
 
@@ -1696,14 +2000,12 @@ namespace MatrixOperations
 	}
 
 
-	//Compute eigevalues L and eigenvectors V of symmetric tridiagonal matrix
-	//Computation based on the QR algorithm with the Wilkinson shift
-	//Eigenvalues and eigenvecors are sorted in the ascending order
+	//Eigenvalues of the symmetric matrix in the ascending order, eigenvectors are not computed
+	//Householder tridiagonalization followed by the implicit QL algorithm, O(4/3 n^3)
 	template <typename T>
-	void eig(const Matrix <T> &A, Matrix<T> &V, Matrix<T> &L, const unsigned int max_iter, const T tolerance)
+	Matrix <T> eigvals(const Matrix <T> &A, const unsigned int max_iter, const T tolerance)
 	{
-		//Modified algorithm by Brian Brodie
-		unsigned int m = A.rows(), n = A.cols();
+		const unsigned int m = A.rows(), n = A.cols();
 
 		//Not rectangular matrix
 		if (m != n)
@@ -1711,7 +2013,382 @@ namespace MatrixOperations
 			throw ErrorMathMatrixNotSquare <Matrix <T> >("ErrorMathMatrixNotSquare: ", " invalid dimension of the matrix (rectangle matrix), can not compute eigenvalues; (rows_count, columns_count):  ", A);
 		}
 
-		/*
+		//Reduce to the tridiagonal form
+		Matrix <T> Q = A, D(n, 1), E(n, 1);
+		tridiagSym(Q, D, E, false);
+
+		//Compute eigenvalues
+		eigTridiag(D, E, (Matrix <T> *) NULL, max_iter, tolerance);
+
+		return D;
+	}
+
+
+	//Reduce the symmetric matrix A to the tridiagonal form T = Q' * A * Q using the Householder reflections
+	//D stores the diagonal, E the subdiagonal of T (E(0) = 0), only the lower triangle of A is referenced
+	//If accumulate = true, A is overwritten by the orthogonal matrix Q, otherwise A is destroyed
+	template <typename T>
+	void tridiagSym(Matrix <T> &A, Matrix <T> &D, Matrix <T> &E, const bool accumulate)
+	{
+		//Algorithm tred2 (Bowdler, Martin, Reinsch, Wilkinson), reduction starts from the last row
+		const unsigned int n = A.rows();
+
+		//Rectangular matrix
+		if (n != A.cols())
+		{
+			throw ErrorMathMatrixNotSquare <Matrix <T> >("ErrorMathMatrixNotSquare: ", " invalid dimension of the matrix (rectangle matrix), can not compute tridiagonal matrix; (rows_count, columns_count):  ", A);
+		}
+
+		//Different size of D, E
+		if ((D.rows() * D.cols() != n) || (E.rows() * E.cols() != n))
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " invalid size of D or E, can not compute tridiagonal matrix:  ", D, E);
+		}
+
+		T * v = A.data(), *d = D.data(), *e = E.data();
+
+		for (unsigned int j = 0; j < n; j++)
+			d[j] = v[(n - 1) * n + j];
+
+		//Householder reduction of the row i
+		for (unsigned int i = n - 1; i > 0; i--)
+		{
+			T scale = 0, h = 0;
+
+			for (unsigned int k = 0; k < i; k++)
+				scale += fabs(d[k]);
+
+			//Row is already reduced
+			if (scale == 0)
+			{
+				e[i] = d[i - 1];
+
+				for (unsigned int j = 0; j < i; j++)
+				{
+					d[j] = v[(i - 1) * n + j];
+					v[i * n + j] = 0;
+					v[j * n + i] = 0;
+				}
+			}
+
+			//Generate the Householder vector
+			else
+			{
+				for (unsigned int k = 0; k < i; k++)
+				{
+					d[k] /= scale;
+					h += d[k] * d[k];
+				}
+
+				T f = d[i - 1];
+				T g = sqrt(h);
+
+				if (f > 0)
+					g = -g;
+
+				e[i] = scale * g;
+				h -= f * g;
+				d[i - 1] = f - g;
+
+				for (unsigned int j = 0; j < i; j++)
+					e[j] = 0;
+
+				//Apply the similarity transformation to the remaining rows
+				for (unsigned int j = 0; j < i; j++)
+				{
+					f = d[j];
+					v[j * n + i] = f;
+					g = e[j] + v[j * n + j] * f;
+
+					for (unsigned int k = j + 1; k <= i - 1; k++)
+					{
+						g += v[k * n + j] * d[k];
+						e[k] += v[k * n + j] * f;
+					}
+
+					e[j] = g;
+				}
+
+				f = 0;
+
+				for (unsigned int j = 0; j < i; j++)
+				{
+					e[j] /= h;
+					f += e[j] * d[j];
+				}
+
+				const T hh = f / (h + h);
+
+				for (unsigned int j = 0; j < i; j++)
+					e[j] -= hh * d[j];
+
+				for (unsigned int j = 0; j < i; j++)
+				{
+					f = d[j];
+					g = e[j];
+
+					for (unsigned int k = j; k <= i - 1; k++)
+						v[k * n + j] -= (f * e[k] + g * d[k]);
+
+					d[j] = v[(i - 1) * n + j];
+					v[i * n + j] = 0;
+				}
+			}
+
+			d[i] = h;
+		}
+
+		//Eigenvalues only: the diagonal remains on the diagonal of A
+		if (!accumulate)
+		{
+			for (unsigned int j = 0; j < n; j++)
+				d[j] = v[j * n + j];
+
+			e[0] = 0;
+
+			return;
+		}
+
+		//Accumulate the transformations
+		for (unsigned int i = 0; i + 1 < n; i++)
+		{
+			v[(n - 1) * n + i] = v[i * n + i];
+			v[i * n + i] = 1;
+
+			const T h = d[i + 1];
+
+			if (h != 0)
+			{
+				for (unsigned int k = 0; k <= i; k++)
+					d[k] = v[k * n + i + 1] / h;
+
+				for (unsigned int j = 0; j <= i; j++)
+				{
+					T g = 0;
+
+					for (unsigned int k = 0; k <= i; k++)
+						g += v[k * n + i + 1] * v[k * n + j];
+
+					for (unsigned int k = 0; k <= i; k++)
+						v[k * n + j] -= g * d[k];
+				}
+			}
+
+			for (unsigned int k = 0; k <= i; k++)
+				v[k * n + i + 1] = 0;
+		}
+
+		for (unsigned int j = 0; j < n; j++)
+		{
+			d[j] = v[(n - 1) * n + j];
+			v[(n - 1) * n + j] = 0;
+		}
+
+		v[(n - 1) * n + n - 1] = 1;
+		e[0] = 0;
+	}
+
+
+	//Eigenvalues of the symmetric tridiagonal matrix (diagonal D, subdiagonal E(1:n-1)) using the implicit QL algorithm
+	//Eigenvalues are returned in D in the ascending order, E is destroyed
+	//If Z != NULL, the plane rotations are applied to the rows of Z and rows are sorted with the eigenvalues:
+	//for Z = I the rows contain eigenvectors of the tridiagonal matrix, for Z = Q' eigenvectors of A = Q * T * Q'
+	template <typename T>
+	void eigTridiag(Matrix <T> &D, Matrix <T> &E, Matrix <T> *Z, const unsigned int max_iter, const T tolerance)
+	{
+		//Algorithm tql2 (Bowdler, Martin, Reinsch, Wilkinson)
+		const unsigned int n = D.rows() * D.cols();
+
+		//Different size of D, E
+		if (E.rows() * E.cols() != n)
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " invalid size of D or E, can not compute eigenvalues:  ", D, E);
+		}
+
+		//Different size of D, Z
+		if ((Z != NULL) && (Z->rows() != n))
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " invalid size of D or Z, can not compute eigenvalues:  ", D, *Z);
+		}
+
+		if (n == 0)
+		{
+			return;
+		}
+
+		T * d = D.data(), *e = E.data();
+		T * z = (Z != NULL ? Z->data() : NULL);
+		const unsigned int nz = (Z != NULL ? Z->cols() : 0);
+
+		//Relative accuracy of the deflation
+		const T eps = std::max(tolerance, std::numeric_limits <T>::epsilon());
+
+		//Shift the subdiagonal
+		for (unsigned int i = 1; i < n; i++)
+			e[i - 1] = e[i];
+
+		e[n - 1] = 0;
+
+		T f = 0, tst1 = 0;
+
+		for (unsigned int l = 0; l < n; l++)
+		{
+			//Find the small subdiagonal element
+			tst1 = std::max(tst1, fabs(d[l]) + fabs(e[l]));
+
+			unsigned int m = l;
+
+			while (m < n - 1)
+			{
+				if (fabs(e[m]) <= eps * tst1)
+					break;
+
+				m++;
+			}
+
+			//Eigenvalue d[l] has not converged yet
+			if (m > l)
+			{
+				for (unsigned int iter = 0; iter < max_iter; iter++)
+				{
+					//Compute the implicit shift
+					T g = d[l];
+					T p = (d[l + 1] - g) / (2 * e[l]);
+					T r = sqrt(p * p + 1);
+
+					if (p < 0)
+						r = -r;
+
+					d[l] = e[l] / (p + r);
+					d[l + 1] = e[l] * (p + r);
+
+					const T dl1 = d[l + 1];
+					T h = g - d[l];
+
+					for (unsigned int i = l + 2; i < n; i++)
+						d[i] -= h;
+
+					f += h;
+
+					//Implicit QL transformation
+					p = d[m];
+					T c = 1, c2 = c, c3 = c, s = 0, s2 = 0;
+					const T el1 = e[l + 1];
+
+					for (unsigned int i = m; i-- > l;)
+					{
+						c3 = c2;
+						c2 = c;
+						s2 = s;
+						g = c * e[i];
+						h = c * p;
+						r = sqrt(p * p + e[i] * e[i]);
+						e[i + 1] = s * r;
+						s = e[i] / r;
+						c = p / r;
+						p = c * d[i] - s * g;
+						d[i + 1] = h + s * (c * g + s * d[i]);
+
+						//Rotate rows i, i + 1 of Z
+						if (z != NULL)
+						{
+							T * zi = z + (std::size_t) i * nz, *zi1 = zi + nz;
+
+							for (unsigned int k = 0; k < nz; k++)
+							{
+								const T t = zi1[k];
+								zi1[k] = s * zi[k] + c * t;
+								zi[k] = c * zi[k] - s * t;
+							}
+						}
+					}
+
+					p = -s * s2 * c3 * el1 * e[l] / dl1;
+					e[l] = s * p;
+					d[l] = c * p;
+
+					//Convergence
+					if (fabs(e[l]) <= eps * tst1)
+						break;
+				}
+			}
+
+			d[l] = d[l] + f;
+			e[l] = 0;
+		}
+
+		//Sort eigenvalues (and rows of Z) in the ascending order
+		for (unsigned int i = 0; i + 1 < n; i++)
+		{
+			unsigned int k = i;
+
+			for (unsigned int j = i + 1; j < n; j++)
+			{
+				if (d[j] < d[k])
+					k = j;
+			}
+
+			if (k != i)
+			{
+				std::swap(d[k], d[i]);
+
+				if (z != NULL)
+					std::swap_ranges(z + (std::size_t) i * nz, z + (std::size_t) i * nz + nz, z + (std::size_t) k * nz);
+			}
+		}
+	}
+
+
+	//Compute eigevalues L and eigenvectors V (columns) of the matrix
+	//Symmetric matrix: Householder tridiagonalization followed by the implicit QL algorithm
+	//Other matrices: Lanczos tridiagonalization and the QR algorithm with the Wilkinson shift
+	//Eigenvalues and eigenvecors are sorted in the ascending order
+	template <typename T>
+	void eig(const Matrix <T> &A, Matrix<T> &V, Matrix<T> &L, const unsigned int max_iter, const T tolerance)
+	{
+		//Modified algorithm by Brian Brodie
+		unsigned int m = A.rows(), n = A.cols();
+
+		//Not rectangular matrix
+		if (m != n)
+		{
+			throw ErrorMathMatrixNotSquare <Matrix <T> >("ErrorMathMatrixNotSquare: ", " invalid dimension of the matrix (rectangle matrix), can not compute eigenvalues; (rows_count, columns_count):  ", A);
+		}
+
+		//Symmetric matrix
+		bool symmetric = true;
+		const T * a = A.data();
+
+		for (unsigned int i = 0; (i < m) && symmetric; i++)
+		{
+			for (unsigned int j = 0; j < i; j++)
+			{
+				if (fabs(a[i * n + j] - a[j * n + i]) > MAX_FLOAT_OPER_ERROR * (fabs(a[i * n + j]) + fabs(a[j * n + i])))
+				{
+					symmetric = false;
+					break;
+				}
+			}
+		}
+
+		//Symmetric matrix: A = Q * T * Q', T = Z' * diag(L) * Z, V = Q * Z'
+		if (symmetric)
+		{
+			Matrix <T> Q = A, D(m, 1), E(m, 1);
+			tridiagSym(Q, D, E, true);
+
+			//Rotations are applied to the rows of Q'
+			transInPlace(Q);
+			eigTridiag(D, E, &Q, max_iter, tolerance);
+			transInPlace(Q);
+
+			V.swap(Q);
+			L.swap(D);
+
+			return;
+		}
+
+		/*
 		//Not positive definite matrix
 		const bool positive_definite = posdef(A);
 
@@ -1848,63 +2525,34 @@ namespace MatrixOperations
 
 
 	//Pseudo-inverse matrix calculation using SVD algorithm
+	//Thin SVD computed by the one-sided Jacobi algorithm, O(m * n^2) for tall matrices
 	//Works also for rank deficient matrices
 	template <typename T>
 	Matrix <T> pinvs(const Matrix <T> &A, const T tolerance)
 	{
-		unsigned int m = A.rows(), n = A.cols();
-		bool transpose = false;
-		const T MAX_SVD_ITER = 1000;
-		Matrix <T> AT(n, m);
-
-		//Rank deficient matrix
-		if (m < n)
-		{
-			//Transpose matrix
-			AT = trans(A);
-
-			//Swap m, n
-			const unsigned int temp = m;
-			m = n; n = temp;
-
-			//Set flag as true
-			transpose = true;
-		}
-
-		//Initialize matrix M
-		Matrix <T> M = (transpose ? AT : A);
-
-		//Create matrices
-		Matrix <T> U(m, m), B(m, n), V(n, n);
-
-		//Compute SVD decomposition
-		svd(M, U, B, V, MAX_SVD_ITER);
-
-		//Get B diagonal
-		Matrix <T> B_D = diag(B);
+		const unsigned int m = A.rows(), n = A.cols();
 
-		//Compute B inverse
-		Matrix <T> B_I(n, n);
+		//Compute SVD decomposition A = U * S * V'
+		Matrix <T> U(m, 1), S(1, 1), V(n, 1);
+		svdJacobi(A, U, S, V);
 
 		//Compute threshold
-		const T treshold = std::max(m, n) * norm(M) * MAX_FLOAT_OPER_ERROR;
+		const T treshold = std::max(m, n) * norm(A) * tolerance;
 
-		//Compute inverse matrix
-		for (unsigned int i = 0; i < n; i++)
+		//Compute V * inv(S): reset small singular values to zero
+		const unsigned int k = S.rows();
+		T * v = V.data();
+
+		for (unsigned int j = 0; j < k; j++)
 		{
-			//Inverse diagonal elements
-			if (fabs(B_D(i, 0)) > treshold)
-				B_I(i, i) = 1.0 / B_D(i, 0);
+			const T s_inv = (fabs(S(j, 0)) > treshold ? 1.0 / S(j, 0) : 0.0);
 
-			//Reset small diagonal elements to zero
-			else B_I(i, i) = 0.0;
+			for (unsigned int i = 0; i < n; i++)
+				v[i * k + j] *= s_inv;
 		}
 
 		//Compute pseudoinverse
-		Matrix <T> A_I = V *  B_I * trans(U(0, m - 1, 0, n - 1));
-
-		//Return A_I or transposed A_I
-		return (transpose ? trans(A_I) : A_I);
+		return V * trans(lazy(U));
 	}
 
 
@@ -1935,6 +2583,38 @@ namespace MatrixOperations
 		//Initialize matrix M
 		Matrix <T> AA = (transpose ? AT : A);
 
+		//Tall matrix: A = Q1 * R, pinv(A) = pinv(R) * Q1', the pivoted factorization works with R (n, n) only
+		if (m > n)
+		{
+			Matrix <T> tau(n, 1);
+			qrWY(AA, tau);
+
+			//Get R
+			Matrix <T> R(n, n);
+
+			for (unsigned int i = 0; i < n; i++)
+			{
+				for (unsigned int j = i; j < n; j++)
+					R(i, j) = AA(i, j);
+			}
+
+			const Matrix <T> RI = pinv1(R);
+
+			//Q1 * RI' = Q * [RI'; 0]
+			Matrix <T> QRI(m, n);
+
+			for (unsigned int i = 0; i < n; i++)
+			{
+				for (unsigned int j = 0; j < n; j++)
+					QRI(i, j) = RI(j, i);
+			}
+
+			qrMultQ(AA, tau, QRI, false);
+
+			//Return A_I or transposed A_I
+			return (transpose ? QRI : trans(QRI));
+		}
+
 		//QR decomposition of A with a permutation matrix E
 		Matrix <T> Q(m, m), R(m, n), B();
 		Matrix <unsigned int> P(n, n);
@@ -2203,20 +2883,8 @@ namespace MatrixOperations
 				break;
 			}
 
-			//Get part of matrix need to be changed
-			Matrix <T> D_S = D(i1, i2 + 1, 0, 0);
-			Matrix <T> E_S = E(i1, i2, 0, 0);
-			Matrix <T> U_S = U(0, m - 1, i1, i2 + 1);
-			Matrix <T> V_S = V(0, n - 1, i1, i2 + 1);
-
-			//Perform next iteration
-			qr0Shift(D_S, E_S, U_S, V_S);
-
-			//Actualize matrices
-			D.submat(D_S, i1, 0);
-			E.submat(E_S, i1, 0);
-			U.submat(U_S, 0, i1);
-			V.submat(V_S, 0, i1);
+			//Perform next iteration on the part of matrices need to be changed, views are updated in place
+			qr0Shift(D.view(i1, i2 + 1, 0, 0), E.view(i1, i2, 0, 0), U.view(0, m - 1, i1, i2 + 1), V.view(0, n - 1, i1, i2 + 1));
 
 			//Increment iterations
 			iterations++;
@@ -2293,83 +2961,158 @@ namespace MatrixOperations
 		U = Matrix <T>(m, m, 0, 1);
 		V = Matrix <T>(n, n, 0, 1);
 
+		T * b = B.data(), * u = U.data(), * vv = V.data();
+
 		//Set amount of rotations: n-1 for squared matrix, n for rectangular matrix
 		unsigned int mn = (m > n ? n : n - 1);
 
-		//Perform bidiagonalization using Householder transformation
-		for (int i = 0; i < mn; i++)
+		//Householder vector and the projections
+		std::vector <T> h(std::max(m, n)), w(std::max(m, n));
+
+		//Perform bidiagonalization using Householder transformation H = I - tau * h * h', reflectors are never formed
+		for (unsigned int i = 0; i < mn; i++)
 		{
 			//Eliminate all non-zero elements below the diagonal using Householder transformation
-			Matrix <T> H1 = hous(B(0, m - 1, i, i), i);
+			const unsigned int mi = m - i;
 
-			//Left multiplication
-			B = H1 * B;
-			U = U * H1;
+			for (unsigned int j = 0; j < mi; j++)
+				h[j] = b[(i + j) * n + i];
 
-			//Eliminate all non-zero elements to the right of the superdiagonal Householder transformation
-			if (i < n - 2)
+			const T tau1 = housv(&h[0], mi, 1);
+
+			b[i * n + i] = h[0];
+			h[0] = 1;
+
+			for (unsigned int j = 1; j < mi; j++)
+				b[(i + j) * n + i] = 0;
+
+			if (tau1 != 0)
 			{
-				Matrix <T> H2 = hous(trans(B(i, i, 0, n - 1)), i + 1);
+				//Left multiplication: B = H1 * B
+				std::fill(w.begin(), w.begin() + n, T(0));
 
-				//Right multiplication
-				B = B * trans(H2);
-				V = H2 * V;
-			}
-		}
+				for (unsigned int j = 0; j < mi; j++)
+				{
+					for (unsigned int l = i + 1; l < n; l++)
+						w[l] += h[j] * b[(i + j) * n + l];
+				}
 
-		//Transpose V
-		V = trans(V);
+				for (unsigned int j = 0; j < mi; j++)
+				{
+					const T th = tau1 * h[j];
 
-		//Rank deficient matrix, trim U, B matrices to m_old rows
-		if (rank_def)
-		{
-			U.res(m_old, m_old);
-			B.res(m_old, n);
-		}
-	}
+					for (unsigned int l = i + 1; l < n; l++)
+						b[(i + j) * n + l] -= th * w[l];
+				}
 
+				//Right multiplication: U = U * H1
+				for (unsigned int j = 0; j < m; j++)
+				{
+					T * uj = u + j * m + i;
+					T uh = 0;
 
-	//Perform QR zero shift using givens transformation, Demel & Kahan,
-	//Accurate singular values of bidiagonal matrices, 1990, pp. 14
-	template <typename T>
-	void qr0Shift(Matrix <T> &D, Matrix <T> &E, Matrix <T> &U, Matrix <T> &V)
-	{
-	
-		const unsigned int m = D.rows(), n1 = U.rows(), n2 = V.rows();
-		T cs = 1.0, oldcs = 1.0, r = 0.0, sn = 0.0, oldsn = 0.0;
+					for (unsigned int l = 0; l < mi; l++)
+						uh += uj[l] * h[l];
 
-		for (unsigned int i = 0; i < m - 1; i++)
-		{
-			//Compute givens rotation
-			givens(cs * D(i, 0), E(i, 0), cs, sn, r);
+					uh *= tau1;
 
-			//Get submatrices
-			Matrix <T> V_S = V(0, n2 - 1, i, i);
-			Matrix <T> V_S1 = V(0, n2 - 1, i + 1, i + 1);
+					for (unsigned int l = 0; l < mi; l++)
+						uj[l] -= uh * h[l];
+				}
+			}
 
-			//Update items of V matrix applying Givens rotations
-			updgivens(cs, sn, V_S, V_S1);
+			//Eliminate all non-zero elements to the right of the superdiagonal Householder transformation
+			if (i + 2 < n)
+			{
+				const unsigned int ni = n - i - 1;
 
-			//Update U matrices
-			V.submat(V_S, 0, i);
-			V.submat(V_S1, 0, i + 1);
+				for (unsigned int l = 0; l < ni; l++)
+					h[l] = b[i * n + i + 1 + l];
 
-			if (i > 0)
-				E(i - 1, 0) = r * oldsn;
+				const T tau2 = housv(&h[0], ni, 1);
 
+				b[i * n + i + 1] = h[0];
+				h[0] = 1;
+
+				for (unsigned int l = 1; l < ni; l++)
+					b[i * n + i + 1 + l] = 0;
+
+				if (tau2 != 0)
+				{
+					//Right multiplication of the remaining rows: B = B * H2
+					for (unsigned int j = i + 1; j < m; j++)
+					{
+						T * bj = b + j * n + i + 1;
+						T bh = 0;
+
+						for (unsigned int l = 0; l < ni; l++)
+							bh += bj[l] * h[l];
+
+						bh *= tau2;
+
+						for (unsigned int l = 0; l < ni; l++)
+							bj[l] -= bh * h[l];
+					}
+
+					//V = V * H2
+					for (unsigned int j = 0; j < n; j++)
+					{
+						T * vj = vv + j * n + i + 1;
+						T vh = 0;
+
+						for (unsigned int l = 0; l < ni; l++)
+							vh += vj[l] * h[l];
+
+						vh *= tau2;
+
+						for (unsigned int l = 0; l < ni; l++)
+							vj[l] -= vh * h[l];
+					}
+				}
+			}
+		}
+
+		//Rank deficient matrix, trim U, B matrices to m_old rows
+		if (rank_def)
+		{
+			U.res(m_old, m_old);
+			B.res(m_old, n);
+		}
+	}
+
+
+	//Perform QR zero shift using givens transformation, Demel & Kahan,
+	//Accurate singular values of bidiagonal matrices, 1990, pp. 14
+	template <typename T>
+	void qr0Shift(Matrix <T> &D, Matrix <T> &E, Matrix <T> &U, Matrix <T> &V)
+	{
+		qr0Shift(D.view(), E.view(), U.view(), V.view());
+	}
+
+
+	//Perform QR zero shift on the views of D, E, U, V, items are updated in place
+	template <typename T>
+	void qr0Shift(const MatrixView <T> &D, const MatrixView <T> &E, const MatrixView <T> &U, const MatrixView <T> &V)
+	{
+		const unsigned int m = D.rows();
+		T cs = 1.0, oldcs = 1.0, r = 0.0, sn = 0.0, oldsn = 0.0;
+
+		for (unsigned int i = 0; i < m - 1; i++)
+		{
 			//Compute givens rotation
-			givens(oldcs * r, D(i + 1, 0) * sn, oldcs, oldsn, D(i, 0));
+			givens(cs * D(i, 0), E(i, 0), cs, sn, r);
 
-			//Get submatrices
-			Matrix <T> U_S = U(0, n1 - 1, i, i);
-			Matrix <T> U_S1 = U(0, n1 - 1, i + 1, i + 1);
+			//Update columns of V matrix applying Givens rotations
+			updgivens(cs, sn, V.col(i), V.col(i + 1));
 
-			//Update items of V matrix applying Givens rotations
-			updgivens(oldcs, oldsn, U_S, U_S1);
+			if (i > 0)
+				E(i - 1, 0) = r * oldsn;
+
+			//Compute givens rotation
+			givens(oldcs * r, D(i + 1, 0) * sn, oldcs, oldsn, D(i, 0));
 
-			//Update U matrices
-			U.submat(U_S, 0, i);
-			U.submat(U_S1, 0, i + 1);
+			//Update columns of U matrix applying Givens rotations
+			updgivens(oldcs, oldsn, U.col(i), U.col(i + 1));
 		}
 
 		//Actualize diagonal and superdiagonal
@@ -2514,13 +3257,580 @@ namespace MatrixOperations
 	template <typename T>
 	void updgivens(const T cs, const T sn, Matrix <T> & V1, Matrix <T> &V2)
 	{
-		const unsigned int m = V1.rows(), n = V1.cols();
+		updgivens(cs, sn, V1.view(), V2.view());
+	}
+
+
+	//Apply Givens rotation to the first columns of two views (e.g. two columns of U, V), items are updated in place
+	template <typename T>
+	void updgivens(const T cs, const T sn, const MatrixView <T> &V1, const MatrixView <T> &V2)
+	{
+		const unsigned int m = V1.rows();
+
+		//Different rows count
+		if (m != V2.rows())
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " different rows count of V1, V2. Cannot apply Givens rotation. ", V1.toMatrix(), V2.toMatrix());
+		}
+
+		T * v1 = V1.data(), *v2 = V2.data();
+		const std::size_t rs1 = V1.rowStride(), rs2 = V2.rowStride();
 
 		for (unsigned int i = 0; i < m; i++)
 		{
-			const T t = V1(i, 0);
-			V1(i, 0) = cs * t + sn * V2(i, 0);
-			V2(i, 0) = -sn * t + cs * V2(i, 0);
+			const T t = v1[i * rs1];
+			v1[i * rs1] = cs * t + sn * v2[i * rs2];
+			v2[i * rs2] = -sn * t + cs * v2[i * rs2];
+		}
+	}
+
+
+	//Compute Householder reflector H = I - tau * v * v' in place, so as H * x = (beta, 0, ..., 0)'
+	//Vector x (n items stored inc apart) is overwritten by beta and v(1), ..., v(n - 1), v(0) = 1 is not stored; returns tau
+	template <typename T>
+	T housv(T * x, const unsigned int n, const unsigned int inc)
+	{
+		//Squared norm of the items bellow x(0)
+		T x_norm2 = 0;
+
+		for (unsigned int i = 1; i < n; i++)
+			x_norm2 += x[i * inc] * x[i * inc];
+
+		//Nothing to eliminate: H = I
+		if (x_norm2 == 0)
+			return 0;
+
+		//Sign of beta avoids the cancellation
+		const T alpha = x[0];
+		const T beta = (alpha >= 0 ? -sqrt(alpha * alpha + x_norm2) : sqrt(alpha * alpha + x_norm2));
+		const T scale = 1.0 / (alpha - beta);
+
+		for (unsigned int i = 1; i < n; i++)
+			x[i * inc] *= scale;
+
+		x[0] = beta;
+
+		return (beta - alpha) / beta;
+	}
+
+
+	//Compute triangular factor TW (jb, jb) of the compact WY representation H(j0) * ... * H(j0 + jb - 1) = I - V * TW * V'
+	//Householder vectors V are stored bellow the diagonal of QR in columns j0, ..., j0 + jb - 1 (forward, columnwise, Schreiber & Van Loan)
+	template <typename T>
+	void housWY(const Matrix <T> &QR, const Matrix <T> &tau, const unsigned int j0, const unsigned int jb, Matrix <T> &TW)
+	{
+		const unsigned int m = QR.rows(), n = QR.cols();
+		const T * a = QR.data();
+
+		TW.res(jb, jb);
+		std::fill(TW.data(), TW.data() + jb * jb, T(0));
+		T * t = TW.data();
+
+		std::vector <T> z(jb);
+
+		for (unsigned int i = 0; i < jb; i++)
+		{
+			const T ti = tau(j0 + i, 0);
+			t[i * jb + i] = ti;
+
+			if ((i == 0) || (ti == 0))
+				continue;
+
+			//z = V(:, 0 : i - 1)' * v(i), v(i) starts at the row j0 + i with the implicit unit item
+			std::fill(z.begin(), z.begin() + i, T(0));
+
+			for (unsigned int r = j0 + i; r < m; r++)
+			{
+				const T vi = (r == j0 + i ? 1 : a[r * n + j0 + i]);
+
+				for (unsigned int p = 0; p < i; p++)
+					z[p] += a[r * n + j0 + p] * vi;
+			}
+
+			//TW(0 : i - 1, i) = -tau(i) * TW(0 : i - 1, 0 : i - 1) * z
+			for (unsigned int p = 0; p < i; p++)
+			{
+				T sum = 0;
+
+				for (unsigned int q = p; q < i; q++)
+					sum += t[p * jb + q] * z[q];
+
+				t[p * jb + i] = -ti * sum;
+			}
+		}
+	}
+
+
+	//Apply block reflector H = I - V * TW * V' (or H') from the left to C (m - j0, nc), C is given by the pointer to the row j0 and the leading dimension
+	//Two passes over the rows of C instead of jb rank-1 updates
+	template <typename T>
+	void housApplyWY(const Matrix <T> &QR, const unsigned int j0, const unsigned int jb, const Matrix <T> &TW, const bool transposed, T * c, const unsigned int ldc, const unsigned int nc)
+	{
+		const unsigned int m = QR.rows(), n = QR.cols();
+		const T * a = QR.data();
+		const T * t = TW.data();
+
+		//W = V' * C
+		std::vector <T> W(jb * nc, T(0));
+
+		for (unsigned int r = j0; r < m; r++)
+		{
+			const T * cr = c + (r - j0) * ldc;
+
+			for (unsigned int p = 0; (p < jb) && (j0 + p <= r); p++)
+			{
+				const T v = (r == j0 + p ? 1 : a[r * n + j0 + p]);
+				T * wp = &W[p * nc];
+
+				for (unsigned int l = 0; l < nc; l++)
+					wp[l] += v * cr[l];
+			}
+		}
+
+		//W = TW' * W: row p depends on the rows 0, ..., p
+		if (transposed)
+		{
+			for (int p = jb - 1; p >= 0; p--)
+			{
+				T * wp = &W[p * nc];
+
+				for (unsigned int l = 0; l < nc; l++)
+					wp[l] *= t[p * jb + p];
+
+				for (int q = 0; q < p; q++)
+				{
+					const T tqp = t[q * jb + p];
+					const T * wq = &W[q * nc];
+
+					for (unsigned int l = 0; l < nc; l++)
+						wp[l] += tqp * wq[l];
+				}
+			}
+		}
+
+		//W = TW * W: row p depends on the rows p, ..., jb - 1
+		else
+		{
+			for (unsigned int p = 0; p < jb; p++)
+			{
+				T * wp = &W[p * nc];
+
+				for (unsigned int l = 0; l < nc; l++)
+					wp[l] *= t[p * jb + p];
+
+				for (unsigned int q = p + 1; q < jb; q++)
+				{
+					const T tpq = t[p * jb + q];
+					const T * wq = &W[q * nc];
+
+					for (unsigned int l = 0; l < nc; l++)
+						wp[l] += tpq * wq[l];
+				}
+			}
+		}
+
+		//C = C - V * W
+		for (unsigned int r = j0; r < m; r++)
+		{
+			T * cr = c + (r - j0) * ldc;
+
+			for (unsigned int p = 0; (p < jb) && (j0 + p <= r); p++)
+			{
+				const T v = (r == j0 + p ? 1 : a[r * n + j0 + p]);
+				const T * wp = &W[p * nc];
+
+				for (unsigned int l = 0; l < nc; l++)
+					cr[l] -= v * wp[l];
+			}
+		}
+	}
+
+
+	//Householder QR decomposition A = Q * R in place, blocked algorithm with the compact WY representation, O(m * n^2)
+	//R is stored in the upper triangle of A, Householder vectors bellow the diagonal, tau (min(m, n), 1) holds the reflector coefficients
+	//Q is never formed, use qrMultQ
+	template <typename T>
+	void qrWY(Matrix <T> &A, Matrix <T> &tau, const unsigned int block_size)
+	{
+		const unsigned int m = A.rows(), n = A.cols(), k = std::min(m, n);
+		const unsigned int nb = std::max(block_size, 1U);
+
+		tau.res(k, 1);
+		T * a = A.data();
+
+		Matrix <T> TW(1, 1);
+		std::vector <T> w(nb);
+
+		//Process panels of nb columns
+		for (unsigned int j0 = 0; j0 < k; j0 += nb)
+		{
+			const unsigned int jb = std::min(nb, k - j0);
+
+			//Unblocked factorization of the panel, reflectors are applied to the panel columns only
+			for (unsigned int j = j0; j < j0 + jb; j++)
+			{
+				const T t = housv(a + j * n + j, m - j, n);
+				tau(j, 0) = t;
+
+				const unsigned int c1 = j + 1, nc = j0 + jb - c1;
+
+				if ((t == 0) || (nc == 0))
+					continue;
+
+				//w = tau * v' * A(j : m - 1, j + 1 : j0 + jb - 1)
+				for (unsigned int l = 0; l < nc; l++)
+					w[l] = a[j * n + c1 + l];
+
+				for (unsigned int r = j + 1; r < m; r++)
+				{
+					const T v = a[r * n + j];
+
+					for (unsigned int l = 0; l < nc; l++)
+						w[l] += v * a[r * n + c1 + l];
+				}
+
+				for (unsigned int l = 0; l < nc; l++)
+				{
+					w[l] *= t;
+					a[j * n + c1 + l] -= w[l];
+				}
+
+				for (unsigned int r = j + 1; r < m; r++)
+				{
+					const T v = a[r * n + j];
+
+					for (unsigned int l = 0; l < nc; l++)
+						a[r * n + c1 + l] -= v * w[l];
+				}
+			}
+
+			//Apply H' of the whole panel to the trailing matrix
+			if (j0 + jb < n)
+			{
+				housWY(A, tau, j0, jb, TW);
+				housApplyWY(A, j0, jb, TW, true, a + j0 * n + j0 + jb, n, n - j0 - jb);
+			}
+		}
+	}
+
+
+	//Multiply C (m, p) by Q or Q' stored in the compact form by qrWY: C = Q * C or C = Q' * C
+	template <typename T>
+	void qrMultQ(const Matrix <T> &QR, const Matrix <T> &tau, Matrix <T> &C, const bool transposed, const unsigned int block_size)
+	{
+		const unsigned int m = QR.rows(), k = tau.rows(), nc = C.cols();
+		const unsigned int nb = std::max(block_size, 1U);
+
+		//Matrix dimemension invalid, throw exception
+		if (C.rows() != m)
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <T> >("ErrorMathMatrixDifferentSize: ", " different rows count. Cannot compute Q * C. ", QR, C);
+		}
+
+		Matrix <T> TW(1, 1);
+		T * c = C.data();
+
+		//C = Q' * C = H(k - 1) * ... * H(0) * C, process blocks forward
+		if (transposed)
+		{
+			for (unsigned int j0 = 0; j0 < k; j0 += nb)
+			{
+				const unsigned int jb = std::min(nb, k - j0);
+				housWY(QR, tau, j0, jb, TW);
+				housApplyWY(QR, j0, jb, TW, true, c + j0 * nc, nc, nc);
+			}
+		}
+
+		//C = Q * C = H(0) * ... * H(k - 1) * C, process blocks backward
+		else
+		{
+			for (int j0 = ((k - 1) / nb) * nb; j0 >= 0; j0 -= nb)
+			{
+				const unsigned int jb = std::min(nb, k - j0);
+				housWY(QR, tau, j0, jb, TW);
+				housApplyWY(QR, j0, jb, TW, false, c + j0 * nc, nc, nc);
+			}
+		}
+	}
+
+
+	//Thin SVD A = U * diag(S) * V' using the one-sided Jacobi algorithm (Hestenes) preconditioned by the Householder QR
+	//A (m, n), U (m, k), S (k, 1) sorted descending, V (n, k), k = min(m, n)
+	//Rotations are applied to the columns of R stored as rows; pairs of the columns are processed by panels of block_size columns
+	template <typename T>
+	void svdJacobi(const Matrix <T> &A, Matrix <T> &U, Matrix <T> &S, Matrix <T> &V, const unsigned int block_size, const unsigned int max_sweeps)
+	{
+		const unsigned int m = A.rows(), n = A.cols();
+
+		//Wide matrix: A' = U2 * S * V2', A = V2 * S * U2'
+		if (m < n)
+		{
+			svdJacobi(trans(A), V, S, U, block_size, max_sweeps);
+			return;
+		}
+
+		const unsigned int nb = std::max(block_size, 1U);
+
+		//A = Q * R
+		Matrix <T> QR = A, tau(n, 1);
+		qrWY(QR, tau);
+		const T * qr = QR.data();
+
+		//Columns of R stored as rows of W, columns of V as rows of VT
+		Matrix <T> W(n, n), VT(n, n, 0.0, 1.0);
+		T * w = W.data(), * vt = VT.data();
+
+		for (unsigned int i = 0; i < n; i++)
+		{
+			for (unsigned int j = i; j < n; j++)
+				w[j * n + i] = qr[i * n + j];
+		}
+
+		//Jacobi sweeps over the pairs of panels
+		const T eps = MAX_FLOAT_OPER_ERROR;
+
+		for (unsigned int sweep = 0; sweep < max_sweeps; sweep++)
+		{
+			bool rotated = false;
+
+			for (unsigned int bi = 0; bi < n; bi += nb)
+			{
+				const unsigned int ei = std::min(bi + nb, n);
+
+				for (unsigned int bj = bi; bj < n; bj += nb)
+				{
+					const unsigned int ej = std::min(bj + nb, n);
+
+					for (unsigned int p = bi; p < ei; p++)
+					{
+						T * wp = w + p * n, * vp = vt + p * n;
+
+						for (unsigned int q = std::max(p + 1, bj); q < ej; q++)
+						{
+							T * wq = w + q * n, * vq = vt + q * n;
+
+							//Squared norms and the dot product of the columns p, q
+							T alpha = 0, beta = 0, gamma = 0;
+
+							for (unsigned int l = 0; l < n; l++)
+							{
+								alpha += wp[l] * wp[l];
+								beta += wq[l] * wq[l];
+								gamma += wp[l] * wq[l];
+							}
+
+							//Columns are orthogonal
+							if (fabs(gamma) <= eps * sqrt(alpha * beta))
+								continue;
+
+							//Rotation making the columns orthogonal
+							const T zeta = (beta - alpha) / (2 * gamma);
+							const T t = (zeta >= 0 ? 1.0 : -1.0) / (fabs(zeta) + sqrt(1 + zeta * zeta));
+							const T cs = 1.0 / sqrt(1 + t * t), sn = cs * t;
+
+							for (unsigned int l = 0; l < n; l++)
+							{
+								const T wpl = wp[l], vpl = vp[l];
+								wp[l] = cs * wpl - sn * wq[l];
+								wq[l] = sn * wpl + cs * wq[l];
+								vp[l] = cs * vpl - sn * vq[l];
+								vq[l] = sn * vpl + cs * vq[l];
+							}
+
+							rotated = true;
+						}
+					}
+				}
+			}
+
+			//Convergence
+			if (!rotated)
+				break;
+		}
+
+		//Singular values are norms of the columns, sort descending
+		std::vector <std::pair <T, unsigned int> > sigma(n);
+
+		for (unsigned int i = 0; i < n; i++)
+		{
+			T sum = 0;
+
+			for (unsigned int l = 0; l < n; l++)
+				sum += w[i * n + l] * w[i * n + l];
+
+			sigma[i] = std::make_pair(-sqrt(sum), i);
+		}
+
+		std::sort(sigma.begin(), sigma.end());
+
+		//U = Q * [UR; 0], columns of UR are the normalized columns of R * V
+		Matrix <T> UC(m, n), SC(n, 1), VC(n, n);
+		T * u = UC.data(), * v = VC.data();
+
+		for (unsigned int j = 0; j < n; j++)
+		{
+			const T s = -sigma[j].first;
+			const unsigned int i = sigma[j].second;
+
+			SC(j, 0) = s;
+
+			for (unsigned int l = 0; l < n; l++)
+			{
+				u[l * n + j] = (s > 0 ? w[i * n + l] / s : 0);
+				v[l * n + j] = vt[i * n + l];
+			}
+		}
+
+		qrMultQ(QR, tau, UC, false);
+
+		U.swap(UC);
+		S.swap(SC);
+		V.swap(VC);
+	}
+
+
+	//Transposed view of the matrix, items are not copied, O(1)
+	template <typename T>
+	MatrixView <T> trans(const MatrixView <T> &A)
+	{
+		return A.trans();
+	}
+
+
+	//Sum of the items of the view
+	template <typename T>
+	typename TMatrixViewItem <T>::Type sum(const MatrixView <T> &A)
+	{
+		const unsigned int m = A.rows(), n = A.cols();
+		const std::size_t rs = A.rowStride(), cs = A.colStride();
+
+		typename TMatrixViewItem <T>::Type sum = 0;
+
+		for (unsigned int i = 0; i < m; i++)
+		{
+			const T * a = A.data() + i * rs;
+
+			for (unsigned int j = 0; j < n; j++)
+			{
+				sum += a[j * cs];
+			}
+		}
+
+		return sum;
+	}
+
+
+	//Sum2 of the items of the view
+	template <typename T>
+	typename TMatrixViewItem <T>::Type sum2(const MatrixView <T> &A)
+	{
+		return dot(A, A);
+	}
+
+
+	//Norm of the view
+	template <typename T>
+	typename TMatrixViewItem <T>::Type norm(const MatrixView <T> &A)
+	{
+		return sqrt(sum2(A));
+	}
+
+
+	//Dot product of two views having the same dimensions (e.g. two columns of the matrix)
+	template <typename T, typename U>
+	typename TMatrixViewItem <T>::Type dot(const MatrixView <T> &A, const MatrixView <U> &B)
+	{
+		const unsigned int m = A.rows(), n = A.cols();
+
+		//Different dimensions
+		if ((m != B.rows()) || (n != B.cols()))
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <typename TMatrixViewItem <T>::Type> >("ErrorMathMatrixDifferentSize: ", " different dimensions of the views. Cannot compute dot product. ", A.toMatrix(), B.toMatrix());
+		}
+
+		const std::size_t rsa = A.rowStride(), csa = A.colStride(), rsb = B.rowStride(), csb = B.colStride();
+
+		typename TMatrixViewItem <T>::Type sum = 0;
+
+		for (unsigned int i = 0; i < m; i++)
+		{
+			const T * a = A.data() + i * rsa;
+			const U * b = B.data() + i * rsb;
+
+			for (unsigned int j = 0; j < n; j++)
+			{
+				sum += a[j * csa] * b[j * csb];
+			}
+		}
+
+		return sum;
+	}
+
+
+	//Multiply views C = A * B, the result is written through into the matrix viewed by C
+	//Transposed views are passed to the kernels as A' * B or A * B', they are never created
+	template <typename T, typename U>
+	void mult(const MatrixView <T> &A, const MatrixView <U> &B, const MatrixView <typename TMatrixViewItem <T>::Type> &C)
+	{
+		typedef typename TMatrixViewItem <T>::Type TItem;
+
+		const unsigned int m = A.rows(), k = A.cols(), n = B.cols();
+
+		//Different rows count
+		if (k != B.rows())
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <TItem> >("ErrorMathMatrixDifferentSize: ", " different rows count. Cannot compute A * B. ", A.toMatrix(), B.toMatrix());
+		}
+
+		//Invalid dimension of the output view
+		if ((C.rows() != m) || (C.cols() != n))
+		{
+			throw ErrorMathMatrixDifferentSize <Matrix <TItem> >("ErrorMathMatrixDifferentSize: ", " invalid dimension of the output view. Cannot compute A * B. ", A.toMatrix(), C.toMatrix());
+		}
+
+		//Output view shares items with the arguments or it is not stored row by row: compute the temporary product
+		if (C.overlaps(A) || C.overlaps(B) || !C.rowMajor())
+		{
+			Matrix <TItem> CT(m, n);
+			mult(A, B, CT.view());
+			C = CT;
+
+			return;
+		}
+
+		//Reset the output view, kernels accumulate into C
+		C.fill(0);
+
+		const std::size_t ldc = C.rowStride();
+
+		//C = A * B
+		if (A.rowMajor() && B.rowMajor())
+		{
+			MatrixKernels::mult(m, n, k, A.data(), A.rowStride(), B.data(), B.rowStride(), C.data(), ldc);
+		}
+
+		//C = A' * B, A' is stored row by row
+		else if (A.colMajor() && B.rowMajor())
+		{
+			MatrixKernels::gemmTN(m, n, k, A.data(), A.colStride(), B.data(), B.rowStride(), C.data(), ldc);
+		}
+
+		//C = A * B', B' is stored row by row
+		else if (A.rowMajor() && B.colMajor())
+		{
+			MatrixKernels::gemmNT(m, n, k, A.data(), A.rowStride(), B.data(), B.colStride(), C.data(), ldc);
+		}
+
+		//General strides
+		else
+		{
+			for (unsigned int i = 0; i < m; i++)
+			{
+				for (unsigned int j = 0; j < n; j++)
+				{
+					C(i, j) = dot(A.row(i), B.col(j).trans());
+				}
+			}
 		}
 	}
 
@@ -2565,10 +3875,10 @@ namespace MatrixOperations
 		//Some error during points processing has appeared
 		catch (Error & error)
 		{
-			//Print error and do not add projection to the list
+			//Print error
 			if (print_exception)
 			{
-				error.printException();
+				error.printException(output);
 			}
 
 			//Throw exception
@@ -2576,6 +3886,42 @@ namespace MatrixOperations
 		}
 	}
 
+
+	//Load matrix from the binary matrix file (items are copied from the read-only mapping)
+	template <typename T>
+	Matrix <T> loadBinary(const char *file, const bool print_exception, std::ostream * output)
+	{
+		try
+		{
+			MappedMatrix <T> A(file);
+
+			return A.toMatrix();
+		}
+
+		//Some error during loading has appeared
+		catch (Error & error)
+		{
+			//Print error
+			if (print_exception)
+			{
+				error.printException(output);
+			}
+
+			//Throw exception
+			throw;
+		}
+	}
+
+
+	//Save matrix into the binary matrix file
+	template <typename T>
+	void saveBinary(const char *file, const Matrix <T> &A)
+	{
+		MatrixFileWriter <T> writer(file, A.cols());
+		writer.writeRows(A);
+		writer.close();
+	}
+
 }
 
 #endif
@@ -23,11 +23,18 @@
 #define NNDistance_H
 
 #include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/PointArray.h"
 
 //Forward declaration
 template <class T>
 class KDTree2D;
 
+template <class T>
+class FlatKDTree2D;
+
+template <typename T, const unsigned int Dim>
+class KDTree;
+
 //Compute several variants of NN-distance
 class NNDistance
 {
@@ -35,11 +42,28 @@ class NNDistance
                 template <typename Point1, typename Point2>
                 static typename Point1::Type getCrossNearestNeighbourDistance ( const Container <Point1 *> &list1, const Container <Point2 *> &list2 );
 
+                template <typename Point1, typename Point2>
+                static typename Point1::Type getCrossNearestNeighbourDistance ( const FlatKDTree2D <Point1> &tree1, const Container <Point2 *> &list2 );
+
                 template <typename Point1, typename Point2>
                 static typename Point1::Type getAverageNearestNeighbourDistance ( const KDTree2D <Point1> &tree, const Point2 * point, unsigned int k = 10 );
 
                 template <typename Point1, typename Point2>
                 static typename Point1::Type compare2DatasetsUsingAverageNearestNeighbourDistance ( const Container <Point1 *> &list1, const Container <Point2 *> &list2, unsigned int k = 10 );
+
+                //Point arrays
+                template <typename T>
+                static T getCrossNearestNeighbourDistance ( const PointArray <T> &pa1, const PointArray <T> &pa2 );
+
+                template <typename T>
+                static T compare2DatasetsUsingAverageNearestNeighbourDistance ( const PointArray <T> &pa1, const PointArray <T> &pa2, unsigned int k = 10 );
+
+        private:
+                template <typename T>
+                static T getSumNearestNeighbourDistance ( const KDTree <T, 2> &tree, const PointArray <T> &pa, const KDTree <T, 2> &tree_pa );
+
+                template <typename T>
+                static void getAverageNearestNeighbourDistances ( const KDTree <T, 2> &tree, const PointArray <T> &pa, const unsigned int k, std::vector <T> &annd );
 };
 
 
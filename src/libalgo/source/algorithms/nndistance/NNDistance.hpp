@@ -25,6 +25,8 @@
 #include <algorithm>
 
 #include "libalgo/source/structures/tree/KDTree.h"
+#include "libalgo/source/structures/tree/FlatKDTree.h"
+#include "libalgo/source/structures/tree/KDTreeND.h"
 
 #include "libalgo/source/algorithms/eucldistance/EuclDistance.h"
 
@@ -35,70 +37,73 @@ template <typename Point1, typename Point2>
 typename Point1::Type NNDistance::getCrossNearestNeighbourDistance ( const Container <Point1 *> &list1, const Container <Point2 *> &list2 )
 {
         //Compute cross nearest neighbour distance for two lists of points
-        typename Point1::Type dist = 0;
         const unsigned int n1 = list1.size();
         const unsigned int n2 = list2.size();
 
-        //Throw exception
-        if ( n1 != n2 || n1 == 0 || n2 == 0 )
+        //Throw exception: no points
+        if ( n1 == 0 || n2 == 0 )
+        {
+                throw ErrorBadData ( "ErrorBadData: can not compute cross nearest diastance,", " list of points is empty." );
+        }
+
+        //Throw exception: different sizes
+        if ( n1 != n2 )
         {
                 throw ErrorBadData ( "ErrorBadData: can not compute cross nearest diastance,", " both lists have different size." );
         }
 
-        //Create KD trees for neighbours searching
-        KDTree2D <Point1> kd_tree1;
-        KDTree2D <Point2> kd_tree2;
-        kd_tree1.createKDTree2D ( const_cast < Container <Point1 *> &> ( list1 ) );
-        kd_tree2.createKDTree2D ( const_cast < Container <Point2 *> &> ( list2 ) );
+        //Create KD tree of the first dataset
+        FlatKDTree2D <Point1> kd_tree1;
+        kd_tree1.createKDTree2D ( list1 );
+
+        return getCrossNearestNeighbourDistance ( kd_tree1, list2 );
+}
+
+
+template <typename Point1, typename Point2>
+typename Point1::Type NNDistance::getCrossNearestNeighbourDistance ( const FlatKDTree2D <Point1> &tree1, const Container <Point2 *> &list2 )
+{
+        //Compute cross nearest neighbour distance for two lists of points, KD tree of the first list may be reused for several second lists
+        //All nearest neighbours in both directions are found by the dual tree search
+        const unsigned int n1 = tree1.getPointsCount();
+        const unsigned int n2 = list2.size();
 
-        //Process all points
-        for ( unsigned int i = 0; i < list1.size(); i++ )
+        //Throw exception: no points
+        if ( n1 == 0 || n2 == 0 )
         {
-                Point1 * point1 = list1 [i];
-                Point2 * point2 = list2 [i];
-
-		/*
-				//Find nearest points
-				typename Point1::Type nearest_dist12 = MAX_FLOAT, nearest_dist21 = MAX_FLOAT;
-				Point1 * nearest12 = list2[0], *nearest21 = list1[0];
-
-				for (unsigned int j = 0; j < list1.size(); j++)
-				{
-					const typename Point1::Type dist12 = EuclDistance::getEuclDistance2D(list1[i]->getX(), list1[i]->getY(), list2[j]->getX(), list2[j]->getY());
-					const typename Point1::Type dist21 = EuclDistance::getEuclDistance2D(list1[j]->getX(), list1[j]->getY(), list2[i]->getX(), list2[i]->getY());
-
-					//Find shorter distance d12
-					if ( dist12 < nearest_dist12)
-					{
-						nearest_dist12 = dist12;
-						nearest12 = list2[j];
-					}
-
-					//Find shorter distance d21
-					if (dist21 < nearest_dist21)
-					{
-						nearest_dist21 = dist21;
-						nearest21 = list1[j];
-					}
-				}
-		*/
-
-                //Find nearest point to point from first dataset in KD tree of the second dataset
-                Point1 * nearest21 = kd_tree1.findNN ( point2 );
-
-                //Find nearest point to point from second dataset in KD tree of the first dataset
-                Point2 * nearest12 = kd_tree2.findNN ( point1 );
-
-                //Compute distances
-                dist += EuclDistance::getEuclDistance2D ( nearest21->getX(), nearest21->getY(), list2 [i]->getX(), list2 [i]->getY() ) +
-                        EuclDistance::getEuclDistance2D ( nearest12->getX(), nearest12->getY(), list1 [i]->getX(), list1 [i]->getY() );			
+                throw ErrorBadData ( "ErrorBadData: can not compute cross nearest diastance,", " list of points is empty." );
+        }
+
+        //Throw exception: different sizes
+        if ( n1 != n2 )
+        {
+                throw ErrorBadData ( "ErrorBadData: can not compute cross nearest diastance,", " both lists have different size." );
+        }
+
+        //Create KD tree of the second dataset
+        FlatKDTree2D <Point2> kd_tree2;
+        kd_tree2.createKDTree2D ( list2 );
+
+        //Find nearest point to each point from the second dataset in KD tree of the first dataset and vice versa
+        std::vector <Point1 *> nn21;
+        std::vector <Point2 *> nn12;
+        std::vector <typename Point1::Type> dist21, dist12;
+
+        tree1.findAllNN ( kd_tree2, nn21, &dist21 );
+        kd_tree2.findAllNN ( tree1, nn12, &dist12 );
+
+        //Sum distances
+        typename Point1::Type dist = 0;
+
+        for ( unsigned int i = 0; i < n1; i++ )
+        {
+                dist += dist21[i] + dist12[i];
         }
 
         return dist / ( 2 * n1 );
 }
 
 
-
 template <typename Point1, typename Point2>
 typename Point1::Type NNDistance::getAverageNearestNeighbourDistance ( const KDTree2D <Point1> &tree, const Point2 * point,  unsigned int k )
 {
@@ -106,7 +111,7 @@ typename Point1::Type NNDistance::getAverageNearestNeighbourDistance ( const KDT
         typename Point1::Type average_nn_dist = 0;
 
         //Throw exceptions: no KD-tree
-        if ( tree == NULL )
+        if ( tree.getNodesCount() == 0 )
         {
                 throw ErrorBadData ( "ErrorBadData: can not compute average nearest neighbour distance,", " KD-tree is empty." );
         }
@@ -115,15 +120,17 @@ typename Point1::Type NNDistance::getAverageNearestNeighbourDistance ( const KDT
         Container <Point1 *, NonDestructable > knn;
 
         //Find all k-narest neighbours
-        tree.findAllKNN ( point, &knn, k );
+        tree.findAllKNN ( point, knn, k );
 
         //Compute average distance
+        k = knn.size();
+
         for ( unsigned int i = 0; i < k; i++ )
         {
-                average_nn_dist += EuclDistance::getEuclDistance2D ( point, knn[i] ) ;
+                average_nn_dist += EuclDistance::getEuclDistance2D ( point->getX(), point->getY(), knn[i]->getX(), knn[i]->getY() ) ;
         }
 
-        return average_nn_dist / k;
+        return average_nn_dist / std::max ( k, 1U );
 }
 
 
@@ -148,8 +155,14 @@ typename Point1::Type NNDistance::compare2DatasetsUsingAverageNearestNeighbourDi
         k = std::min ( k, n1 - 2 );
 
         //Create KD-trees
-        kd_tree1.createKDTree2D ( const_cast < Container <Point1 *> *> ( list1 ) );
-        kd_tree2.createKDTree2D ( const_cast < Container <Point2 *> *> ( list2 ) );
+        kd_tree1.createKDTree2D ( list1 );
+        kd_tree2.createKDTree2D ( list2 );
+
+        //Find k-nearest neighbours of all points (one batch for each data set)
+        std::vector <Point1 *> knn1;
+        std::vector <Point2 *> knn2;
+        const unsigned int k1 = kd_tree1.findAllKNN ( list1, knn1, k );
+        const unsigned int k2 = kd_tree2.findAllKNN ( list2, knn2, k );
 
         //Compute ANND ratio for both datasets
         typename Point1::Type annd_ratio = 0;
@@ -157,8 +170,17 @@ typename Point1::Type NNDistance::compare2DatasetsUsingAverageNearestNeighbourDi
         for ( unsigned int i = 0; i < n1; i++ )
         {
                 //Compute annd for each data set
-                typename Point1::Type annd1 = getAverageNearestNeighbourDistance ( kd_tree1, ( *list1 ) [i], k );
-                typename Point2::Type annd2 = getAverageNearestNeighbourDistance ( kd_tree2, ( *list2 ) [i], k );
+                typename Point1::Type annd1 = 0, annd2 = 0;
+
+                for ( unsigned int j = 0; j < k1; j++ )
+                {
+                        annd1 += EuclDistance::getEuclDistance2D ( list1 [i]->getX(), list1 [i]->getY(), knn1[i * k1 + j]->getX(), knn1[i * k1 + j]->getY() ) / k1;
+                }
+
+                for ( unsigned int j = 0; j < k2; j++ )
+                {
+                        annd2 += EuclDistance::getEuclDistance2D ( list2 [i]->getX(), list2 [i]->getY(), knn2[i * k2 + j]->getX(), knn2[i * k2 + j]->getY() ) / k2;
+                }
 
                 //Compute ANND ratio
                 annd_ratio += fabs ( annd1 - annd2 );
@@ -167,4 +189,143 @@ typename Point1::Type NNDistance::compare2DatasetsUsingAverageNearestNeighbourDi
         return annd_ratio / n1;
 }
 
+
+template <typename T>
+T NNDistance::getCrossNearestNeighbourDistance ( const PointArray <T> &pa1, const PointArray <T> &pa2 )
+{
+        //Compute cross nearest neighbour distance for two point arrays
+        const unsigned int n1 = pa1.size();
+        const unsigned int n2 = pa2.size();
+
+        //Throw exception: no points
+        if ( n1 == 0 || n2 == 0 )
+        {
+                throw ErrorBadData ( "ErrorBadData: can not compute cross nearest diastance,", " list of points is empty." );
+        }
+
+        //Throw exception: different sizes
+        if ( n1 != n2 )
+        {
+                throw ErrorBadData ( "ErrorBadData: can not compute cross nearest diastance,", " both lists have different size." );
+        }
+
+        //Create KD trees of both datasets directly from the coordinate arrays
+        KDTree <T, 2> kd_tree1, kd_tree2;
+        kd_tree1.createKDTree ( pa1 );
+        kd_tree2.createKDTree ( pa2 );
+
+        //Find nearest point to each point from the second dataset in KD tree of the first dataset and vice versa
+        const T dist = getSumNearestNeighbourDistance ( kd_tree1, pa2, kd_tree2 ) + getSumNearestNeighbourDistance ( kd_tree2, pa1, kd_tree1 );
+
+        return dist / ( 2 * n1 );
+}
+
+
+template <typename T>
+T NNDistance::compare2DatasetsUsingAverageNearestNeighbourDistance ( const PointArray <T> &pa1, const PointArray <T> &pa2, unsigned int k )
+{
+        //Compare 2 datasets stored in point arrays using ANND ratio
+        const unsigned int n1 = pa1.size();
+        const unsigned int n2 = pa2.size();
+
+        //Throw exception
+        if ( n1 != n2 )
+        {
+                throw ErrorBadData ( "ErrorBadData: can not compare 2 datasets using ANND ratio, ", "datasets have different sizes." );
+        }
+
+        //Correct k: if there are less points than k
+        k = std::min ( k, n1 - 2 );
+
+        //Create KD-trees
+        KDTree <T, 2> kd_tree1, kd_tree2;
+        kd_tree1.createKDTree ( pa1 );
+        kd_tree2.createKDTree ( pa2 );
+
+        //Average distance of k-nearest neighbours of all points (the point itself is included)
+        std::vector <T> annd1, annd2;
+        getAverageNearestNeighbourDistances ( kd_tree1, pa1, k, annd1 );
+        getAverageNearestNeighbourDistances ( kd_tree2, pa2, k, annd2 );
+
+        //Compute ANND ratio for both datasets
+        T annd_ratio = 0;
+
+        for ( unsigned int i = 0; i < n1; i++ )
+        {
+                annd_ratio += fabs ( annd1[i] - annd2[i] );
+        }
+
+        return annd_ratio / n1;
+}
+
+
+template <typename T>
+T NNDistance::getSumNearestNeighbourDistance ( const KDTree <T, 2> &tree, const PointArray <T> &pa, const KDTree <T, 2> &tree_pa )
+{
+        //Sum of distances of all points of the array to their nearest neighbours in the KD tree, the queries are processed in parallel
+        //Points are queried in the order of leaves of their own KD tree: subsequent queries visit the same nodes
+        const int n = pa.size();
+        const T * x = pa.getX(), * y = pa.getY();
+
+        T dist = 0;
+
+#ifdef _OPENMP
+        #pragma omp parallel for reduction ( + : dist ) if ( n >= KD_TREE_PARALLEL_QUERY_SIZE )
+#endif
+
+        for ( int i = 0; i < n; i++ )
+        {
+                const unsigned int index = tree_pa.getPointIndex ( i );
+                const T point[2] = {x[index], y[index]};
+                T dist_nn = 0;
+
+                tree.findNN ( point, &dist_nn );
+                dist += dist_nn;
+        }
+
+        return dist;
+}
+
+
+template <typename T>
+void NNDistance::getAverageNearestNeighbourDistances ( const KDTree <T, 2> &tree, const PointArray <T> &pa, const unsigned int k, std::vector <T> &annd )
+{
+        //Average distance of k-nearest neighbours in the KD tree for each point of the array, the queries are processed in parallel
+        const int n = pa.size();
+        const T * x = pa.getX(), * y = pa.getY();
+
+        annd.resize ( n );
+
+#ifdef _OPENMP
+        #pragma omp parallel if ( n >= KD_TREE_PARALLEL_QUERY_SIZE )
+#endif
+        {
+                //Lists reused by all queries of the thread
+                TIndexList knn;
+                std::vector <T> distances;
+
+#ifdef _OPENMP
+                #pragma omp for schedule ( dynamic, 256 )
+#endif
+
+                for ( int i = 0; i < n; i++ )
+                {
+                        const T point[2] = {x[i], y[i]};
+
+                        knn.clear();
+                        distances.clear();
+                        tree.findAllKNN ( point, k, knn, &distances );
+
+                        T sum = 0;
+
+                        for ( unsigned int j = 0; j < distances.size(); j++ )
+                        {
+                                sum += distances[j];
+                        }
+
+                        annd[i] = sum / std::max ( ( unsigned int ) distances.size(), 1U );
+                }
+        }
+}
+
 #endif
@@ -28,6 +28,7 @@
 
 #include "libalgo/source/structures/list/Container.h"
 #include "libalgo/source/algorithms/matrixoperations/MatrixOperations.h"
+#include "libalgo/source/algorithms/matrixoperations/MatrixFactorization.h"
 
 
 
@@ -82,22 +83,22 @@ class NonLinearLeastSquares
 		static void trStep32(const Matrix <T> &B, Matrix <T> &R, Matrix <T> &s, const Matrix <T> &G, Matrix <T> &v, T & lambda_min, T &lambda_max, T &lambda, const T delta_min, const T delta_max, const T delta, T &mju_min, bool &stop);
 
 		template <typename T>
-		static void trStep4(const Matrix <T> &B, const Matrix <T> &R, Matrix <T> &s, const Matrix <T> &G, Matrix <T> &v, T & lambda_min, T &lambda_max, T &lambda, const T delta_min, const T delta_max, const T delta, T &mju_min, bool &stop);
+		static void trStep4(const Matrix <T> &B, const CholeskyFactorization <T> &F, Matrix <T> &s, const Matrix <T> &G, Matrix <T> &v, T & lambda_min, T &lambda_max, T &lambda, const T delta_min, const T delta_max, const T delta, T &mju_min, bool &stop);
 
 		template <typename T>
-		static void trStep42(const Matrix <T> &B, const Matrix <T> &R, Matrix <T> &s, const Matrix <T> &G, Matrix <T> &v, T & lambda_min, T &lambda_max, T &lambda, const T delta_min, const T delta_max, const T delta, T &mju_min, bool &stop);
+		static void trStep42(const Matrix <T> &B, const CholeskyFactorization <T> &F, Matrix <T> &s, const Matrix <T> &G, Matrix <T> &v, T & lambda_min, T &lambda_max, T &lambda, const T delta_min, const T delta_max, const T delta, T &mju_min, bool &stop);
 
 		template <typename T>
-		static void trStep5 (const Matrix <T> &B, const Matrix <T> &R, Matrix<T> &s, Matrix<T> &v, T &lambda, const T delta_min, const T delta, T &mju_min, bool &stop);
+		static void trStep5 (const Matrix <T> &B, const CholeskyFactorization <T> &F, Matrix<T> &s, Matrix<T> &v, T &lambda, const T delta_min, const T delta, T &mju_min, bool &stop);
 		
 		template <typename T>
-		static void trStep52(const Matrix <T> &B, const Matrix <T> &R, Matrix<T> &s, const Matrix <T> &G, Matrix<T> &v, const T lambda_min, const T lambda_max, T &lambda, const T delta_min, const T delta, T &mju_min, bool &stop);
+		static void trStep52(const Matrix <T> &B, const CholeskyFactorization <T> &F, Matrix<T> &s, const Matrix <T> &G, Matrix<T> &v, const T lambda_min, const T lambda_max, T &lambda, const T delta_min, const T delta, T &mju_min, bool &stop);
 		
 		template <typename T>
-		static T trStep6(const Matrix <T> &R, const Matrix <T> &s, Matrix<T> &v, const T delta);
+		static T trStep6(const CholeskyFactorization <T> &F, const Matrix <T> &s, Matrix<T> &v, const T delta);
 		
 		template <typename T>
-		static void trStep62(const Matrix <T> &R, const Matrix <T> &s, const Matrix <T> &G, Matrix<T> &v, const T lambda_min, const T lambda_max, T &lambda, const T delta, const T mju_min);
+		static void trStep62(const CholeskyFactorization <T> &F, const Matrix <T> &s, const Matrix <T> &G, Matrix<T> &v, const T lambda_min, const T lambda_max, T &lambda, const T delta, const T mju_min);
 
 		template <typename T>
 		static void reflection(Matrix <T> &X, const Matrix <T> &XMIN, const Matrix <T> &XMAX);
@@ -59,13 +59,13 @@ T NonLinearLeastSquares::GN ( FunctionJ function_j, FunctionV function_v, Functi
                 function_j ( X, J );
 
                 //Stop computation
-                if ( sum2 ( trans ( J ) * W * V ) < max_error )
+                if ( sum2 ( tmult ( J, W * V ) ) < max_error )
                         break;
 
                 //Compute Minimum Weighteed Least Squares using qr decomposition
                 //Jacobian J = [ d_R, d_latp, d_lonp, d_lat0, d_lon0, d_dx, d_dy]
                 //dX = mlsqr ( J, W, V ) * ( -1.0 );
-                dX = pinv1 ( trans ( J ) * W * J ) * trans ( J ) * W * V * ( -1.0 );
+                dX = pinv1 ( tmult ( J, W * J ) ) * tmult ( J, W * V ) * ( -1.0 );
 
                 //Compute new X
                 X = X + dX;
@@ -80,7 +80,7 @@ T NonLinearLeastSquares::GN ( FunctionJ function_j, FunctionV function_v, Functi
         function_v ( X, Y, V, W );
 
         //Return squares of residuals
-        return norm ( trans ( V ) * W * V );
+        return norm ( eval ( trans ( lazy ( V ) ) * W * V ) );
 }
 
 
@@ -105,8 +105,8 @@ T NonLinearLeastSquares::GND(FunctionJ function_j, FunctionV function_v, Functio
 
         //Compute matrices
         function_j ( X, J );
-        Matrix <T> G = trans ( J ) * W * V;
-        Matrix <T> F = trans ( V ) * W * V;
+        Matrix <T> G = tmult ( J, W * V );
+        Matrix <T> F = trans ( lazy ( V ) ) * W * V;
 	//V.print();
 
         //Perform iterations
@@ -119,7 +119,7 @@ T NonLinearLeastSquares::GND(FunctionJ function_j, FunctionV function_v, Functio
                 //function_j ( X, J );
 
                 //Compute the direction 
-		dX = pinv1(trans(J) * W * J) * G * (-1.0);
+		dX = pinv1(tmult(J, W * J)) * G * (-1.0);
 
 		//dX.print();
 
@@ -139,7 +139,7 @@ T NonLinearLeastSquares::GND(FunctionJ function_j, FunctionV function_v, Functio
 		const T t_min = 1.0e-10;
 		T t = 1.0;
 
-		while ( (sum2(V2) > sum2(V) + sum(trans(V) * J *  dX) * t * alpha * 2.0) && (t > t_min) )
+		while ( (sum2(V2) > sum2(V) + sum(eval(trans(lazy(V)) * J *  dX)) * t * alpha * 2.0) && (t > t_min) )
                 {
                         //Step t bisection
                         t /= 2;
@@ -169,8 +169,8 @@ T NonLinearLeastSquares::GND(FunctionJ function_j, FunctionV function_v, Functio
                 function_j ( X, J );
 
                 //Compute new residuals and gradient
-                Matrix <T> F_new = trans ( V ) * W * V;
-                Matrix <T> G_new = trans ( J ) * W * V;
+                Matrix <T> F_new = trans ( lazy ( V ) ) * W * V;
+                Matrix <T> G_new = tmult ( J, W * V );
 		
                 //Terminal condition
                 if ( ( norm ( G ) < max_error ) || ( fabs ( F_new ( 0, 0 ) - F ( 0, 0 ) ) < max_diff * std::max ( 1.0 , F ( 0, 0 ) ) ) ||
@@ -197,7 +197,7 @@ T NonLinearLeastSquares::GND(FunctionJ function_j, FunctionV function_v, Functio
         //std::cout << "res =" << rr << '\n';
 
         //Return squares of residuals
-        return norm ( trans ( V ) * W * V );
+        return norm ( eval ( trans ( lazy ( V ) ) * W * V ) );
 }
 
 
@@ -224,9 +224,9 @@ T NonLinearLeastSquares::BFGS(FunctionJ function_j, FunctionV function_v, Functi
 	function_j(X, J);
 
 	//Compute matrices
-	Matrix <T> H = trans(J) * W * J;
-	Matrix <T> G = trans(J) * W * V;
-	Matrix <T> F = trans(V) * W * V;
+	Matrix <T> H = tmult(J, W * J);
+	Matrix <T> G = tmult(J, W * V);
+	Matrix <T> F = trans(lazy(V)) * W * V;
 
 	//Initialize BFGS parameter
 	Matrix <T> H_new = H, G_new = G, F_new = F;
@@ -259,7 +259,7 @@ T NonLinearLeastSquares::BFGS(FunctionJ function_j, FunctionV function_v, Functi
 		const T t_min = 1.0e-10;
 		T t = 1.0;
 
-		while ((sum2(V2) > sum2(V) + sum(trans(V) * J *  dX) * t * alpha * 2.0) && (t > t_min))
+		while ((sum2(V2) > sum2(V) + sum(eval(trans(lazy(V)) * J *  dX)) * t * alpha * 2.0) && (t > t_min))
 		{
 			//Step t bisection
 			t /= 2;
@@ -290,8 +290,8 @@ T NonLinearLeastSquares::BFGS(FunctionJ function_j, FunctionV function_v, Functi
 		function_j(X, J);
 
 		//Compute new residuals and gradient
-		F_new = trans(V) * V;
-		G_new = trans(J) * W * V;
+		F_new = trans(lazy(V)) * V;
+		G_new = tmult(J, W * V);
 
 		//Terminal condition
 		if ((norm(G) < max_error) || (fabs(F_new(0, 0) - F(0, 0)) < 1.0 * max_diff * std::max(1.0, F(0, 0))) ||
@@ -308,8 +308,8 @@ T NonLinearLeastSquares::BFGS(FunctionJ function_j, FunctionV function_v, Functi
 		Matrix <T> y = G_new - G;
 
 		//Compute new Hessian matrix using BFGS
-		const Matrix <T> D1 = trans(y) * d;
-		const Matrix <T> D2 = trans(d) * H * d;
+		const Matrix <T> D1 = trans(lazy(y)) * d;
+		const Matrix <T> D2 = trans(lazy(d)) * H * d;
 
 		Matrix <T> dH = y * trans(y) / D1(0, 0) - H * d * trans(H * d) / D2(0, 0);
 		H_new = H + dH;
@@ -323,7 +323,7 @@ T NonLinearLeastSquares::BFGS(FunctionJ function_j, FunctionV function_v, Functi
 	//Compute final values in V
 	function_v(X, Y, V, W);
 
-	return norm(trans(V) * W * V);
+	return norm(eval(trans(lazy(V)) * W * V));
 }
 
 
@@ -349,9 +349,9 @@ T NonLinearLeastSquares::BFGSH(FunctionJ function_j, FunctionV function_v, Funct
         function_j ( X, J );
 	
         //Compute matrices
-        Matrix <T> H = trans ( J ) * W * J;
-        Matrix <T> G = trans ( J ) * W * V;
-        Matrix <T> F = trans ( V ) * W * V;
+        Matrix <T> H = tmult ( J, W * J );
+        Matrix <T> G = tmult ( J, W * V );
+        Matrix <T> F = trans ( lazy ( V ) ) * W * V;
 
         //Initialize BFGS parameter
         Matrix <T> H_new = H, G_new = G, F_new = F;
@@ -381,7 +381,7 @@ T NonLinearLeastSquares::BFGSH(FunctionJ function_j, FunctionV function_v, Funct
                 const T t_min = 1.0e-10; 
 		T t = 1.0;
 
-                while ( ( sum2 ( V2 ) > sum2 ( V ) + sum ( trans ( V ) * J *  dX ) * t * alpha * 2.0 ) && ( t > t_min ) )
+                while ( ( sum2 ( V2 ) > sum2 ( V ) + sum ( eval ( trans ( lazy ( V ) ) * J *  dX ) ) * t * alpha * 2.0 ) && ( t > t_min ) )
                 {
                         //Step t bisection
                         t /= 2;
@@ -411,8 +411,8 @@ T NonLinearLeastSquares::BFGSH(FunctionJ function_j, FunctionV function_v, Funct
 		//X.print();
 
                 //Compute new residuals and gradient
-                F_new = trans ( V ) * V;
-                G_new = trans ( J ) * W * V;	
+                F_new = trans ( lazy ( V ) ) * V;
+                G_new = tmult ( J, W * V );	
 		
 		//Terminal condition
 		if ((norm(G) < max_error) || (fabs(F_new(0, 0) - F(0, 0)) < 1.0 * max_diff * std::min(1.0, F(0, 0))) ||
@@ -427,7 +427,7 @@ T NonLinearLeastSquares::BFGSH(FunctionJ function_j, FunctionV function_v, Funct
                 //Compute Hessian matrix in a common way
                 if ( dF > nu )
                 {
-                        H_new = trans ( J ) * W * J;
+                        H_new = tmult ( J, W * J );
                 }
 
                 //Use BFGS method
@@ -442,8 +442,8 @@ T NonLinearLeastSquares::BFGSH(FunctionJ function_j, FunctionV function_v, Funct
                         //Matrix <T> B2 = trans ( J ) * W * J;
 
                         //Compute new Hessian matrix using BFGS
-                        const Matrix <T> D1 =  trans ( y ) * d;
-                        const Matrix <T> D2 =  trans ( d ) * H * d;
+                        const Matrix <T> D1 =  trans ( lazy ( y ) ) * d;
+                        const Matrix <T> D2 =  trans ( lazy ( d ) ) * H * d;
 			
 			//Compute update
 			Matrix <T> dH(n, n);
@@ -472,7 +472,7 @@ T NonLinearLeastSquares::BFGSH(FunctionJ function_j, FunctionV function_v, Funct
 
         std::cout << "iter:" << iterations << '\n';
 
-        return norm ( trans ( V ) * W * V ) ;
+        return norm ( eval ( trans ( lazy ( V ) ) * W * V ) ) ;
 }
 
 
@@ -490,7 +490,7 @@ T NonLinearLeastSquares::LM(FunctionJ function_j, FunctionV function_v, Function
 
 	//Create matrices
 	const unsigned short m = W.rows(), n = X.rows();
-	Matrix <T> J(m, n), dX(n, 1), I(n, n, 0.0, 1.0);
+	Matrix <T> J(m, n), dX(n, 1), I(n, n, 0.0, 1.0), WJ(m, n), WV(m, 1);
 
 	//Initialize matrices
 	Matrix <T> Y2 = Y, V2 = V, W2 = W, J2 = J;
@@ -502,10 +502,12 @@ T NonLinearLeastSquares::LM(FunctionJ function_j, FunctionV function_v, Function
 	function_j(X, J);
 
 	//Compute matrices
-	Matrix <T> H = trans(J) * W * J;
-	Matrix <T> G = trans(J) * W * V;
-	Matrix <T> F = trans(V) * W * V * 0.5;
-	Matrix <T> G2 = trans(G) * H * G;
+	mult(W, J, WJ);
+	mult(W, V, WV);
+	Matrix <T> H = tmult(J, WJ);
+	Matrix <T> G = tmult(J, WV);
+	Matrix <T> F = trans(lazy(V)) * W * V * 0.5;
+	Matrix <T> G2 = trans(lazy(G)) * H * G;
 
 	//Compute nitial parameters
 	T ng = norm(G);
@@ -513,7 +515,7 @@ T NonLinearLeastSquares::LM(FunctionJ function_j, FunctionV function_v, Function
 	
 	//lambda = std::max(norm(trans(G) * G) / norm(trans(G) * H  * G), 0.001);
 	//T lambda =  0.01 *max ( diag ( H ) );
-	Matrix <T> GB = trans(G) * H * G;
+	Matrix <T> GB = trans(lazy(G)) * H * G;
 	//T lambda = std::max(1.0, ng * ng / fabs(GB(0, 0)));
 	//lambda = 30 * ng;
 	//lambda = 3000000;
@@ -543,11 +545,11 @@ T NonLinearLeastSquares::LM(FunctionJ function_j, FunctionV function_v, Function
 		function_j(X2, J2);
 
 		//Compute dQ: model function
-		Matrix <T> dQM = trans(dX) * H * dX * 0.5 + trans(G) * dX;
+		Matrix <T> dQM = trans(lazy(dX)) * H * dX * 0.5 + trans(lazy(G)) * dX;
 		const T dQ = -dQM(0, 0);
 
 		//Compute dF
-		const Matrix <T> F2 = trans(V2) * W2 * V2 * 0.5;
+		const Matrix <T> F2 = trans(lazy(V2)) * W2 * V2 * 0.5;
 		const T dF = F(0, 0) - F2(0, 0);
 		const T rho = dF / dQ;
 
@@ -585,9 +587,11 @@ T NonLinearLeastSquares::LM(FunctionJ function_j, FunctionV function_v, Function
 			V = V2;
 			W = W2;
 
-			//Actualize matrices
-			H = trans(J) * W * J;
-			G = trans(J) * W * V;
+			//Actualize matrices, reuse allocated buffers
+			mult(W, J, WJ);
+			mult(W, V, WV);
+			tmult(J, WJ, H);
+			tmult(J, WV, G);
 			ng = norm(G);
 		}
 
@@ -604,7 +608,7 @@ T NonLinearLeastSquares::LM(FunctionJ function_j, FunctionV function_v, Function
 	//X.print(output);
 
 	//Return squares of residuals
-	return norm(trans(V) * W * V);
+	return norm(eval(trans(lazy(V)) * W * V));
 }
 
 
@@ -622,7 +626,7 @@ T NonLinearLeastSquares::TR(FunctionJ function_j, FunctionV function_v, Function
 
 	//Create matrices
 	const unsigned short m = W.rows(), n = X.rows();
-	Matrix <T> J(m, n), dX(n, 1), I(n, n, 0.0, 1.0);
+	Matrix <T> J(m, n), dX(n, 1), I(n, n, 0.0, 1.0), WJ(m, n), WV(m, 1);
 
 	//Initialize matrices
 	Matrix <T> Y2 = Y, V2 = V, W2 = W, J2 = J;
@@ -637,10 +641,12 @@ T NonLinearLeastSquares::TR(FunctionJ function_j, FunctionV function_v, Function
 	function_j(X, J);
 
 	//Compute matrices
-	Matrix <T> H = trans(J) * W * J;
-	Matrix <T> G = trans(J) * W * V;
-	Matrix <T> F = trans(V) * W * V * 0.5;
-	Matrix <T> G2 = trans(G) * H * G;
+	mult(W, J, WJ);
+	mult(W, V, WV);
+	Matrix <T> H = tmult(J, WJ);
+	Matrix <T> G = tmult(J, WV);
+	Matrix <T> F = trans(lazy(V)) * W * V * 0.5;
+	Matrix <T> G2 = trans(lazy(G)) * H * G;
 
 	//Compute nitial parameters
 	T ng = norm(G);
@@ -648,7 +654,7 @@ T NonLinearLeastSquares::TR(FunctionJ function_j, FunctionV function_v, Function
 	//Initialize trust region size
 	//T delta = 0.00001 * ng;
 	//T delta = 30 * ng;
-	Matrix <T> GB = trans(G) * H * G;
+	Matrix <T> GB = trans(lazy(G)) * H * G;
 	//T delta = std::max(15000.0, ng * ng / fabs(GB(0, 0)));
 	//T delta = std::max(10.0, ng * ng / fabs(GB(0, 0)));
 	//
@@ -687,7 +693,7 @@ T NonLinearLeastSquares::TR(FunctionJ function_j, FunctionV function_v, Function
 		//X2.print();
 
 		//Compute new residuals
-		const Matrix <T> F2 = trans(V2) * W2 * V2 * 0.5;
+		const Matrix <T> F2 = trans(lazy(V2)) * W2 * V2 * 0.5;
 
 		//Terminal condition
 		if ((norm(G) < max_error) || (fabs(F2(0, 0) - F(0, 0)) < 1.0 * max_diff * std::max(1.0, F(0, 0))) ||
@@ -695,7 +701,7 @@ T NonLinearLeastSquares::TR(FunctionJ function_j, FunctionV function_v, Function
 			break;
 
 		//Compute dQ: model function
-		Matrix <T> dQM = trans(dX) * H * dX * 0.5 + trans(G) * dX;
+		Matrix <T> dQM = trans(lazy(dX)) * H * dX * 0.5 + trans(lazy(G)) * dX;
 		const T dQ = -dQM(0, 0);
 
 		//Compute dF
@@ -709,7 +715,7 @@ T NonLinearLeastSquares::TR(FunctionJ function_j, FunctionV function_v, Function
 		const T ndx = norm(dX);
 
 		//Bad estimation of nu
-		const T gdx = norm(trans(G) * dX);
+		const T gdx = norm(eval(trans(lazy(G)) * dX));
 		const T numer = (1 - 0.9) * gdx;
 		const T denom = (1 - 0.9) * (F(0, 0) + gdx + 0.9 * (F(0, 0) + norm(dQM)) - F2(0, 0));
 		const T nu_bad = numer / denom;
@@ -726,9 +732,11 @@ T NonLinearLeastSquares::TR(FunctionJ function_j, FunctionV function_v, Function
 			V = V2;
 			W = W2;
 
-			//Actualize matrices
-			H = trans(J) * W * J;
-			G = trans(J) * W * V;
+			//Actualize matrices, reuse allocated buffers
+			mult(W, J, WJ);
+			mult(W, V, WV);
+			tmult(J, WJ, H);
+			tmult(J, WV, G);
 			ng = norm(G);
 		}
 
@@ -770,7 +778,7 @@ T NonLinearLeastSquares::TR(FunctionJ function_j, FunctionV function_v, Function
 	//X.print(output);
 
 	//Return squares of residuals
-	return norm(trans(V) * W * V);
+	return norm(eval(trans(lazy(V)) * W * V));
 }
 
 
@@ -789,7 +797,7 @@ T NonLinearLeastSquares::TR2(FunctionJ function_j, FunctionV function_v, Functio
 
 	//Create matrices
 	const unsigned short m = W.rows(), n = X.rows();
-	Matrix <T> J(m, n), dX(n, 1), I(n, n, 0.0, 1.0);
+	Matrix <T> J(m, n), dX(n, 1), I(n, n, 0.0, 1.0), WJ(m, n), WV(m, 1);
 
 	//Initialize matrices
 	Matrix <T> Y2 = Y, V2 = V, W2 = W, J2 = J;
@@ -801,17 +809,19 @@ T NonLinearLeastSquares::TR2(FunctionJ function_j, FunctionV function_v, Functio
 	function_j(X, J);
 
 	//Compute matrices
-	Matrix <T> H = trans(J) * W * J;
-	Matrix <T> G = trans(J) * W * V;
-	Matrix <T> F = trans(V) * W * V * 0.5;
-	Matrix <T> G2 = trans(G) * H * G;
+	mult(W, J, WJ);
+	mult(W, V, WV);
+	Matrix <T> H = tmult(J, WJ);
+	Matrix <T> G = tmult(J, WV);
+	Matrix <T> F = trans(lazy(V)) * W * V * 0.5;
+	Matrix <T> G2 = trans(lazy(G)) * H * G;
 
 	//Compute nitial parameters
 	T ng = norm(G);
 
 	//Initialize trust region size
 	//T delta = 30 * ng;
-	Matrix <T> GB = trans(G) * H * G;
+	Matrix <T> GB = trans(lazy(G)) * H * G;
 	//T delta = std::max(100.0, ng * ng / fabs(GB(0, 0)));
 	delta = 10000;
 
@@ -845,7 +855,7 @@ T NonLinearLeastSquares::TR2(FunctionJ function_j, FunctionV function_v, Functio
 		//X2.print();
 
 		//Compute new residuals
-		const Matrix <T> F2 = trans(V2) * W2 * V2 * 0.5;
+		const Matrix <T> F2 = trans(lazy(V2)) * W2 * V2 * 0.5;
 
 		//Terminal condition
 		if ((norm(G) < max_error) || (fabs(F2(0, 0) - F(0, 0)) < 1.0 * max_diff * std::max(1.0, F(0, 0))) ||
@@ -858,7 +868,7 @@ T NonLinearLeastSquares::TR2(FunctionJ function_j, FunctionV function_v, Functio
 		const T dFc = F(0,0) - F2(0, 0);
 
 		//Compute dQ: model function
-		Matrix <T> dQM = trans(dX) * H * dX * 0.5 + trans(G) * dX;
+		Matrix <T> dQM = trans(lazy(dX)) * H * dX * 0.5 + trans(lazy(G)) * dX;
 		const T dQ = -dQM(0, 0);
 
 		//Compute Rho
@@ -885,9 +895,11 @@ T NonLinearLeastSquares::TR2(FunctionJ function_j, FunctionV function_v, Functio
 			V = V2;
 			W = W2;
 
-			//Actualize matrices
-			H = trans(J) * W * J;
-			G = trans(J) * W * V;
+			//Actualize matrices, reuse allocated buffers
+			mult(W, J, WJ);
+			mult(W, V, WV);
+			tmult(J, WJ, H);
+			tmult(J, WV, G);
 			ng = norm(G);
 
 			//Update the best value
@@ -923,7 +935,7 @@ T NonLinearLeastSquares::TR2(FunctionJ function_j, FunctionV function_v, Functio
 		const T ndx = norm(dX);
 
 		//Bad estimation of nu
-		const T gdx = norm(trans(G) * dX);
+		const T gdx = norm(eval(trans(lazy(G)) * dX));
 		const T numer = (1 - 0.9) * gdx;
 		const T denom = (1 - 0.9) * (F(0, 0) + gdx + 0.9 * (F(0, 0) + norm(dQM)) - F2(0, 0));
 		const T nu_bad = numer / denom;
@@ -966,7 +978,7 @@ T NonLinearLeastSquares::TR2(FunctionJ function_j, FunctionV function_v, Functio
 	//X.print(output);
 
 	//Return squares of residuals
-	return norm(trans(V) * W * V);
+	return norm(eval(trans(lazy(V)) * W * V));
 }
 
 
@@ -984,7 +996,7 @@ T NonLinearLeastSquares::TR3(FunctionJ function_j, FunctionV function_v, Functio
 
 	//Create matrices
 	const unsigned short m = W.rows(), n = X.rows();
-	Matrix <T> J(m, n), dX(n, 1), I(n, n, 0.0, 1.0);
+	Matrix <T> J(m, n), dX(n, 1), I(n, n, 0.0, 1.0), WJ(m, n), WV(m, 1);
 
 	//Initialize matrices
 	Matrix <T> Y2 = Y, V2 = V, W2 = W, J2 = J;
@@ -996,17 +1008,19 @@ T NonLinearLeastSquares::TR3(FunctionJ function_j, FunctionV function_v, Functio
 	function_j(X, J);
 
 	//Compute matrices
-	Matrix <T> H = trans(J) * W * J;
-	Matrix <T> G = trans(J) * W * V;
-	Matrix <T> F = trans(V) * W * V * 0.5;
-	Matrix <T> G2 = trans(G) * H * G;
+	mult(W, J, WJ);
+	mult(W, V, WV);
+	Matrix <T> H = tmult(J, WJ);
+	Matrix <T> G = tmult(J, WV);
+	Matrix <T> F = trans(lazy(V)) * W * V * 0.5;
+	Matrix <T> G2 = trans(lazy(G)) * H * G;
 
 	//Compute nitial parameters
 	T ng = norm(G);
 
 	//Initialize trust region size
 	delta = 3000 * ng;
-	Matrix <T> GB = trans(G) * H * G;
+	Matrix <T> GB = trans(lazy(G)) * H * G;
 	//delta = std::max(10.0, ng * ng / fabs(GB(0, 0)));
 	//std::cout << "ng = " << ng;
 	//delta = 300000000;
@@ -1040,7 +1054,7 @@ T NonLinearLeastSquares::TR3(FunctionJ function_j, FunctionV function_v, Functio
 		//X2.print();
 
 		//Compute new residuals
-		Matrix <T> F2 = trans(V2) * W2 * V2 * 0.5;
+		Matrix <T> F2 = trans(lazy(V2)) * W2 * V2 * 0.5;
 
 		//Terminal condition
 		if ((norm(G) < max_error) || (fabs(F2(0, 0) - F(0, 0)) < 1.0 * max_diff * std::max(1.0, F(0, 0))) ||
@@ -1048,7 +1062,7 @@ T NonLinearLeastSquares::TR3(FunctionJ function_j, FunctionV function_v, Functio
 			break;
 
 		//Compute dQ: model function
-		Matrix <T> dQM = trans(dX) * H * dX * 0.5 + trans(G) * dX;
+		Matrix <T> dQM = trans(lazy(dX)) * H * dX * 0.5 + trans(lazy(G)) * dX;
 		const T dQ = -dQM(0, 0);
 
 		//Compute dF
@@ -1095,10 +1109,10 @@ T NonLinearLeastSquares::TR3(FunctionJ function_j, FunctionV function_v, Functio
 				//X2.print();
 
 				//Compute new residuals
-				F2j = trans(V2j) * W2j * V2j * 0.5;
+				F2j = trans(lazy(V2j)) * W2j * V2j * 0.5;
 
 				//Compute new rho
-				Matrix <T> dQMj = trans(dXj) * H * dXj * 0.5 + trans(G) * dXj;
+				Matrix <T> dQMj = trans(lazy(dXj)) * H * dXj * 0.5 + trans(lazy(G)) * dXj;
 				const T dQj = -dQMj(0, 0);
 
 				//Compute dF
@@ -1136,7 +1150,7 @@ T NonLinearLeastSquares::TR3(FunctionJ function_j, FunctionV function_v, Functio
 		const T ndx = norm(dX);
 
 		//Bad estimation of nu
-		const T gdx = norm(trans(G) * dX);
+		const T gdx = norm(eval(trans(lazy(G)) * dX));
 		const T numer = (1 - 0.9) * gdx;
 		const T denom = (1 - 0.9) * (F(0, 0) + gdx + 0.9 * (F(0, 0) + norm(dQM)) - F2(0, 0));
 		const T nu_bad = numer / denom;
@@ -1153,9 +1167,11 @@ T NonLinearLeastSquares::TR3(FunctionJ function_j, FunctionV function_v, Functio
 			V = V2;
 			W = W2;
 
-			//Actualize matrices
-			H = trans(J) * W * J;
-			G = trans(J) * W * V;
+			//Actualize matrices, reuse allocated buffers
+			mult(W, J, WJ);
+			mult(W, V, WV);
+			tmult(J, WJ, H);
+			tmult(J, WV, G);
 			ng = norm(G);
 		}
 
@@ -1198,7 +1214,7 @@ T NonLinearLeastSquares::TR3(FunctionJ function_j, FunctionV function_v, Functio
 	//X.print(output);
 
 	//Return squares of residuals
-	return norm(trans(V) * W * V);
+	return norm(eval(trans(lazy(V)) * W * V));
 }
 
 
@@ -1219,8 +1235,8 @@ Matrix <T> NonLinearLeastSquares::optTRStep(const Matrix <T> &J, const Matrix <T
 	const T beta_min = 0.001, delta_min = 0.9, delta_max = 1.1;
 
 	//Compute initial matrices
-	const Matrix <T> B = trans(J) * W * J;
-	const Matrix <T> G = trans(J) * W * V;
+	const Matrix <T> B = tmult(J, W * J);
+	const Matrix <T> G = tmult(J, W * V);
 
 	//Eigenvalues decomposition
 	Matrix <T> EV(n, n, 0, 1), EL(n, 1);
@@ -1267,7 +1283,7 @@ Matrix <T> NonLinearLeastSquares::optTRStep(const Matrix <T> &J, const Matrix <T
 		//If (B + lambda * I) is positive definite diag|E| = 0
 		if (max_diag_E < 1.0e-3)
 		{
-			trStep4(B, R, s, G, v, lambda_min, lambda_max, lambda, delta_min, delta_max, delta, mju_min, stop);
+			trStep4(B, CholeskyFactorization <T>(TriangularMatrix <T>(R, UpperTriangular)), s, G, v, lambda_min, lambda_max, lambda, delta_min, delta_max, delta, mju_min, stop);
 		}
 
 		// (B + lambda * I) is not positive definite: diag|E| != 0
@@ -1277,7 +1293,7 @@ Matrix <T> NonLinearLeastSquares::optTRStep(const Matrix <T> &J, const Matrix <T
 			v = v * (1.0 / norm(v));
 
 			//Actualize mju_min
-			const Matrix <T> vb = trans(v) * (B + I * lambda) * v;
+			const Matrix <T> vb = trans(lazy(v)) * (B + I * lambda) * v;
 
 			//mju_min = lambda - vb(0, 0);
 			mju_min = std::max(mju_min, lambda - vb(0, 0));
@@ -1311,8 +1327,8 @@ Matrix <T> NonLinearLeastSquares::optTRStep2(const Matrix <T> &J, const Matrix <
 	const T beta_min = 0.001, beta_max = 0.999, delta_min = 0.9, delta_max = 1.1;
 
 	//Compute initial matrices
-	const Matrix <T> B = trans(J) * W * J;
-	const Matrix <T> G = trans(J) * W * V;
+	const Matrix <T> B = tmult(J, W * J);
+	const Matrix <T> G = tmult(J, W * V);
 
 	//Eigenvalues decomposition
 	Matrix < T> EV(n, n, 0, 1), EL(n, 1);
@@ -1409,7 +1425,7 @@ void NonLinearLeastSquares::trStep32(const Matrix <T> &B, Matrix <T> &R, Matrix
 	//If (B + lambda * I) is positive definite diag|E| = 0
       	if (max_diag_E < 1.0e-3)
 	{
-		trStep42(B, R, s, G, v, lambda_min, lambda_max, lambda, delta_min, delta_max, delta, mju_min, stop);
+		trStep42(B, CholeskyFactorization <T>(TriangularMatrix <T>(R, UpperTriangular)), s, G, v, lambda_min, lambda_max, lambda, delta_min, delta_max, delta, mju_min, stop);
 	}
 
 	// (B + lambda * I) is not positive definite: diag|E| != 0
@@ -1419,7 +1435,7 @@ void NonLinearLeastSquares::trStep32(const Matrix <T> &B, Matrix <T> &R, Matrix
 		v = v * (1.0 / norm(v));
 
 		//Actualize mju_min
-		const Matrix <T> vb = trans(v) * (B + I * lambda) * v;
+		const Matrix <T> vb = trans(lazy(v)) * (B + I * lambda) * v;
 		
 		mju_min = lambda - vb(0, 0);
 		//mju_min = std::max(mju_min, lambda - vb(0, 0));
@@ -1429,15 +1445,16 @@ void NonLinearLeastSquares::trStep32(const Matrix <T> &B, Matrix <T> &R, Matrix
 
 
 template <typename T>
-void NonLinearLeastSquares::trStep4(const Matrix <T> &B, const Matrix <T> &R, Matrix <T> &s, const Matrix <T> &G, Matrix <T> &v, T & lambda_min, T &lambda_max, T &lambda, const T delta_min, const T delta_max, const T delta, T &mju_min,  bool &stop)
+void NonLinearLeastSquares::trStep4(const Matrix <T> &B, const CholeskyFactorization <T> &F, Matrix <T> &s, const Matrix <T> &G, Matrix <T> &v, T & lambda_min, T &lambda_max, T &lambda, const T delta_min, const T delta_max, const T delta, T &mju_min,  bool &stop)
 {
 	//Step 4 of the trust region subproblem
 
-	//Compute S, so as R'RS + g = 0
+	//Compute S, so as R'RS + g = 0: R' * R = L * L' is given by the factorization
 	//Matrix<T> kkk =B + I *lambda;
 	//kkk.print();
 	//B.print();
-	s = inv(trans(R) * R) * G * (-1.0);
+	s = G * (-1.0);
+	F.solveInPlace(s);
 	//R.print();
 	//S.print();
 	//S = pinv1(B) * G * (-1.0);
@@ -1451,7 +1468,7 @@ void NonLinearLeastSquares::trStep4(const Matrix <T> &B, const Matrix <T> &R, Ma
 		lambda_min = lambda;
 
 		//Go to step 6
-		lambda += trStep6(R, s, v, delta);
+		lambda += trStep6(F, s, v, delta);
 	}
 
 	//Stop computation
@@ -1467,21 +1484,22 @@ void NonLinearLeastSquares::trStep4(const Matrix <T> &B, const Matrix <T> &R, Ma
 		lambda_max = lambda;
 
 		//Goto step 5
-		trStep5(B, R, s, v, lambda, delta_min, delta, mju_min, stop);
+		trStep5(B, F, s, v, lambda, delta_min, delta, mju_min, stop);
 	}
 }
 
 
 template <typename T>
-void NonLinearLeastSquares::trStep42(const Matrix <T> &B, const Matrix <T> &R, Matrix <T> &s, const Matrix <T> &G, Matrix <T> &v, T & lambda_min, T &lambda_max, T &lambda, const T delta_min, const T delta_max, const T delta, T &mju_min, bool &stop)
+void NonLinearLeastSquares::trStep42(const Matrix <T> &B, const CholeskyFactorization <T> &F, Matrix <T> &s, const Matrix <T> &G, Matrix <T> &v, T & lambda_min, T &lambda_max, T &lambda, const T delta_min, const T delta_max, const T delta, T &mju_min, bool &stop)
 {
 	//Step 4 of the trust region subproblem
 
-	//Compute S, so as R'RS + g = 0
+	//Compute S, so as R'RS + g = 0: R' * R = L * L' is given by the factorization
 	//Matrix<T> kkk =B + I *lambda;
 	//kkk.print();
 	//B.print();
-	s = pinv1(trans(R) * R) * G * (-1.0);
+	s = G * (-1.0);
+	F.solveInPlace(s);
 	//R.print();
 	//S.print();
 	//S = pinv1(B) * G * (-1.0);
@@ -1495,7 +1513,7 @@ void NonLinearLeastSquares::trStep42(const Matrix <T> &B, const Matrix <T> &R, M
 		lambda_min = lambda;
 
 		//Go to step 6
-		trStep62(R, s, G, v, lambda_min, lambda_max, lambda, delta, mju_min);
+		trStep62(F, s, G, v, lambda_min, lambda_max, lambda, delta, mju_min);
 	}
 
 	//Stop computation
@@ -1511,7 +1529,7 @@ void NonLinearLeastSquares::trStep42(const Matrix <T> &B, const Matrix <T> &R, M
 		lambda_max = lambda;
 
 		//Goto step 5
-		trStep52(B, R, s, G, v, lambda_min, lambda_max, lambda, delta_min, delta, mju_min, stop);
+		trStep52(B, F, s, G, v, lambda_min, lambda_max, lambda, delta_min, delta, mju_min, stop);
 	}
 }
 
@@ -1519,7 +1537,7 @@ void NonLinearLeastSquares::trStep42(const Matrix <T> &B, const Matrix <T> &R, M
 
 
 template <typename T>
-void NonLinearLeastSquares::trStep5(const Matrix <T> &B, const Matrix <T> &R, Matrix<T> &s, Matrix<T> &v, T &lambda, const T delta_min, const T delta, T &mju_min, bool &stop)
+void NonLinearLeastSquares::trStep5(const Matrix <T> &B, const CholeskyFactorization <T> &F, Matrix<T> &s, Matrix<T> &v, T &lambda, const T delta_min, const T delta, T &mju_min, bool &stop)
 {
 	// Step 5 of the trust region subproblem
 	const unsigned short n = B.cols();
@@ -1532,7 +1550,7 @@ void NonLinearLeastSquares::trStep5(const Matrix <T> &B, const Matrix <T> &R, Ma
 	eig(B, EV, EL);
 
 	//Get the smallest eigenvector and norm
-	v = trans(EV(0, 0, 0, n - 1));
+	v = EV(0, n - 1, 0, 0);
 	v = v * (1.0 / norm(v));
 
 	//Compute alpha for vn'*S > 0
@@ -1544,8 +1562,9 @@ void NonLinearLeastSquares::trStep5(const Matrix <T> &B, const Matrix <T> &R, Ma
 	const T alpha = (vts <= 0 ? vtsd_sqr - vts : (delta * delta - s2) / (vtsd_sqr + vts));
 
 	//Test condition
-	const T rvn2 = norm(R * v) * norm(R * v);
-	const T rs2 = norm(R * s) * norm(R * s);
+	const T nrv = norm(F.getL().transMult(v)), nrs = norm(F.getL().transMult(s));
+	const T rvn2 = nrv * nrv;
+	const T rs2 = nrs * nrs;
 	const T l = alpha * alpha * rvn2;
 	const T r = (1 - delta_min * delta_min) * (rs2 + lambda * delta * delta);
 
@@ -1567,13 +1586,13 @@ void NonLinearLeastSquares::trStep5(const Matrix <T> &B, const Matrix <T> &R, Ma
 		mju_min = std::max(mju_min, lambda - rvn2);
 
 		//Goto Step 6, compute new lambda
-		lambda += trStep6(R, s, v, delta);
+		lambda += trStep6(F, s, v, delta);
 	}
 }
 
 
 template <typename T>
-void NonLinearLeastSquares::trStep52(const Matrix <T> &B, const Matrix <T> &R, Matrix<T> &s, const Matrix <T> &G, Matrix<T> &v, const T lambda_min, const T lambda_max, T &lambda, const T delta_min, const T delta, T &mju_min, bool &stop)
+void NonLinearLeastSquares::trStep52(const Matrix <T> &B, const CholeskyFactorization <T> &F, Matrix<T> &s, const Matrix <T> &G, Matrix<T> &v, const T lambda_min, const T lambda_max, T &lambda, const T delta_min, const T delta, T &mju_min, bool &stop)
 {
 	// Step 5 of the trust region subproblem
 	const unsigned short n = B.cols();
@@ -1586,7 +1605,7 @@ void NonLinearLeastSquares::trStep52(const Matrix <T> &B, const Matrix <T> &R, M
 	eig(B, EV, EL);
 
 	//Get the smallest eigenvector and norm
-	v = trans(EV(0, 0, 0, n - 1));
+	v = EV(0, n - 1, 0, 0);
 	v = v * (1.0 / norm(v));
 
 	//Compute alpha for vn'*S > 0
@@ -1598,8 +1617,9 @@ void NonLinearLeastSquares::trStep52(const Matrix <T> &B, const Matrix <T> &R, M
 	const T alpha = (delta * delta - s2) / (vtsd_sqr + vts);
 
 	//Test condition
-	const T rvn2 = norm(R * v) * norm(R * v);
-	const T rs2 = norm(R * s) * norm(R * s);
+	const T nrv = norm(F.getL().transMult(v)), nrs = norm(F.getL().transMult(s));
+	const T rvn2 = nrv * nrv;
+	const T rs2 = nrs * nrs;
 	const T l = alpha * alpha * rvn2;
 	const T r = (1 - delta_min * delta_min) * (rs2 + lambda * delta * delta);
 
@@ -1620,17 +1640,18 @@ void NonLinearLeastSquares::trStep52(const Matrix <T> &B, const Matrix <T> &R, M
 		//mju_min = std::max(mju_min, lambda - rvn2);
 
 		//Goto Step 6, compute new lambda
-		trStep62(R, s, G, v, lambda_min, lambda_max, lambda, delta, mju_min);
+		trStep62(F, s, G, v, lambda_min, lambda_max, lambda, delta, mju_min);
 	}
 }
 
 
 template <typename T>
-T NonLinearLeastSquares::trStep6(const Matrix <T> &R, const Matrix <T> &s, Matrix<T> &v, const T delta)
+T NonLinearLeastSquares::trStep6(const CholeskyFactorization <T> &F, const Matrix <T> &s, Matrix<T> &v, const T delta)
 {
 
 	// Step 6 of the trust region subproblem
-	v = inv(trans(R)) * s;
+	v = s;
+	F.solveLInPlace(v);
 
 	//Actualize lambda solving the Newton iteration step
 	const T ns = norm(s);
@@ -1645,7 +1666,7 @@ T NonLinearLeastSquares::trStep6(const Matrix <T> &R, const Matrix <T> &s, Matri
 
 
 template <typename T>
-void NonLinearLeastSquares::trStep62(const Matrix <T> &R, const Matrix <T> &s, const Matrix <T> &G, Matrix<T> &v, const T lambda_min, const T lambda_max, T &lambda, const T delta, const T mju_min )
+void NonLinearLeastSquares::trStep62(const CholeskyFactorization <T> &F, const Matrix <T> &s, const Matrix <T> &G, Matrix<T> &v, const T lambda_min, const T lambda_max, T &lambda, const T delta, const T mju_min )
 {
 
 	// Step 6 of the trust region subproblem
@@ -1656,7 +1677,8 @@ void NonLinearLeastSquares::trStep62(const Matrix <T> &R, const Matrix <T> &s, c
 	}
 	
 	//Compute step
-	v = pinv1(trans(R)) * s;
+	v = s;
+	F.solveLInPlace(v);
 
 	//Actualize lambda solving the Newton iteration step
 	const T ns = norm(s);
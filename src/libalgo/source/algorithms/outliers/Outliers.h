@@ -25,6 +25,7 @@
 #include "libalgo/source/structures/list/Container.h"
 
 #include "libalgo/source/algorithms/transformation/Transformation2D.h"
+#include "libalgo/source/algorithms/matrixoperations/MatrixFactorization.h"
 
 //Scheme for M-estimators
 typedef enum
@@ -223,12 +223,29 @@ void Outliers::findOutliersME(const Matrix <T> &P, const Matrix <T> &Q, const T
 	Y.submat(P(0, m1 - 1, 0, 0), 0, 0);
 	Y.submat(P(0, m1 - 1, 1, 1), m1, 0);
 
+	//Normal equations N = A' * W * A, AWY = A' * W * Y for the diagonal W = I
+	SymmetricMatrix <T> N(n_cols);
+	N.rankUpdate(A);
+	Matrix <T> AWY = tmult(A, Y);
+
+	//Weights used in the normal equations
+	std::vector <T> w(2 * m1, 1.0);
+
+	//Factorization of N reused by the iterations, singular matrix: use the pseudoinverse
+	CholeskyFactorization <T> F(n_cols);
+	bool factorized = F.factorize(N);
+
 	//Compute initial residuals
-	Matrix <T> beta = pinv1(trans(A) * W * A) * trans(A) * W  * Y;
+	Matrix <T> beta = (factorized ? F.solve(AWY) : pinv1(N.full()) * AWY);
 
 	//Compute initial residuals
 	Eps = Y - A * beta;
-	f_init = norm(trans(Eps) * W * Eps);
+	f_init = 0;
+
+	for (unsigned int i = 0; i < 2 * m1; i++)
+		f_init += W(i, i) * Eps(i, 0) * Eps(i, 0);
+
+	f_init = fabs(f_init);
 
 	//Set parameters
 	T df = 2 * tol;
@@ -238,8 +255,39 @@ void Outliers::findOutliersME(const Matrix <T> &P, const Matrix <T> &Q, const T
 	//Main IRLS procedure
 	while ((df > tol) && (iter < max_iter))
 	{
-		//Compute new beta using the least squares: more accurate than a common inversion
-		beta = pinv1(trans(A) * W * A) * trans(A) * W  * Y;
+		//Actualize normal equations for the changed weights: N = N + dw * a' * a, a is the row of A
+		unsigned int n_changed = 0;
+		Matrix <T> a(n_cols, 1);
+
+		for (unsigned int i = 0; i < 2 * m1; i++)
+		{
+			const T dw = W(i, i) - w[i];
+
+			if (dw == 0)
+				continue;
+
+			for (unsigned int j = 0; j < n_cols; j++)
+			{
+				a(j, 0) = A(i, j);
+				AWY(j, 0) += dw * A(i, j) * Y(i, 0);
+			}
+
+			N.rankUpdate(trans(a), dw);
+
+			//A few changed weights: rank-1 modification of the factorization, O(n^2)
+			if (factorized && (n_changed < n_cols))
+				factorized = F.rankUpdate(a, dw);
+
+			w[i] = W(i, i);
+			n_changed++;
+		}
+
+		//Many changed weights or the downdate failed: compute the factorization again
+		if ((n_changed > n_cols) || !factorized)
+			factorized = F.factorize(N);
+
+		//Compute new beta using the least squares, singular normal matrix: use the pseudoinverse
+		beta = (factorized ? F.solve(AWY) : pinv1(N.full()) * AWY);
 
 		//Compute residuals
 		Eps = Y - A * beta;
@@ -358,7 +406,12 @@ void Outliers::findOutliersME(const Matrix <T> &P, const Matrix <T> &Q, const T
 		}
 
 		//Compute residuals
-		const T f2 = norm(trans(Eps) * W * Eps);
+		T f2 = 0;
+
+		for (unsigned int i = 0; i < 2 * m1; i++)
+			f2 += W(i, i) * Eps(i, 0) * Eps(i, 0);
+
+		f2 = fabs(f2);
 
 		//Compute the condition
 		df = fabs(f2 - f);
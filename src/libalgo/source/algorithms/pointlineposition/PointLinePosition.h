@@ -22,7 +22,7 @@
 #ifndef PointLinePosition_H
 #define PointLinePosition_H
 
-#include "libalgo/source/algorithms/vectorvectororientation/VectorVectorOrientation.h"
+#include "libalgo/source/algorithms/robustpredicates/RobustPredicates.h"
 
 //Forward declaration
 template <typename T>
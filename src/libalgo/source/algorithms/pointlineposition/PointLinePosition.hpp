@@ -33,9 +33,24 @@ unsigned short PointLinePosition::getPointLinePosition2D ( const Point3DCartesia
         		1 = point lies in left half plane,
         		0 = point lies in the right half plane,
          		2 = point lies on the line
+         The exact orientation predicate is used, the point lies on the line only if it is exactly colinear
          */
-
-        return VectorVectorOrientation::getVectorVectorOrientation2D ( p2->getX() - p1->getX(), p2->getY() - p1->getY(),  p->getX() - p1->getX(), p->getY() - p1->getY() );
+        const double orientation = RobustPredicates::getOrientation2D ( p1, p2, p );
+
+        //Point lies in the left half plane
+        if ( orientation > 0 )
+        {
+                return 1;
+        }
+
+        //Point lies in the right half plane
+        if ( orientation < 0 )
+        {
+                return 0;
+        }
+
+        //Point lies on the line
+        return 2;
 }
 
 #endif
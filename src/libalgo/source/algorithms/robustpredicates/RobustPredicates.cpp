@@ -0,0 +1,447 @@
+#include "RobustPredicates.h"
+
+#include <cmath>
+#include <vector>
+
+
+//Machine epsilon 2^(-53) of the double precision arithmetic (round to nearest) and the splitter 2^27 + 1
+//The expansion arithmetic requires the IEEE 754 double arithmetic without extended precision and contraction of a * b + c
+static const double epsilon = 1.1102230246251565e-16;
+static const double splitter = 134217729.0;
+
+//Error bounds of the filters (Shewchuk, 1997)
+static const double result_err_bound = ( 3.0 + 8.0 * epsilon ) * epsilon;
+static const double ccw_err_bound_A = ( 3.0 + 16.0 * epsilon ) * epsilon;
+static const double ccw_err_bound_B = ( 2.0 + 12.0 * epsilon ) * epsilon;
+static const double ccw_err_bound_C = ( 9.0 + 64.0 * epsilon ) * epsilon * epsilon;
+static const double icc_err_bound_A = ( 10.0 + 96.0 * epsilon ) * epsilon;
+
+
+//Counts of the exact evaluations of one thread, padded to avoid sharing the cache line with the counts of other threads
+struct TExactCounts
+{
+        unsigned long orientations;
+        unsigned long in_circles;
+        char padding[128 - 2 * sizeof ( unsigned long )];
+
+        TExactCounts() : orientations ( 0 ), in_circles ( 0 ) {}
+};
+
+//Counts of the current thread, created on its first exact evaluation
+static TExactCounts * thread_counts = NULL;
+
+#ifdef _OPENMP
+#pragma omp threadprivate ( thread_counts )
+#endif
+
+
+//Counts of all threads (never destroyed: counts of the finished threads are kept in the sums)
+static std::vector <TExactCounts *> & getAllCounts()
+{
+        static std::vector <TExactCounts *> counts;
+        return counts;
+}
+
+
+static TExactCounts * getThreadCounts()
+{
+        //Get counts of the current thread, register them on the first use
+        if ( thread_counts == NULL )
+        {
+                TExactCounts * counts = new TExactCounts();
+
+#ifdef _OPENMP
+                #pragma omp critical ( RobustPredicates )
+#endif
+                getAllCounts().push_back ( counts );
+
+                thread_counts = counts;
+        }
+
+        return thread_counts;
+}
+
+
+double RobustPredicates::getOrientation2D ( const double x1, const double y1, const double x2, const double y2, const double x3, const double y3 )
+{
+        //Orientation of the points: positive = counterclockwise, negative = clockwise, zero = colinear
+        const double det_left = ( x1 - x3 ) * ( y2 - y3 );
+        const double det_right = ( y1 - y3 ) * ( x2 - x3 );
+        const double det = det_left - det_right;
+
+        //Products have different signs or one of them is zero: the sign is correct
+        double det_sum = 0;
+
+        if ( det_left > 0 )
+        {
+                if ( det_right <= 0 ) return det;
+
+                det_sum = det_left + det_right;
+        }
+
+        else if ( det_left < 0 )
+        {
+                if ( det_right >= 0 ) return det;
+
+                det_sum = - det_left - det_right;
+        }
+
+        else
+        {
+                return det;
+        }
+
+        //Floating point filter
+        const double err_bound = ccw_err_bound_A * det_sum;
+
+        if ( ( det >= err_bound ) || ( -det >= err_bound ) )
+        {
+                return det;
+        }
+
+        //Adaptive evaluation
+        getThreadCounts() -> orientations++;
+
+        return getOrientation2DAdapt ( x1, y1, x2, y2, x3, y3, det_sum );
+}
+
+
+double RobustPredicates::getInCircle ( const double x1, const double y1, const double x2, const double y2, const double x3, const double y3, const double x, const double y )
+{
+        //In circle test: positive = p lies inside the circle (p1, p2, p3) oriented counterclockwise, negative = outside, zero = cocircular points
+        const double dx1 = x1 - x, dy1 = y1 - y;
+        const double dx2 = x2 - x, dy2 = y2 - y;
+        const double dx3 = x3 - x, dy3 = y3 - y;
+
+        const double dx2dy3 = dx2 * dy3, dx3dy2 = dx3 * dy2, lift1 = dx1 * dx1 + dy1 * dy1;
+        const double dx3dy1 = dx3 * dy1, dx1dy3 = dx1 * dy3, lift2 = dx2 * dx2 + dy2 * dy2;
+        const double dx1dy2 = dx1 * dy2, dx2dy1 = dx2 * dy1, lift3 = dx3 * dx3 + dy3 * dy3;
+
+        const double det = lift1 * ( dx2dy3 - dx3dy2 ) + lift2 * ( dx3dy1 - dx1dy3 ) + lift3 * ( dx1dy2 - dx2dy1 );
+
+        //Floating point filter
+        const double permanent = ( fabs ( dx2dy3 ) + fabs ( dx3dy2 ) ) * lift1 + ( fabs ( dx3dy1 ) + fabs ( dx1dy3 ) ) * lift2 + ( fabs ( dx1dy2 ) + fabs ( dx2dy1 ) ) * lift3;
+        const double err_bound = icc_err_bound_A * permanent;
+
+        if ( ( det > err_bound ) || ( -det > err_bound ) )
+        {
+                return det;
+        }
+
+        //Exact evaluation
+        getThreadCounts() -> in_circles++;
+
+        return getInCircleExact ( x1, y1, x2, y2, x3, y3, x, y );
+}
+
+
+unsigned long RobustPredicates::getExactOrientationsCount()
+{
+        //Sum the counts of all threads
+        unsigned long count = 0;
+
+#ifdef _OPENMP
+        #pragma omp critical ( RobustPredicates )
+#endif
+        {
+                const std::vector <TExactCounts *> & counts = getAllCounts();
+
+                for ( unsigned int i = 0; i < counts.size(); i++ ) count += counts[i] -> orientations;
+        }
+
+        return count;
+}
+
+
+unsigned long RobustPredicates::getExactInCirclesCount()
+{
+        //Sum the counts of all threads
+        unsigned long count = 0;
+
+#ifdef _OPENMP
+        #pragma omp critical ( RobustPredicates )
+#endif
+        {
+                const std::vector <TExactCounts *> & counts = getAllCounts();
+
+                for ( unsigned int i = 0; i < counts.size(); i++ ) count += counts[i] -> in_circles;
+        }
+
+        return count;
+}
+
+
+void RobustPredicates::resetExactCounts()
+{
+        //Reset counts of all threads, no predicate may be evaluated at the same time
+#ifdef _OPENMP
+        #pragma omp critical ( RobustPredicates )
+#endif
+        {
+                const std::vector <TExactCounts *> & counts = getAllCounts();
+
+                for ( unsigned int i = 0; i < counts.size(); i++ ) counts[i] -> orientations = counts[i] -> in_circles = 0;
+        }
+}
+
+
+double RobustPredicates::getOrientation2DAdapt ( const double x1, const double y1, const double x2, const double y2, const double x3, const double y3, const double det_sum )
+{
+        //Adaptive orientation test: the determinant of the rounded differences is computed exactly, then the rounding errors
+        //of the differences are added as a first order correction, the fully exact determinant is computed only if it is necessary
+        const double dx13 = x1 - x3, dx23 = x2 - x3;
+        const double dy13 = y1 - y3, dy23 = y2 - y3;
+
+        //Exact determinant of the rounded differences
+        double left[2], right[2], b[4];
+        twoProduct ( dx13, dy23, left[1], left[0] );
+        twoProduct ( -dy13, dx23, right[1], right[0] );
+        const unsigned int b_length = sumExpansions ( 2, left, 2, right, b );
+
+        double det = estimate ( b_length, b );
+        double err_bound = ccw_err_bound_B * det_sum;
+
+        if ( ( det >= err_bound ) || ( -det >= err_bound ) )
+        {
+                return det;
+        }
+
+        //Rounding errors of the differences
+        const double dx13_tail = getDiffTail ( x1, x3, dx13 ), dx23_tail = getDiffTail ( x2, x3, dx23 );
+        const double dy13_tail = getDiffTail ( y1, y3, dy13 ), dy23_tail = getDiffTail ( y2, y3, dy23 );
+
+        //Differences are exact: the determinant is exact
+        if ( ( dx13_tail == 0 ) && ( dy13_tail == 0 ) && ( dx23_tail == 0 ) && ( dy23_tail == 0 ) )
+        {
+                return det;
+        }
+
+        //First order correction
+        err_bound = ccw_err_bound_C * det_sum + result_err_bound * fabs ( det );
+        det += ( dx13 * dy23_tail + dy23 * dx13_tail ) - ( dy13 * dx23_tail + dx23 * dy13_tail );
+
+        if ( ( det >= err_bound ) || ( -det >= err_bound ) )
+        {
+                return det;
+        }
+
+        //Exact determinant: add products of the tails
+        double u[4], c1[8], c2[12], d[16];
+        twoProduct ( dx13_tail, dy23, left[1], left[0] );
+        twoProduct ( -dy13_tail, dx23, right[1], right[0] );
+        unsigned int u_length = sumExpansions ( 2, left, 2, right, u );
+        const unsigned int c1_length = sumExpansions ( b_length, b, u_length, u, c1 );
+
+        twoProduct ( dx13, dy23_tail, left[1], left[0] );
+        twoProduct ( -dy13, dx23_tail, right[1], right[0] );
+        u_length = sumExpansions ( 2, left, 2, right, u );
+        const unsigned int c2_length = sumExpansions ( c1_length, c1, u_length, u, c2 );
+
+        twoProduct ( dx13_tail, dy23_tail, left[1], left[0] );
+        twoProduct ( -dy13_tail, dx23_tail, right[1], right[0] );
+        u_length = sumExpansions ( 2, left, 2, right, u );
+        const unsigned int d_length = sumExpansions ( c2_length, c2, u_length, u, d );
+
+        //The largest component has the sign of the expansion
+        return d[d_length - 1];
+}
+
+
+double RobustPredicates::getInCircleExact ( const double x1, const double y1, const double x2, const double y2, const double x3, const double y3, const double x, const double y )
+{
+        //Exact in circle test: differences are represented by expansions of the length 1 or 2 (exact differences), so that the length
+        //of all expansions and the cost of the evaluation adapt to the input data
+        double dx1[2], dy1[2], dx2[2], dy2[2], dx3[2], dy3[2];
+        const unsigned int dx1_length = growExpansion ( 1, &x1, -x, dx1 ), dy1_length = growExpansion ( 1, &y1, -y, dy1 );
+        const unsigned int dx2_length = growExpansion ( 1, &x2, -x, dx2 ), dy2_length = growExpansion ( 1, &y2, -y, dy2 );
+        const unsigned int dx3_length = growExpansion ( 1, &x3, -x, dx3 ), dy3_length = growExpansion ( 1, &y3, -y, dy3 );
+
+        //Products of the differences (at most 8 components) and the 2x2 determinants (at most 16 components)
+        double t1[8], t2[8], d23[16], d31[16], d12[16];
+        unsigned int t1_length = multiplyExpansions ( dx2_length, dx2, dy3_length, dy3, t1 );
+        unsigned int t2_length = multiplyExpansions ( dx3_length, dx3, dy2_length, dy2, t2 );
+        for ( unsigned int i = 0; i < t2_length; i++ ) t2[i] = -t2[i];
+        const unsigned int d23_length = sumExpansions ( t1_length, t1, t2_length, t2, d23 );
+
+        t1_length = multiplyExpansions ( dx3_length, dx3, dy1_length, dy1, t1 );
+        t2_length = multiplyExpansions ( dx1_length, dx1, dy3_length, dy3, t2 );
+        for ( unsigned int i = 0; i < t2_length; i++ ) t2[i] = -t2[i];
+        const unsigned int d31_length = sumExpansions ( t1_length, t1, t2_length, t2, d31 );
+
+        t1_length = multiplyExpansions ( dx1_length, dx1, dy2_length, dy2, t1 );
+        t2_length = multiplyExpansions ( dx2_length, dx2, dy1_length, dy1, t2 );
+        for ( unsigned int i = 0; i < t2_length; i++ ) t2[i] = -t2[i];
+        const unsigned int d12_length = sumExpansions ( t1_length, t1, t2_length, t2, d12 );
+
+        //Lifted coordinates (at most 16 components)
+        double lift1[16], lift2[16], lift3[16];
+        t1_length = multiplyExpansions ( dx1_length, dx1, dx1_length, dx1, t1 );
+        t2_length = multiplyExpansions ( dy1_length, dy1, dy1_length, dy1, t2 );
+        const unsigned int lift1_length = sumExpansions ( t1_length, t1, t2_length, t2, lift1 );
+
+        t1_length = multiplyExpansions ( dx2_length, dx2, dx2_length, dx2, t1 );
+        t2_length = multiplyExpansions ( dy2_length, dy2, dy2_length, dy2, t2 );
+        const unsigned int lift2_length = sumExpansions ( t1_length, t1, t2_length, t2, lift2 );
+
+        t1_length = multiplyExpansions ( dx3_length, dx3, dx3_length, dx3, t1 );
+        t2_length = multiplyExpansions ( dy3_length, dy3, dy3_length, dy3, t2 );
+        const unsigned int lift3_length = sumExpansions ( t1_length, t1, t2_length, t2, lift3 );
+
+        //Determinant (at most 3 * 512 components)
+        double det1[512], det2[512], det3[512], det[1536];
+        const unsigned int det1_length = multiplyExpansions ( lift1_length, lift1, d23_length, d23, det1 );
+        const unsigned int det2_length = multiplyExpansions ( lift2_length, lift2, d31_length, d31, det2 );
+        const unsigned int det3_length = multiplyExpansions ( lift3_length, lift3, d12_length, d12, det3 );
+
+        unsigned int det_length = sumExpansions ( det1_length, det1, det2_length, det2, det );
+        det_length = sumExpansions ( det_length, det, det3_length, det3, det );
+
+        //The largest component has the sign of the expansion
+        return det[det_length - 1];
+}
+
+
+void RobustPredicates::twoSum ( const double a, const double b, double &x, double &y )
+{
+        //Exact sum a + b = x + y
+        x = a + b;
+        const double b_virt = x - a;
+        const double a_virt = x - b_virt;
+        y = ( a - a_virt ) + ( b - b_virt );
+}
+
+
+void RobustPredicates::fastTwoSum ( const double a, const double b, double &x, double &y )
+{
+        //Exact sum a + b = x + y, |a| >= |b|
+        x = a + b;
+        y = b - ( x - a );
+}
+
+
+double RobustPredicates::getDiffTail ( const double a, const double b, const double x )
+{
+        //Rounding error of the difference x = a - b
+        const double b_virt = a - x;
+        const double a_virt = x + b_virt;
+        return ( a - a_virt ) + ( b_virt - b );
+}
+
+
+void RobustPredicates::split ( const double a, double &a_hi, double &a_lo )
+{
+        //Split a into two halves having at most 26 significant bits
+        const double c = splitter * a;
+        const double a_big = c - a;
+        a_hi = c - a_big;
+        a_lo = a - a_hi;
+}
+
+
+void RobustPredicates::twoProduct ( const double a, const double b, double &x, double &y )
+{
+        //Exact product a * b = x + y
+        double a_hi, a_lo, b_hi, b_lo;
+        x = a * b;
+        split ( a, a_hi, a_lo );
+        split ( b, b_hi, b_lo );
+        const double err1 = x - ( a_hi * b_hi );
+        const double err2 = err1 - ( a_lo * b_hi );
+        const double err3 = err2 - ( a_hi * b_lo );
+        y = ( a_lo * b_lo ) - err3;
+}
+
+
+unsigned int RobustPredicates::growExpansion ( const unsigned int n, const double * e, const double b, double * h )
+{
+        //Add the scalar b to the expansion e, zero components are eliminated, h may be identical to e
+        double q = b;
+        unsigned int h_length = 0;
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                double q_new, hh;
+                twoSum ( q, e[i], q_new, hh );
+                q = q_new;
+
+                if ( hh != 0 ) h[h_length++] = hh;
+        }
+
+        if ( ( q != 0 ) || ( h_length == 0 ) ) h[h_length++] = q;
+
+        return h_length;
+}
+
+
+unsigned int RobustPredicates::sumExpansions ( const unsigned int m, const double * e, const unsigned int n, const double * f, double * h )
+{
+        //Sum of the expansions e and f, zero components are eliminated, h may be identical to e
+        if ( h != e )
+        {
+                for ( unsigned int i = 0; i < m; i++ ) h[i] = e[i];
+        }
+
+        unsigned int h_length = m;
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                h_length = growExpansion ( h_length, h, f[i], h );
+        }
+
+        return h_length;
+}
+
+
+unsigned int RobustPredicates::scaleExpansion ( const unsigned int n, const double * e, const double b, double * h )
+{
+        //Multiply the expansion e by the scalar b, zero components are eliminated, at most 2n components
+        double q, hh, product_hi, product_lo, sum;
+        unsigned int h_length = 0;
+
+        twoProduct ( e[0], b, q, hh );
+
+        if ( hh != 0 ) h[h_length++] = hh;
+
+        for ( unsigned int i = 1; i < n; i++ )
+        {
+                twoProduct ( e[i], b, product_hi, product_lo );
+
+                twoSum ( q, product_lo, sum, hh );
+                if ( hh != 0 ) h[h_length++] = hh;
+
+                fastTwoSum ( product_hi, sum, q, hh );
+                if ( hh != 0 ) h[h_length++] = hh;
+        }
+
+        if ( ( q != 0 ) || ( h_length == 0 ) ) h[h_length++] = q;
+
+        return h_length;
+}
+
+
+unsigned int RobustPredicates::multiplyExpansions ( const unsigned int m, const double * e, const unsigned int n, const double * f, double * h )
+{
+        //Product of the expansions e and f as a sum of e scaled by the components of f, at most 2mn components
+        std::vector <double> scaled ( 2 * m );
+
+        unsigned int h_length = scaleExpansion ( m, e, f[0], h );
+
+        for ( unsigned int i = 1; i < n; i++ )
+        {
+                const unsigned int scaled_length = scaleExpansion ( m, e, f[i], &scaled[0] );
+                h_length = sumExpansions ( h_length, h, scaled_length, &scaled[0], h );
+        }
+
+        return h_length;
+}
+
+
+double RobustPredicates::estimate ( const unsigned int n, const double * e )
+{
+        //Approximate value of the expansion
+        double q = e[0];
+
+        for ( unsigned int i = 1; i < n; i++ ) q += e[i];
+
+        return q;
+}
@@ -0,0 +1,70 @@
+// Description: Robust adaptive precision orientation and in-circle predicates
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef RobustPredicates_H
+#define RobustPredicates_H
+
+
+//Forward declaration
+template <typename T>
+class Point3DCartesian;
+
+
+//Adaptive precision orientation and in-circle predicates (Shewchuk, 1997)
+//The determinants are evaluated in floating point arithmetic first, an exact evaluation using floating point expansions
+//is performed only if the error bound does not guarantee the sign. Coordinates are converted to double.
+class RobustPredicates
+{
+        public:
+                template <typename T>
+                static double getOrientation2D ( const Point3DCartesian <T> * p1, const Point3DCartesian <T> * p2, const Point3DCartesian <T> * p3 );
+
+                template <typename T>
+                static double getInCircle ( const Point3DCartesian <T> * p1, const Point3DCartesian <T> * p2, const Point3DCartesian <T> * p3, const Point3DCartesian <T> * p );
+
+                static double getOrientation2D ( const double x1, const double y1, const double x2, const double y2, const double x3, const double y3 );
+                static double getInCircle ( const double x1, const double y1, const double x2, const double y2, const double x3, const double y3, const double x, const double y );
+
+                //Counts of the exact evaluations are kept by each thread and summed on read
+                static unsigned long getExactOrientationsCount();
+                static unsigned long getExactInCirclesCount();
+                static void resetExactCounts();
+
+        private:
+                static double getOrientation2DAdapt ( const double x1, const double y1, const double x2, const double y2, const double x3, const double y3, const double det_sum );
+                static double getInCircleExact ( const double x1, const double y1, const double x2, const double y2, const double x3, const double y3, const double x, const double y );
+
+                static void twoSum ( const double a, const double b, double &x, double &y );
+                static void fastTwoSum ( const double a, const double b, double &x, double &y );
+                static double getDiffTail ( const double a, const double b, const double x );
+                static void split ( const double a, double &a_hi, double &a_lo );
+                static void twoProduct ( const double a, const double b, double &x, double &y );
+
+                static unsigned int growExpansion ( const unsigned int n, const double * e, const double b, double * h );
+                static unsigned int sumExpansions ( const unsigned int m, const double * e, const unsigned int n, const double * f, double * h );
+                static unsigned int scaleExpansion ( const unsigned int n, const double * e, const double b, double * h );
+                static unsigned int multiplyExpansions ( const unsigned int m, const double * e, const unsigned int n, const double * f, double * h );
+                static double estimate ( const unsigned int n, const double * e );
+};
+
+#include "RobustPredicates.hpp"
+
+#endif
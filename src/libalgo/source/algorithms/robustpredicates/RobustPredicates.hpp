@@ -0,0 +1,43 @@
+// Description: Robust adaptive precision orientation and in-circle predicates
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef RobustPredicates_HPP
+#define RobustPredicates_HPP
+
+#include "libalgo/source/structures/point/Point3DCartesian.h"
+
+
+template <typename T>
+double RobustPredicates::getOrientation2D ( const Point3DCartesian <T> * p1, const Point3DCartesian <T> * p2, const Point3DCartesian <T> * p3 )
+{
+        //Orientation of the points: positive = counterclockwise, negative = clockwise, zero = colinear (sign is exact)
+        return getOrientation2D ( ( double ) p1->getX(), ( double ) p1->getY(), ( double ) p2->getX(), ( double ) p2->getY(), ( double ) p3->getX(), ( double ) p3->getY() );
+}
+
+
+template <typename T>
+double RobustPredicates::getInCircle ( const Point3DCartesian <T> * p1, const Point3DCartesian <T> * p2, const Point3DCartesian <T> * p3, const Point3DCartesian <T> * p )
+{
+        //In circle test: positive = p lies inside the circle (p1, p2, p3) oriented counterclockwise, negative = outside, zero = cocircular points (sign is exact)
+        return getInCircle ( ( double ) p1->getX(), ( double ) p1->getY(), ( double ) p2->getX(), ( double ) p2->getY(), ( double ) p3->getX(), ( double ) p3->getY(), ( double ) p->getX(), ( double ) p->getY() );
+}
+
+#endif
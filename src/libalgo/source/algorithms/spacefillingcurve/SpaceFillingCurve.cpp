@@ -0,0 +1,64 @@
+// Description: Space filling curves, spatial sorting of points
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#include "SpaceFillingCurve.h"
+
+#include <algorithm>
+
+
+unsigned int SpaceFillingCurve::getHilbertCode ( unsigned int x, unsigned int y )
+{
+        //Distance of the cell (x, y) along the Hilbert curve of the order HILBERT_CURVE_ORDER
+        const unsigned int n = 1 << HILBERT_CURVE_ORDER;
+        unsigned int d = 0;
+
+        for ( unsigned int s = n / 2; s > 0; s /= 2 )
+        {
+                const unsigned int rx = ( x & s ) > 0;
+                const unsigned int ry = ( y & s ) > 0;
+
+                d += s * s * ( ( 3 * rx ) ^ ry );
+
+                //Rotate the quadrant
+                if ( ry == 0 )
+                {
+                        if ( rx == 1 )
+                        {
+                                x = n - 1 - x;
+                                y = n - 1 - y;
+                        }
+
+                        std::swap ( x, y );
+                }
+        }
+
+        return d;
+}
+
+
+std::ptrdiff_t SpaceFillingCurve::TRandomGenerator::operator() ( const std::ptrdiff_t n )
+{
+        //Random number from the interval <0, n)
+        state = 1664525 * state + 1013904223;
+
+        return ( std::ptrdiff_t ) ( ( state >> 8 ) % ( unsigned int ) n );
+}
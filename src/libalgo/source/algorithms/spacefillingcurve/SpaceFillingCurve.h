@@ -0,0 +1,67 @@
+// Description: Space filling curves, spatial sorting of points
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef SpaceFillingCurve_H
+#define SpaceFillingCurve_H
+
+#include <cstddef>
+#include <vector>
+
+
+//Order of the Hilbert curve: cells of the 2^16 x 2^16 grid are numbered by 32-bit codes
+#define HILBERT_CURVE_ORDER			16
+
+
+//Spatial sorting of points along the Hilbert curve, biased randomized insertion order (BRIO)
+class SpaceFillingCurve
+{
+        public:
+                static unsigned int getHilbertCode ( unsigned int x, unsigned int y );
+
+                template <typename Point>
+                static unsigned int getHilbertCode ( const Point * p, const typename Point::Type xmin, const typename Point::Type ymin, const typename Point::Type xmax, const typename Point::Type ymax );
+
+                template <typename Iterator, typename T>
+                static void getHilbertOrder ( Iterator it_begin, Iterator it_end, const T xmin, const T ymin, const T xmax, const T ymax, std::vector <unsigned int> &order );
+
+                template <typename Iterator, typename T>
+                static void sortPointsHilbert ( Iterator it_begin, Iterator it_end, const T xmin, const T ymin, const T xmax, const T ymax );
+
+                template <typename Iterator, typename T>
+                static void sortPointsBRIO ( Iterator it_begin, Iterator it_end, const T xmin, const T ymin, const T xmax, const T ymax, const unsigned int seed = 1 );
+
+        private:
+                //Linear congruential generator used for the reproducible shuffle of points
+                class TRandomGenerator
+                {
+                        private:
+                                unsigned int state;
+
+                        public:
+                                TRandomGenerator ( const unsigned int seed ) : state ( seed ) {}
+                                std::ptrdiff_t operator() ( const std::ptrdiff_t n );
+                };
+};
+
+#include "SpaceFillingCurve.hpp"
+
+#endif
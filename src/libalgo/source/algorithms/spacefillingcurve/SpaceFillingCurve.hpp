@@ -0,0 +1,116 @@
+// Description: Space filling curves, spatial sorting of points
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef SpaceFillingCurve_HPP
+#define SpaceFillingCurve_HPP
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+
+#include "libalgo/source/const/Const.h"
+
+
+template <typename Point>
+unsigned int SpaceFillingCurve::getHilbertCode ( const Point * p, const typename Point::Type xmin, const typename Point::Type ymin, const typename Point::Type xmax, const typename Point::Type ymax )
+{
+        //Hilbert code of the point inside the min-max box (xmin, ymin, xmax, ymax)
+        const typename Point::Type dmax = ( std::max ) ( xmax - xmin, ymax - ymin );
+        const double scale = ( dmax > 0 ? ( ( 1 << HILBERT_CURVE_ORDER ) - 1 ) / ( double ) dmax : 0.0 );
+
+        //Grid cell of the point, points outside the box are moved to the border
+        const double x = ( std::min ) ( ( std::max ) ( ( p->getX() - xmin ) * scale, 0.0 ), ( double ) ( ( 1 << HILBERT_CURVE_ORDER ) - 1 ) );
+        const double y = ( std::min ) ( ( std::max ) ( ( p->getY() - ymin ) * scale, 0.0 ), ( double ) ( ( 1 << HILBERT_CURVE_ORDER ) - 1 ) );
+
+        return getHilbertCode ( ( unsigned int ) x, ( unsigned int ) y );
+}
+
+
+template <typename Iterator, typename T>
+void SpaceFillingCurve::getHilbertOrder ( Iterator it_begin, Iterator it_end, const T xmin, const T ymin, const T xmax, const T ymax, std::vector <unsigned int> &order )
+{
+        //Positions of points sorted along the Hilbert curve, points with the same code keep their order
+        const unsigned int n = std::distance ( it_begin, it_end );
+
+        //Pairs (Hilbert code, position)
+        std::vector <std::pair <unsigned int, unsigned int> > codes ( n );
+
+        for ( unsigned int i = 0; i < n; i++, ++it_begin )
+        {
+                codes[i] = std::make_pair ( getHilbertCode ( *it_begin, xmin, ymin, xmax, ymax ), i );
+        }
+
+        std::sort ( codes.begin(), codes.end() );
+
+        order.resize ( n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                order[i] = codes[i].second;
+        }
+}
+
+
+template <typename Iterator, typename T>
+void SpaceFillingCurve::sortPointsHilbert ( Iterator it_begin, Iterator it_end, const T xmin, const T ymin, const T xmax, const T ymax )
+{
+        //Sort points along the Hilbert curve, points with the same code keep their order
+        typedef typename std::iterator_traits <Iterator>::value_type TPoint;
+        const unsigned int n = std::distance ( it_begin, it_end );
+
+        std::vector <unsigned int> order;
+        getHilbertOrder ( it_begin, it_end, xmin, ymin, xmax, ymax, order );
+
+        //Reorder points
+        std::vector <TPoint> points ( it_begin, it_end );
+
+        for ( unsigned int i = 0; i < n; i++, ++it_begin )
+        {
+                *it_begin = points[order[i]];
+        }
+}
+
+
+template <typename Iterator, typename T>
+void SpaceFillingCurve::sortPointsBRIO ( Iterator it_begin, Iterator it_end, const T xmin, const T ymin, const T xmax, const T ymax, const unsigned int seed )
+{
+        //Biased randomized insertion order (Amenta, Choi, Rote, 2003): points are shuffled and divided
+        //into rounds, each round is twice as large as the previous one and sorted along the Hilbert curve
+        const unsigned int n = std::distance ( it_begin, it_end );
+
+        TRandomGenerator generator ( seed );
+        std::random_shuffle ( it_begin, it_end, generator );
+
+        //Last round contains one half of points, the previous one quarter, etc.
+        unsigned int round_end = n;
+
+        while ( round_end > 0 )
+        {
+                const unsigned int round_start = ( round_end > BRIO_MIN_ROUND_SIZE ? round_end / 2 : 0 );
+
+                sortPointsHilbert ( it_begin + round_start, it_begin + round_end, xmin, ymin, xmax, ymax );
+
+                round_end = round_start;
+        }
+}
+
+#endif
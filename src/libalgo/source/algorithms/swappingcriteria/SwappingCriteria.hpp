@@ -26,9 +26,10 @@
 
 #include "libalgo/source/structures/point/Node3DCartesian.h"
 
+#include "libalgo/source/algorithms/robustpredicates/RobustPredicates.h"
+
 #include "libalgo/source/exceptions/ErrorMathZeroDevision.h"
 #include "libalgo/source/exceptions/ErrorMathInvalidArgument.h"
-#include "libalgo/source/exceptions/ErrorBadData.h"
 
 using namespace std;
 
@@ -168,44 +169,9 @@ template <typename T>
 bool SwappingCriteria::getClineRenka ( const Node3DCartesian <T> *p, const Node3DCartesian <T> *p1, const Node3DCartesian <T> *p2, const Node3DCartesian <T> *p3 )
 {
         //Cline-Renka legality test: true, if quadrilateral illegal (it needs to be swapped)
-        const T	x4 = p->getX();		// Tested point
-        const T	y4 = p->getY();		// Tested point
-
-        //Points coiunter clock wise oriented
-        const T	x1 = p1->getX();	// First vertex in triangle adjacent to legalized
-        const T	y1 = p1->getY();	// First vertex in triangle adjacent to legalized
-        const T	x2 = p2->getX();	// Second vertex in triangle adjacent to legalized
-        const T	y2 = p2->getY();	// Second vertex in triangle adjacent to legalized
-        const T	x3 = p3->getX();	// Third vertex in triangle adjacent to legalized
-        const T	y3 = p3->getY();	// Third vertex in triangle adjacent to legalized
-
-        //Cline-Renka test
-        T cos_a = ( x1 - x3 ) * ( x2 - x3 ) + ( y1 - y3 ) * ( y2 - y3 ) ;
-        T cos_b = ( x2 - x4 ) * ( x1 - x4 ) + ( y2 - y4 ) * ( y1 - y4 ) ;
-
-        //Triangle is legal: swap = false
-        if ( ( cos_a >= 0 ) && ( cos_b >= 0 ) )
-        {
-                return false;
-        }
-
-        //Triangle is illegal: swap = true
-        if ( ( cos_a < 0 ) && ( cos_b < 0 ) )
-        {
-                return true;
-        }
-
-        T sin_ab = ( ( x1 - x3 ) * ( y2 - y3 ) - ( x2 - x3 ) * ( y1 - y3 ) ) * cos_b +
-                   ( ( x2 - x4 ) * ( y1 - y4 ) - ( x1 - x4 ) * ( y2 - y4 ) ) * cos_a;
-
-        //Triangle is illegal: swap = true
-        if ( sin_ab < 0 )
-        {
-                return true;
-        }
-
-        //Triangle is legal: swap = false
-        return false;
+        //Points p1, p2, p3 are counterclockwise oriented, sum of the angles at p3 and p exceeds 180 deg, if p lies inside the circle (p1, p2, p3)
+        //The exact in circle predicate is used, the quadrilateral of cocircular points is legal
+        return RobustPredicates::getInCircle ( p1, p2, p3, p ) > 0;
 }
 
 
@@ -214,34 +180,8 @@ T SwappingCriteria::getEmptyCircleTest ( const Node3DCartesian <T> *p, const Nod
 {
         //Modified empty circle test by Okabe, 2000
         //Test legality of Delaunay triangle and point, also used in incremental construction of Voronoi diagram
-        const T	x4 = p->getX();		// Test point
-        const T	y4 = p->getY();		// Test point
-
-        //Points counter clock wise oriented
-        const T	x1 = p1->getX();	// First vertex in triangle adjacent to legalized
-        const T	y1 = p1->getY();	// First vertex in triangle adjacent to legalized
-        const T	x2 = p2->getX();	// Second vertex in triangle adjacent to legalized
-        const T	y2 = p2->getY();	// Second vertex in triangle adjacent to legalized
-        const T	x3 = p3->getX();	// Third vertex in triangle adjacent to legalized
-        const T	y3 = p3->getY();	// Third vertex in triangle adjacent to legalized
-
-        //Are not 2 points identical?
-        if ( *p1 == *p2 || *p1 == *p3 || *p2 == *p3 )
-        {
-                throw ErrorBadData ( "ErrorBadData, can not compute empty circle test", "2 points are identical" );
-        }
-
-        //First determinant
-        const T Jijk2 = ( y1 - y3 ) * ( ( x2 - x3 ) * ( x2 - x3 ) + ( y2 - y3 ) * ( y2 - y3 ) ) - ( ( x1 - x3 ) * ( x1 - x3 ) + ( y1 - y3 ) * ( y1 - y3 ) ) * ( y2 - y3 );
-
-        //Second determinant
-        const T Jijk3 = ( x1 - x3 ) * ( ( x2 - x3 ) * ( x2 - x3 ) + ( y2 - y3 ) * ( y2 - y3 ) ) - ( ( x1 - x3 ) * ( x1 - x3 ) + ( y1 - y3 ) * ( y1 - y3 ) ) * ( x2 - x3 );
-
-        //Third determinant
-        const T Jijk4 = ( x1 - x3 ) * ( y2 - y3 ) - ( y1 - y3 ) * ( x2 - x3 );
-
-        //Criterion
-        return  Jijk2 * ( x4 - x3 ) - Jijk3 * ( y4 - y3 ) + Jijk4 * ( ( x4 - x3 ) * ( x4 - x3 ) + ( y4 - y3 ) * ( y4 - y3 ) );
+        //Points p1, p2, p3 are counterclockwise oriented: negative = p lies inside the circle, positive = outside, zero = cocircular points (sign is exact)
+        return ( T ) ( - RobustPredicates::getInCircle ( p1, p2, p3, p ) );
 }
 
 #endif
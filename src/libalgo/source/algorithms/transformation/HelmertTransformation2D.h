@@ -25,6 +25,7 @@
 #include <vector>
 
 #include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/PointArray.h"
 
 //Transformation key
 template <typename T>
@@ -72,6 +73,15 @@ class HelmertTransformation2D
                 static void transform ( const Container <Point1 *, destructable> &global_points, const Container <Point2 *, destructable2> &local_points, Container <Point3 *, destructable3> &transformed_points,
                                         const TTransformationKeyHelmert2D <typename Point1::Type> & key_helmert );
 
+                template <typename T>
+                static void getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, TTransformationKeyHelmert2D <T> &key_helmert );
+
+                template <typename T>
+                static void getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, typename TWeights <T> ::Type & weights, TTransformationKeyHelmert2D <T> &key_helmert );
+
+                template <typename T>
+                static void transform ( const PointArray <T> &local_points, PointArray <T> &transformed_points, const TTransformationKeyHelmert2D <T> &key_helmert );
+
 		template <typename T>
 		static Matrix <T> getTransformKey(const Matrix <T> &P, const Matrix <T> &Q, const Matrix <T> &W);
 
@@ -28,6 +28,7 @@
 #include "libalgo/source/structures/point/Point3DCartesian.h"
 
 #include "libalgo/source/algorithms/matrixoperations/MatrixOperations.h"
+#include "libalgo/source/algorithms/matrixoperations/MatrixFactorization.h"
 
 #include "libalgo/source/exceptions/ErrorBadData.h"
 #include "libalgo/source/exceptions/ErrorMathZeroDevision.h"
@@ -165,6 +166,107 @@ void HelmertTransformation2D::transform ( const Container <Point1 *, destructabl
 }
 
 
+template <typename T>
+void HelmertTransformation2D::getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, TTransformationKeyHelmert2D <T> &key_helmert )
+{
+        //Get transformation key: non weighted 2D Helmert transformation of points stored in arrays
+        typename TWeights <T> ::Type weights ( global_points.size(), 1.0 );
+        getTransformKey ( global_points, local_points, weights, key_helmert );
+}
+
+
+template <typename T>
+void HelmertTransformation2D::getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, typename TWeights <T> ::Type & weights, TTransformationKeyHelmert2D <T> &key_helmert )
+{
+        //Get transformation key for weighted transformation of points stored in arrays
+        const unsigned int n_global = global_points.size(), n_local = local_points.size();
+
+        //Not enough points
+        if ( ( n_global < 2 ) || ( n_local < 2 ) )
+        {
+                throw  ErrorBadData ( "ErrorBadData: not enough points. ", "Can not compute Helmert 2D transformation key. \n" );
+        }
+
+        //Less local points
+        if ( n_global > n_local )
+        {
+                throw  ErrorBadData ( "ErrorBadData: less local points than global points. ", "Can not compute Helmert 2D transformation key. \n" );
+        }
+
+        const T * xl = local_points.getX(), * yl = local_points.getY(), * xg = global_points.getX(), * yg = global_points.getY(), * w = &weights[0];
+
+        //Compute sums of coordinates, weights
+        T sumx_local = 0, sumy_local = 0, sumx_global = 0, sumy_global = 0, sum_weights = 0;
+
+        for ( unsigned int i = 0; i < n_global; i++ )
+        {
+                sumx_local += w[i] * xl[i];
+                sumy_local += w[i] * yl[i];
+                sumx_global += w[i] * xg[i];
+                sumy_global += w[i] * yg[i];
+                sum_weights += w[i];
+        }
+
+        //Compute center of mass
+        key_helmert.x_mass_local = sumx_local / sum_weights;
+        key_helmert.y_mass_local = sumy_local / sum_weights;
+        key_helmert.x_mass_global = sumx_global / sum_weights;
+        key_helmert.y_mass_global = sumy_global / sum_weights;
+
+        //Remeber k
+        key_helmert.k = sum_weights;
+
+        //Compute coefficients of transformation from the reduced coordinates
+        const T x_mass_local = key_helmert.x_mass_local, y_mass_local = key_helmert.y_mass_local, x_mass_global = key_helmert.x_mass_global, y_mass_global = key_helmert.y_mass_global;
+        T J = 0, k1 = 0, k2 = 0;
+
+        for ( unsigned int i = 0; i < n_global; i++ )
+        {
+                const T x_red_local = xl[i] - x_mass_local, y_red_local = yl[i] - y_mass_local, xred_global = xg[i] - x_mass_global, yred_global = yg[i] - y_mass_global;
+
+                J += w[i] * ( x_red_local * x_red_local + y_red_local * y_red_local );
+                k1 += w[i] * ( xred_global * x_red_local + yred_global * y_red_local );
+                k2 += w[i] * ( yred_global * x_red_local - xred_global * y_red_local );
+        }
+
+        key_helmert.J = J;
+
+        //Throw exception
+        if ( key_helmert.J == 0 )
+        {
+                throw  ErrorMathZeroDevision <T> ( "ErrorMathZeroDevision: can not compute Helmert 2D transformation key, ", " divider = 0.", key_helmert.J );
+        }
+
+        //Transformation coefficients
+        key_helmert.c1 = k1 / key_helmert.J;
+        key_helmert.c2 = k2 / key_helmert.J;
+}
+
+
+template <typename T>
+void HelmertTransformation2D::transform ( const PointArray <T> &local_points, PointArray <T> &transformed_points, const TTransformationKeyHelmert2D <T> &key_helmert )
+{
+        //Transform all points stored in the array using 2D Helmert transformation, the transformed array may be the local one
+        const unsigned int n = local_points.size();
+
+        transformed_points.resize ( n );
+
+        const T * xl = local_points.getX(), * yl = local_points.getY();
+        T * xt = transformed_points.getX(), * yt = transformed_points.getY();
+
+        const T c1 = key_helmert.c1, c2 = key_helmert.c2;
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                //Reduce coordinates, transform point, add coordinates center of mass
+                const T x_red_local = xl[i] - key_helmert.x_mass_local, y_red_local = yl[i] - key_helmert.y_mass_local;
+
+                xt[i] = c1 * x_red_local - c2 * y_red_local + key_helmert.x_mass_global;
+                yt[i] = c2 * x_red_local + c1 * y_red_local + key_helmert.y_mass_global;
+        }
+}
+
+
 template <typename T>
 Matrix <T> HelmertTransformation2D::getTransformKey(const Matrix <T> &P, const Matrix <T> &Q, const Matrix <T> &W)
 {
@@ -203,23 +305,31 @@ void HelmertTransformation2D::getTransformKey2(const Matrix <T> &P, const Matrix
 	//Helmert transformation, matrix notation
 	const unsigned int m = P.rows(), n = P.cols();
 
-	//Get matrices
-	const Matrix <T> XG = P(0, m - 1, 0, 0);
-	const Matrix <T> YG = P(0, m - 1, 1, 1);
-	const Matrix <T> XL = Q(0, m - 1, 0, 0);
-	const Matrix <T> YL = Q(0, m - 1, 1, 1);
-	const Matrix <T> WX = W(0, m - 1, 0, m - 1);
-	const Matrix <T> WY = W(m, 2 * m - 1, m, 2 * m - 1);
+	//Get views of the coordinates and weights, items are not copied
+	const MatrixView <const T> XG = P.view(0, m - 1, 0, 0);
+	const MatrixView <const T> YG = P.view(0, m - 1, 1, 1);
+	const MatrixView <const T> XL = Q.view(0, m - 1, 0, 0);
+	const MatrixView <const T> YL = Q.view(0, m - 1, 1, 1);
+	const MatrixView <const T> WX = W.view(0, m - 1, 0, m - 1);
+	const MatrixView <const T> WY = W.view(m, 2 * m - 1, m, 2 * m - 1);
 	
 	//Sum of weights
-	const T swx = sum(diag(WX));
-	const T swy = sum(diag(WY));
+	const T swx = sum(WX.diag());
+	const T swy = sum(WY.diag());
 
 	//Centers of gravity
-	const T x_mass_glob = sum( trans( XG ) * WX ) / swx;
-	const T y_mass_glob = sum( trans( YG ) * WY ) / swy;
-	const T x_mass_loc = sum( trans(XL) * WX ) / swx;
-	const T y_mass_loc = sum( trans(YL) * WY ) / swy;
+	Matrix <T> XW(1, m);
+	mult(trans(XG), WX, XW.view());
+	const T x_mass_glob = sum(XW) / swx;
+
+	mult(trans(YG), WY, XW.view());
+	const T y_mass_glob = sum(XW) / swy;
+
+	mult(trans(XL), WX, XW.view());
+	const T x_mass_loc = sum(XW) / swx;
+
+	mult(trans(YL), WY, XW.view());
+	const T y_mass_loc = sum(XW) / swy;
 
 	//Store coordinates
 	C(0, 0) = x_mass_glob;
@@ -228,8 +338,8 @@ void HelmertTransformation2D::getTransformKey2(const Matrix <T> &P, const Matrix
 	C(1, 1) = y_mass_loc;
 
 	//Reduce coordinates
-	const Matrix <T> XLR = XL - x_mass_loc;
-	const Matrix <T> YLR = YL - y_mass_loc;
+	const Matrix <T> XLR = XL.toMatrix() - x_mass_loc;
+	const Matrix <T> YLR = YL.toMatrix() - y_mass_loc;
 
 	//Set elements of A(2m, 4) matrix, applicable to each scheme
 	A.submat(XLR, 0, 0);
@@ -243,11 +353,21 @@ void HelmertTransformation2D::getTransformKey2(const Matrix <T> &P, const Matrix
 	A.submat(I, m, 3);
 
 	//Create Y vector
-	Y.submat(XG, 0, 0);
-	Y.submat(YG, m, 0);
+	Y.view(0, m - 1, 0, 0) = XG;
+	Y.view(m, 2 * m - 1, 0, 0) = YG;
 
-	//Find solution
-	X = inv(trans(A) * W * A) * trans(A) * W  * Y;
+	//Find solution of the normal equations A' * W * A * X = A' * W * Y, A' * W is computed only once
+	const Matrix <T> AW = trans(lazy(A)) * W;
+	const SymmetricMatrix <T> N(AW * A);
+	const Matrix <T> AWY = AW * Y;
+
+	//Cholesky factorization of N, singular matrix: use the pseudoinverse
+	CholeskyFactorization <T> F(N.rows());
+
+	if (F.factorize(N))
+		X = F.solve(AWY);
+	else
+		X = pinv1(N.full()) * AWY;
 
 }
 
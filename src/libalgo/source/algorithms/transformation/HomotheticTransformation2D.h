@@ -24,6 +24,7 @@
 
 
 #include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/PointArray.h"
 
 #include "HelmertTransformation2D.h"
 
@@ -65,6 +66,15 @@ class HomotheticTransformation2D
                 template <typename Point1, typename Point2, typename Point3, TDestructable destructable, TDestructable destructable2, TDestructable destructable3>
                 void static transform ( const Container <Point1 *, destructable> &global_points, const Container <Point2 *, destructable2> &local_points, Container <Point3 *, destructable3> &transformed_points,
                                         const TTransformationKeyHomothetic2D <typename Point1::Type> & key_homothetic );
+
+                template <typename T>
+                static void getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, TTransformationKeyHomothetic2D <T> &key_homothetic );
+
+                template <typename T>
+                static void getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, typename TWeights <T> ::Type & weights, TTransformationKeyHomothetic2D <T> &key_homothetic );
+
+                template <typename T>
+                static void transform ( const PointArray <T> &local_points, PointArray <T> &transformed_points, const TTransformationKeyHomothetic2D <T> &key_homothetic );
 };
 
 #include "HomotheticTransformation2D.hpp"
@@ -56,7 +56,7 @@ template <typename Point1, typename Point2, TDestructable destructable, TDestruc
 void HomotheticTransformation2D::getTransformKey ( const Container <Point1 *, destructable> &global_points, const Container <Point2 *, destructable2> &local_points, TTransformationKeyHomothetic2D <typename Point1::Type> &key_homothetic )
 {
         //Get transformation key: non weighted 2D Homothetic transformation
-        typename TWeights <typename Point1::Type> ::Type weights ( global_points->size(), 1.0 );
+        typename TWeights <typename Point1::Type> ::Type weights ( global_points.size(), 1.0 );
         getTransformKey ( global_points, local_points, weights, key_homothetic );
 }
 
@@ -159,4 +159,103 @@ void HomotheticTransformation2D::transform ( const Container <Point1 *, destruct
         }
 }
 
+
+template <typename T>
+void HomotheticTransformation2D::getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, TTransformationKeyHomothetic2D <T> &key_homothetic )
+{
+        //Get transformation key: non weighted 2D Homothetic transformation of points stored in arrays
+        typename TWeights <T> ::Type weights ( global_points.size(), 1.0 );
+        getTransformKey ( global_points, local_points, weights, key_homothetic );
+}
+
+
+template <typename T>
+void HomotheticTransformation2D::getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, typename TWeights <T> ::Type & weights, TTransformationKeyHomothetic2D <T> &key_homothetic )
+{
+        //Get transformation key for weighted transformation of points stored in arrays
+        const unsigned int n_global = global_points.size(), n_local = local_points.size();
+
+        //Not enough points
+        if ( ( n_global < 2 ) || ( n_local < 2 ) )
+        {
+                throw  ErrorBadData ( "ErrorBadData: not enough points. ", "Can not compute Homothetic 2D transformation key. \n" );
+        }
+
+        //Less local points
+        if ( n_global > n_local )
+        {
+                throw  ErrorBadData ( "ErrorBadData: less local points than global points. ", "Can not compute Homothetic 2D transformation key. \n" );
+        }
+
+        const T * xl = local_points.getX(), * yl = local_points.getY(), * xg = global_points.getX(), * yg = global_points.getY(), * w = &weights[0];
+
+        //Compute sums of coordinates, weights
+        T sumx_local = 0, sumy_local = 0, sumx_global = 0, sumy_global = 0, sum_weights = 0;
+
+        for ( unsigned int i = 0; i < n_global; i++ )
+        {
+                sumx_local += w[i] * xl[i];
+                sumy_local += w[i] * yl[i];
+                sumx_global += w[i] * xg[i];
+                sumy_global += w[i] * yg[i];
+                sum_weights += w[i];
+        }
+
+        //Compute center of mass
+        key_homothetic.x_mass_local = sumx_local / sum_weights;
+        key_homothetic.y_mass_local = sumy_local / sum_weights;
+        key_homothetic.x_mass_global = sumx_global / sum_weights;
+        key_homothetic.y_mass_global = sumy_global / sum_weights;
+
+        //Remeber k
+        key_homothetic.k = sum_weights;
+
+        //Compute coefficients of transformation from the reduced coordinates
+        const T x_mass_local = key_homothetic.x_mass_local, y_mass_local = key_homothetic.y_mass_local, x_mass_global = key_homothetic.x_mass_global, y_mass_global = key_homothetic.y_mass_global;
+        T J = 0, k = 0;
+
+        for ( unsigned int i = 0; i < n_global; i++ )
+        {
+                const T x_red_local = xl[i] - x_mass_local, y_red_local = yl[i] - y_mass_local, xred_global = xg[i] - x_mass_global, yred_global = yg[i] - y_mass_global;
+
+                J += w[i] * ( x_red_local * x_red_local + y_red_local * y_red_local );
+                k += w[i] * ( xred_global * x_red_local + yred_global * y_red_local );
+        }
+
+        key_homothetic.J = J;
+
+        //Throw exception
+        if ( key_homothetic.J == 0 )
+        {
+                throw  ErrorMathZeroDevision <T> ( "ErrorMathZeroDevision: can not compute Homothetic 2D transformation, ", " divider = ", key_homothetic.J );
+        }
+
+        //Transformation coefficient: only scale
+        key_homothetic.c = fabs ( k ) / key_homothetic.J;
+}
+
+
+template <typename T>
+void HomotheticTransformation2D::transform ( const PointArray <T> &local_points, PointArray <T> &transformed_points, const TTransformationKeyHomothetic2D <T> &key_homothetic )
+{
+        //Transform all points stored in the array using 2D Homothetic transformation, the transformed array may be the local one
+        const unsigned int n = local_points.size();
+
+        transformed_points.resize ( n );
+
+        const T * xl = local_points.getX(), * yl = local_points.getY();
+        T * xt = transformed_points.getX(), * yt = transformed_points.getY();
+
+        const T c = key_homothetic.c;
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                //Reduce coordinates, transform point, add coordinates center of mass
+                const T x_red_local = xl[i] - key_homothetic.x_mass_local, y_red_local = yl[i] - key_homothetic.y_mass_local;
+
+                xt[i] = c * x_red_local + key_homothetic.x_mass_global;
+                yt[i] = c * y_red_local + key_homothetic.y_mass_global;
+        }
+}
+
 #endif
@@ -128,6 +128,25 @@ class Transformation2D
                                               TTransformationKeyHomothetic2D <typename Point1::Type> &key );
 
 
+                //Transformation of points stored in the point arrays
+                template <typename T>
+                static void getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, TTransformationKeyHelmert2D <T> &key );
+
+                template <typename T>
+                static void getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, TTransformationKeyHomothetic2D <T> &key );
+
+                template <typename T>
+                static void getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, typename TWeights <T> ::Type & weights, TTransformationKeyHelmert2D <T> &key );
+
+                template <typename T>
+                static void getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, typename TWeights <T> ::Type & weights, TTransformationKeyHomothetic2D <T> &key );
+
+                template <typename T>
+                static void transform ( const PointArray <T> &local_points, PointArray <T> &transformed_points, const TTransformationKeyHelmert2D <T> &key );
+
+                template <typename T>
+                static void transform ( const PointArray <T> &local_points, PointArray <T> &transformed_points, const TTransformationKeyHomothetic2D <T> &key );
+
                 template <typename Point1, typename Point2>
                 static void rearrangePoints ( const Container <Point1 *> &global_source, const Container <Point2 *> &local_source, Container <Point1 *> &global_destination,
                                               Container <Point2 *> &local_destination, const typename TDevIndexPairs <typename Point1::Type> ::Type & pairs );
@@ -125,6 +125,55 @@ void Transformation2D::transform ( const Container <Point1 *, destructable> &glo
         HomotheticTransformation2D::transform ( global_points, local_points, transformed_points, key );
 }
 
+
+template <typename T>
+void Transformation2D::getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, TTransformationKeyHelmert2D <T> &key )
+{
+        //Compute Helmert transformation key of point arrays, overloaded function for Helmert key
+        HelmertTransformation2D::getTransformKey ( global_points, local_points, key );
+}
+
+
+template <typename T>
+void Transformation2D::getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, TTransformationKeyHomothetic2D <T> &key )
+{
+        //Compute Homothetic transformation key of point arrays, overloaded function for Homothetic key
+        HomotheticTransformation2D::getTransformKey ( global_points, local_points, key );
+}
+
+
+template <typename T>
+void Transformation2D::getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, typename TWeights <T> ::Type & weights, TTransformationKeyHelmert2D <T> &key )
+{
+        //Compute weighted Helmert transformation key of point arrays, overloaded function for Helmert key
+        HelmertTransformation2D::getTransformKey ( global_points, local_points, weights, key );
+}
+
+
+template <typename T>
+void Transformation2D::getTransformKey ( const PointArray <T> &global_points, const PointArray <T> &local_points, typename TWeights <T> ::Type & weights, TTransformationKeyHomothetic2D <T> &key )
+{
+        //Compute weighted Homothetic transformation key of point arrays, overloaded function for Homothetic key
+        HomotheticTransformation2D::getTransformKey ( global_points, local_points, weights, key );
+}
+
+
+template <typename T>
+void Transformation2D::transform ( const PointArray <T> &local_points, PointArray <T> &transformed_points, const TTransformationKeyHelmert2D <T> &key )
+{
+        //Transform point arrays using Helmert transformation, overloaded function for Helmert key
+        HelmertTransformation2D::transform ( local_points, transformed_points, key );
+}
+
+
+template <typename T>
+void Transformation2D::transform ( const PointArray <T> &local_points, PointArray <T> &transformed_points, const TTransformationKeyHomothetic2D <T> &key )
+{
+        //Transform point arrays using Homothetic transformation, overloaded function for Homothetic key
+        HomotheticTransformation2D::transform ( local_points, transformed_points, key );
+}
+
+
 template <typename Point1, typename Point2>
 void Transformation2D::rearrangePoints ( const Container <Point1 *> &global_source, const Container <Point2 *> &local_source, Container <Point1 *> &global_destination,
                 Container <Point2 *> &local_destination, const typename TDevIndexPairs <typename Point1::Type> ::Type & pairs )
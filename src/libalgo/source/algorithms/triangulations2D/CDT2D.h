@@ -23,6 +23,8 @@
 #define CDT2D_H
 
 #include <list>
+#include <set>
+#include <vector>
 
 #include "libalgo/source/structures/line/HalfEdge.h"
 #include "libalgo/source/structures/list/Container.h"
@@ -34,6 +36,9 @@ class Node3DCartesian;
 template <typename T>
 class Edge;
 
+template <typename T>
+class TriangleMesh;
+
 
 //New user types
 template <typename T>
@@ -42,6 +47,12 @@ struct THalfEdgesCDTList
         typedef std::list < HalfEdge <T> *> Type;
 };
 
+//Edges of the triangle mesh given by start and end vertex indices
+typedef std::pair <unsigned int, unsigned int> TEdgeCDT;
+typedef std::list <TEdgeCDT> TEdgesCDTList;
+typedef std::set <TEdgeCDT> TEdgesCDTSet;
+
+
 //2D CDT class
 class CDT2D
 {
@@ -49,21 +60,32 @@ class CDT2D
                 template <typename T>
                 static void CDT ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *> &half_edges, Container <Edge <Node3DCartesian <T> > *> &constrained_edges, const bool print_message = false, const bool print_exception = true, std::ostream * output = &std::cout );
 
+                template <typename T>
+                static void CDT ( Container <Node3DCartesian <T> *> &nl, TriangleMesh <T> &mesh, const Container <Edge <Node3DCartesian <T> > *> &constrained_edges, const bool print_message = false, const bool print_exception = true, std::ostream * output = &std::cout );
+
         private:
                 template <typename T>
-                static void insertConstrainedEdge ( Edge <Node3DCartesian <T> > *e_constrained, HalfEdge <T> *he, Container <Edge <Node3DCartesian <T> > *> &constrained_edges );
+                static void insertConstrainedEdge ( unsigned int a, unsigned int b, TriangleMesh <T> &mesh, std::vector <unsigned int> &vertex_edges, TEdgesCDTList &constrained_edges, TEdgesCDTSet &inserted_edges );
 
                 template <typename T>
-                static void findIntersectedEdges ( Edge <Node3DCartesian <T> > *e_constrained, HalfEdge <T> *he, typename THalfEdgesCDTList <T>::Type & half_edges_removed, Container <Edge <Node3DCartesian <T> > *> &constrained_edges );
+                static void findIntersectedEdges ( const unsigned int a, unsigned int &b, const TriangleMesh <T> &mesh, const std::vector <unsigned int> &vertex_edges, TEdgesCDTList &half_edges_removed, TEdgesCDTList &constrained_edges, const TEdgesCDTSet &inserted_edges );
 
                 template <typename T>
-                static void removeIntersectedEdges ( const Edge <Node3DCartesian <T> > *e_constrained, typename THalfEdgesCDTList <T>::Type & half_edges_removed, typename THalfEdgesCDTList <T>::Type & half_edges_created );
+                static void removeIntersectedEdges ( const unsigned int a, const unsigned int b, TriangleMesh <T> &mesh, std::vector <unsigned int> &vertex_edges, TEdgesCDTList &half_edges_removed, TEdgesCDTList &half_edges_created );
 
                 template <typename T>
-                static void restoreDT ( const Edge <Node3DCartesian <T> > *e_constrained, typename THalfEdgesCDTList <T>::Type & half_edges_removed, typename THalfEdgesCDTList <T>::Type & half_edges_created );
+                static void restoreDT ( TriangleMesh <T> &mesh, std::vector <unsigned int> &vertex_edges, TEdgesCDTList &half_edges_created, const TEdgesCDTSet &inserted_edges );
 
                 template <typename T>
-                static bool legalizeConstrainedTriangle ( HalfEdge <T> *e_twin );
+                static bool legalizeConstrainedTriangle ( const unsigned int e_twin, TriangleMesh <T> &mesh, std::vector <unsigned int> &vertex_edges );
+
+                template <typename T>
+                static void swapDiagonal ( const unsigned int e, TriangleMesh <T> &mesh, std::vector <unsigned int> &vertex_edges );
+
+                template <typename T>
+                static unsigned int findEdge ( const unsigned int a, const unsigned int b, const TriangleMesh <T> &mesh, const std::vector <unsigned int> &vertex_edges );
+
+                static TEdgeCDT getUndirectedEdge ( const unsigned int a, const unsigned int b ) {return a < b ? TEdgeCDT ( a, b ) : TEdgeCDT ( b, a );}
 
 };
 
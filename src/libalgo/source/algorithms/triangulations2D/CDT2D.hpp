@@ -17,61 +17,132 @@
 //
 // You should have received a copy of the GNU Lesser General Public License
 // along with this library. If not, see <http://www.gnu.org/licenses/>.
-
-
 #ifndef CDT2D_HPP
 #define CDT2D_HPP
 
 #include <iomanip>
 #include <fstream>
 #include <cmath>
+#include <algorithm>
 
 #include "libalgo/source/structures/line/Edge.h"
+#include "libalgo/source/structures/list/TriangleMesh.h"
 
 #include "libalgo/source/structures/point/Node3DCartesian.h"
 
-#include "libalgo/source/algorithms/lawsonorientedwalk/LawsonOrientedWalk.h"
+#include "libalgo/source/algorithms/pointlineposition/PointLinePosition.h"
 #include "libalgo/source/algorithms/linelineposition/LineLinePosition.h"
 #include "libalgo/source/algorithms/swappingcriteria/SwappingCriteria.h"
 #include "libalgo/source/algorithms/convexquadrilateral/ConvexQuadrilateral.h"
 
 #include "DT2D.h"
 
-#include "libalgo/source/exceptions/ErrorMathZeroDevision.h"
+#include "libalgo/source/exceptions/ErrorBadData.h"
 
 
 template <typename T>
 void CDT2D::CDT ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *> & half_edges, Container <Edge < Node3DCartesian <T> > *> &constrained_edges,  const bool print_message, const bool print_exception, std::ostream * output )
 {
-        // Constrained Delaunay triangulation
-
-        //Create DT
-        DT2D::DT ( nl, half_edges, print_message, print_exception );
+        // Constrained Delaunay triangulation, half edges are created from the triangle mesh
+        try
+        {
+                TriangleMesh <T> mesh;
+                CDT ( nl, mesh, constrained_edges, print_message, print_exception, output );
 
-        //Initialize edge
-        HalfEdge <T> *e_heuristic = ( *half_edges ) [0];
+                //Convert mesh to half edges
+                DT2D::createHalfEdges ( mesh, half_edges );
+        }
 
-        //Print info
-        if ( print_message )
+        //Throw exception
+        catch ( Error & error )
         {
-                *output << "> Starting CDT, please wait..." << std::endl;
-                *output << "Total: " << half_edges->size() << " constrained edges." << std::endl;
+                //Clear half edges
+                half_edges.clear();
+
+                throw;
         }
+}
 
-        //Throw exception
+
+template <typename T>
+void CDT2D::CDT ( Container <Node3DCartesian <T> *> &nl, TriangleMesh <T> &mesh, const Container <Edge < Node3DCartesian <T> > *> &constrained_edges,  const bool print_message, const bool print_exception, std::ostream * output )
+{
+        // Constrained Delaunay triangulation
         try
         {
-                //Process all constrained edges
-                while ( !constrained_edges->empty() )
+                //Create DT
+                DT2D::DT ( nl, mesh, print_message, print_exception, output );
+
+                //Print info
+                if ( print_message )
                 {
-                        // Get constrained edge
-                        Edge <Node3DCartesian <T> > *e_constrained = constrained_edges->front();
+                        *output << "> Starting CDT, please wait..." << std::endl;
+                        *output << "Total: " << constrained_edges.size() << " constrained edges." << std::endl;
+                }
 
-                        // Run constrained Delaunay triangulation for this edge
-                        insertConstrainedEdge ( e_constrained, e_heuristic, constrained_edges );
+                //Sorted pairs (point, vertex index) used to find vertices of constrained edges
+                const unsigned int n_points = mesh.getPointsCount();
+                std::vector <std::pair <const Node3DCartesian <T> *, unsigned int> > vertex_indices ( n_points );
+
+                for ( unsigned int i = 0; i < n_points; i++ )
+                {
+                        vertex_indices[i] = std::make_pair ( mesh.getVertex ( i ), i );
+                }
+
+                std::sort ( vertex_indices.begin(), vertex_indices.end() );
+
+                //Convert constrained edges to pairs of vertex indices
+                TEdgesCDTList constrained_edges_mesh;
+                const unsigned int n_constrained_edges = constrained_edges.size();
+
+                for ( unsigned int i = 0; i < n_constrained_edges; i++ )
+                {
+                        const Node3DCartesian <T> *nodes[2] = { constrained_edges [i]->getP1(), constrained_edges [i]->getP2() };
+                        unsigned int v[2];
+
+                        for ( unsigned int j = 0; j < 2; j++ )
+                        {
+                                typename std::vector <std::pair <const Node3DCartesian <T> *, unsigned int> >::const_iterator i_vertex =
+                                        std::lower_bound ( vertex_indices.begin(), vertex_indices.end(), std::make_pair ( nodes[j], 0U ) );
+
+                                //End point of the constrained edge is not a vertex of the triangulation
+                                if ( ( i_vertex == vertex_indices.end() ) || ( i_vertex->first != nodes[j] ) )
+                                {
+                                        throw ErrorBadData ( "ErrorBadData: ", "Constrained Delaunay triangulation: end point of the constrained edge is not a vertex of the triangulation." );
+                                }
+
+                                v[j] = i_vertex->second;
+                        }
+
+                        //Skip degenerated edges
+                        if ( v[0] != v[1] )
+                        {
+                                constrained_edges_mesh.push_back ( TEdgeCDT ( v[0], v[1] ) );
+                        }
+                }
+
+                //Outgoing half edge of each vertex, updated after each swap
+                std::vector <unsigned int> vertex_edges ( n_points, NO_HALF_EDGE );
+                const unsigned int n_edges = mesh.getEdgesCount();
+
+                for ( unsigned int i = 0; i < n_edges; i++ )
+                {
+                        vertex_edges[mesh.getStartVertex ( i )] = i;
+                }
+
+                //Process all constrained edges, the list is extended by the parts of broken edges
+                TEdgesCDTSet inserted_edges;
+
+                while ( !constrained_edges_mesh.empty() )
+                {
+                        // Get constrained edge
+                        const TEdgeCDT e_constrained = constrained_edges_mesh.front();
 
                         // Pop this edge
-                        constrained_edges->pop_front();
+                        constrained_edges_mesh.pop_front();
+
+                        // Run constrained Delaunay triangulation for this edge
+                        insertConstrainedEdge ( e_constrained.first, e_constrained.second, mesh, vertex_edges, constrained_edges_mesh, inserted_edges );
                 }
 
                 //Print results
@@ -84,8 +155,8 @@ void CDT2D::CDT ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T>
         //Throw exception
         catch ( Error & error )
         {
-                //Clear constrained edges
-                constrained_edges->clear();
+                //Clear mesh
+                mesh.clear();
 
                 //Print exception
                 if ( print_exception )
@@ -100,314 +171,285 @@ void CDT2D::CDT ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T>
 
 
 template <typename T>
-void CDT2D::insertConstrainedEdge ( Edge <Node3DCartesian <T> > *e_constrained, HalfEdge <T> *e_heuristic, Container <Edge <Node3DCartesian <T> > *> &constrained_edges )
+void CDT2D::insertConstrainedEdge ( unsigned int a, unsigned int b, TriangleMesh <T> &mesh, std::vector <unsigned int> &vertex_edges, TEdgesCDTList &constrained_edges, TEdgesCDTSet &inserted_edges )
 {
-        //Insert one constrained edge
-        typename THalfEdgesCDTList <T>::Type half_edges_created;
-        typename THalfEdgesCDTList <T>::Type half_edges_removed;
+        //Insert one constrained edge (a, b)
+        TEdgesCDTList half_edges_created;
+        TEdgesCDTList half_edges_removed;
 
-        // Constrained Delaunay triangulation by Sloan(1992)
-        findIntersectedEdges ( e_constrained, e_heuristic, half_edges_removed, constrained_edges );
+        // Constrained Delaunay triangulation by Sloan(1992), b may be moved to the collinear vertex
+        findIntersectedEdges ( a, b, mesh, vertex_edges, half_edges_removed, constrained_edges, inserted_edges );
+
+        // Remember the constrained edge, it must not be swapped
+        inserted_edges.insert ( getUndirectedEdge ( a, b ) );
 
         // Remove edges intersecting constrained edge
-        removeIntersectedEdges ( e_constrained, half_edges_removed, half_edges_created );
+        removeIntersectedEdges ( a, b, mesh, vertex_edges, half_edges_removed, half_edges_created );
 
         // Restore Delaunay triangulation over edge
-        restoreDT ( e_constrained, half_edges_removed, half_edges_created );
+        restoreDT ( mesh, vertex_edges, half_edges_created, inserted_edges );
 }
 
 
 template <typename T>
-void CDT2D::findIntersectedEdges ( Edge <Node3DCartesian <T> > *e_constrained, HalfEdge <T> *he, typename THalfEdgesCDTList <T>::Type & half_edges_removed, Container <Edge <Node3DCartesian <T> > *> &constrained_edges )
+void CDT2D::findIntersectedEdges ( const unsigned int a, unsigned int &b, const TriangleMesh <T> &mesh, const std::vector <unsigned int> &vertex_edges, TEdgesCDTList &half_edges_removed, TEdgesCDTList &constrained_edges, const TEdgesCDTSet &inserted_edges )
 {
+        /* Find edges intersecting constrained edge (a, b);
+        Triangle incident to a and intersected by the constrained edge is found by the rotation around a;
+        Constrained edges crossing the already inserted constrained edges are not supported */
 
-        /* Find edges intersection constrained edge ;
-        Used heuristic: finding starts from the last triangle defined by edge e */
+        const Node3DCartesian <T> *n1 = mesh.getVertex ( a );
+        const Node3DCartesian <T> *n2 = mesh.getVertex ( b );
 
-        bool left = true;	// Searching direction
-        short status = -1;
+        unsigned int he = vertex_edges[a];
 
-        // Is a constrained edge already in triangulation?
-        he = LawsonOrientedWalk::findTriangleWalk ( &e_constrained->getP1(), &status, he, 0 );
+        if ( he == NO_HALF_EDGE )
+        {
+                throw ErrorBadData ( "ErrorBadData: ", "Constrained Delaunay triangulation: end point of the constrained edge is not a vertex of the triangulation." );
+        }
 
-        // If found edge has an opposite orientation (n1==n4)
-        if ( ( * he->getPoint() ) != ( e_constrained->getP1() ) )
+        // Rotate clockwise to the boundary edge (or around the whole star of a)
+        const unsigned int he_start = he;
+
+        while ( ( mesh.getTwinEdge ( he ) != NO_HALF_EDGE ) && ( TriangleMesh <T>::getNextEdge ( mesh.getTwinEdge ( he ) ) != he_start ) )
         {
-                // Switch orientation
-                he = he->getTwinEdge();
+                he = TriangleMesh <T>::getNextEdge ( mesh.getTwinEdge ( he ) );
         }
 
-        // Get start and end point of the edge
-        const Node3DCartesian <T> *n1 = &e_constrained->getP1();
-        Node3DCartesian <T> *n2 = &e_constrained->getP2();
+        // Rotate counterclockwise around a and find the triangle (a, x, y) intersected by the constrained edge
+        const unsigned int he_first = he;
+        unsigned int he_intersected = NO_HALF_EDGE;
 
-        try
+        for ( ;; )
         {
-                // Found point has same start point as the constrainend edge
-                if ( he != NULL )
+                const unsigned int he_prev = TriangleMesh <T>::getPreviousEdge ( he );
+                const unsigned int x = mesh.getEndVertex ( he ), y = mesh.getStartVertex ( he_prev );
+
+                // Constrained edge is already in the triangulation
+                if ( ( x == b ) || ( y == b ) )
                 {
-                        // Loop over all edges intersecting constrained edge
-                        for ( ;; )
-                        {
-                                // Next edge
-                                he = he->getNextEdge();
+                        return;
+                }
 
-                                // Intersect edge e constrained edge?
-                                const HalfEdge <T> *e_next = he->getNextEdge();
+                const unsigned short pos_x = PointLinePosition::getPointLinePosition2D ( mesh.getVertex ( x ), n1, n2 );
+                const unsigned short pos_y = PointLinePosition::getPointLinePosition2D ( mesh.getVertex ( y ), n1, n2 );
 
-                                // Get nodes of the next analyzed edge
-                                const Node3DCartesian <T> *n3 = he->getPoint();
-                                const Node3DCartesian <T> *n4 = e_next->getPoint();
+                // Constrained edge passes through the vertex of the triangle: brake constrained edge in 2 parts
+                for ( unsigned int i = 0; i < 2; i++ )
+                {
+                        const unsigned int v = ( i == 0 ? x : y );
 
-                                const short inters2 = LineLinePosition::get2LineSegmentsPosition ( n1, n2, n3, n4, 0 );
+                        if ( ( i == 0 ? pos_x : pos_y ) == 2 )
+                        {
+                                const Node3DCartesian <T> *n = mesh.getVertex ( v );
 
-                                // Constrained edge intersects some edge
-                                if ( inters2 == 1 )
+                                // Vertex lies in the direction of the constrained edge
+                                if ( ( n->getX() - n1->getX() ) * ( n2->getX() - n1->getX() ) + ( n->getY() - n1->getY() ) * ( n2->getY() - n1->getY() ) > 0 )
                                 {
-                                        // Remove intersected edge from triangulation
-                                        half_edges_removed.push_back ( he );
+                                        // Add next part of the broken constrained edge into list
+                                        constrained_edges.push_back ( TEdgeCDT ( v, b ) );
+
+                                        // Correct end point of the first constrained edge, it is already in the triangulation
+                                        b = v;
 
-                                        // Set incident edge of the adjacent triangle
-                                        he = he->getTwinEdge();
+                                        return;
                                 }
+                        }
+                }
 
-                                // Constrained edge and Delaunay edge intersect in 1 end point: brake constrained edge in 2 parts
-                                else if ( inters2 == 2 )
-                                {
-                                        // Get start point of intersected edge
-                                        const HalfEdge <T> *e_next = he->getNextEdge();
-                                        Node3DCartesian <T> *n = e_next->getPoint();
+                // Constrained edge intersects the edge (x, y) opposite to a
+                if ( ( pos_x == 0 ) && ( pos_y == 1 ) )
+                {
+                        he_intersected = TriangleMesh <T>::getNextEdge ( he );
+                        break;
+                }
 
-                                        // Correct end point of the first constrained edge
-                                        e_constrained->setP2 ( n );
+                // Next triangle counterclockwise
+                he = mesh.getTwinEdge ( he_prev );
 
-                                        // Create new constrained edge
-                                        Edge <Node3DCartesian <T> > *ce2 = new Edge <Node3DCartesian <T> > ( n, n2 );
+                if ( ( he == NO_HALF_EDGE ) || ( he == he_first ) )
+                {
+                        throw ErrorBadData ( "ErrorBadData: ", "Constrained Delaunay triangulation: can not find edges intersected by the constrained edge." );
+                }
+        }
 
-                                        // Add next part of the broken constrained edge into list
-                                        constrained_edges->push_back ( ce2 );
+        // Walk over triangles intersected by the constrained edge, start vertex of he_intersected lies right, end vertex left
+        for ( ;; )
+        {
+                // Constrained edges cross each other, the inserted one must not be removed
+                if ( inserted_edges.find ( getUndirectedEdge ( mesh.getStartVertex ( he_intersected ), mesh.getEndVertex ( he_intersected ) ) ) != inserted_edges.end() )
+                {
+                        throw ErrorBadData ( "ErrorBadData: ", "Constrained Delaunay triangulation: constrained edges intersect." );
+                }
 
-                                        // Stop searching
-                                        break;
-                                }
+                // Remove intersected edge from triangulation
+                half_edges_removed.push_back ( TEdgeCDT ( mesh.getStartVertex ( he_intersected ), mesh.getEndVertex ( he_intersected ) ) );
 
+                // Set incident edge of the adjacent triangle
+                const unsigned int he_twin = mesh.getTwinEdge ( he_intersected );
 
-                                // Constrained edge and Delaunay edge intersect in 2 endpoints: brake constrained edge in 2 edges
-                                else if ( inters2 == 3 )
-                                {
-                                        // Get start point end end point
-                                        const Node3DCartesian <T> *ns = he->getPoint();
-                                        const Node3DCartesian <T> *ne = he->getNextEdge()->getPoint();	// We found end point of the constrained edge, this edge was not collinear
-
-                                        // Is it endpoint of the edge
-                                        if ( ns == n2 || ne == n2 )
-                                        {
-                                                break;	// We found endpoint
-                                        }
-
-                                        // We are again in start point of the constrained edge n1
-                                        else
-                                        {
-                                                // Switch to the left triangle
-                                                if ( left )
-                                                {
-                                                        // Good way, switch the triangle
-                                                        if ( he->getTwinEdge() != NULL )
-                                                        {
-                                                                // Switch triangle to left incident triangle
-                                                                he = he->getTwinEdge();
-                                                        }
-
-                                                        // Wrong way, change direction to the right
-                                                        else
-                                                        {
-                                                                left = false;
-                                                        }
-                                                }
-
-                                                // Switch to the right triangle
-                                                if ( !left )
-                                                {
-                                                        // Go to next edge
-                                                        he = he->getNextEdge();
-
-                                                        // Switch to the right incident triangle
-                                                        he = he->getTwinEdge();
-
-                                                        // Go to the next edge with start point different from n1
-                                                        he = he->getNextEdge();
-                                                }
-                                        }
-                                }
-                        }
+                if ( he_twin == NO_HALF_EDGE )
+                {
+                        throw ErrorBadData ( "ErrorBadData: ", "Constrained Delaunay triangulation: constrained edge intersects the convex hull." );
                 }
-        }
 
-        //Throw an exception
-        catch ( ErrorMathZeroDevision <T> & e )
-        {
-                //Clear half edges
-                half_edges_removed.clear();
+                // Vertex of the adjacent triangle opposite to the intersected edge
+                const unsigned int z = mesh.getStartVertex ( TriangleMesh <T>::getPreviousEdge ( he_twin ) );
 
-                //Throw exception
-                throw ErrorMathZeroDevision <T> ( "ErrorMathZeroDevision: ", "Constrained Delaunay triangulation: Can not find intersected edges." );
+                // We found end point of the constrained edge
+                if ( z == b )
+                {
+                        break;
+                }
+
+                const unsigned short pos_z = PointLinePosition::getPointLinePosition2D ( mesh.getVertex ( z ), n1, n2 );
+
+                // Constrained edge and Delaunay edge intersect in 1 end point: brake constrained edge in 2 parts
+                if ( pos_z == 2 )
+                {
+                        // Add next part of the broken constrained edge into list
+                        constrained_edges.push_back ( TEdgeCDT ( z, b ) );
+
+                        // Correct end point of the first constrained edge
+                        b = z;
+
+                        break;
+                }
+
+                // Continue through the edge (x, z) or (z, y)
+                he_intersected = ( pos_z == 1 ? TriangleMesh <T>::getNextEdge ( he_twin ) : TriangleMesh <T>::getPreviousEdge ( he_twin ) );
         }
 }
 
 
 template <typename T>
-void CDT2D::removeIntersectedEdges ( const Edge <Node3DCartesian <T> > *e_constrained, typename THalfEdgesCDTList <T>::Type & half_edges_removed, typename THalfEdgesCDTList <T>::Type & half_edges_created )
+void CDT2D::removeIntersectedEdges ( const unsigned int a, const unsigned int b, TriangleMesh <T> &mesh, std::vector <unsigned int> &vertex_edges, TEdgesCDTList &half_edges_removed, TEdgesCDTList &half_edges_created )
 {
         //Remove edges intersecting constrained edge
 
         //Get start and end point of the edge
-        const Node3DCartesian <T> *n1 = &e_constrained->getP1();
-        const Node3DCartesian <T> *n2 = &e_constrained->getP2();
+        const Node3DCartesian <T> *n1 = mesh.getVertex ( a );
+        const Node3DCartesian <T> *n2 = mesh.getVertex ( b );
 
-        try
+        //Count of edges postponed without any swap
+        unsigned int postponed = 0;
+
+        while ( !half_edges_removed.empty() )
         {
-                while ( !half_edges_removed.empty() )
-                {
-                        // Take the first edge
-                        HalfEdge <T> *e_swap = half_edges_removed.front();
+                // Take the first edge
+                const TEdgeCDT e = half_edges_removed.front();
 
-                        // Pop this edge
-                        half_edges_removed.pop_front();
-
-                        // Test of convexity for quadrilateral
-                        HalfEdge <T> *e12 = e_swap->getNextEdge();
-                        HalfEdge <T> *e13 = e12->getNextEdge();
-                        HalfEdge <T> *e21 = e_swap->getTwinEdge();
-                        HalfEdge <T> *e22 = e21->getNextEdge();
-                        HalfEdge <T> *e23 = e22->getNextEdge();
-
-                        // Get nodes, counterclockwise set of nodes
-                        Node3DCartesian <T> *n11 = e_swap->getPoint();
-                        Node3DCartesian <T> *n23 = e23->getPoint();
-                        Node3DCartesian <T> *n12 = e12->getPoint();
-                        Node3DCartesian <T> *n13 = e13->getPoint();
-
-                        //Is quadrilateral strictly convex?
-                        if ( ConvexQuadrilateral::isStrictlyConvex ( static_cast< Point3DCartesian <T> * > ( n11 ), static_cast < Point3DCartesian <T> * > ( n23 ), static_cast < Point3DCartesian <T> * > ( n12 ), static_cast < Point3DCartesian <T> * > ( n13 ) ) == 1, true )
-                        {
-                                // Swap diagonal
-                                DT2D::swapDiagonal ( e_swap, e12, e13, e21, e22, e23 );
+                // Pop this edge
+                half_edges_removed.pop_front();
 
-                                // Intersect edge e constrained edge?
-                                const HalfEdge <T> *e_next = e_swap->getNextEdge();
+                // Find the half edge
+                const unsigned int e_swap = findEdge ( e.first, e.second, mesh, vertex_edges );
 
-                                // Get nodes of the next analyzed edge
-                                const Node3DCartesian <T> *n3 = e_swap->getPoint();
-                                const Node3DCartesian <T> *n4 = e_next->getPoint();
+                if ( ( e_swap == NO_HALF_EDGE ) || ( mesh.isBoundaryEdge ( e_swap ) ) )
+                {
+                        throw ErrorBadData ( "ErrorBadData: ", "Constrained Delaunay triangulation: can not remove intersected edges." );
+                }
 
-                                // Test swapped diagonal
-                                const short inters = LineLinePosition::get2LineSegmentsPosition ( n1, n2, n3, n4, 0 );
+                // Get nodes, counterclockwise set of nodes
+                Node3DCartesian <T> *n11 = mesh.getPoint ( e_swap );
+                Node3DCartesian <T> *n23 = mesh.getPoint ( TriangleMesh <T>::getPreviousEdge ( mesh.getTwinEdge ( e_swap ) ) );
+                Node3DCartesian <T> *n12 = mesh.getPoint ( TriangleMesh <T>::getNextEdge ( e_swap ) );
+                Node3DCartesian <T> *n13 = mesh.getPoint ( TriangleMesh <T>::getPreviousEdge ( e_swap ) );
 
-                                if ( inters == 1 )
-                                {
-                                        // Add swapped edge again to list of removed edges
-                                        half_edges_removed.push_back ( e_swap );
-                                }
+                //Is quadrilateral strictly convex?
+                if ( ConvexQuadrilateral::isStrictlyConvex ( n11, n23, n12, n13 ) == 1 )
+                {
+                        // Swap diagonal, e_swap = (n23, n13)
+                        swapDiagonal ( e_swap, mesh, vertex_edges );
+                        postponed = 0;
 
-                                // Add swapped edge to list of newly created edges
-                                else
-                                {
-                                        half_edges_created.push_back ( e_swap );
-                                }
+                        // Test swapped diagonal
+                        T x_int, y_int;
+                        const short inters = LineLinePosition::get2LineSegmentsPosition ( n1, n2, n23, n13, x_int, y_int );
+
+                        if ( inters == 1 )
+                        {
+                                // Add swapped edge again to list of removed edges
+                                half_edges_removed.push_back ( TEdgeCDT ( mesh.getStartVertex ( e_swap ), mesh.getEndVertex ( e_swap ) ) );
                         }
 
-                        // Non convex
+                        // Add swapped edge to list of newly created edges
                         else
                         {
-                                // Add this edge again to list of removed edges
-                                half_edges_removed.push_back ( e_swap );
+                                half_edges_created.push_back ( TEdgeCDT ( mesh.getStartVertex ( e_swap ), mesh.getEndVertex ( e_swap ) ) );
                         }
-
                 }
-        }
 
-        //Throw exception
-        catch ( ErrorMathZeroDevision <T> & e )
-        {
-                //Clear half edges
-                half_edges_removed.clear();
-                half_edges_created.clear();
+                // Non convex
+                else
+                {
+                        // Add this edge again to list of removed edges
+                        half_edges_removed.push_back ( e );
 
-                //Throw exception
-                throw ErrorMathZeroDevision <T> ( "ErrorMathZeroDevision: ", "Constrained Delaunay triangulation: Can not remove intersected edges." );
+                        // No remaining edge may be swapped
+                        if ( ++postponed > half_edges_removed.size() )
+                        {
+                                throw ErrorBadData ( "ErrorBadData: ", "Constrained Delaunay triangulation: can not remove intersected edges." );
+                        }
+                }
         }
 }
 
 
 template <typename T>
-void CDT2D::restoreDT ( const Edge <Node3DCartesian <T> > *e_constrained, typename THalfEdgesCDTList <T>::Type & half_edges_removed, typename THalfEdgesCDTList <T>::Type & half_edges_created )
+void CDT2D::restoreDT ( TriangleMesh <T> &mesh, std::vector <unsigned int> &vertex_edges, TEdgesCDTList &half_edges_created, const TEdgesCDTSet &inserted_edges )
 {
         // Restore Delaunay triangulation
         bool swap = true;	// Swap identificator
-        typename THalfEdgesCDTList <T>::Type::iterator i_half_edges_created;
-
-        // Get start and end point of the edge
-        const Node3DCartesian <T> *n1 = &e_constrained->getP1();
-        const Node3DCartesian <T> *n2 = &e_constrained->getP2();
 
         // Loop until no further swap is available
-        i_half_edges_created = half_edges_created.begin();
-
         while ( swap )
         {
                 swap = false;	// Set no swap will be done
 
                 // Loop all newly created edges
-                while ( i_half_edges_created != half_edges_created.end() )
+                for ( TEdgesCDTList::iterator i_half_edges_created = half_edges_created.begin(); i_half_edges_created != half_edges_created.end(); ++i_half_edges_created )
                 {
-                        // Take edge e
-                        HalfEdge <T> *e_swap = *i_half_edges_created;
-                        HalfEdge <T> *e_swap_next = e_swap->getNextEdge();
-
-                        // Is edge e = e_constrained?
-                        const Node3DCartesian <T> *n3 = e_swap->getPoint();
-                        const Node3DCartesian <T> *n4 = e_swap_next->getPoint();
-
                         // Is edge constrained edge?
-                        if ( ! ( ( ( n1 == n3 ) && ( n2 == n4 ) ) || ( ( n1 == n4 ) && ( n2 == n3 ) ) ) )
+                        if ( inserted_edges.find ( getUndirectedEdge ( i_half_edges_created->first, i_half_edges_created->second ) ) != inserted_edges.end() )
                         {
-                                // Legalize triangle
-                                if ( legalizeConstrainedTriangle ( e_swap ) )
-                                {
-                                        swap = true;
-                                }
+                                continue;
                         }
 
-                        //Increment iterator
-                        i_half_edges_created++;
-                }
+                        // Take edge e
+                        const unsigned int e_swap = findEdge ( i_half_edges_created->first, i_half_edges_created->second, mesh, vertex_edges );
 
+                        // Legalize triangle
+                        if ( ( e_swap != NO_HALF_EDGE ) && ( !mesh.isBoundaryEdge ( e_swap ) ) && legalizeConstrainedTriangle ( e_swap, mesh, vertex_edges ) )
+                        {
+                                // Swapped edge replaces the created edge
+                                *i_half_edges_created = TEdgeCDT ( mesh.getStartVertex ( e_swap ), mesh.getEndVertex ( e_swap ) );
+                                swap = true;
+                        }
+                }
         }
 
         // Empty list of newly created half-edges
         half_edges_created.clear();
-        half_edges_removed.clear();
 }
 
 
 template <typename T>
-bool CDT2D::legalizeConstrainedTriangle ( HalfEdge <T> *e_twin )
+bool CDT2D::legalizeConstrainedTriangle ( const unsigned int e_twin, TriangleMesh <T> &mesh, std::vector <unsigned int> &vertex_edges )
 {
-
         // Legalize triangle in CDT (without recursive legalization) */
-        HalfEdge <T> *e21 = e_twin->getTwinEdge();		/* First edge in triangle adjacent to legalized */
-        HalfEdge <T> *e22 = e21->getNextEdge();		/* Second edge in triangle adjacent to legalized */
-        HalfEdge <T> *e23 = e22->getNextEdge();		/* Third edge in triangle adjacent to legalized */
+        const unsigned int e21 = mesh.getTwinEdge ( e_twin );			/* First edge in triangle adjacent to legalized */
+        const unsigned int e22 = TriangleMesh <T>::getNextEdge ( e21 );		/* Second edge in triangle adjacent to legalized */
+        const unsigned int e23 = TriangleMesh <T>::getPreviousEdge ( e21 );	/* Third edge in triangle adjacent to legalized */
 
         // Adjacent triangle
-        HalfEdge <T> *e12 = e_twin->getNextEdge();
-        HalfEdge <T> *e13 = e12->getNextEdge();
+        const unsigned int e13 = TriangleMesh <T>::getPreviousEdge ( e_twin );
 
         // Illegal triangle?
-        if ( SwappingCriteria::getClineRenka ( e13->getPoint(), e21->getPoint(), e22->getPoint(), e23->getPoint() ) )
+        if ( SwappingCriteria::getClineRenka ( mesh.getPoint ( e13 ), mesh.getPoint ( e21 ), mesh.getPoint ( e22 ), mesh.getPoint ( e23 ) ) )
         {
                 //Swap diagonal in (e11,e12,e13) and (e21,e22,e23)
-                DT2D::swapDiagonal ( e_twin, e12, e13, e21, e22, e23 );
+                swapDiagonal ( e_twin, mesh, vertex_edges );
 
                 // HalfEdge <T> has been swapped
                 return true;
@@ -421,4 +463,66 @@ bool CDT2D::legalizeConstrainedTriangle ( HalfEdge <T> *e_twin )
         }
 }
 
+
+template <typename T>
+void CDT2D::swapDiagonal ( const unsigned int e, TriangleMesh <T> &mesh, std::vector <unsigned int> &vertex_edges )
+{
+        //Swap diagonal e = (a, b) of triangles (a, b, c), (b, a, d) to (d, c) and update outgoing edges of the vertices
+        const unsigned int e_twin = mesh.getTwinEdge ( e );
+
+        mesh.swapDiagonal ( e );
+
+        //Triangles (d, c, a) and (c, d, b)
+        vertex_edges[mesh.getStartVertex ( e )] = e;
+        vertex_edges[mesh.getStartVertex ( e_twin )] = e_twin;
+        vertex_edges[mesh.getStartVertex ( TriangleMesh <T>::getPreviousEdge ( e ) )] = TriangleMesh <T>::getPreviousEdge ( e );
+        vertex_edges[mesh.getStartVertex ( TriangleMesh <T>::getPreviousEdge ( e_twin ) )] = TriangleMesh <T>::getPreviousEdge ( e_twin );
+}
+
+
+template <typename T>
+unsigned int CDT2D::findEdge ( const unsigned int a, const unsigned int b, const TriangleMesh <T> &mesh, const std::vector <unsigned int> &vertex_edges )
+{
+        //Find half edge (a, b) by the rotation around a
+        const unsigned int he_start = vertex_edges[a];
+
+        if ( he_start == NO_HALF_EDGE )
+        {
+                return NO_HALF_EDGE;
+        }
+
+        //Rotate counterclockwise
+        unsigned int he = he_start;
+
+        do
+        {
+                if ( mesh.getEndVertex ( he ) == b )
+                {
+                        return he;
+                }
+
+                he = mesh.getTwinEdge ( TriangleMesh <T>::getPreviousEdge ( he ) );
+        }
+        while ( ( he != NO_HALF_EDGE ) && ( he != he_start ) );
+
+        //Boundary vertex: rotate clockwise
+        if ( he == NO_HALF_EDGE )
+        {
+                he = he_start;
+
+                while ( mesh.getTwinEdge ( he ) != NO_HALF_EDGE )
+                {
+                        he = TriangleMesh <T>::getNextEdge ( mesh.getTwinEdge ( he ) );
+
+                        if ( mesh.getEndVertex ( he ) == b )
+                        {
+                                return he;
+                        }
+                }
+        }
+
+        //Edge not found
+        return NO_HALF_EDGE;
+}
+
 #endif
@@ -22,7 +22,11 @@
 #ifndef DT2D_H
 #define DT2D_H
 
+#include <vector>
+
 #include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/TriangleMesh.h"
+#include "libalgo/source/structures/list/QuadEdgeMesh.h"
 
 //Forward declarations
 template <typename T>
@@ -31,29 +35,67 @@ class Node3DCartesian;
 template <typename T>
 class HalfEdge;
 
+struct TWalkStatistics;
+
+
+//Method of the Delaunay triangulation: incremental insertion, divide and conquer (Guibas, Stolfi, 1985)
+typedef enum
+{
+        IncrementalInsertion = 0,
+        DivideAndConquer
+} TDTMethod;
+
+
+//Insertion order of points: bins (Sloan, 1993), Hilbert curve, biased randomized insertion order (Amenta, 2003)
+typedef enum
+{
+        BinsOrder = 0,
+        HilbertOrder,
+        BRIOOrder
+} TDTInsertionOrder;
+
+
 //2D Delaunay triangulation
 class DT2D
 {
         public:
                 template <typename T>
-                static void DT ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *> &half_edges_dt, const bool print_message = false, const bool print_exception = true, std::ostream * output = &std::cout );
+                static void DT ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *> &half_edges_dt, const bool print_message = false, const bool print_exception = true, std::ostream * output = &std::cout, const TDTMethod method = IncrementalInsertion, const TDTInsertionOrder insertion_order = BinsOrder, TWalkStatistics * walk_statistics = NULL );
+
+                template <typename T>
+                static void DT ( Container <Node3DCartesian <T> *> &nl, TriangleMesh <T> &mesh, const bool print_message = false, const bool print_exception = true, std::ostream * output = &std::cout, const TDTMethod method = IncrementalInsertion, const TDTInsertionOrder insertion_order = BinsOrder, TWalkStatistics * walk_statistics = NULL );
 
                 template <typename T>
                 static void swapDiagonal ( HalfEdge <T> *e_twin, HalfEdge <T> *e12, HalfEdge <T> *e13, HalfEdge <T> *e21, HalfEdge <T> *e22, HalfEdge <T> *e23 );
 
+                template <typename T>
+                static void createHalfEdges ( const TriangleMesh <T> &mesh, Container <HalfEdge <T> *> &half_edges );
+
         private:
 
                 template <typename T>
-                static void createSimplexTriangle ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *> &half_edges_dt );
+                static void createSimplexTriangle ( Container <Node3DCartesian <T> *> &nl, TriangleMesh <T> &mesh, const TDTInsertionOrder insertion_order );
+
+                template <typename T>
+                static void DTInsertPoint ( const unsigned int p, unsigned int *e1, TriangleMesh <T> &mesh, TWalkStatistics * walk_statistics );
+
+                template <typename T>
+                static void legalizeTriangle ( const unsigned int p, const unsigned int e11, TriangleMesh <T> &mesh );
+
+                template <typename T>
+                static void removeSimplexTriangles ( Container <Node3DCartesian <T> *> &nl, TriangleMesh <T> &mesh );
+
+                template <typename T>
+                static void DTDivideAndConquer ( Container <Node3DCartesian <T> *> &nl, TriangleMesh <T> &mesh );
 
                 template <typename T>
-                static void DTInsertPoint ( Node3DCartesian <T> *p, const Node3DCartesian <T> *s1, const Node3DCartesian <T> *s2, const Node3DCartesian <T> *s3, HalfEdge <T> **e1, Container <HalfEdge <T> *> &half_edges_dt );
+                static void triangulateDivideAndConquer ( const std::vector <Node3DCartesian <T> *> &points, const unsigned int begin, const unsigned int end, QuadEdgeMesh &qe, unsigned int &le, unsigned int &re );
 
                 template <typename T>
-                static void legalizeTriangle ( Node3DCartesian <T> *p, HalfEdge <T> *e11, const Node3DCartesian <T> *s1, const Node3DCartesian <T> *s2, const Node3DCartesian <T> *s3 );
+                static void mergeDivideAndConquer ( const std::vector <Node3DCartesian <T> *> &points, QuadEdgeMesh &qe, unsigned int ldo, unsigned int ldi, unsigned int rdi, unsigned int rdo, unsigned int &le, unsigned int &re );
 
                 template <typename T>
-                static void removeSimplexTriangles ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *> &half_edges_dt );
+                static void createTriangles ( const std::vector <Node3DCartesian <T> *> &points, const QuadEdgeMesh &qe, TriangleMesh <T> &mesh );
 };
 
 #include "DT2D.hpp"
@@ -28,13 +28,16 @@
 #include <fstream>
 #include <cmath>
 
+#include "libalgo/source/const/Const.h"
+
 #include "libalgo/source/structures/line/HalfEdge.h"
 
 #include "libalgo/source/algorithms/lawsonorientedwalk/LawsonOrientedWalk.h"
 #include "libalgo/source/algorithms/convexquadrilateral/ConvexQuadrilateral.h"
 #include "libalgo/source/algorithms/swappingcriteria/SwappingCriteria.h"
+#include "libalgo/source/algorithms/spacefillingcurve/SpaceFillingCurve.h"
+#include "libalgo/source/algorithms/robustpredicates/RobustPredicates.h"
 
-#include "libalgo/source/comparators/removeSimplexHalfEdge.h"
 #include "libalgo/source/comparators/sortPointsByX.h"
 #include "libalgo/source/comparators/sortPointsByY.h"
 #include "libalgo/source/comparators/sortPointsToBins.h"
@@ -45,9 +48,33 @@
 
 
 template <typename T>
-void DT2D::DT ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *> &half_edges_dt, const bool print_message, const bool print_exception, std::ostream * output )
+void DT2D::DT ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *> &half_edges_dt, const bool print_message, const bool print_exception, std::ostream * output, const TDTMethod method, const TDTInsertionOrder insertion_order, TWalkStatistics * walk_statistics )
+{
+        // Create 2D Delaunay triangulation using incremental insertion method, half edges are created from the triangle mesh
+        try
+        {
+                TriangleMesh <T> mesh;
+                DT ( nl, mesh, print_message, print_exception, output, method, insertion_order, walk_statistics );
+
+                //Convert mesh to half edges
+                createHalfEdges ( mesh, half_edges_dt );
+        }
+
+        //Throw exception
+        catch ( Error & error )
+        {
+                //Clear half edges
+                half_edges_dt.clear();
+
+                throw;
+        }
+}
+
+
+template <typename T>
+void DT2D::DT ( Container <Node3DCartesian <T> *> &nl, TriangleMesh <T> &mesh, const bool print_message, const bool print_exception, std::ostream * output, const TDTMethod method, const TDTInsertionOrder insertion_order, TWalkStatistics * walk_statistics )
 {
-        // Create 2D Delaunay triangulation using incremental insertion method
+        // Create 2D Delaunay triangulation using incremental insertion method, lengths of the point location walks are added to walk_statistics
         const unsigned int nodes_count_before = nl.size();
 
         // Remove duplicate points
@@ -65,26 +92,35 @@ void DT2D::DT ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *
 
         try
         {
-                //There are at least 3 points
-                if ( nodes_count_after > 2 )
+                //Remove previous triangulation
+                mesh.clear();
+
+                //There are at least 3 points, use divide and conquer method
+                if ( ( nodes_count_after > 2 ) && ( method == DivideAndConquer ) )
+                {
+                        DTDivideAndConquer ( nl, mesh );
+                }
+
+                //There are at least 3 points, use incremental method
+                else if ( nodes_count_after > 2 )
                 {
                         //Create simplex triangle
-                        createSimplexTriangle ( nl, half_edges_dt );
+                        createSimplexTriangle ( nl, mesh, insertion_order );
 
                         //Increment nodes count
                         nodes_count_after += 3;
 
                         //Starting half edge using for searching
-                        HalfEdge <T> *e_heuristic = half_edges_dt [0];
+                        unsigned int e_heuristic = 0;
 
                         // Insert all points into triangulation using incremental method
                         for ( unsigned int i = 3; i < nodes_count_after; i++ )	// Jump over simplex
                         {
-                                DTInsertPoint ( nl [i], nl [0], nl [1], nl [2], &e_heuristic, half_edges_dt );
+                                DTInsertPoint ( i, &e_heuristic, mesh, walk_statistics );
                         }
 
                         //Remove triangles having simplex points
-                        removeSimplexTriangles ( nl, half_edges_dt );
+                        removeSimplexTriangles ( nl, mesh );
                 }
 
                 //Sort points by ID again
@@ -100,8 +136,8 @@ void DT2D::DT ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *
         //Throw exception
         catch ( Error & error )
         {
-                //Clear half edges
-                half_edges_dt.clear();
+                //Clear triangles
+                mesh.clear();
 
                 //Print exception
                 if ( print_exception )
@@ -115,15 +151,12 @@ void DT2D::DT ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *
 
 
 template <typename T>
-void DT2D::createSimplexTriangle ( Container <Node3DCartesian <T> *> &pl, Container <HalfEdge <T> *> &half_edges_dt )
+void DT2D::createSimplexTriangle ( Container <Node3DCartesian <T> *> &pl, TriangleMesh <T> &mesh, const TDTInsertionOrder insertion_order )
 {
         //Create simplex triangle
         Node3DCartesian <T> *s1 = NULL;
         Node3DCartesian <T> *s2 = NULL;
         Node3DCartesian <T> *s3 = NULL;
-        HalfEdge <T> *he1 = NULL;
-        HalfEdge <T> *he2 = NULL;
-        HalfEdge <T> *he3 = NULL;
 
         //Find extremal nodes
         const Node3DCartesian <T> *p_x_max = * std::max_element ( pl.begin(), pl.end(), sortPointsByX () );
@@ -148,179 +181,148 @@ void DT2D::createSimplexTriangle ( Container <Node3DCartesian <T> *> &pl, Contai
         s2 = new Node3DCartesian <T> ( ( T ) xc, ( T ) ( yc + 3 * ( std::max ) ( dx, dy ) ) );
         s3 = new Node3DCartesian <T> ( ( T ) ( xc - 3 * ( std::max ) ( dx, dy ) ), ( T ) ( yc - 3 * ( std::max ) ( dx, dy ) ) );
 
-        // Create first simplex triangle (3 half edges)
-        he3 = new HalfEdge <T> ( s3, NULL, NULL );
-        he2 = new HalfEdge <T> ( s2, he3, NULL );
-        he1 = new HalfEdge <T> ( s1, he2, NULL );
-
-        //Link first and last edge of the triangle
-        he3->setNextEdge ( he1 );
-
         // Add 3 simplex points to list
         pl.insert ( pl.begin(), s1 );
         pl.insert ( pl.begin(), s2 );
         pl.insert ( pl.begin(), s3 );
 
-        // Add 3 half edges of the triangle to list
-        half_edges_dt.push_back ( he1 );
-        half_edges_dt.push_back ( he2 );
-        half_edges_dt.push_back ( he3 );
+        // Sort points in the insertion order (do not sort 3 simplex points)
+        if ( insertion_order == HilbertOrder )
+        {
+                SpaceFillingCurve::sortPointsHilbert ( pl.begin() + 3, pl.end(), p_x_min->getX(), p_y_min->getY(), p_x_max->getX(), p_y_max->getY() );
+        }
 
-        // Sort points to bin (do not sort 3 simplex points)
-        pl.sort ( pl.begin() += 3, pl.end(), sortPointsToBins <Node3DCartesian<T> *> ( p_x_min->getX(), p_y_min->getY(), p_x_max->getX(), p_y_max->getY(), ( unsigned int ) ( 0.1 * ( sqrt ( ( double ) pl.size() ) ) ) ) );
+        else if ( insertion_order == BRIOOrder )
+        {
+                SpaceFillingCurve::sortPointsBRIO ( pl.begin() + 3, pl.end(), p_x_min->getX(), p_y_min->getY(), p_x_max->getX(), p_y_max->getY() );
+        }
+
+        // Sort points to bins
+        else
+        {
+                pl.sort ( pl.begin() += 3, pl.end(), sortPointsToBins <Node3DCartesian<T> *> ( p_x_min->getX(), p_y_min->getY(), p_x_max->getX(), p_y_max->getY(), ( unsigned int ) ( 0.1 * ( sqrt ( ( double ) pl.size() ) ) ) ) );
+        }
+
+        // Vertices of the mesh in the order of insertion: s3, s2, s1 and sorted points
+        const unsigned int n = pl.size();
+        mesh.reserve ( n, 2 * n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                mesh.addPoint ( pl [i] );
+        }
+
+        // Create first simplex triangle (s1, s2, s3)
+        mesh.addTriangle ( 2, 1, 0 );
 }
 
 
 template <typename T>
-void DT2D::DTInsertPoint ( Node3DCartesian <T> *p, const Node3DCartesian <T> *s1, const Node3DCartesian <T> *s2, const Node3DCartesian <T> *s3, HalfEdge <T> **e1, Container <HalfEdge <T> *>  &half_edges_dt )
+void DT2D::DTInsertPoint ( const unsigned int p, unsigned int *e1, TriangleMesh <T> &mesh, TWalkStatistics * walk_statistics )
 {
         // One step of the Delaunay triangulation, incremental insertion by de Berg (2001)
         short status = -1;
 
-        //HalfEdges
-        HalfEdge <T> *e2 = NULL;
-        HalfEdge <T> *e3 = NULL;
-        HalfEdge <T> *e4 = NULL;
-        HalfEdge <T> *e5 = NULL;
-        HalfEdge <T> *e6 = NULL;
-        HalfEdge <T> *e31 = NULL;
-        HalfEdge <T> *e21 = NULL;
-        HalfEdge <T> *e12 = NULL;
-        HalfEdge <T> *e32 = NULL;
-        HalfEdge <T> *e23 = NULL;
-        HalfEdge <T> *e13 = NULL;
-        HalfEdge <T> *e53 = NULL;
-        HalfEdge <T> *e44 = NULL;
-        HalfEdge <T> *e63 = NULL;
-
         try
         {
                 // Test, if point lies inside triangle
-		const T max_steps = 5 * half_edges_dt.size();
-                *e1 = LawsonOrientedWalk::findFaceWalk2 ( p, &status, *e1, max_steps);
+		const T max_steps = 5 * mesh.getEdgesCount();
+                *e1 = LawsonOrientedWalk::findFaceWalk2 ( mesh.getVertex ( p ), &status, mesh, *e1, max_steps, walk_statistics );
 
 		//Boundary triangle found, add point
-                if ( *e1 != NULL )
+                if ( *e1 != NO_HALF_EDGE )
                 {
-                        // Remaining edges of the triangle inside the added point lies
-                        e2 = ( *e1 )->getNextEdge();
-                        e3 = e2->getNextEdge();
+                        // Remaining edges of the triangle (a, b, c) inside the added point lies
+                        const unsigned int e2 = TriangleMesh <T>::getNextEdge ( *e1 );
+                        const unsigned int e3 = TriangleMesh <T>::getNextEdge ( e2 );
+                        const unsigned int a = mesh.getStartVertex ( *e1 ), b = mesh.getStartVertex ( e2 ), c = mesh.getStartVertex ( e3 );
 
                         // Point lies inside the triangle: split into 3 triangles
                         if ( status == 1 )
                         {
-                                // Create first new triangle T1, twin edges set after creation
-                                e31 = new HalfEdge <T> ( p, *e1, NULL );
-                                e21 = new HalfEdge <T> ( e2->getPoint(), e31, NULL );
-                                ( *e1 )->setNextEdge ( e21 );
+                                const unsigned int t2 = mesh.getTwinEdge ( e2 ), t3 = mesh.getTwinEdge ( e3 );
 
-                                // Create second new triangle T2, twin edges set after creation
-                                e12 = new HalfEdge <T> ( p, e2, NULL );
-                                e32 = new HalfEdge <T> ( e3->getPoint(), e12, NULL );
-                                e2->setNextEdge ( e32 );
+                                // First triangle T1 = (a, b, p) replaces the split triangle
+                                mesh.setStartVertex ( e3, p );
 
-                                // Create third new triangle T3, twin edges set after creation
-                                e23 = new HalfEdge <T> ( p, e3, NULL );
-                                e13 = new HalfEdge <T> ( ( *e1 )->getPoint(), e23, NULL );
-                                e3->setNextEdge ( e13 );
+                                // Create second new triangle T2 = (b, c, p) and third new triangle T3 = (c, a, p)
+                                const unsigned int e21 = mesh.addTriangle ( b, c, p );
+                                const unsigned int e31 = mesh.addTriangle ( c, a, p );
 
                                 // Set twin edges in T1, T2, T3
-                                e12->setTwinEdge ( e21 );
-                                e21->setTwinEdge ( e12 );
-                                e13->setTwinEdge ( e31 );
-                                e31->setTwinEdge ( e13 );
-                                e23->setTwinEdge ( e32 );
-                                e32->setTwinEdge ( e23 );
-
-                                // Add new edges into list
-                                half_edges_dt.push_back ( e21 );
-                                half_edges_dt.push_back ( e12 );
-                                half_edges_dt.push_back ( e31 );
-                                half_edges_dt.push_back ( e13 );
-                                half_edges_dt.push_back ( e32 );
-                                half_edges_dt.push_back ( e23 );
+                                mesh.setTwinEdges ( e21, t2 );
+                                mesh.setTwinEdges ( e31, t3 );
+                                mesh.setTwinEdges ( e2, e21 + 2 );
+                                mesh.setTwinEdges ( e21 + 1, e31 + 2 );
+                                mesh.setTwinEdges ( e31 + 1, e3 );
 
                                 // Legalize triangle T1
-                                if ( ( *e1 )->getTwinEdge() != NULL )
+                                if ( !mesh.isBoundaryEdge ( *e1 ) )
                                 {
-                                        legalizeTriangle ( p, *e1, s1, s2, s3 );
+                                        legalizeTriangle ( p, *e1, mesh );
                                 }
 
                                 // Legalize triangle T2
-                                if ( e2->getTwinEdge() != NULL )
+                                if ( !mesh.isBoundaryEdge ( e21 ) )
                                 {
-                                        legalizeTriangle ( p, e2, s1, s2, s3 );
+                                        legalizeTriangle ( p, e21, mesh );
                                 }
 
                                 // Legalize triangle T3
-                                if ( e3->getTwinEdge() != NULL )
+                                if ( !mesh.isBoundaryEdge ( e31 ) )
                                 {
-                                        legalizeTriangle ( p, e3, s1, s2, s3 );
+                                        legalizeTriangle ( p, e31, mesh );
                                 }
                         }
 
-                        // Point lies on the edge of the triangle: split into 4 triangles
+                        // Point lies on the edge (a, b) of the triangle: split into 4 triangles
                         else if ( status == 2 )
                         {
-                                // Find adjacent triangle
-                                e4 = ( *e1 )->getTwinEdge();
-                                e5 = e4->getNextEdge();
-                                e6 = e5->getNextEdge();
-
-                                // Create first new triangle T1, twin edges set after creation
-                                e21 = new HalfEdge < T > ( p, e3, NULL );
-                                ( *e1 )->setNextEdge ( e21 );
-
-                                // Create second new triangle T2, OK
-                                e12 = new HalfEdge <T> ( p, e2, e4 );
-                                e32 = new HalfEdge <T> ( e3->getPoint(), e12, e21 );
-                                e2->setNextEdge ( e32 );
-
-                                // Create third new triangle T3, twin edges set after creation
-                                e53 = new HalfEdge <T> ( p, e6, NULL );
-                                e4->setNextEdge ( e53 );
-
-                                // Create fourth new triangle T4, OK
-                                e44 = new HalfEdge <T> ( p, e5, *e1 );
-                                e63 = new HalfEdge <T> ( e6->getPoint(), e44, e53 );
-                                e5->setNextEdge ( e63 );
-
-                                // Set twin edges in T1, T3
-                                e21->setTwinEdge ( e32 );
-                                ( *e1 )->setTwinEdge ( e44 );
-                                e53->setTwinEdge ( e63 );
-                                e4->setTwinEdge ( e12 );
-
-                                // Add new edges into list
-                                half_edges_dt.push_back ( e21 );
-                                half_edges_dt.push_back ( e12 );
-                                half_edges_dt.push_back ( e32 );
-                                half_edges_dt.push_back ( e53 );
-                                half_edges_dt.push_back ( e63 );
-                                half_edges_dt.push_back ( e44 );
+                                // Find adjacent triangle (b, a, d)
+                                const unsigned int e4 = mesh.getTwinEdge ( *e1 );
+                                const unsigned int e5 = TriangleMesh <T>::getNextEdge ( e4 );
+                                const unsigned int e6 = TriangleMesh <T>::getNextEdge ( e5 );
+                                const unsigned int d = mesh.getStartVertex ( e6 );
+                                const unsigned int t2 = mesh.getTwinEdge ( e2 ), t5 = mesh.getTwinEdge ( e5 );
+
+                                // First triangle T1 = (a, p, c) and third triangle T3 = (b, p, d) replace the split triangles
+                                mesh.setStartVertex ( e2, p );
+                                mesh.setStartVertex ( e5, p );
+
+                                // Create second new triangle T2 = (b, c, p) and fourth new triangle T4 = (a, d, p)
+                                const unsigned int e21 = mesh.addTriangle ( b, c, p );
+                                const unsigned int e41 = mesh.addTriangle ( a, d, p );
+
+                                // Set twin edges in T1, T2, T3, T4
+                                mesh.setTwinEdges ( e21, t2 );
+                                mesh.setTwinEdges ( e41, t5 );
+                                mesh.setTwinEdges ( e2, e21 + 1 );
+                                mesh.setTwinEdges ( *e1, e41 + 2 );
+                                mesh.setTwinEdges ( e5, e41 + 1 );
+                                mesh.setTwinEdges ( e4, e21 + 2 );
 
                                 // Legalize triangle T1
-                                if ( e3->getTwinEdge() != NULL )
+                                if ( !mesh.isBoundaryEdge ( e3 ) )
                                 {
-                                        legalizeTriangle ( p, e3, s1, s2, s3 );
+                                        legalizeTriangle ( p, e3, mesh );
                                 }
 
                                 // Legalize triangle T4
-                                if ( e5->getTwinEdge() != NULL )
+                                if ( !mesh.isBoundaryEdge ( e41 ) )
                                 {
-                                        legalizeTriangle ( p, e5, s1, s2, s3 );
+                                        legalizeTriangle ( p, e41, mesh );
                                 }
 
                                 // Legalize triangle T3
-                                if ( e6->getTwinEdge() != NULL )
+                                if ( !mesh.isBoundaryEdge ( e6 ) )
                                 {
-                                        legalizeTriangle ( p, e6, s1, s2, s3 );
+                                        legalizeTriangle ( p, e6, mesh );
                                 }
 
                                 // Legalize triangle T2
-                                if ( e2->getTwinEdge() != NULL )
+                                if ( !mesh.isBoundaryEdge ( e21 ) )
                                 {
-                                        legalizeTriangle ( p, e2, s1, s2, s3 );
+                                        legalizeTriangle ( p, e21, mesh );
                                 }
                         }
                 }
@@ -329,43 +331,13 @@ void DT2D::DTInsertPoint ( Node3DCartesian <T> *p, const Node3DCartesian <T> *s1
 		else
 		{
 			//Re-initialize start edge
-			*e1 = half_edges_dt[0];
+			*e1 = 0;
 		}
         }
 
         //Throw exception
         catch ( ErrorMathZeroDevision <T> & error )
         {
-                //Set NULL pointers
-                if ( e1 != NULL ) ( *e1 ) -> setNextEdge ( NULL );
-
-                if ( e2 != NULL ) e2 ->setNextEdge ( NULL );
-
-                if ( e3 != NULL ) e3 ->setNextEdge ( NULL );
-
-                if ( e4 != NULL ) e4->setNextEdge ( NULL );
-
-                if ( e5 != NULL ) e5->setNextEdge ( NULL );
-
-                //Free memory
-                if ( e31 != NULL ) delete e31;
-
-                if ( e21 != NULL ) delete e21;
-
-                if ( e12 != NULL ) delete e12;
-
-                if ( e32 != NULL ) delete e32;
-
-                if ( e23 != NULL ) delete e23;
-
-                if ( e13 != NULL ) delete e13;
-
-                if ( e53 != NULL ) delete e53;
-
-                if ( e44 != NULL ) delete e44;
-
-                if ( e63 != NULL ) delete e63;
-
                 //Throw exception
                 throw ErrorMathZeroDevision <T> ( "ErrorMathZeroDevision: ", "Delaunay triangulation: Can not create new triangles for inserted point p.", error.getArg() );
         }
@@ -373,47 +345,39 @@ void DT2D::DTInsertPoint ( Node3DCartesian <T> *p, const Node3DCartesian <T> *s1
 
 
 template <typename T>
-void DT2D::legalizeTriangle ( Node3DCartesian <T> *p, HalfEdge <T> *e11, const Node3DCartesian <T> *s1, const Node3DCartesian <T> *s2, const Node3DCartesian <T> *s3 )
+void DT2D::legalizeTriangle ( const unsigned int p, const unsigned int e11, TriangleMesh <T> &mesh )
 {
         //Recursive legalization procedure: defined in Computational Geometry, de Berg et al, pp 196
-        HalfEdge <T> *e21 = e11->getTwinEdge();		// First edge in triangle adjacent to legalized
-        HalfEdge <T> *e22 = e21->getNextEdge();		// Second edge in triangle adjacent to legalized
-        HalfEdge <T> *e23 = e22->getNextEdge();		// Third edge in triangle adjacent to legalized
-        HalfEdge <T> *e12 = e11->getNextEdge();         // Second edge in  legalized triangle
-        HalfEdge <T> *e13 = e12->getNextEdge();		// Third edge in  legalized triangle
+        //Edge e11 lies in the triangle (p1, p2, p) opposite to the point p, the adjacent triangle is (p2, p1, p3)
+        const unsigned int e21 = mesh.getTwinEdge ( e11 );			// First edge in triangle adjacent to legalized
+        const unsigned int e22 = TriangleMesh <T>::getNextEdge ( e21 );		// Second edge in triangle adjacent to legalized
+        const unsigned int e23 = TriangleMesh <T>::getNextEdge ( e22 );		// Third edge in triangle adjacent to legalized
 
         //Get vertices of the quadrilateral
-        const Node3DCartesian <T> *p1 = e21->getPoint();
-        const Node3DCartesian <T> *p2 = e22->getPoint();
-        const Node3DCartesian <T> *p3 = e23->getPoint();
-
-        //Test, if points p1, p2, p3, p4 are identical to simplex points s1, s2, s3
-        //Returns number of point to which is point p identical (1 - 3),
-        //We test each vertex  of the quadrilateral to each simplex point
-        const unsigned short b11 = ( p1 == s1 );
-        const unsigned short b12 = 2 * ( p1 == s2 );
-        const unsigned short b13 = 3 * ( p1 == s3 );
-        const unsigned short b21 = ( p2 == s1 );
-        const unsigned short b22 = 2 * ( p2 == s2 );
-        const unsigned short b23 = 3 * ( p2 == s3 );
-        const unsigned short b31 = ( p3 == s1 );
-        const unsigned short b32 = 2 * ( p3 == s2 );
-        const unsigned short b33 = 3 * ( p3 == s3 );
-        const unsigned short b41 = ( p == s1 );
-        const unsigned short b42 = 2 * ( p == s2 );
-        const unsigned short b43 = 3 * ( p == s3 );
+        const unsigned int i1 = mesh.getStartVertex ( e21 );
+        const unsigned int i2 = mesh.getStartVertex ( e22 );
+        const unsigned int i3 = mesh.getStartVertex ( e23 );
+
+        //Test, if points p1, p2, p3, p4 are identical to simplex points s1, s2, s3 (first three vertices of the mesh)
+        //Returns number of point to which is point p identical (1 - 3), 0 otherwise
 
         //Point p1 is identical with any of point s1, s2, s3
-        const unsigned short b1 = b11 + b12 + b13;
+        const unsigned short b1 = ( i1 < 3 ? i1 + 1 : 0 );
 
         //Point p2 is identical with any of point s1, s2, s3
-        const unsigned short b2 = b21 + b22 + b23;
+        const unsigned short b2 = ( i2 < 3 ? i2 + 1 : 0 );
 
         //Point p3 is identical with any of point s1, s2, s3
-        const unsigned short b3 = b31 + b32 + b33;
+        const unsigned short b3 = ( i3 < 3 ? i3 + 1 : 0 );
 
         //Point p4 is identical with any of point s1, s2, s3
-        const unsigned short b4 = b41 + b42 + b43;
+        const unsigned short b4 = ( p < 3 ? p + 1 : 0 );
+
+        //Get points of the quadrilateral
+        const Node3DCartesian <T> *pp = mesh.getVertex ( p );
+        const Node3DCartesian <T> *p1 = mesh.getVertex ( i1 );
+        const Node3DCartesian <T> *p2 = mesh.getVertex ( i2 );
+        const Node3DCartesian <T> *p3 = mesh.getVertex ( i3 );
 
         //Define rules
         bool illegal_triangle = false;
@@ -429,7 +393,7 @@ void DT2D::legalizeTriangle ( Node3DCartesian <T> *p, HalfEdge <T> *e11, const N
         else if ( ( b1 == 0 ) && ( b2 == 0 ) && ( b3 == 0 ) && ( b4 == 0 ) )
         {
                 //Swap diagonal in convex quadrilateral using Cline-Renka
-                illegal_triangle = SwappingCriteria::getClineRenka ( p, p1, p2, p3 ) ;
+                illegal_triangle = SwappingCriteria::getClineRenka ( pp, p1, p2, p3 ) ;
         }
 
         //Rule 3: One point is a simplex
@@ -438,7 +402,7 @@ void DT2D::legalizeTriangle ( Node3DCartesian <T> *p, HalfEdge <T> *e11, const N
                 //Point p1 or p2 represent a simplex
                 if ( b1 > 0 || b2 > 0 )
                 {
-                        illegal_triangle = ( ConvexQuadrilateral::isStrictlyConvex ( p1, p, p2, p3 ) == 1 );
+                        illegal_triangle = ( ConvexQuadrilateral::isStrictlyConvex ( p1, pp, p2, p3 ) == 1 );
                 }
         }
 
@@ -451,7 +415,7 @@ void DT2D::legalizeTriangle ( Node3DCartesian <T> *p, HalfEdge <T> *e11, const N
                         //Swap diagonal
                         if ( b1 > b3 )
                         {
-                                illegal_triangle = ( ConvexQuadrilateral::isStrictlyConvex ( p1, p, p2, p3 ) == 1 );
+                                illegal_triangle = ( ConvexQuadrilateral::isStrictlyConvex ( p1, pp, p2, p3 ) == 1 );
                         }
                 }
 
@@ -461,7 +425,7 @@ void DT2D::legalizeTriangle ( Node3DCartesian <T> *p, HalfEdge <T> *e11, const N
                         //Swap diagonal
                         if ( b2 > b3 )
                         {
-                                illegal_triangle = ( ConvexQuadrilateral::isStrictlyConvex ( p1, p, p2, p3 ) == 1 );
+                                illegal_triangle = ( ConvexQuadrilateral::isStrictlyConvex ( p1, pp, p2, p3 ) == 1 );
                         }
                 }
 
@@ -471,7 +435,7 @@ void DT2D::legalizeTriangle ( Node3DCartesian <T> *p, HalfEdge <T> *e11, const N
                         //Swap diagonal
                         if ( b1 > b4 )
                         {
-                                illegal_triangle = ( ConvexQuadrilateral::isStrictlyConvex ( p1, p, p2, p3 ) == 1 );
+                                illegal_triangle = ( ConvexQuadrilateral::isStrictlyConvex ( p1, pp, p2, p3 ) == 1 );
                         }
                 }
 
@@ -481,7 +445,7 @@ void DT2D::legalizeTriangle ( Node3DCartesian <T> *p, HalfEdge <T> *e11, const N
                         //Swap diagonal
                         if ( b2 > b4 )
                         {
-                                illegal_triangle = ( ConvexQuadrilateral::isStrictlyConvex ( p1, p, p2, p3 ) == 1 );
+                                illegal_triangle = ( ConvexQuadrilateral::isStrictlyConvex ( p1, pp, p2, p3 ) == 1 );
                         }
                 }
         }
@@ -489,18 +453,22 @@ void DT2D::legalizeTriangle ( Node3DCartesian <T> *p, HalfEdge <T> *e11, const N
         // Illegal triangle, swap diagonal
         if ( illegal_triangle )
         {
-                // Swap diagonal in (e11,e12,e13) and (e21,e22,e23)
-                swapDiagonal ( e11, e12, e13, e21, e22, e23 );
+                // Swap diagonal in (p1, p2, p) and (p2, p1, p3): triangles (p3, p, p2) and (p, p3, p1) are created
+                mesh.swapDiagonal ( e11 );
+
+                // Edges (p2, p3) and (p3, p1) opposite to p
+                const unsigned int e_23 = TriangleMesh <T>::getPreviousEdge ( e11 );
+                const unsigned int e_31 = TriangleMesh <T>::getNextEdge ( e21 );
 
                 // Legalize adjacent triangles
-                if ( e22->getTwinEdge() != NULL )
+                if ( !mesh.isBoundaryEdge ( e_23 ) )
                 {
-                        legalizeTriangle ( p, e22, s1, s2, s3 );			// Triangle adjacent to first newly created
+                        legalizeTriangle ( p, e_23, mesh );			// Triangle adjacent to first newly created
                 }
 
-                if ( e23->getTwinEdge() != NULL )
+                if ( !mesh.isBoundaryEdge ( e_31 ) )
                 {
-                        legalizeTriangle ( p, e23, s1, s2, s3 );			// Triangle adjacent to second newly created
+                        legalizeTriangle ( p, e_31, mesh );			// Triangle adjacent to second newly created
                 }
 
         }
@@ -530,76 +498,333 @@ void DT2D::swapDiagonal ( HalfEdge <T> *e_twin, HalfEdge <T> *e12, HalfEdge <T>
 
 
 template <typename T>
-void DT2D::removeSimplexTriangles ( Container <Node3DCartesian <T> *> &nl, Container <HalfEdge <T> *> &half_edges_dt )
+void DT2D::removeSimplexTriangles ( Container <Node3DCartesian <T> *> &nl, TriangleMesh <T> &mesh )
 {
         // Remove simplex triangles
-        const Node3DCartesian <T> *s1 = nl [0];  //Simplex s1
-        const Node3DCartesian <T> *s2 = nl [1];  //Simplex s2
-        const Node3DCartesian <T> *s3 = nl [2];  //Simplex s3
+        const unsigned int n = mesh.getTrianglesCount();
+        std::vector <bool> simplex_triangles ( n, false );
+
+        // Check all triangles, simplex points are the first three vertices
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                simplex_triangles[i] = ( mesh.getStartVertex ( 3 * i ) < 3 ) || ( mesh.getStartVertex ( 3 * i + 1 ) < 3 ) || ( mesh.getStartVertex ( 3 * i + 2 ) < 3 );
+        }
+
+        // Remove simplex triangles, adjacent edges become boundary edges
+        mesh.removeTriangles ( simplex_triangles );
+
+        // Remove simplex points from the mesh
+        mesh.removePoints ( 3 );
+
+        //Remove three simplex points
+        delete nl [0];
+        delete nl [1];
+        delete nl [2];
+
+        //Remove first three items of vector
+        typename  TItemsList <Node3DCartesian <T> *>::Type ::iterator i_points = nl.begin();
+        i_points = nl.erase ( i_points );
+        i_points = nl.erase ( i_points );
+        i_points = nl.erase ( i_points );
+}
+
+
+template <typename T>
+void DT2D::DTDivideAndConquer ( Container <Node3DCartesian <T> *> &nl, TriangleMesh <T> &mesh )
+{
+        //Delaunay triangulation by divide and conquer method (Guibas, Stolfi, 1985), duplicate points are removed
+        const unsigned int n = nl.size();
+        std::vector <Node3DCartesian <T> *> points ( nl.begin(), nl.end() );
 
-        // Check all edges
-        unsigned int n = half_edges_dt.size();
+        //Sort points by x and y
+        std::sort ( points.begin(), points.end(), sortPointsByX () );
+
+        //All points are colinear with the first and the last point
+        bool colinear = true;
+
+        for ( unsigned int i = 1; ( i < n - 1 ) && colinear; i++ )
+        {
+                colinear = ( RobustPredicates::getOrientation2D ( points[0], points[i], points[n - 1] ) == 0 );
+        }
+
+        if ( colinear )
+                throw ErrorBadData ( "ErrorBadData: All input points are colinear. ", "Can not contruct Delaunay triangulation. " );
+
+        //Triangulate points using quad edges, large parts are triangulated by the parallel tasks
+        QuadEdgeMesh qe;
+        qe.reserve ( 3 * n );
+
+        unsigned int le = 0, re = 0;
+
+#ifdef _OPENMP
+        #pragma omp parallel if ( n >= 2 * DT_PARALLEL_BUILD_SIZE )
+        #pragma omp single
+#endif
+        triangulateDivideAndConquer ( points, 0, n, qe, le, re );
+
+        //Convert quad edges to the triangle mesh
+        mesh.reserve ( n, 2 * n );
 
         for ( unsigned int i = 0; i < n; i++ )
         {
-                const Node3DCartesian <T> *p = half_edges_dt [i]->getPoint();
+                mesh.addPoint ( points[i] );
+        }
+
+        createTriangles ( points, qe, mesh );
+}
+
+
+template <typename T>
+void DT2D::triangulateDivideAndConquer ( const std::vector <Node3DCartesian <T> *> &points, const unsigned int begin, const unsigned int end, QuadEdgeMesh &qe, unsigned int &le, unsigned int &re )
+{
+        //Triangulate points [begin, end), at least 2 points
+        //	le: counterclockwise convex hull edge out of the leftmost vertex,
+        //	re: clockwise convex hull edge out of the rightmost vertex
+        const unsigned int n = end - begin;
+
+        //Two points: one edge
+        if ( n == 2 )
+        {
+                const unsigned int a = qe.makeEdge ( begin, begin + 1 );
+
+                le = a;
+                re = QuadEdgeMesh::getSym ( a );
+
+                return;
+        }
+
+        //Three points: triangle or two colinear edges
+        if ( n == 3 )
+        {
+                const unsigned int a = qe.makeEdge ( begin, begin + 1 );
+                const unsigned int b = qe.makeEdge ( begin + 1, begin + 2 );
+                qe.splice ( QuadEdgeMesh::getSym ( a ), b );
 
-                // Remember simplex triangles
-                if ( p == s1 || p == s2 || p == s3 )
+                const double orientation = RobustPredicates::getOrientation2D ( points[begin], points[begin + 1], points[begin + 2] );
+
+                //Counterclockwise triangle
+                if ( orientation > 0 )
                 {
-                        // Get edges belonging to simplex triangle
-                        HalfEdge <T> *e2 = half_edges_dt [i]->getNextEdge();
-                        HalfEdge <T> *e3 = e2->getNextEdge();
-
-                        // Mark edges belonging to simplex triangle
-                        half_edges_dt [i]->setEdgeAsSimplex ( true );
-                        e2->setEdgeAsSimplex ( true );
-                        e3->setEdgeAsSimplex ( true );
-
-                        // Get twin edges of the simplex triangle
-                        HalfEdge <T> *et1 = half_edges_dt [i]->getTwinEdge();
-                        HalfEdge <T> *et2 = e2->getTwinEdge();
-                        HalfEdge <T> *et3 = e3->getTwinEdge();
-
-                        // Remove pointers from adjacent edges to simplex edges
-                        if ( et1 != NULL )
-                        {
-                                et1->setTwinEdge ( NULL );
-                        }
+                        qe.connect ( b, a );
+
+                        le = a;
+                        re = QuadEdgeMesh::getSym ( b );
+                }
+
+                //Clockwise triangle
+                else if ( orientation < 0 )
+                {
+                        const unsigned int c = qe.connect ( b, a );
+
+                        le = QuadEdgeMesh::getSym ( c );
+                        re = c;
+                }
+
+                //Colinear points
+                else
+                {
+                        le = a;
+                        re = QuadEdgeMesh::getSym ( b );
+                }
+
+                return;
+        }
+
+        //Split points into the left and right halves
+        const unsigned int middle = begin + n / 2;
+        unsigned int ldo = 0, ldi = 0, rdi = 0, rdo = 0;
+
+#ifdef _OPENMP
+        //Large part: triangulate the right half by a separate task using its own quad edges
+        if ( n >= 2 * DT_PARALLEL_BUILD_SIZE )
+        {
+                QuadEdgeMesh qe_right;
+
+                #pragma omp task default ( shared )
+                triangulateDivideAndConquer ( points, middle, end, qe_right, rdi, rdo );
+
+                triangulateDivideAndConquer ( points, begin, middle, qe, ldo, ldi );
+
+                #pragma omp taskwait
+
+                //Join quad edges of both halves
+                const unsigned int offset = qe.append ( qe_right );
+                rdi += offset;
+                rdo += offset;
+        }
+
+        else
+#endif
+        {
+                //Triangulate left half
+                triangulateDivideAndConquer ( points, begin, middle, qe, ldo, ldi );
+
+                //Triangulate right half
+                triangulateDivideAndConquer ( points, middle, end, qe, rdi, rdo );
+        }
+
+        //Merge both triangulations
+        mergeDivideAndConquer ( points, qe, ldo, ldi, rdi, rdo, le, re );
+}
+
+
+template <typename T>
+void DT2D::mergeDivideAndConquer ( const std::vector <Node3DCartesian <T> *> &points, QuadEdgeMesh &qe, unsigned int ldo, unsigned int ldi, unsigned int rdi, unsigned int rdo, unsigned int &le, unsigned int &re )
+{
+        //Merge left and right triangulations, ldi and rdi are the inner convex hull edges of the left and right triangulations
+        //Find the lower common tangent of both convex hulls
+        for ( ;; )
+        {
+                //Origin of rdi lies left to ldi
+                if ( RobustPredicates::getOrientation2D ( points[qe.getOrigin ( rdi )], points[qe.getOrigin ( ldi )], points[qe.getDestination ( ldi )] ) > 0 )
+                {
+                        ldi = qe.getLnext ( ldi );
+                }
+
+                //Origin of ldi lies right to rdi
+                else if ( RobustPredicates::getOrientation2D ( points[qe.getOrigin ( ldi )], points[qe.getDestination ( rdi )], points[qe.getOrigin ( rdi )] ) > 0 )
+                {
+                        rdi = qe.getRprev ( rdi );
+                }
+
+                else
+                {
+                        break;
+                }
+        }
+
+        //Create base edge from the right to the left triangulation
+        unsigned int basel = qe.connect ( QuadEdgeMesh::getSym ( rdi ), ldi );
+
+        if ( qe.getOrigin ( ldi ) == qe.getOrigin ( ldo ) )
+        {
+                ldo = QuadEdgeMesh::getSym ( basel );
+        }
+
+        if ( qe.getOrigin ( rdi ) == qe.getOrigin ( rdo ) )
+        {
+                rdo = basel;
+        }
+
+        //Add cross edges from the bottom to the top
+        for ( ;; )
+        {
+                const Node3DCartesian <T> *p_start = points[qe.getDestination ( basel )];
+                const Node3DCartesian <T> *p_end = points[qe.getOrigin ( basel )];
+
+                //Left candidate: remove left edges violating the empty circle criterion
+                unsigned int lcand = qe.getOnext ( QuadEdgeMesh::getSym ( basel ) );
 
-                        if ( et2 != NULL )
+                if ( RobustPredicates::getOrientation2D ( points[qe.getDestination ( lcand )], p_start, p_end ) > 0 )
+                {
+                        while ( RobustPredicates::getInCircle ( p_start, p_end, points[qe.getDestination ( lcand )], points[qe.getDestination ( qe.getOnext ( lcand ) )] ) > 0 )
                         {
-                                et2->setTwinEdge ( NULL );
+                                const unsigned int t = qe.getOnext ( lcand );
+                                qe.deleteEdge ( lcand );
+                                lcand = t;
                         }
+                }
 
-                        if ( et3 != NULL )
+                //Right candidate: remove right edges violating the empty circle criterion
+                unsigned int rcand = qe.getOprev ( basel );
+
+                if ( RobustPredicates::getOrientation2D ( points[qe.getDestination ( rcand )], p_start, p_end ) > 0 )
+                {
+                        while ( RobustPredicates::getInCircle ( p_start, p_end, points[qe.getDestination ( rcand )], points[qe.getDestination ( qe.getOprev ( rcand ) )] ) > 0 )
                         {
-                                et3->setTwinEdge ( NULL );
+                                const unsigned int t = qe.getOprev ( rcand );
+                                qe.deleteEdge ( rcand );
+                                rcand = t;
                         }
                 }
+
+                //Candidates lying above the base edge
+                const bool lvalid = RobustPredicates::getOrientation2D ( points[qe.getDestination ( lcand )], p_start, p_end ) > 0;
+                const bool rvalid = RobustPredicates::getOrientation2D ( points[qe.getDestination ( rcand )], p_start, p_end ) > 0;
+
+                //Upper common tangent has been reached
+                if ( !lvalid && !rvalid )
+                {
+                        break;
+                }
+
+                //Connect the right candidate
+                if ( !lvalid || ( rvalid && RobustPredicates::getInCircle ( points[qe.getDestination ( lcand )], points[qe.getOrigin ( lcand )], points[qe.getOrigin ( rcand )], points[qe.getDestination ( rcand )] ) > 0 ) )
+                {
+                        basel = qe.connect ( rcand, QuadEdgeMesh::getSym ( basel ) );
+                }
+
+                //Connect the left candidate
+                else
+                {
+                        basel = qe.connect ( QuadEdgeMesh::getSym ( basel ), QuadEdgeMesh::getSym ( lcand ) );
+                }
         }
 
-        // Remove simplex
-        typename  TItemsList <HalfEdge<T> *>::Type ::iterator i_half_edges = std::remove_if ( half_edges_dt.begin(), half_edges_dt.end(), removeSimplexHalfEdge() );
-        half_edges_dt.erase ( i_half_edges, half_edges_dt.end() );
+        le = ldo;
+        re = rdo;
+}
 
-        //Remove three simplex points
-        delete s1;
-        delete s2;
-        delete s3;
 
-        //Remove first three items of vector
-        typename  TItemsList <Node3DCartesian <T> *>::Type ::iterator i_points = nl.begin();
-        i_points = nl.erase ( i_points );
-        i_points = nl.erase ( i_points );
-        i_points = nl.erase ( i_points );
+template <typename T>
+void DT2D::createTriangles ( const std::vector <Node3DCartesian <T> *> &points, const QuadEdgeMesh &qe, TriangleMesh <T> &mesh )
+{
+        //Create triangles of the mesh from the counterclockwise faces of quad edges having 3 edges
+        const unsigned int n = qe.getEdgesCount();
+        std::vector <unsigned int> half_edges ( n, NO_HALF_EDGE );
 
-        // Set all edges as non simplex
-        n = half_edges_dt.size();
+        //Process all primal edges
+        for ( unsigned int e1 = 0; e1 < n; e1 += 2 )
+        {
+                if ( ( half_edges[e1] != NO_HALF_EDGE ) || ( qe.isDeleted ( e1 ) ) )
+                {
+                        continue;
+                }
 
+                const unsigned int e2 = qe.getLnext ( e1 ), e3 = qe.getLnext ( e2 );
+
+                //Left face is a counterclockwise triangle (the outer face is clockwise)
+                if ( ( qe.getLnext ( e3 ) == e1 ) && ( RobustPredicates::getOrientation2D ( points[qe.getOrigin ( e1 )], points[qe.getOrigin ( e2 )], points[qe.getOrigin ( e3 )] ) > 0 ) )
+                {
+                        const unsigned int t = mesh.addTriangle ( qe.getOrigin ( e1 ), qe.getOrigin ( e2 ), qe.getOrigin ( e3 ) );
+
+                        half_edges[e1] = t;
+                        half_edges[e2] = t + 1;
+                        half_edges[e3] = t + 2;
+                }
+        }
+
+        //Set twin edges
+        for ( unsigned int e = 0; e < n; e += 2 )
+        {
+                if ( ( half_edges[e] != NO_HALF_EDGE ) && ( half_edges[QuadEdgeMesh::getSym ( e )] != NO_HALF_EDGE ) )
+                {
+                        mesh.setTwinEdges ( half_edges[e], half_edges[QuadEdgeMesh::getSym ( e )] );
+                }
+        }
+}
+
+
+template <typename T>
+void DT2D::createHalfEdges ( const TriangleMesh <T> &mesh, Container <HalfEdge <T> *> &half_edges )
+{
+        //Create half edges (start point, next and twin edges) from the triangle mesh
+        const unsigned int n = mesh.getEdgesCount(), first = half_edges.size();
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                half_edges.push_back ( new HalfEdge <T> ( mesh.getPoint ( i ), NULL, NULL ) );
+        }
+
+        //Link half edges
         for ( unsigned int i = 0; i < n; i++ )
         {
-                half_edges_dt [i] ->setEdgeAsSimplex ( false );
+                half_edges [first + i]->setNextEdge ( half_edges [first + TriangleMesh <T>::getNextEdge ( i )] );
+
+                if ( !mesh.isBoundaryEdge ( i ) )
+                {
+                        half_edges [first + i]->setTwinEdge ( half_edges [first + mesh.getTwinEdge ( i )] );
+                }
         }
 }
 
@@ -39,6 +39,9 @@ class VoronoiCell;
 template <typename T>
 class HalfEdgesList;
 
+template <typename T>
+class TriangleMesh;
+
 
 //Set type of generated VoronoiCells: all cells, only bounded cells, only bounded cells of the appropriate shape
 typedef enum
@@ -65,13 +68,16 @@ class Voronoi2D
                 template <typename T>
                 static void VD ( Container <Node3DCartesian <T> *> &points, Container <Node3DCartesian <T> *> &vor_points, Container <HalfEdge <T> *> &hl_dt, Container <HalfEdge <T> *> &hl_vor, Container <VoronoiCell <T> *> &vl, const TVoronoiCellsType cells_type = BoundedCells, const TVoronoiDiagramMethod vor_diagram_method = TopologicApproach, const bool print_message = false, const bool print_exception = true, std::ostream * output = &std::cout );
 
+                template <typename T>
+                static void VD ( Container <Node3DCartesian <T> *> &points, Container <Node3DCartesian <T> *> &vor_points, TriangleMesh <T> &dt, Container <HalfEdge <T> *> &hl_vor, Container <VoronoiCell <T> *> &vl, const TVoronoiCellsType cells_type = BoundedCells, const TVoronoiDiagramMethod vor_diagram_method = TopologicApproach, const bool print_message = false, const bool print_exception = true, std::ostream * output = &std::cout );
+
                 template <typename T>
                 static void mergeVoronoiCellAndAdjacentCells ( const VoronoiCell <T> *voronoi_cell, Face <T> ** output_face, Container <Node3DCartesian <T> *>  &intersections, Container <HalfEdge <T> *> &hl );
 
         private:
 
                 template <typename T>
-                static void createVoronoiCells ( Container <HalfEdge <T> *> &hl_dt, Container <HalfEdge <T> *> &hl_vor, Container <Node3DCartesian <T> *> &vor_points, Container <VoronoiCell <T> *> &vl,
+                static void createVoronoiCells ( const TriangleMesh <T> &dt, HalfEdge <T> * const * hl_dt, Container <HalfEdge <T> *> &hl_vor, Container <Node3DCartesian <T> *> &vor_points, Container <VoronoiCell <T> *> &vl,
                                                  const TVoronoiCellsType cells_type, const TVoronoiDiagramMethod vor_diagram_method );
 
                 template <typename T>
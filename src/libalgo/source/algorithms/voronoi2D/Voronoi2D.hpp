@@ -30,6 +30,7 @@
 #include "libalgo/source/const/Const.h"
 
 #include "libalgo/source/structures/line/HalfEdge.h"
+#include "libalgo/source/structures/list/TriangleMesh.h"
 
 #include "libalgo/source/structures/face/VoronoiCell.h"
 
@@ -55,15 +56,81 @@ void Voronoi2D::VD ( Container <Node3DCartesian <T> *> &points, Container <Node3
                         vor_diagram_method == TopologicApproach ? *output << "topologic approach. \n" : *output << "error free approach. \n";
                 }
 
+                //Perform Delaunay triangulation over the triangle mesh and convert it to the half edges
+                TriangleMesh <T> dt;
+                DT2D::DT ( points, dt, print_message, print_exception, output );
+
+                const unsigned int n_dt = hl_dt.size();
+                DT2D::createHalfEdges ( dt, hl_dt );
+
+                //At least 3 Delaunay edges (one triangle) were created
+                if ( dt.getEdgesCount() > 3 )
+                {
+                        //Construct Voronoi diagram cell by cell from each halfedge: edge -> twin -> previous, link dual edges
+                        createVoronoiCells ( dt, &* ( hl_dt.begin() + n_dt ), hl_vor, vor_points, vl, cells_type, vor_diagram_method );
+
+                        //Correct Voronoi cells for topologic approach
+                        correctTopologyInVoronoiCells ( hl_vor, vor_points );
+
+                        //Remove unbounded Voronoi cells
+                        if ( cells_type == BoundedCells || cells_type == AppropriateBoundedCells )
+                        {
+                                removeUnboundedVoronoiCells ( vl );
+                        }
+
+                        //Print info
+                        if ( print_message )
+                        {
+                                *output << " Completed." << std::endl;
+                        }
+                }
+        }
+
+        //Throw exception
+        catch ( Error & error )
+        {
+                //Clear lists
+                vor_points.clear();
+                hl_dt.clear();
+                hl_vor.clear();
+                vl.clear();
+
+                //Print exception
+                if ( print_exception )
+                {
+                        error.printException();
+                }
+
+                throw error;
+        }
+}
+
+
+template <typename T>
+void Voronoi2D::VD ( Container <Node3DCartesian <T> *> &points, Container <Node3DCartesian <T> *> &vor_points, TriangleMesh <T> &dt, Container <HalfEdge <T> *> &hl_vor, Container <VoronoiCell <T> *> &vl,
+                     const TVoronoiCellsType cells_type, const TVoronoiDiagramMethod vor_diagram_method, const bool print_message, const bool print_exception, std::ostream * output )
+{
+        //Create 2D Voronoi diagrams using duality between DT <-> VT, DT is stored in the triangle mesh
+        try
+        {
+                //Print info
+                if ( print_message )
+                {
+                        *output << "> Starting VD, please wait... ";
+                        *output << "Cells type: ";
+                        cells_type == AllCells ? *output << "all cells. \n" : *output << "unbounded cells. \n";
+                        *output << "Voronoi diagram type: ";
+                        vor_diagram_method == TopologicApproach ? *output << "topologic approach. \n" : *output << "error free approach. \n";
+                }
+
                 //Perform Delaunay triangulation
-                DT2D::DT ( points, hl_dt, print_message, print_exception, output );
-                //DXFExport::exportDTToDXF ( "D:\\Tomas\\Cpp\\detectproj\\detectproj\\out\\dt_error_merc.dxf", hl_dt );
+                DT2D::DT ( points, dt, print_message, print_exception, output );
 
                 //At least 3 Delaunay edges (one triangle) were created
-                if ( hl_dt.size() > 3 )
+                if ( dt.getEdgesCount() > 3 )
                 {
                         //Construct Voronoi diagram cell by cell from each halfedge: edge -> twin -> previous
-                        createVoronoiCells ( hl_dt, hl_vor, vor_points, vl, cells_type, vor_diagram_method );
+                        createVoronoiCells ( dt, ( HalfEdge <T> * const * ) NULL, hl_vor, vor_points, vl, cells_type, vor_diagram_method );
 
                         //Correct Voronoi cells for topologic approach
                         correctTopologyInVoronoiCells ( hl_vor, vor_points );
@@ -87,7 +154,7 @@ void Voronoi2D::VD ( Container <Node3DCartesian <T> *> &points, Container <Node3
         {
                 //Clear lists
                 vor_points.clear();
-                hl_dt.clear();
+                dt.clear();
                 hl_vor.clear();
                 vl.clear();
 
@@ -102,15 +169,22 @@ void Voronoi2D::VD ( Container <Node3DCartesian <T> *> &points, Container <Node3
 }
 
 
+
 template <typename T>
-void Voronoi2D:: createVoronoiCells ( Container <HalfEdge <T> *> &hl_dt, Container <HalfEdge <T> *> &hl_vor, Container <Node3DCartesian <T> *> &vor_points, Container <VoronoiCell <T> *> &vl,
+void Voronoi2D::createVoronoiCells ( const TriangleMesh <T> &dt, HalfEdge <T> * const * hl_dt, Container <HalfEdge <T> *> &hl_vor, Container <Node3DCartesian <T> *> &vor_points, Container <VoronoiCell <T> *> &vl,
                                       const TVoronoiCellsType cells_type, const TVoronoiDiagramMethod vor_diagram_method )
 {
-        //Create Voronoi Diagram with full topolgy from Delaunay edges
-        std::queue <HalfEdge <T> *> Q;
+        //Create Voronoi Diagram with full topolgy from Delaunay edges (dual edges of the DT half edges hl_dt are set, if available)
+        const unsigned int n = dt.getEdgesCount();
+        std::queue <unsigned int> Q;
+
+        //Processed Delaunay edges and Voronoi edges dual to Delaunay edges
+        std::vector <bool> processed ( n, false );
+        std::vector <HalfEdge <T> *> dual ( n, ( HalfEdge <T> * ) NULL );
 
         //Add first edge to the list
-        Q.push ( hl_dt [0] );
+        unsigned int e_seed = 0;
+        Q.push ( e_seed );
 
         //Process all edges int the queue
         while ( ! Q.empty() )
@@ -120,19 +194,19 @@ void Voronoi2D:: createVoronoiCells ( Container <HalfEdge <T> *> &hl_dt, Contain
                 HalfEdge <T> *vor_edge = NULL, *vor_edge_previous = NULL, * vor_edge_first = NULL, *vor_edge_boundary = NULL;
 
                 //Remember start edge
-                HalfEdge <T> *e = Q.front();
-                HalfEdge <T> *e_start = e;
+                unsigned int e = Q.front();
+                const unsigned int e_start = e;
 
                 //Remove element on the top
                 Q.pop();
 
                 //Edge has not been processed
-                if ( !e_start->isSimplexEdge() )
+                if ( !processed[e_start] )
                 {
                         //Get vertices of the Deluanay triangle
-                        Node3DCartesian <T> *q1 = e->getPoint();
-                        Node3DCartesian <T> *q2 = e->getNextEdge() -> getPoint();
-                        Node3DCartesian <T> *q3 = e->getNextEdge()->getNextEdge()->getPoint();
+                        Node3DCartesian <T> *q1 = dt.getPoint ( e );
+                        Node3DCartesian <T> *q2 = dt.getPoint ( TriangleMesh <T>::getNextEdge ( e ) );
+                        Node3DCartesian <T> *q3 = dt.getPoint ( TriangleMesh <T>::getPreviousEdge ( e ) );
 
                         //Remember start nodes
                         Node3DCartesian <T> *q1_start = q1;
@@ -170,21 +244,21 @@ void Voronoi2D:: createVoronoiCells ( Container <HalfEdge <T> *> &hl_dt, Contain
                                 }
 
                                 //Set this edge as processed (all edges on the same side of the triangle as edge e_start)
-                                e->setEdgeAsSimplex ( true );
+                                processed[e] = true;
 
                                 //Get twin edge
-                                HalfEdge <T> *e_twin = e->getTwinEdge();
+                                const unsigned int e_twin = dt.getTwinEdge ( e );
                                 Node3DCartesian <T> *center = NULL;
 
                                 //Add visited unprocessed twin edges to the queue
-                                if ( ( e_twin != NULL ) && ( !e_twin->isSimplexEdge() ) )
+                                if ( ( e_twin != NO_HALF_EDGE ) && ( !processed[e_twin] ) )
                                 {
                                         Q.push ( e_twin );
                                 }
 
                                 //Test if all Voronoi edges sharing this node = center have already been created: 3 Voronoi edges
-                                const HalfEdge <T> *e21_dual = e->getNextEdge()->getDualEdge();
-                                const HalfEdge <T> *e31_dual = e->getNextEdge()->getNextEdge()->getDualEdge();
+                                const HalfEdge <T> *e21_dual = dual[TriangleMesh <T>::getNextEdge ( e )];
+                                const HalfEdge <T> *e31_dual = dual[TriangleMesh <T>::getPreviousEdge ( e )];
 
                                 //Keep topologic consistency of Voronoi cells: if computed Voronoi point too close to another
                                 //Voronoi point, use this point
@@ -247,18 +321,23 @@ void Voronoi2D:: createVoronoiCells ( Container <HalfEdge <T> *> &hl_dt, Contain
                                 }
 
                                 //Set dual Delaunay edge e to this Voronoi edge and this Voronoi edge as dual to Delaunay edge e
-                                vor_edge->setDualEdge ( e );
-                                e->setDualEdge ( vor_edge );
+                                dual[e] = vor_edge;
+
+                                if ( hl_dt != NULL )
+                                {
+                                        vor_edge->setDualEdge ( hl_dt [e] );
+                                        hl_dt [e]->setDualEdge ( vor_edge );
+                                }
 
                                 //Set dual edge for twin edge to actual Voronoi edge e (in both directions of processing)
-                                if ( e_twin != NULL )
+                                if ( e_twin != NO_HALF_EDGE )
                                 {
                                         //Is there a twin Voronoi edge dual to e_twin ?
-                                        if ( ( e_twin->getDualEdge() != NULL ) )
+                                        if ( ( dual[e_twin] != NULL ) )
                                         {
                                                 //Set twin Voronoi edge to actual Voronoi edge
-                                                vor_edge->setTwinEdge ( e_twin->getDualEdge() );
-                                                e_twin->getDualEdge()->setTwinEdge ( vor_edge );
+                                                vor_edge->setTwinEdge ( dual[e_twin] );
+                                                dual[e_twin]->setTwinEdge ( vor_edge );
                                         }
                                 }
 
@@ -289,28 +368,28 @@ void Voronoi2D:: createVoronoiCells ( Container <HalfEdge <T> *> &hl_dt, Contain
                                         vor_edge_previous = vor_edge;
 
                                         //Increment actual edge
-                                        e = e_twin->getNextEdge()->getNextEdge();
+                                        e = TriangleMesh <T>::getPreviousEdge ( e_twin );
 
                                         //Assign circle points
                                         q3 = q1;
-                                        q1 = e->getPoint();
+                                        q1 = dt.getPoint ( e );
                                 }
 
                                 //Changed direction of the processing: we add new Voronoi edge before the first created Voronoi edge)
                                 else
                                 {
                                         //Increment actual edge
-                                        e = e->getNextEdge()->getTwinEdge();
+                                        e = dt.getTwinEdge ( TriangleMesh <T>::getNextEdge ( e ) );
 
                                         //We found a boundary triangle, we processed both parts of an unbounded Voronoi cell
-                                        if ( e == NULL )
+                                        if ( e == NO_HALF_EDGE )
                                         {
                                                 break;
                                         }
 
                                         //Assign circle points
                                         q1 = q3;
-                                        q3 = e ->getNextEdge()->getNextEdge()->getPoint();
+                                        q3 = dt.getPoint ( TriangleMesh <T>::getPreviousEdge ( e ) );
                                 }
 
                         }
@@ -341,6 +420,12 @@ void Voronoi2D:: createVoronoiCells ( Container <HalfEdge <T> *> &hl_dt, Contain
                         //Add Voronoi cell to the list
                         vl.push_back ( voronoi_cell_new );
                 }
+
+                //Edges ending in the hull vertex of one triangle are not twins of any edge: continue with the next unprocessed edge
+                while ( Q.empty() && ( ++e_seed < n ) )
+                {
+                        if ( !processed[e_seed] ) Q.push ( e_seed );
+                }
         }
 }
 
@@ -21,7 +21,9 @@
 #ifndef sortKDNodesByPriority_H
 #define sortKDNodesByPriority_H
 
-#include "../structures/tree/KDTree.h"
+//Forward declarations
+template <typename Point>
+struct TKDNodePriority;
 
 
 //Sort KD nodes by priority
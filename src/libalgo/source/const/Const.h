@@ -91,6 +91,58 @@
 #define MAX_FLOAT_EXPONENT 			log(MAX_FLOAT)
 #endif
 
+#ifndef KD_TREE_BUCKET_SIZE							//Maximum points stored in the leaf bucket of the flat KD tree
+#define KD_TREE_BUCKET_SIZE			16
+#endif
+
+#ifndef KD_TREE_PARALLEL_BUILD_SIZE						//Minimum points of the KD subtree built by a separate OpenMP task
+#define KD_TREE_PARALLEL_BUILD_SIZE		50000
+#endif
+
+#ifndef KD_TREE_PARALLEL_QUERY_SIZE						//Minimum points processed by the parallel batch search of the KD tree
+#define KD_TREE_PARALLEL_QUERY_SIZE		1000
+#endif
+
+#ifndef KD_TREE_PARALLEL_SUBTREES						//Count of query subtrees processed independently by the dual tree search
+#define KD_TREE_PARALLEL_SUBTREES		256
+#endif
+
+#ifndef KD_TREE_SCAPEGOAT_ALPHA							//Maximum ratio of the subtree and its parent sizes, larger subtrees are rebuilt after the insertion
+#define KD_TREE_SCAPEGOAT_ALPHA			0.7
+#endif
+
+#ifndef MEMORY_POOL_BLOCK_ITEMS							//Count of items allocated at once by the memory pool of points, nodes and half edges
+#define MEMORY_POOL_BLOCK_ITEMS			1024
+#endif
+
+#ifndef MEMORY_POOL_MAX_ITEM_SIZE						//Maximum size of the object allocated in the memory pool, larger objects use the global operator new (0 = pools disabled)
+#define MEMORY_POOL_MAX_ITEM_SIZE		512
+#endif
+
+#ifndef MEMORY_POOL_ALIGNMENT							//Alignment of the objects allocated in the memory pool
+#define MEMORY_POOL_ALIGNMENT			16
+#endif
+
+#ifndef DT_PARALLEL_BUILD_SIZE							//Minimum points of the part of the divide and conquer DT triangulated by a separate OpenMP task
+#define DT_PARALLEL_BUILD_SIZE			50000
+#endif
+
+#ifndef BRIO_MIN_ROUND_SIZE							//Points of the first round of the biased randomized insertion order, rounds are not split further
+#define BRIO_MIN_ROUND_SIZE			64
+#endif
+
+#ifndef POINT_LOCATION_POINTS_PER_CELL						//Average count of mesh vertices in one cell of the jump-and-walk grid
+#define POINT_LOCATION_POINTS_PER_CELL		4
+#endif
+
+#ifndef POINT_LOCATION_CHUNK_SIZE						//Count of consecutive queries (along the Hilbert curve) located by one thread in the batch point location
+#define POINT_LOCATION_CHUNK_SIZE		1024
+#endif
+
+#ifndef POINT_LOCATION_PARALLEL_QUERY_SIZE					//Minimum points processed by the parallel batch point location
+#define POINT_LOCATION_PARALLEL_QUERY_SIZE	4096
+#endif
+
 #ifndef MAX_NODES								//Maximum of nodes stored in the list
 #define MAX_NODES				5000000
 #endif
@@ -107,11 +159,51 @@
 #define MAX_COLUMNS_MATRIX			1000
 #endif
 
+#ifndef MATRIX_MULT_BLOCK_MC							//Rows of the A block in the blocked matrix multiplication
+#define MATRIX_MULT_BLOCK_MC			64
+#endif
+
+#ifndef MATRIX_MULT_BLOCK_KC							//Columns of the A block (rows of the B panel) in the blocked matrix multiplication
+#define MATRIX_MULT_BLOCK_KC			256
+#endif
+
+#ifndef MATRIX_MULT_BLOCK_NC							//Columns of the B panel in the blocked matrix multiplication
+#define MATRIX_MULT_BLOCK_NC			512
+#endif
+
+#ifndef MATRIX_MULT_SMALL_SIZE							//Matrix products with less multiplications are computed without blocking
+#define MATRIX_MULT_SMALL_SIZE			32768
+#endif
+
+#ifndef QR_BLOCK_SIZE								//Columns of the panel in the blocked Householder QR decomposition (compact WY form)
+#define QR_BLOCK_SIZE				32
+#endif
+
+#ifndef SVD_JACOBI_BLOCK_SIZE							//Columns of the panel in the blocked one-sided Jacobi SVD
+#define SVD_JACOBI_BLOCK_SIZE			16
+#endif
+
+#ifndef SVD_JACOBI_MAX_SWEEPS							//Maximum sweeps of the one-sided Jacobi SVD
+#define SVD_JACOBI_MAX_SWEEPS			60
+#endif
+
+#ifndef MATRIX_MULT_NARROW_COLS							//Maximum columns of B processed by the narrow multiplication kernel
+#define MATRIX_MULT_NARROW_COLS			16
+#endif
+
+#ifndef MATRIX_TRANS_BLOCK							//Size of the square block copied by the matrix transposition
+#define MATRIX_TRANS_BLOCK			32
+#endif
+
 
 #ifndef MAX_TEXT_LENGTH								//Maximum length of the char
 #define MAX_TEXT_LENGTH				4096
 #endif
 
+#ifndef FILE_CHUNK_SIZE								//Bytes of the text file parsed by one OpenMP thread at once (chunks are aligned to lines)
+#define FILE_CHUNK_SIZE				1048576
+#endif
+
 #ifndef MAX_TEXT_FILE_LENGTH							//Maximum length of the text file
 #define MAX_TEXT_FILE_LENGTH			800000
 #endif
@@ -33,6 +33,9 @@ class HalfEdge;
 template <typename T>
 class VoronoiCell;
 
+template <typename T>
+class TriangleMesh;
+
 template <typename T>
 struct TMeridiansListF;
 
@@ -47,6 +50,9 @@ class DXFExport
                 template <typename T>
                 static void exportDTToDXF ( const char * file_name, const Container <HalfEdge <T> *> &hl );
 
+                template <typename T>
+                static void exportDTToDXF ( const char * file_name, const TriangleMesh <T> &mesh );
+
                 template <typename T>
                 static void exportVDToDXF ( const char * file_name, const Container <VoronoiCell <T> *> &vl, const bool process_all_cells );
 
@@ -80,6 +86,9 @@ class DXFExport
                 template <typename T>
                 static void processHalfEdges ( FILE * file, const Container <HalfEdge <T> *> &hl, const char * layer_name );
 
+                template <typename T>
+                static void processHalfEdges ( FILE * file, const TriangleMesh <T> &mesh, const char * layer_name );
+
                 template <typename T>
                 static void processFace ( FILE * file, const Face <T> * face, const char * layer_name_edges );
 
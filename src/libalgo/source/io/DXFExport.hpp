@@ -30,6 +30,7 @@
 
 #include "libalgo/source/structures/point/Point3DCartesian.h"
 #include "libalgo/source/structures/line/HalfEdge.h"
+#include "libalgo/source/structures/list/TriangleMesh.h"
 #include "libalgo/source/structures/face/VoronoiCell.h"
 
 #include "libalgo/source/algorithms/bearing/Bearing.h"
@@ -92,6 +93,61 @@ void DXFExport::exportDTToDXF ( const char * file_name, const Container <HalfEdg
 }
 
 
+template <typename T>
+void DXFExport::exportDTToDXF ( const char * file_name, const TriangleMesh <T> &mesh )
+{
+        //Export Delaunay triangulation stored in the triangle mesh to DXF
+        FILE * file = NULL;
+
+        try
+        {
+                if ( ( file = fopen ( file_name, "w" ) ) != NULL )
+                {
+                        //Create header section
+                        createHeaderSection ( file );
+
+                        //Create table section
+                        createTableSection ( file );
+
+                        //Create layer
+                        createLayerSection ( file, "DT", 3 );
+
+                        //End table header
+                        endTableSection ( file );
+
+                        //Create entity section
+                        createEntitySection ( file );
+
+                        //Process half edges
+                        processHalfEdges ( file, mesh, "DT" );
+
+                        //End header section
+                        endHeaderSection ( file );
+
+                        //Close file
+                        fclose ( file );
+                }
+
+                //Throw exception
+                else
+                {
+                        //Can not open file
+                        throw std::ios_base::failure ( "Error: can not open the file. " );
+                }
+        }
+
+        //Any error has appeared
+        catch ( std::ios_base::failure & )
+        {
+                //Close file
+                fclose ( file );
+
+                //Throw exception
+                throw ErrorFileWrite ( "ErrorFileWrite: can not write the file: ", file_name );
+        }
+}
+
+
 template <typename T>
 void DXFExport::exportVDToDXF ( const char * file_name, const Container <VoronoiCell <T> *> &vl, const bool process_all_cells )
 {
@@ -673,6 +729,38 @@ void DXFExport::processHalfEdges ( FILE * file, const Container <HalfEdge <T> *>
 }
 
 
+template <typename T>
+void DXFExport::processHalfEdges ( FILE * file, const TriangleMesh <T> &mesh, const char * layer_name )
+{
+        //Process all half edges of the mesh, each edge is exported once
+        const unsigned int n = mesh.getEdgesCount();
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                //Skip the twin edge with the lower index, it has already been processed
+                const unsigned int i_twin = mesh.getTwinEdge ( i );
+
+                if ( ( i_twin == NO_HALF_EDGE ) || ( i < i_twin ) )
+                {
+                        // Get start point
+                        const Node3DCartesian <T> *p1 = mesh.getPoint ( i );
+                        T x1 = p1->getX();
+                        T y1 = p1->getY();
+                        T z1 = p1->getZ();
+
+                        // Get end point
+                        const Node3DCartesian <T> *p2 = mesh.getPoint ( TriangleMesh <T>::getNextEdge ( i ) );
+                        T x2 = p2->getX();
+                        T y2 = p2->getY();
+                        T z2 = p2->getZ();
+
+                        //Create line
+                        createLine ( file, layer_name, x1, y1, z1, x2, y2, z2 );
+                }
+        }
+}
+
+
 template <typename T>
 void DXFExport::processFace ( FILE * file, const Face <T> * face, const char * layer_name_edges )
 {
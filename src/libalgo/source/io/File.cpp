@@ -1,14 +1,24 @@
 #include "File.h"
 
+#include <algorithm>
 #include <fstream>
 #include <iostream>
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <ctype.h>
+#include <stdint.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 #include "libalgo/source/const/Const.h"
 #include "libalgo/source/exceptions/ErrorBadData.h"
 #include "libalgo/source/exceptions/ErrorFileRead.h"
 
+#include "libalgo/source/io/FileMapping.h"
+
 TFileLines File::loadFileToLines(const char * file_name)
 {
         //Load lines from text file
@@ -138,6 +148,222 @@ TFileWords File::loadFileToWords(const char * file_name)
         return file_words;
 }
 
+void File::loadFileToRecords(const FileMapping & file, TFileRecords & records)
+{
+        //Load words of the mapped text file converted to numbers, chunks aligned to lines are parsed in parallel
+        const char * text = file.data();
+        const std::size_t length = file.size();
+
+        records.text = text;
+        records.values.clear();
+        records.words.clear();
+        records.labels.clear();
+        records.labels_length.clear();
+
+        //Split file to chunks: a chunk ends after the end of the line
+        const std::size_t n_chunks = length / FILE_CHUNK_SIZE + 1;
+        std::vector <std::size_t> chunks_bounds(n_chunks + 1, length);
+        chunks_bounds[0] = 0;
+
+        for (std::size_t i = 1; i < n_chunks; i++)
+        {
+                std::size_t bound = std::max(i * (length / n_chunks), chunks_bounds[i - 1]);
+                const char * line_end = bound < length ? (const char *) memchr(text + bound, '\n', length - bound) : NULL;
+
+                chunks_bounds[i] = line_end ? line_end - text + 1 : length;
+        }
+
+        //Parse chunks
+        std::vector <TFileRecords> chunks_records(n_chunks);
+
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(dynamic)
+#endif
+        for (int i = 0; i < (int) n_chunks; i++)
+        {
+                loadChunkToRecords(text, chunks_bounds[i], chunks_bounds[i + 1], chunks_records[i]);
+        }
+
+        //Offsets of the chunks in the merged records
+        std::vector <std::size_t> values_offsets(n_chunks + 1, 0), records_offsets(n_chunks + 1, 0);
+
+        for (std::size_t i = 0; i < n_chunks; i++)
+        {
+                values_offsets[i + 1] = values_offsets[i] + chunks_records[i].values.size();
+                records_offsets[i + 1] = records_offsets[i] + chunks_records[i].labels.size();
+        }
+
+        records.values.resize(values_offsets[n_chunks]);
+        records.words.resize(records_offsets[n_chunks] + 1);
+        records.labels.resize(records_offsets[n_chunks]);
+        records.labels_length.resize(records_offsets[n_chunks]);
+        records.words[records_offsets[n_chunks]] = values_offsets[n_chunks];
+
+        //Merge chunks
+#ifdef _OPENMP
+        #pragma omp parallel for schedule(dynamic)
+#endif
+        for (int i = 0; i < (int) n_chunks; i++)
+        {
+                const TFileRecords & chunk_records = chunks_records[i];
+                std::copy(chunk_records.values.begin(), chunk_records.values.end(), records.values.begin() + values_offsets[i]);
+                std::copy(chunk_records.labels.begin(), chunk_records.labels.end(), records.labels.begin() + records_offsets[i]);
+                std::copy(chunk_records.labels_length.begin(), chunk_records.labels_length.end(), records.labels_length.begin() + records_offsets[i]);
+
+                for (std::size_t j = 0; j < chunk_records.labels.size(); j++)
+                {
+                        records.words[records_offsets[i] + j] = chunk_records.words[j] + values_offsets[i];
+                }
+        }
+}
+
+
+void File::loadChunkToRecords(const char * text, const std::size_t begin, const std::size_t end, TFileRecords & records)
+{
+        //Load words of the lines in the chunk [begin, end) of the text file, words are delimited by " \t;\r"
+        records.values.reserve((end - begin) / 8);
+
+        for (const char * line = text + begin, * chunk_end = text + end; line < chunk_end;)
+        {
+                //Find the end of the line
+                const char * line_end = (const char *) memchr(line, '\n', chunk_end - line);
+
+                if (line_end == NULL) line_end = chunk_end;
+
+                //Delimit line to words
+                const std::size_t first_value = records.values.size();
+                const char * label = line, * label_end = line;
+                bool empty_line = true;
+
+                for (const char * c = line; c < line_end;)
+                {
+                        //Skip delimiters
+                        if (*c == ' ' || *c == '\t' || *c == ';' || *c == '\r')
+                        {
+                                if (*c == ';') empty_line = false;
+
+                                c++;
+                                continue;
+                        }
+
+                        //Find the end of the word
+                        const char * word = c;
+
+                        for (; c < line_end && *c != ' ' && *c != '\t' && *c != ';' && *c != '\r'; c++)
+                        {
+                                if (*c != '\v' && *c != '\f') empty_line = false;
+                        }
+
+                        //Remember the first word
+                        if (records.values.size() == first_value)
+                        {
+                                label = word;
+                                label_end = c;
+                        }
+
+                        //Add value of the word
+                        records.values.push_back(parseDouble(word, c));
+                }
+
+                //Add non empty line
+                if (!empty_line)
+                {
+                        records.words.push_back(first_value);
+                        records.labels.push_back(label - text);
+                        records.labels_length.push_back((unsigned int) (label_end - label));
+                }
+
+                //Do not add an empty line
+                else records.values.resize(first_value);
+
+                line = line_end + 1;
+        }
+}
+
+
+double File::parseDouble(const char * begin, const char * end)
+{
+        //Convert word [begin, end) to double, both '.' and ',' are decimal separators
+        //Fast path: at most 19 significant digits and a small exponent are converted exactly, other words are converted by strtod
+        static const double powers[] = {1.0e0, 1.0e1, 1.0e2, 1.0e3, 1.0e4, 1.0e5, 1.0e6, 1.0e7, 1.0e8, 1.0e9, 1.0e10, 1.0e11,
+                                        1.0e12, 1.0e13, 1.0e14, 1.0e15, 1.0e16, 1.0e17, 1.0e18, 1.0e19, 1.0e20, 1.0e21, 1.0e22
+                                       };
+
+        const char * c = begin;
+        const bool negative = (c < end && *c == '-');
+
+        if (c < end && (*c == '-' || *c == '+')) c++;
+
+        //Digits of the mantissa
+        uint64_t mantissa = 0;
+        int exponent = 0, digits = 0, significant_digits = 0;
+
+        for (; c < end && *c >= '0' && *c <= '9'; c++, digits++)
+        {
+                if (mantissa != 0 || *c != '0') significant_digits++;
+
+                mantissa = 10 * mantissa + (*c - '0');
+        }
+
+        if (c < end && (*c == '.' || *c == ','))
+        {
+                for (c++; c < end && *c >= '0' && *c <= '9'; c++, digits++, exponent--)
+                {
+                        if (mantissa != 0 || *c != '0') significant_digits++;
+
+                        mantissa = 10 * mantissa + (*c - '0');
+                }
+        }
+
+        //Exponent
+        if (digits > 0 && significant_digits <= 19 && c < end && (*c == 'e' || *c == 'E'))
+        {
+                const char * e = c + 1;
+                const bool negative_exponent = (e < end && *e == '-');
+
+                if (e < end && (*e == '-' || *e == '+')) e++;
+
+                int exponent_value = 0;
+
+                for (c = e; c < end && *c >= '0' && *c <= '9' && exponent_value < 1000; c++)
+                {
+                        exponent_value = 10 * exponent_value + (*c - '0');
+                }
+
+                if (c == e) c = begin;
+
+                exponent += negative_exponent ? -exponent_value : exponent_value;
+        }
+
+        //Whole word converted by the fast path
+        if (digits > 0 && significant_digits <= 19 && c == end && mantissa <= ((uint64_t) 1 << 53))
+        {
+                if (mantissa == 0) return negative ? -0.0 : 0.0;
+
+                if (exponent >= -22 && exponent <= 22)
+                {
+                        const double value = exponent < 0 ? (double) mantissa / powers[-exponent] : (double) mantissa * powers[exponent];
+
+                        return negative ? -value : value;
+                }
+        }
+
+        //Other words: labels, long mantissas, large exponents, inf, nan, hexadecimal numbers
+        char buffer[BUFF];
+        const std::size_t length = std::min((std::size_t) (end - begin), (std::size_t) (BUFF - 1));
+
+        memcpy(buffer, begin, length);
+        buffer[length] = '\0';
+
+        //Change separator to "."
+        char * separator = strchr(buffer, ',');
+
+        if (separator) *separator = '.';
+
+        return strtod(buffer, NULL);
+}
+
+
 void File::commaToDot(char ** text)
 {
         //Change decimal separator: replace , with .
@@ -22,22 +22,48 @@
 #ifndef File_H
 #define File_H
 
+#include <cstddef>
 #include <vector>
 #include <list>
 #include <string>
 
+//Forward declaration
+class FileMapping;
+
 //New user types
 typedef std::vector < std::string >  TFileLines;
 typedef std::vector < std::vector < std::string > > TFileWords;
 
+//Words of the non empty lines (records) of the mapped text file converted to numbers
+//Values of the i-th record are values [words[i], words[i + 1]), the first word of the record is kept as a position in the text (label)
+struct TFileRecords
+{
+        const char * text;				//Content of the file, must not be unmapped while the records are used
+        std::vector <double> values;			//Values of all words
+        std::vector <std::size_t> words;		//Index of the first value of each record, words.size() = records + 1
+        std::vector <std::size_t> labels;		//Position of the first word of each record in the text
+        std::vector <unsigned int> labels_length;	//Length of the first word of each record
+
+        TFileRecords() : text ( NULL ) {}
+
+        std::size_t size() const {return labels.size();}
+        unsigned int getWordsCount ( const std::size_t i ) const {return ( unsigned int ) ( words[i + 1] - words[i] );}
+        const double * getValues ( const std::size_t i ) const {return values.empty() ? NULL : &values[0] + words[i];}
+        std::string getLabel ( const std::size_t i ) const {return std::string ( text + labels[i], labels_length[i] );}
+};
+
 //Input operation with file
 class File
 {
         public:
                 static TFileLines loadFileToLines ( const char * file_name );
                 static TFileWords loadFileToWords ( const char * file_name );
+                static void loadFileToRecords ( const FileMapping & file, TFileRecords & records );
+
+                static double parseDouble ( const char * begin, const char * end );
 
         private:
+                static void loadChunkToRecords ( const char * text, const std::size_t begin, const std::size_t end, TFileRecords & records );
 
                 static void commaToDot ( char ** text );
 };
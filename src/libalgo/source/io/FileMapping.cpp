@@ -0,0 +1,86 @@
+#include "FileMapping.h"
+
+#include <stdio.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "libalgo/source/exceptions/ErrorFileRead.h"
+
+
+FileMapping::FileMapping ( const char * file_name ) : address ( NULL ), length ( 0 ), mapped ( false ), buffer()
+{
+#ifndef _WIN32
+        //Map the whole file read-only
+        const int descriptor = open ( file_name, O_RDONLY );
+
+        if ( descriptor < 0 )
+        {
+                throw ErrorFileRead ( "ErrorFileRead: can not open file. ", file_name );
+        }
+
+        struct stat file_stat;
+
+        if ( fstat ( descriptor, &file_stat ) != 0 )
+        {
+                ::close ( descriptor );
+                throw ErrorFileRead ( "ErrorFileRead: can not get size of the file. ", file_name );
+        }
+
+        length = ( std::size_t ) file_stat.st_size;
+
+        if ( length > 0 )
+        {
+                void * map = mmap ( NULL, length, PROT_READ, MAP_PRIVATE, descriptor, 0 );
+
+                if ( map != MAP_FAILED )
+                {
+                        address = ( const char * ) map;
+                        mapped = true;
+                }
+        }
+
+        //The mapping holds its own reference to the file
+        ::close ( descriptor );
+
+        if ( mapped || length == 0 )
+        {
+                return;
+        }
+#endif
+        //Mapping is not available: read the file into the buffer
+        FILE * file = fopen ( file_name, "rb" );
+
+        if ( file == NULL )
+        {
+                throw ErrorFileRead ( "ErrorFileRead: can not open file. ", file_name );
+        }
+
+        char block[65536];
+
+        for ( std::size_t n = 0; ( n = fread ( block, 1, sizeof ( block ), file ) ) > 0; )
+        {
+                buffer.insert ( buffer.end(), block, block + n );
+        }
+
+        fclose ( file );
+
+        length = buffer.size();
+        address = buffer.empty() ? NULL : &buffer[0];
+}
+
+
+FileMapping::~FileMapping()
+{
+#ifndef _WIN32
+        //Unmap the file
+        if ( mapped )
+        {
+                munmap ( ( void * ) address, length );
+        }
+#endif
+}
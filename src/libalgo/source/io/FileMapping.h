@@ -0,0 +1,52 @@
+// Description: Read-only memory mapping of the whole file
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef FileMapping_H
+#define FileMapping_H
+
+#include <cstddef>
+#include <vector>
+
+
+//Read-only mapping of the whole file into the memory (mmap), the file is read into the buffer where mmap is not available
+class FileMapping
+{
+        private:
+                const char * address;			//First byte of the file
+                std::size_t length;			//File size
+                bool mapped;				//File is mapped (not read into the buffer)
+                std::vector <char> buffer;		//Content of the file, mmap is not available
+
+        public:
+                FileMapping ( const char * file_name );
+                ~FileMapping();
+
+        public:
+                const char * data() const {return address;}
+                std::size_t size() const {return length;}
+
+        private:
+                FileMapping ( const FileMapping & );
+                FileMapping & operator = ( const FileMapping & );
+};
+
+#endif
@@ -0,0 +1,71 @@
+// Description: Binary matrix file: read-only memory mapping and streaming writer
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#include "MatrixFile.h"
+
+#include <string.h>
+
+#include "libalgo/source/exceptions/ErrorFileRead.h"
+
+
+const TMatrixFileHeader & MatrixFileMapping::header ( const char * file_name, const uint32_t item_type, const uint32_t item_size ) const
+{
+        //File is shorter than the header
+        if ( size() < sizeof ( TMatrixFileHeader ) )
+        {
+                throw ErrorFileRead ( "ErrorFileRead: file is not a binary matrix file (too short). ", file_name );
+        }
+
+        const TMatrixFileHeader & h = * ( const TMatrixFileHeader * ) data();
+
+        //Magic number
+        if ( memcmp ( h.magic, "LAMX", 4 ) != 0 )
+        {
+                throw ErrorFileRead ( "ErrorFileRead: file is not a binary matrix file (bad magic number). ", file_name );
+        }
+
+        //Newer version of the format
+        if ( h.version > MATRIX_FILE_VERSION )
+        {
+                throw ErrorFileRead ( "ErrorFileRead: unsupported version of the binary matrix file. ", file_name );
+        }
+
+        //File written on the machine with a different byte order
+        if ( h.byte_order != MATRIX_FILE_BYTE_ORDER )
+        {
+                throw ErrorFileRead ( "ErrorFileRead: different byte order of the binary matrix file. ", file_name );
+        }
+
+        //Different type of items
+        if ( ( h.item_type != item_type ) || ( h.item_size != item_size ) )
+        {
+                throw ErrorFileRead ( "ErrorFileRead: different item type of the binary matrix file. ", file_name );
+        }
+
+        //Truncated file
+        if ( ( h.cols != 0 ) && ( h.rows > ( size() - sizeof ( TMatrixFileHeader ) ) / item_size / h.cols ) )
+        {
+                throw ErrorFileRead ( "ErrorFileRead: binary matrix file is truncated. ", file_name );
+        }
+
+        return h;
+}
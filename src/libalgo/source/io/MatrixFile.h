@@ -0,0 +1,142 @@
+// Description: Binary matrix file: read-only memory mapping and streaming writer
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef MatrixFile_H
+#define MatrixFile_H
+
+#include <cstddef>
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+#include "libalgo/source/structures/matrix/Matrix.h"
+
+#include "libalgo/source/io/FileMapping.h"
+
+
+//Constants of the binary matrix file
+#define MATRIX_FILE_VERSION			1
+#define MATRIX_FILE_BYTE_ORDER			0x01020304
+
+
+//Binary matrix file (version 1): header of 64 bytes followed by rows * cols items in the row-major order
+//Items are stored in the native byte order, the data start at the offset 64 and may be mapped without copying
+struct TMatrixFileHeader
+{
+        char magic[4];				//"LAMX"
+        uint32_t version;			//Format version
+        uint32_t item_type;			//Code of the item type
+        uint32_t item_size;			//sizeof (item)
+        uint32_t byte_order;			//MATRIX_FILE_BYTE_ORDER written in the native order
+        uint32_t reserved0;
+        uint64_t rows;				//Rows count
+        uint64_t cols;				//Columns count
+        char reserved[24];
+};
+
+
+//Codes of the supported item types
+template <typename T>
+struct TMatrixFileItemType;
+
+template <> struct TMatrixFileItemType <float> { static const uint32_t code = 1; };
+template <> struct TMatrixFileItemType <double> { static const uint32_t code = 2; };
+template <> struct TMatrixFileItemType <long double> { static const uint32_t code = 3; };
+template <> struct TMatrixFileItemType <int> { static const uint32_t code = 4; };
+template <> struct TMatrixFileItemType <unsigned int> { static const uint32_t code = 5; };
+
+
+//Mapping of the binary matrix file
+class MatrixFileMapping : public FileMapping
+{
+        public:
+                MatrixFileMapping ( const char * file_name ) : FileMapping ( file_name ) {}
+
+        public:
+                //Check the header of the binary matrix file
+                const TMatrixFileHeader & header ( const char * file_name, const uint32_t item_type, const uint32_t item_size ) const;
+};
+
+
+//Matrix stored in the binary file mapped read-only, items are not copied
+template <typename T>
+class MappedMatrix
+{
+        private:
+                MatrixFileMapping mapping;		//Mapped file
+                unsigned int rows_count;		//Rows count
+                unsigned int columns_count;		//Columns count
+                const T * items;			//First item inside the mapping
+
+        public:
+                MappedMatrix ( const char * file_name );
+
+        public:
+                unsigned int rows() const {return rows_count;}
+                unsigned int cols() const {return columns_count;}
+                const T * data() const {return items;}
+
+                //Get read-only view of the mapped items, O(1), usable by MatrixOperations
+                MatrixView <const T> view() const {return MatrixView <const T> ( items, rows_count, columns_count, columns_count );}
+
+                //Copy items into the matrix
+                Matrix <T> toMatrix() const;
+
+        public:
+                T const & operator() ( const unsigned int row, const unsigned int col ) const;
+};
+
+
+//Streaming writer of the binary matrix file: rows are appended one by one, rows count is written by close()
+template <typename T>
+class MatrixFileWriter
+{
+        private:
+                FILE * file;				//Output file
+                unsigned int columns_count;		//Columns count
+                uint64_t rows_count;			//Rows written
+
+        public:
+                MatrixFileWriter ( const char * file_name, const unsigned int columns_count_ );
+                ~MatrixFileWriter();
+
+        public:
+                unsigned int cols() const {return columns_count;}
+                uint64_t rows() const {return rows_count;}
+
+                //Append one row (columns_count items) or all rows of the matrix
+                void writeRow ( const T * row );
+                void writeRows ( const Matrix <T> &A );
+
+                //Write the header and close the file
+                void close();
+
+        private:
+                void writeHeader();
+
+                MatrixFileWriter ( const MatrixFileWriter & );
+                MatrixFileWriter & operator = ( const MatrixFileWriter & );
+};
+
+#include "MatrixFile.hpp"
+
+#endif
@@ -0,0 +1,204 @@
+// Description: Binary matrix file: read-only memory mapping and streaming writer
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef MatrixFile_HPP
+#define MatrixFile_HPP
+
+#include <string.h>
+#include <limits>
+
+#include "libalgo/source/exceptions/ErrorFileRead.h"
+#include "libalgo/source/exceptions/ErrorFileWrite.h"
+#include "libalgo/source/exceptions/ErrorIndexOutOfBound.h"
+#include "libalgo/source/exceptions/ErrorBadData.h"
+
+
+template <typename T>
+MappedMatrix <T> ::MappedMatrix ( const char * file_name ) : mapping ( file_name ), rows_count ( 0 ), columns_count ( 0 ), items ( NULL )
+{
+        //Check the header
+        const TMatrixFileHeader & h = mapping.header ( file_name, TMatrixFileItemType <T>::code, sizeof ( T ) );
+
+        //Empty matrix or dimensions out of the range of Matrix
+        if ( ( h.rows == 0 ) || ( h.cols == 0 ) || ( h.rows > std::numeric_limits <unsigned int>::max() ) || ( h.cols > std::numeric_limits <unsigned int>::max() ) )
+        {
+                throw ErrorFileRead ( "ErrorFileRead: invalid dimensions of the matrix in the binary matrix file. ", file_name );
+        }
+
+        rows_count = ( unsigned int ) h.rows;
+        columns_count = ( unsigned int ) h.cols;
+        items = ( const T * ) ( mapping.data() + sizeof ( TMatrixFileHeader ) );
+}
+
+
+template <typename T>
+Matrix <T> MappedMatrix <T> ::toMatrix() const
+{
+        //Copy all items
+        Matrix <T> A ( rows_count, columns_count );
+        std::copy ( items, items + ( std::size_t ) rows_count * columns_count, A.data() );
+
+        return A;
+}
+
+
+template <typename T>
+T const & MappedMatrix <T> :: operator() ( const unsigned int row, const unsigned int col ) const
+{
+        //Matrix dimemension invalid, throw exception
+        if ( ( row >= rows_count ) || ( col >= columns_count ) )
+        {
+                throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "invalid dimension of the matrix (row >= rows_count or col >= columns_count)." );
+        }
+
+        return items[( std::size_t ) row * columns_count + col];
+}
+
+
+template <typename T>
+MatrixFileWriter <T> ::MatrixFileWriter ( const char * file_name, const unsigned int columns_count_ ) : file ( NULL ), columns_count ( columns_count_ ), rows_count ( 0 )
+{
+        //Columns count must be known in advance
+        if ( columns_count == 0 )
+        {
+                throw ErrorBadData ( "ErrorBadData: no columns, ", "can not create binary matrix file." );
+        }
+
+        file = fopen ( file_name, "wb" );
+
+        if ( file == NULL )
+        {
+                throw ErrorFileWrite ( "ErrorFileWrite: can not open the file. ", file_name );
+        }
+
+        //Header with zero rows, rewritten by close()
+        writeHeader();
+}
+
+
+template <typename T>
+MatrixFileWriter <T> ::~MatrixFileWriter()
+{
+        //Destructor must not throw
+        try
+        {
+                close();
+        }
+
+        catch ( ... )
+        {
+        }
+}
+
+
+template <typename T>
+void MatrixFileWriter <T> ::writeRow ( const T * row )
+{
+        //File has already been closed
+        if ( file == NULL )
+        {
+                throw ErrorFileWrite ( "ErrorFileWrite: binary matrix file has been closed. ", "" );
+        }
+
+        if ( fwrite ( row, sizeof ( T ), columns_count, file ) != columns_count )
+        {
+                throw ErrorFileWrite ( "ErrorFileWrite: can not write row of the matrix. ", "" );
+        }
+
+        rows_count++;
+}
+
+
+template <typename T>
+void MatrixFileWriter <T> ::writeRows ( const Matrix <T> &A )
+{
+        //Different columns count
+        if ( A.cols() != columns_count )
+        {
+                throw ErrorBadData ( "ErrorBadData: different columns count, ", "can not write matrix into the binary matrix file." );
+        }
+
+        //Write all rows at once
+        if ( file == NULL )
+        {
+                throw ErrorFileWrite ( "ErrorFileWrite: binary matrix file has been closed. ", "" );
+        }
+
+        const std::size_t n = ( std::size_t ) A.rows() * columns_count;
+
+        if ( fwrite ( A.data(), sizeof ( T ), n, file ) != n )
+        {
+                throw ErrorFileWrite ( "ErrorFileWrite: can not write rows of the matrix. ", "" );
+        }
+
+        rows_count += A.rows();
+}
+
+
+template <typename T>
+void MatrixFileWriter <T> ::close()
+{
+        //Already closed
+        if ( file == NULL )
+        {
+                return;
+        }
+
+        //Rewrite the header with the final rows count
+        const bool ok = ( fseek ( file, 0, SEEK_SET ) == 0 );
+
+        if ( ok )
+        {
+                writeHeader();
+        }
+
+        const bool closed = ( fclose ( file ) == 0 );
+        file = NULL;
+
+        if ( !ok || !closed )
+        {
+                throw ErrorFileWrite ( "ErrorFileWrite: can not write header of the binary matrix file. ", "" );
+        }
+}
+
+
+template <typename T>
+void MatrixFileWriter <T> ::writeHeader()
+{
+        //Create header
+        TMatrixFileHeader h;
+        memset ( &h, 0, sizeof ( h ) );
+        memcpy ( h.magic, "LAMX", 4 );
+        h.version = MATRIX_FILE_VERSION;
+        h.item_type = TMatrixFileItemType <T>::code;
+        h.item_size = sizeof ( T );
+        h.byte_order = MATRIX_FILE_BYTE_ORDER;
+        h.rows = rows_count;
+        h.cols = columns_count;
+
+        if ( fwrite ( &h, sizeof ( h ), 1, file ) != 1 )
+        {
+                throw ErrorFileWrite ( "ErrorFileWrite: can not write header of the binary matrix file. ", "" );
+        }
+}
+
+#endif
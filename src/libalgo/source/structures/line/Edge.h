@@ -22,6 +22,7 @@
 #define Edge_H
 
 #include <stdio.h>
+#include <iostream>
 
 //Edge having 2 start points
 template <typename Point>
@@ -33,14 +34,17 @@ class Edge
 
         public:
                 Edge() : p1 ( NULL ), p2 ( NULL ) {}
-                Edge ( const Point * p1_, const Point * p2_ ) : p1 ( p1_ ), p2 ( p2_ ) {}
+                Edge ( Point * p1_, Point * p2_ ) : p1 ( p1_ ), p2 ( p2_ ) {}
                 ~Edge() {}
 
         public:
                 Point * getP1() const {return p1;}
                 Point * getP2() const {return p2;}
-                void setP1 ( const Point * p1_ ) {p1 = p1_;}
-                void setP2 ( const Point * p2_ ) {p2 = p2_;}
+                void setP1 ( Point * p1_ ) {p1 = p1_;}
+                void setP2 ( Point * p2_ ) {p2 = p2_;}
+
+        public:
+                void print ( std::ostream * output = &std::cout ) const {p1->print ( output ); p2->print ( output );}
 };
 
 #endif
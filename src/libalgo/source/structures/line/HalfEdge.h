@@ -25,6 +25,8 @@
 #include <iostream>
 #include <ostream>
 
+#include "libalgo/source/structures/list/MemoryPool.h"
+
 //Forward declarations
 template <typename T>
 class Node3DCartesian;
@@ -32,9 +34,9 @@ class Node3DCartesian;
 template <typename T>
 class Face;
 
-//Half edge data structure
+//Half edge data structure (allocated in the memory pool)
 template <typename T>
-class HalfEdge
+class HalfEdge : public PoolAllocated
 {
         private:
                 Node3DCartesian <T> *start; 		//Start point of the half edge
@@ -44,6 +44,7 @@
 #include "libalgo/source/algorithms/round/Round.h"
 
 #include "libalgo/source/io/File.h"
+#include "libalgo/source/io/FileMapping.h"
 
 #include "libalgo/source/comparators/sortPointsByID.h"
 
@@ -111,36 +112,42 @@ void Container <Point, destructable> ::loadPoints ( const char * file, Dimension
         //Load points from file: load points of dimension 3 (Generic container)
         try
         {
-                //Load file
-                const TFileWords file_content = File::loadFileToWords ( file );
+                //Map file and convert words to numbers
+                const FileMapping file_mapping ( file );
+                TFileRecords file_records;
+                File::loadFileToRecords ( file_mapping, file_records );
+
+                //Allocate points
+                this->items.reserve ( this->items.size() + file_records.size() );
 
                 //Process file
-                for ( unsigned int i = 0; i < file_content.size(); i++ )
+                for ( unsigned int i = 0; i < file_records.size(); i++ )
                 {
+                        const unsigned int n_words = file_records.getWordsCount ( i );
+                        const double * v = file_records.getValues ( i );
+
                         // 3D Geographic point in DD MM SS mode: <point_label> <DD_lat> <MM_lat> <SS_lat> <DD_lon> <MM_lon> <SS_lon> <H>
-                        if ( file_content[i].size() == 8 )
+                        if ( n_words == 8 )
                         {
-                                this->items.push_back ( Point ( file_content[i][0].c_str(), atof ( file_content[i][1].c_str() ) + atof ( file_content[i][2].c_str() ) / 60.0  + atof ( file_content[i][3].c_str() ) / 3600.0,
-                                                                atof ( file_content[i][4].c_str() ) + atof ( file_content[i][5].c_str() ) / 60.0  + atof ( file_content[i][6].c_str() ) / 3600.0, atof ( file_content[i][7].c_str() ) ) );
+                                this->items.push_back ( Point ( file_records.getLabel ( i ).c_str(), v[1] + v[2] / 60.0  + v[3] / 3600.0, v[4] + v[5] / 60.0  + v[6] / 3600.0, v[7] ) );
                         }
 
                         //3D Geographic point in DD MM SS mode: <DD_lat> <MM_lat> <SS_lat> <DD_lon> <MM_lon> <SS_lon> <H>
-                        else if ( file_content[i].size() == 7 )
+                        else if ( n_words == 7 )
                         {
-                                this->items.push_back ( Point ( atof ( file_content[i][0].c_str() ) + atof ( file_content[i][1].c_str() ) / 60.0  + atof ( file_content[i][2].c_str() ) / 3600.0,
-                                                                atof ( file_content[i][3].c_str() ) + atof ( file_content[i][4].c_str() ) / 60.0  + atof ( file_content[i][5].c_str() ) / 3600.0, atof ( file_content[i][6].c_str() ) ) );
+                                this->items.push_back ( Point ( v[0] + v[1] / 60.0  + v[2] / 3600.0, v[3] + v[4] / 60.0  + v[5] / 3600.0, v[6] ) );
                         }
 
                         //Common 3D point with label
-                        else if ( file_content[i].size() == 4 )
+                        else if ( n_words == 4 )
                         {
-                                this->items.push_back ( Point ( file_content[i][0].c_str(), atof ( file_content[i][1].c_str() ), atof ( file_content[i][2].c_str() ), atof ( file_content[i][3].c_str() ) ) );
+                                this->items.push_back ( Point ( file_records.getLabel ( i ).c_str(), v[1], v[2], v[3] ) );
                         }
 
                         //Common 3D point without label
-                        else if ( file_content[i].size() == 3 )
+                        else if ( n_words == 3 )
                         {
-                                this->items.push_back ( Point ( atof ( file_content[i][0].c_str() ), atof ( file_content[i][1].c_str() ), atof ( file_content[i][2].c_str() ) ) );
+                                this->items.push_back ( Point ( v[0], v[1], v[2] ) );
                         }
 
                         //Throw exception
@@ -172,36 +179,42 @@ void Container <Point, destructable> ::loadPoints ( const char * file, Dimension
         //Load points from file: overloaded function for points of dimension 2 (Generic container)
         try
         {
-                //Load file
-                const TFileWords file_content = File::loadFileToWords ( file );
+                //Map file and convert words to numbers
+                const FileMapping file_mapping ( file );
+                TFileRecords file_records;
+                File::loadFileToRecords ( file_mapping, file_records );
+
+                //Allocate points
+                this->items.reserve ( this->items.size() + file_records.size() );
 
                 //Process file
-                for ( unsigned int i = 0; i < file_content.size(); i++ )
+                for ( unsigned int i = 0; i < file_records.size(); i++ )
                 {
+                        const unsigned int n_words = file_records.getWordsCount ( i );
+                        const double * v = file_records.getValues ( i );
+
                         // 2D Geographic point in DD MM SS mode: <point_label> <DD_lat> <MM_lat> <SS_lat> <DD_lon> <MM_lon> <SS_lon> <H>
-                        if ( file_content[i].size() == 7 )
+                        if ( n_words == 7 )
                         {
-                                this->items.push_back ( Point ( file_content[i][0].c_str(), atof ( file_content[i][1].c_str() ) + atof ( file_content[i][2].c_str() ) / 60.0  + atof ( file_content[i][3].c_str() ) / 3600.0,
-                                                                atof ( file_content[i][4].c_str() ) + atof ( file_content[i][5].c_str() ) / 60.0  + atof ( file_content[i][6].c_str() ) / 3600.0 ) );
+                                this->items.push_back ( Point ( file_records.getLabel ( i ).c_str(), v[1] + v[2] / 60.0  + v[3] / 3600.0, v[4] + v[5] / 60.0  + v[6] / 3600.0 ) );
                         }
 
                         //2D Geographic point in DD MM SS mode: <DD_lat> <MM_lat> <SS_lat> <DD_lon> <MM_lon> <SS_lon> <H>
-                        else if ( file_content[i].size() == 6 )
+                        else if ( n_words == 6 )
                         {
-                                this->items.push_back ( Point ( atof ( file_content[i][0].c_str() ) + atof ( file_content[i][1].c_str() ) / 60.0  + atof ( file_content[i][2].c_str() ) / 3600.0,
-                                                                atof ( file_content[i][3].c_str() ) + atof ( file_content[i][4].c_str() ) / 60.0  + atof ( file_content[i][5].c_str() ) / 3600.0 ) );
+                                this->items.push_back ( Point ( v[0] + v[1] / 60.0  + v[2] / 3600.0, v[3] + v[4] / 60.0  + v[5] / 3600.0 ) );
                         }
 
                         //Common 2D point with label
-                        else if ( file_content[i].size() == 3 )
+                        else if ( n_words == 3 )
                         {
-                                this->items.push_back ( Point ( file_content[i][0].c_str(), atof ( file_content[i][1].c_str() ), atof ( file_content[i][2].c_str() ) ) );
+                                this->items.push_back ( Point ( file_records.getLabel ( i ).c_str(), v[1], v[2] ) );
                         }
 
                         //Common 2D point without label
-                        else if ( file_content[i].size() == 2 )
+                        else if ( n_words == 2 )
                         {
-                                this->items.push_back ( Point ( atof ( file_content[i][0].c_str() ), atof ( file_content[i][1].c_str() ) ) );
+                                this->items.push_back ( Point ( v[0], v[1] ) );
                         }
 
                         //Throw exception
@@ -275,36 +288,42 @@ void Container <Point *, destructable> ::loadPoints ( const char * file, Dimensi
         //Load points from file: load points of dimension 3 (Partial specialization for Point *)
         try
         {
-                //Load file
-                const TFileWords file_content = File::loadFileToWords ( file );
+                //Map file and convert words to numbers
+                const FileMapping file_mapping ( file );
+                TFileRecords file_records;
+                File::loadFileToRecords ( file_mapping, file_records );
+
+                //Allocate points
+                this->items.reserve ( this->items.size() + file_records.size() );
 
                 //Process file
-                for ( unsigned int i = 0; i < file_content.size(); i++ )
+                for ( unsigned int i = 0; i < file_records.size(); i++ )
                 {
+                        const unsigned int n_words = file_records.getWordsCount ( i );
+                        const double * v = file_records.getValues ( i );
+
                         // 3D Geographic point in DD MM SS mode: <point_label> <DD_lat> <MM_lat> <SS_lat> <DD_lon> <MM_lon> <SS_lon> <H>
-                        if ( file_content[i].size() == 8 )
+                        if ( n_words == 8 )
                         {
-                                this->items.push_back ( new Point ( file_content[i][0].c_str(), atof ( file_content[i][1].c_str() ) + atof ( file_content[i][2].c_str() ) / 60.0  + atof ( file_content[i][3].c_str() ) / 3600.0,
-                                                                    atof ( file_content[i][4].c_str() ) + atof ( file_content[i][5].c_str() ) / 60.0  + atof ( file_content[i][6].c_str() ) / 3600.0, atof ( file_content[i][7].c_str() ) ) );
+                                this->items.push_back ( new Point ( file_records.getLabel ( i ).c_str(), v[1] + v[2] / 60.0  + v[3] / 3600.0, v[4] + v[5] / 60.0  + v[6] / 3600.0, v[7] ) );
                         }
 
                         //3D Geographic point in DD MM SS mode: <DD_lat> <MM_lat> <SS_lat> <DD_lon> <MM_lon> <SS_lon> <H>
-                        else if ( file_content[i].size() == 7 )
+                        else if ( n_words == 7 )
                         {
-                                this->items.push_back ( new Point ( atof ( file_content[i][0].c_str() ) + atof ( file_content[i][1].c_str() ) / 60.0  + atof ( file_content[i][2].c_str() ) / 3600.0,
-                                                                    atof ( file_content[i][3].c_str() ) + atof ( file_content[i][4].c_str() ) / 60.0  + atof ( file_content[i][5].c_str() ) / 3600.0, atof ( file_content[i][6].c_str() ) ) );
+                                this->items.push_back ( new Point ( v[0] + v[1] / 60.0  + v[2] / 3600.0, v[3] + v[4] / 60.0  + v[5] / 3600.0, v[6] ) );
                         }
 
                         //Common 3D point with label
-                        else if ( file_content[i].size() == 4 )
+                        else if ( n_words == 4 )
                         {
-                                this->items.push_back ( new Point ( file_content[i][0].c_str(), atof ( file_content[i][1].c_str() ), atof ( file_content[i][2].c_str() ), atof ( file_content[i][3].c_str() ) ) );
+                                this->items.push_back ( new Point ( file_records.getLabel ( i ).c_str(), v[1], v[2], v[3] ) );
                         }
 
                         //Common 3D point without label
-                        else if ( file_content[i].size() == 3 )
+                        else if ( n_words == 3 )
                         {
-                                this->items.push_back ( new Point ( atof ( file_content[i][0].c_str() ), atof ( file_content[i][1].c_str() ), atof ( file_content[i][2].c_str() ) ) );
+                                this->items.push_back ( new Point ( v[0], v[1], v[2] ) );
                         }
 
                         //Throw exception
@@ -354,36 +373,42 @@ void Container <Point *, destructable> ::loadPoints ( const char * file, Dimensi
         //Load points from file: overloaded function for points of dimension 2 (Partial specialization for Point *)
         try
         {
-                //Load file
-                const TFileWords file_content = File::loadFileToWords ( file );
+                //Map file and convert words to numbers
+                const FileMapping file_mapping ( file );
+                TFileRecords file_records;
+                File::loadFileToRecords ( file_mapping, file_records );
+
+                //Allocate points
+                this->items.reserve ( this->items.size() + file_records.size() );
 
                 //Process file
-                for ( unsigned int i = 0; i < file_content.size(); i++ )
+                for ( unsigned int i = 0; i < file_records.size(); i++ )
                 {
+                        const unsigned int n_words = file_records.getWordsCount ( i );
+                        const double * v = file_records.getValues ( i );
+
                         // 2D Geographic point in DD MM SS mode: <point_label> <DD_lat> <MM_lat> <SS_lat> <DD_lon> <MM_lon> <SS_lon> <H>
-                        if ( file_content[i].size() == 7 )
+                        if ( n_words == 7 )
                         {
-                                this->items.push_back ( new Point ( file_content[i][0].c_str(), atof ( file_content[i][1].c_str() ) + atof ( file_content[i][2].c_str() ) / 60.0  + atof ( file_content[i][3].c_str() ) / 3600.0,
-                                                                    atof ( file_content[i][4].c_str() ) + atof ( file_content[i][5].c_str() ) / 60.0  + atof ( file_content[i][6].c_str() ) / 3600.0 ) );
+                                this->items.push_back ( new Point ( file_records.getLabel ( i ).c_str(), v[1] + v[2] / 60.0  + v[3] / 3600.0, v[4] + v[5] / 60.0  + v[6] / 3600.0 ) );
                         }
 
                         //2D Geographic point in DD MM SS mode: <DD_lat> <MM_lat> <SS_lat> <DD_lon> <MM_lon> <SS_lon> <H>
-                        else if ( file_content[i].size() == 6 )
+                        else if ( n_words == 6 )
                         {
-                                this->items.push_back ( new Point ( atof ( file_content[i][0].c_str() ) + atof ( file_content[i][1].c_str() ) / 60.0  + atof ( file_content[i][2].c_str() ) / 3600.0,
-                                                                    atof ( file_content[i][3].c_str() ) + atof ( file_content[i][4].c_str() ) / 60.0  + atof ( file_content[i][5].c_str() ) / 3600.0 ) );
+                                this->items.push_back ( new Point ( v[0] + v[1] / 60.0  + v[2] / 3600.0, v[3] + v[4] / 60.0  + v[5] / 3600.0 ) );
                         }
 
                         //Common 2D point with label
-                        else if ( file_content[i].size() == 3 )
+                        else if ( n_words == 3 )
                         {
-                                this->items.push_back ( new Point ( file_content[i][0].c_str(), atof ( file_content[i][1].c_str() ), atof ( file_content[i][2].c_str() ) ) );
+                                this->items.push_back ( new Point ( file_records.getLabel ( i ).c_str(), v[1], v[2] ) );
                         }
 
                         //Common 2D point without label
-                        else if ( file_content[i].size() == 2 )
+                        else if ( n_words == 2 )
                         {
-                                this->items.push_back ( new Point ( atof ( file_content[i][0].c_str() ), atof ( file_content[i][1].c_str() ) ) );
+                                this->items.push_back ( new Point ( v[0], v[1] ) );
                         }
 
                         //Throw exception
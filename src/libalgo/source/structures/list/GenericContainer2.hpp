@@ -74,10 +74,13 @@ void GenericContainer2 <Item, destructable>::updateIDOfItems()
                 for ( unsigned int i = 0; i < n; i++ ) replace_items_id [this->items[i].getPointID() ] = i;
 
                 //Replace item numbers to ommit (possible) gaps
+                //New IDs are reserved at once, they are consecutive even if points are created by other threads
+                unsigned int point_id = Item::getNewPointIDs ( replace_items_id.size() );
+
                 for ( TReplaceItemsID::const_iterator i_replace_items_id = replace_items_id.begin();
                                 i_replace_items_id != replace_items_id.end(); i_replace_items_id ++ )
                 {
-                        this->items[i_replace_items_id->second].updateID();
+                        this->items[i_replace_items_id->second].setPointID ( point_id ++ );
                 }
         }
 }
@@ -151,10 +154,13 @@ void GenericContainer2 <Item *, destructable>::updateIDOfItems()
                 for ( unsigned int i = 0; i < n; i++ ) replace_items_id [this->items[i]->getPointID() ] = i;
 
                 //Replace numebrs numbers with actual item_id to ommit (possible) gaps
+                //New IDs are reserved at once, they are consecutive even if points are created by other threads
+                unsigned int point_id = Item::getNewPointIDs ( replace_items_id.size() );
+
                 for ( TReplaceItemsID::const_iterator i_replace_items_id = replace_items_id.begin();
                                 i_replace_items_id != replace_items_id.end(); i_replace_items_id ++ )
                 {
-                        this->items[i_replace_items_id->second] ->updateID();
+                        this->items[i_replace_items_id->second]->setPointID ( point_id ++ );
                 }
         }
 }
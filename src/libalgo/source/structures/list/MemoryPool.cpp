@@ -0,0 +1,347 @@
+#include "MemoryPool.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+
+
+//Size of the item header holding the pool of the item (items behind the header remain aligned)
+static const std::size_t MEMORY_POOL_HEADER_SIZE = ( sizeof ( MemoryPool * ) + MEMORY_POOL_ALIGNMENT - 1 ) / MEMORY_POOL_ALIGNMENT * MEMORY_POOL_ALIGNMENT;
+
+//Token of the thread (its address identifies the thread), default and current arena of the thread
+//Default arenas are never destroyed: objects may be released from static destructors or by other threads
+static char thread_token;
+static MemoryArena * thread_arena = NULL;
+static MemoryArena * current_arena = NULL;
+
+#ifdef _OPENMP
+#pragma omp threadprivate ( thread_token, thread_arena, current_arena )
+#endif
+
+
+MemoryPool::MemoryPool ( const std::size_t item_size_, const unsigned int block_items_ ) : item_size ( item_size_ ), block_items ( block_items_ ), free_list ( NULL ),
+        block_next ( NULL ), block_end ( NULL ), items_count ( 0 ), owner ( NULL ), remote_list ( NULL ), remote_count ( 0 ), remote_lock ( NULL ),
+        orphaned ( false )
+{
+        //Round the size to keep items aligned, add the header (it holds the free list link of the released item)
+        item_size = ( item_size + MEMORY_POOL_ALIGNMENT - 1 ) / MEMORY_POOL_ALIGNMENT * MEMORY_POOL_ALIGNMENT + MEMORY_POOL_HEADER_SIZE;
+
+        if ( block_items == 0 ) block_items = 1;
+
+#ifdef _OPENMP
+        omp_lock_t * lock = new omp_lock_t;
+        omp_init_lock ( lock );
+        remote_lock = lock;
+#endif
+}
+
+
+MemoryPool::~MemoryPool()
+{
+        //Release all blocks
+        for ( unsigned int i = 0; i < blocks.size(); i++ ) ::operator delete ( blocks[i] );
+
+#ifdef _OPENMP
+        omp_lock_t * lock = static_cast <omp_lock_t *> ( remote_lock );
+        omp_destroy_lock ( lock );
+        delete lock;
+#endif
+}
+
+
+void * MemoryPool::allocate()
+{
+        //Allocate an item from the pool, items released by other threads are reused before a new block is allocated
+        if ( free_list == NULL && block_next == block_end ) collectRemoteItems();
+
+        char * item = NULL;
+
+        //Reuse the released item
+        if ( free_list != NULL )
+        {
+                item = static_cast <char *> ( free_list );
+                free_list = * static_cast <void **> ( free_list );
+        }
+
+        else
+        {
+                //Allocate a new block
+                if ( block_next == block_end )
+                {
+                        block_next = static_cast <char *> ( ::operator new ( item_size * block_items ) );
+                        block_end = block_next + item_size * block_items;
+
+                        try
+                        {
+                                blocks.push_back ( block_next );
+                        }
+
+                        catch ( ... )
+                        {
+                                ::operator delete ( block_next );
+                                block_next = block_end = NULL;
+                                throw;
+                        }
+                }
+
+                //Carve the item from the last block
+                item = block_next;
+                block_next += item_size;
+        }
+
+        items_count ++;
+
+        //Store the pool in the header
+        * reinterpret_cast <MemoryPool **> ( item ) = this;
+
+        return item + MEMORY_POOL_HEADER_SIZE;
+}
+
+
+void MemoryPool::deallocate ( void * item )
+{
+        //Return the item to the pool
+        void * header = static_cast <char *> ( item ) - MEMORY_POOL_HEADER_SIZE;
+
+        //Released by the owner: no synchronization
+        if ( owner == MemoryArena::getThread() )
+        {
+                * static_cast <void **> ( header ) = free_list;
+                free_list = header;
+                items_count --;
+        }
+
+        //Released by other thread: the item is collected later by the owner
+        else
+        {
+#ifdef _OPENMP
+                omp_set_lock ( static_cast <omp_lock_t *> ( remote_lock ) );
+#endif
+                * static_cast <void **> ( header ) = remote_list;
+                remote_list = header;
+                remote_count ++;
+
+                //Last item of the orphaned pool: nobody else may access the pool
+                const bool released = orphaned && ( remote_count == items_count );
+#ifdef _OPENMP
+                omp_unset_lock ( static_cast <omp_lock_t *> ( remote_lock ) );
+#endif
+
+                if ( released ) delete this;
+        }
+}
+
+
+void MemoryPool::clear ( const bool keep_first_block )
+{
+        //Release all blocks at once, no item may be used any more
+        if ( getItemsCount() > 0 )
+        {
+                throw ErrorBadData ( "ErrorBadData: can not clear the memory pool, ", "some items are still used." );
+        }
+
+        const unsigned int kept_blocks = ( keep_first_block && !blocks.empty() ? 1 : 0 );
+
+        for ( unsigned int i = kept_blocks; i < blocks.size(); i++ ) ::operator delete ( blocks[i] );
+
+        blocks.resize ( kept_blocks );
+        free_list = NULL;
+
+        //Items will be carved from the beginning of the kept block
+        block_next = ( kept_blocks > 0 ? blocks[0] : NULL );
+        block_end = ( kept_blocks > 0 ? blocks[0] + item_size * block_items : NULL );
+}
+
+
+unsigned int MemoryPool::getItemsCount()
+{
+        //Count of live items, items released by other threads are collected first
+        collectRemoteItems();
+
+        return items_count;
+}
+
+
+bool MemoryPool::orphan()
+{
+        //Detach the pool from its destroyed arena, true is returned if no item is used and the pool may be deleted
+        //Otherwise all items are released as remote items and the last one deletes the pool
+        collectRemoteItems();
+
+#ifdef _OPENMP
+        omp_set_lock ( static_cast <omp_lock_t *> ( remote_lock ) );
+#endif
+        const bool unused = ( remote_count == items_count );
+
+        if ( !unused )
+        {
+                owner = NULL;
+                orphaned = true;
+        }
+#ifdef _OPENMP
+        omp_unset_lock ( static_cast <omp_lock_t *> ( remote_lock ) );
+#endif
+
+        return unused;
+}
+
+
+void MemoryPool::collectRemoteItems()
+{
+        //Move items released by other threads to the free list
+        void * items = NULL;
+        unsigned int count = 0;
+
+#ifdef _OPENMP
+        omp_set_lock ( static_cast <omp_lock_t *> ( remote_lock ) );
+#endif
+        items = remote_list;
+        count = remote_count;
+        remote_list = NULL;
+        remote_count = 0;
+#ifdef _OPENMP
+        omp_unset_lock ( static_cast <omp_lock_t *> ( remote_lock ) );
+#endif
+
+        if ( items == NULL ) return;
+
+        //Append the free list to the collected items
+        void * last = items;
+
+        while ( * static_cast <void **> ( last ) != NULL ) last = * static_cast <void **> ( last );
+
+        * static_cast <void **> ( last ) = free_list;
+        free_list = items;
+        items_count -= count;
+}
+
+
+MemoryArena::MemoryArena() : owner ( MemoryArena::getThread() )
+{
+        for ( unsigned int i = 0; i < SizeClasses; i++ ) pools[i] = NULL;
+}
+
+
+MemoryArena::~MemoryArena()
+{
+        //Release all pools
+        for ( unsigned int i = 0; i < SizeClasses; i++ )
+        {
+                if ( pools[i] == NULL ) continue;
+
+                //Some items are still used: the pool (its items remain valid) is deleted with its last item
+                if ( pools[i] -> orphan() ) delete pools[i];
+        }
+}
+
+
+void * MemoryArena::allocate ( const std::size_t size )
+{
+        //Large objects are allocated by the global operator, their header holds no pool
+        if ( size > MEMORY_POOL_MAX_ITEM_SIZE )
+        {
+                char * item = static_cast <char *> ( ::operator new ( size + MEMORY_POOL_HEADER_SIZE ) );
+                * reinterpret_cast <MemoryPool **> ( item ) = NULL;
+
+                return item + MEMORY_POOL_HEADER_SIZE;
+        }
+
+        //Get pool of the size class, create it if necessary
+        const std::size_t size_class = ( size + MEMORY_POOL_ALIGNMENT - 1 ) / MEMORY_POOL_ALIGNMENT;
+
+        if ( pools[size_class] == NULL )
+        {
+                pools[size_class] = new MemoryPool ( size_class * MEMORY_POOL_ALIGNMENT );
+                pools[size_class] -> setOwner ( owner );
+        }
+
+        return pools[size_class] -> allocate();
+}
+
+
+void MemoryArena::deallocate ( void * item )
+{
+        //Release the item in its pool (in any arena)
+        if ( item == NULL ) return;
+
+        char * header = static_cast <char *> ( item ) - MEMORY_POOL_HEADER_SIZE;
+        MemoryPool * pool = * reinterpret_cast <MemoryPool **> ( header );
+
+        //Large objects are released by the global operator
+        if ( pool == NULL )
+        {
+                ::operator delete ( header );
+                return;
+        }
+
+        pool -> deallocate ( item );
+}
+
+
+void MemoryArena::reset()
+{
+        //Release all items at once, keep the first block of each pool for the next items
+        if ( getItemsCount() > 0 )
+        {
+                throw ErrorBadData ( "ErrorBadData: can not reset the memory arena, ", "some items are still used." );
+        }
+
+        for ( unsigned int i = 0; i < SizeClasses; i++ )
+        {
+                if ( pools[i] != NULL ) pools[i] -> clear ( true );
+        }
+}
+
+
+unsigned int MemoryArena::getItemsCount()
+{
+        //Count of live items in all pools
+        unsigned int items_count = 0;
+
+        for ( unsigned int i = 0; i < SizeClasses; i++ )
+        {
+                if ( pools[i] != NULL ) items_count += pools[i] -> getItemsCount();
+        }
+
+        return items_count;
+}
+
+
+void MemoryArena::setOwner ( const void * owner_ )
+{
+        //Set the thread using the arena
+        owner = owner_;
+
+        for ( unsigned int i = 0; i < SizeClasses; i++ )
+        {
+                if ( pools[i] != NULL ) pools[i] -> setOwner ( owner );
+        }
+}
+
+
+MemoryArena * MemoryArena::getCurrent()
+{
+        //Get the current arena of the thread, create the default arena of the thread if necessary
+        if ( current_arena == NULL )
+        {
+                if ( thread_arena == NULL ) thread_arena = new MemoryArena();
+
+                current_arena = thread_arena;
+        }
+
+        return current_arena;
+}
+
+
+void MemoryArena::setCurrent ( MemoryArena * arena )
+{
+        current_arena = arena;
+}
+
+
+const void * MemoryArena::getThread()
+{
+        return &thread_token;
+}
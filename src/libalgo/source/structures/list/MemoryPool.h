@@ -0,0 +1,153 @@
+// Description: Pool allocator of the small objects (points, nodes, half edges)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef MemoryPool_H
+#define MemoryPool_H
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+#include "libalgo/source/const/Const.h"
+
+
+//Pool of the items having the same size class
+//Items are carved from the large blocks, released items are kept in the free list and reused
+//Every item is preceded by a header holding its pool, so it may be released in any arena or thread
+//Pool is used by one thread (its owner), items released by other threads are kept in the remote list
+//Pool of the destroyed arena having live items is orphaned: all items are released as remote ones, the last one deletes the pool
+class MemoryPool
+{
+        private:
+                std::size_t item_size;				//Size of the item including the header (rounded to MEMORY_POOL_ALIGNMENT)
+                unsigned int block_items;			//Count of items allocated in one block
+                std::vector <char *> blocks;			//Allocated blocks
+                void * free_list;				//Released items (linked through their headers)
+                char * block_next;				//Next unused item in the last block
+                char * block_end;				//End of the last block
+                unsigned int items_count;			//Count of live items
+                const void * owner;				//Thread using the pool
+                void * remote_list;				//Items released by other threads
+                unsigned int remote_count;			//Count of items in the remote list
+                void * remote_lock;				//Lock of the remote list
+                bool orphaned;					//Arena of the pool has been destroyed, the pool is deleted with its last item
+
+        public:
+                MemoryPool ( const std::size_t item_size_, const unsigned int block_items_ = MEMORY_POOL_BLOCK_ITEMS );
+                ~MemoryPool();
+
+        public:
+                void * allocate();
+                void deallocate ( void * item );
+                void clear ( const bool keep_first_block = false );
+
+                std::size_t getItemSize() const { return item_size; }
+                unsigned int getItemsCount();
+                unsigned int getBlocksCount() const { return blocks.size(); }
+
+                void setOwner ( const void * owner_ ) { owner = owner_; }
+                bool orphan();
+
+        private:
+                MemoryPool ( const MemoryPool & );
+                MemoryPool & operator = ( const MemoryPool & );
+
+                void collectRemoteItems();
+};
+
+
+//Arena: pools of all size classes used by one thread
+//Every thread allocates in its own default arena, a sample or a container may install its own arena by MemoryArenaScope
+//Arena releases all its blocks at once by reset() or when it is destroyed, pools having live items are released with their last item
+class MemoryArena
+{
+        public:
+                enum { SizeClasses = ( MEMORY_POOL_MAX_ITEM_SIZE + MEMORY_POOL_ALIGNMENT - 1 ) / MEMORY_POOL_ALIGNMENT + 1 };
+
+        private:
+                MemoryPool * pools[SizeClasses];		//Pools of the size classes (created on demand)
+                const void * owner;				//Thread using the arena
+
+        public:
+                MemoryArena();
+                ~MemoryArena();
+
+        public:
+                void * allocate ( const std::size_t size );
+                void reset();
+
+                unsigned int getItemsCount();
+                void setOwner ( const void * owner_ );
+
+                static void deallocate ( void * item );
+
+                static MemoryArena * getCurrent();
+                static void setCurrent ( MemoryArena * arena );
+                static const void * getThread();
+
+        private:
+                MemoryArena ( const MemoryArena & );
+                MemoryArena & operator = ( const MemoryArena & );
+};
+
+
+//Install the arena as the current arena of the calling thread, the previous arena is restored by the destructor
+class MemoryArenaScope
+{
+        private:
+                MemoryArena * previous;
+
+        public:
+                MemoryArenaScope ( MemoryArena & arena ) : previous ( MemoryArena::getCurrent() ) { arena.setOwner ( MemoryArena::getThread() ); MemoryArena::setCurrent ( &arena ); }
+                ~MemoryArenaScope() { MemoryArena::setCurrent ( previous ); }
+
+        private:
+                MemoryArenaScope ( const MemoryArenaScope & );
+                MemoryArenaScope & operator = ( const MemoryArenaScope & );
+};
+
+
+//Allocation policy: objects of the derived classes are allocated in the current arena of the thread
+//The class having this base must have a virtual destructor if it is deleted through the pointer to base
+class PoolAllocated
+{
+        public:
+                static void * operator new ( std::size_t size ) { return MemoryArena::getCurrent() -> allocate ( size ); }
+                static void operator delete ( void * item ) { MemoryArena::deallocate ( item ); }
+
+                //Nothrow and placement forms hidden by the class operators
+                static void * operator new ( std::size_t size, const std::nothrow_t & ) throw()
+                {
+                        try { return MemoryArena::getCurrent() -> allocate ( size ); }
+                        catch ( ... ) { return NULL; }
+                }
+
+                static void operator delete ( void * item, const std::nothrow_t & ) throw() { MemoryArena::deallocate ( item ); }
+                static void * operator new ( std::size_t, void * place ) throw() { return place; }
+                static void operator delete ( void *, void * ) throw() {}
+
+        protected:
+                PoolAllocated() {}
+                ~PoolAllocated() {}
+};
+
+#endif
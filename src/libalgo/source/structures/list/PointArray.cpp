@@ -0,0 +1 @@
+#include "PointArray.h"
\ No newline at end of file
@@ -0,0 +1,107 @@
+// Description: Point coordinates stored in separate arrays (structure of arrays)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef PointArray_H
+#define PointArray_H
+
+#include <vector>
+#include <string>
+
+#include "libalgo/source/structures/list/GenericContainer2.h"
+
+
+//Forward declaration
+template < typename T, const TDestructable destructable >
+class Container;
+
+
+//Points stored as the structure of arrays: x, y, z coordinates in contiguous arrays
+//Point IDs and labels are kept in optional side tables
+//Coordinate scans (distances, KD tree, convex hull, transformations) run with unit stride
+template <typename T>
+class PointArray
+{
+        private:
+                std::vector <T> x;				//X coordinates
+                std::vector <T> y;				//Y coordinates
+                std::vector <T> z;				//Z coordinates
+                std::vector <unsigned int> ids;			//Point IDs (optional, empty or one for each point)
+                std::vector <std::string> labels;		//Point labels (optional, empty or one for each point)
+
+        public:
+                //Store type of the point coordiantes
+                typedef T Type;
+
+        public:
+                PointArray() {}
+                PointArray ( const unsigned int n ) : x ( n ), y ( n ), z ( n ) {}
+
+                template <typename Point, TDestructable destructable>
+                PointArray ( const Container <Point *, destructable> &points, const bool store_ids = false, const bool store_labels = false ) { load ( points, store_ids, store_labels ); }
+
+        public:
+                template <typename Point, TDestructable destructable>
+                void load ( const Container <Point *, destructable> &points, const bool store_ids = false, const bool store_labels = false );
+
+                template <typename Point, TDestructable destructable>
+                void createPoints ( Container <Point *, destructable> &points ) const;
+
+        public:
+                void push_back ( const T x_, const T y_, const T z_ = 0 );
+                void push_back ( const T x_, const T y_, const T z_, const unsigned int id, const char * label = NULL );
+
+                void resize ( const unsigned int n );
+                void reserve ( const unsigned int n );
+                void clear();
+
+                unsigned int size() const { return x.size(); }
+                bool empty() const { return x.empty(); }
+
+        public:
+                //Contiguous arrays of coordinates
+                const T * getX() const { return x.empty() ? NULL : &x[0]; }
+                const T * getY() const { return y.empty() ? NULL : &y[0]; }
+                const T * getZ() const { return z.empty() ? NULL : &z[0]; }
+                T * getX() { return x.empty() ? NULL : &x[0]; }
+                T * getY() { return y.empty() ? NULL : &y[0]; }
+                T * getZ() { return z.empty() ? NULL : &z[0]; }
+
+                //Coordinates of the i-th point
+                T getX ( const unsigned int i ) const { return x[i]; }
+                T getY ( const unsigned int i ) const { return y[i]; }
+                T getZ ( const unsigned int i ) const { return z[i]; }
+
+                void setX ( const unsigned int i, const T x_ ) { x[i] = x_; }
+                void setY ( const unsigned int i, const T y_ ) { y[i] = y_; }
+                void setZ ( const unsigned int i, const T z_ ) { z[i] = z_; }
+
+                //Side tables
+                bool hasPointIDs() const { return !ids.empty(); }
+                bool hasPointLabels() const { return !labels.empty(); }
+
+                unsigned int getPointID ( const unsigned int i ) const { return ids[i]; }
+                const char * getPointLabel ( const unsigned int i ) const { return labels[i].c_str(); }
+};
+
+#include "PointArray.hpp"
+
+#endif
@@ -0,0 +1,152 @@
+// Description: Point coordinates stored in separate arrays (structure of arrays)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef PointArray_HPP
+#define PointArray_HPP
+
+
+template <typename T>
+template <typename Point, TDestructable destructable>
+void PointArray <T> ::load ( const Container <Point *, destructable> &points, const bool store_ids, const bool store_labels )
+{
+        //Copy coordinates (and optionally IDs and labels) of points into the arrays
+        const unsigned int n = points.size();
+
+        resize ( n );
+        ids.clear();
+        labels.clear();
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                x[i] = points [i]->getX();
+                y[i] = points [i]->getY();
+                z[i] = points [i]->getZ();
+        }
+
+        //Store point IDs
+        if ( store_ids )
+        {
+                ids.resize ( n );
+
+                for ( unsigned int i = 0; i < n; i++ )
+                {
+                        ids[i] = points [i]->getPointID();
+                }
+        }
+
+        //Store point labels
+        if ( store_labels )
+        {
+                labels.resize ( n );
+
+                for ( unsigned int i = 0; i < n; i++ )
+                {
+                        const char * label = points [i]->getPointLabel();
+
+                        if ( label != NULL ) labels[i] = label;
+                }
+        }
+}
+
+
+template <typename T>
+template <typename Point, TDestructable destructable>
+void PointArray <T> ::createPoints ( Container <Point *, destructable> &points ) const
+{
+        //Create points from the arrays and append them to the container, labels are copied if stored
+        const unsigned int n = x.size();
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                if ( !labels.empty() )
+                {
+                        points.push_back ( new Point ( labels[i].c_str(), x[i], y[i], z[i] ) );
+                }
+
+                else
+                {
+                        points.push_back ( new Point ( x[i], y[i], z[i] ) );
+                }
+        }
+}
+
+
+template <typename T>
+void PointArray <T> ::push_back ( const T x_, const T y_, const T z_ )
+{
+        //Add point, side tables can not be used
+        x.push_back ( x_ );
+        y.push_back ( y_ );
+        z.push_back ( z_ );
+}
+
+
+template <typename T>
+void PointArray <T> ::push_back ( const T x_, const T y_, const T z_, const unsigned int id, const char * label )
+{
+        //Add point including its ID and label, side tables are used for all points
+        push_back ( x_, y_, z_ );
+
+        ids.resize ( x.size() - 1 );
+        ids.push_back ( id );
+
+        labels.resize ( x.size() - 1 );
+        labels.push_back ( label != NULL ? label : "" );
+}
+
+
+template <typename T>
+void PointArray <T> ::resize ( const unsigned int n )
+{
+        //Resize arrays, side tables are resized only if used
+        x.resize ( n );
+        y.resize ( n );
+        z.resize ( n );
+
+        if ( !ids.empty() ) ids.resize ( n );
+
+        if ( !labels.empty() ) labels.resize ( n );
+}
+
+
+template <typename T>
+void PointArray <T> ::reserve ( const unsigned int n )
+{
+        //Reserve space for n points
+        x.reserve ( n );
+        y.reserve ( n );
+        z.reserve ( n );
+}
+
+
+template <typename T>
+void PointArray <T> ::clear()
+{
+        //Remove all points
+        x.clear();
+        y.clear();
+        z.clear();
+        ids.clear();
+        labels.clear();
+}
+
+#endif
@@ -0,0 +1,102 @@
+#include "QuadEdgeMesh.h"
+
+#include <algorithm>
+
+
+unsigned int QuadEdgeMesh::makeEdge ( const unsigned int v1, const unsigned int v2 )
+{
+        //Create isolated edge (v1, v2), deleted quad edges are reused
+        unsigned int e = onext.size();
+
+        if ( !free_edges.empty() )
+        {
+                e = free_edges.back();
+                free_edges.pop_back();
+        }
+
+        else
+        {
+                onext.resize ( e + 4 );
+                origins.resize ( ( e >> 1 ) + 2 );
+        }
+
+        //Primal edges form single loops, dual edges form the loop around one face
+        onext[e] = e;
+        onext[e + 1] = e + 3;
+        onext[e + 2] = e + 2;
+        onext[e + 3] = e + 1;
+
+        origins[e >> 1] = v1;
+        origins[ ( e >> 1 ) + 1] = v2;
+
+        return e;
+}
+
+
+unsigned int QuadEdgeMesh::connect ( const unsigned int a, const unsigned int b )
+{
+        //Create edge from the destination of a to the origin of b, all three edges have the same left face
+        const unsigned int e = makeEdge ( getDestination ( a ), getOrigin ( b ) );
+
+        splice ( e, getLnext ( a ) );
+        splice ( getSym ( e ), b );
+
+        return e;
+}
+
+
+void QuadEdgeMesh::splice ( const unsigned int a, const unsigned int b )
+{
+        //Join or split the edge rings around the origins of a and b
+        const unsigned int alpha = getRot ( onext[a] );
+        const unsigned int beta = getRot ( onext[b] );
+
+        std::swap ( onext[a], onext[b] );
+        std::swap ( onext[alpha], onext[beta] );
+}
+
+
+void QuadEdgeMesh::deleteEdge ( const unsigned int e )
+{
+        //Disconnect the edge and keep its quad edge for reuse
+        splice ( e, getOprev ( e ) );
+        splice ( getSym ( e ), getOprev ( getSym ( e ) ) );
+
+        const unsigned int q = e & ~3u;
+
+        origins[q >> 1] = DELETED_QUAD_EDGE;
+        origins[ ( q >> 1 ) + 1] = DELETED_QUAD_EDGE;
+
+        free_edges.push_back ( q );
+}
+
+
+unsigned int QuadEdgeMesh::append ( const QuadEdgeMesh &mesh )
+{
+        //Append edges of the mesh, its edge indices are shifted by the returned offset
+        const unsigned int offset = onext.size(), n = mesh.onext.size();
+
+        onext.reserve ( offset + n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                onext.push_back ( mesh.onext[i] + offset );
+        }
+
+        origins.insert ( origins.end(), mesh.origins.begin(), mesh.origins.end() );
+
+        for ( unsigned int i = 0; i < mesh.free_edges.size(); i++ )
+        {
+                free_edges.push_back ( mesh.free_edges[i] + offset );
+        }
+
+        return offset;
+}
+
+
+void QuadEdgeMesh::reserve ( const unsigned int quad_edges_count )
+{
+        //Reserve memory for quad edges
+        onext.reserve ( 4 * quad_edges_count );
+        origins.reserve ( 2 * quad_edges_count );
+}
@@ -0,0 +1,72 @@
+// Description: Index based quad edge structure (Guibas, Stolfi, 1985)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef QuadEdgeMesh_H
+#define QuadEdgeMesh_H
+
+#include <vector>
+
+
+//Origin of the deleted quad edge
+#define DELETED_QUAD_EDGE			0xFFFFFFFF
+
+
+//Index based quad edge structure (Guibas, Stolfi, 1985): edge e = 4q + r is the r-th rotation of the quad edge q,
+//edges 4q and 4q + 2 are the primal (directed) edges, edges 4q + 1 and 4q + 3 the dual ones
+//Onext links of all edges and origins of the primal edges (vertex indices) are stored in flat arrays
+class QuadEdgeMesh
+{
+        private:
+                std::vector <unsigned int> onext;		//Next edge counterclockwise around the origin, 4 per quad edge
+                std::vector <unsigned int> origins;		//Origins of the primal edges, 2 per quad edge
+                std::vector <unsigned int> free_edges;		//Deleted quad edges reused by makeEdge
+
+        public:
+                QuadEdgeMesh() {}
+
+        public:
+                static unsigned int getRot ( const unsigned int e ) {return ( e & ~3u ) | ( ( e + 1 ) & 3u );}
+                static unsigned int getRotInv ( const unsigned int e ) {return ( e & ~3u ) | ( ( e + 3 ) & 3u );}
+                static unsigned int getSym ( const unsigned int e ) {return e ^ 2u;}
+
+                unsigned int getOnext ( const unsigned int e ) const {return onext[e];}
+                unsigned int getOprev ( const unsigned int e ) const {return getRot ( onext[getRot ( e )] );}
+                unsigned int getLnext ( const unsigned int e ) const {return getRot ( onext[getRotInv ( e )] );}
+                unsigned int getRprev ( const unsigned int e ) const {return onext[getSym ( e )];}
+
+                unsigned int getOrigin ( const unsigned int e ) const {return origins[e >> 1];}
+                unsigned int getDestination ( const unsigned int e ) const {return origins[getSym ( e ) >> 1];}
+
+                unsigned int getEdgesCount() const {return onext.size();}
+                bool isDeleted ( const unsigned int e ) const {return origins[ ( e >> 2 ) << 1] == DELETED_QUAD_EDGE;}
+
+        public:
+                unsigned int makeEdge ( const unsigned int v1, const unsigned int v2 );
+                unsigned int connect ( const unsigned int a, const unsigned int b );
+                void splice ( const unsigned int a, const unsigned int b );
+                void deleteEdge ( const unsigned int e );
+
+                unsigned int append ( const QuadEdgeMesh &mesh );
+                void reserve ( const unsigned int quad_edges_count );
+};
+
+#endif
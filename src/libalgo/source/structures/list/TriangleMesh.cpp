@@ -0,0 +1 @@
+#include "TriangleMesh.h"
\ No newline at end of file
@@ -0,0 +1,88 @@
+// Description: Index based triangle mesh (half edges stored in flat arrays)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef TriangleMesh_H
+#define TriangleMesh_H
+
+#include <vector>
+
+
+//Twin of the boundary half edge, edge not found
+#define NO_HALF_EDGE				0xFFFFFFFF
+
+
+//Forward declarations
+template <typename T>
+class Node3DCartesian;
+
+
+//Index based triangle mesh: half edges of the i-th triangle are 3i, 3i + 1, 3i + 2 (counterclockwise)
+//Next and previous half edges are computed, start vertices and twins are stored as 32-bit indices in flat arrays
+//Vertices are pointers to nodes owned by the caller
+template <typename T>
+class TriangleMesh
+{
+        private:
+                std::vector <Node3DCartesian <T> *> points;	//Vertices of the mesh (not owned)
+                std::vector <unsigned int> vertices;		//Start vertex of each half edge
+                std::vector <unsigned int> twins;		//Twin of each half edge, NO_HALF_EDGE for boundary edges
+
+        public:
+                TriangleMesh() {}
+
+        public:
+                unsigned int getPointsCount() const {return points.size();}
+                unsigned int getEdgesCount() const {return vertices.size();}
+                unsigned int getTrianglesCount() const {return vertices.size() / 3;}
+                bool empty() const {return vertices.empty();}
+
+                static unsigned int getNextEdge ( const unsigned int e ) {return e % 3 == 2 ? e - 2 : e + 1;}
+                static unsigned int getPreviousEdge ( const unsigned int e ) {return e % 3 == 0 ? e + 2 : e - 1;}
+                static unsigned int getTriangle ( const unsigned int e ) {return e / 3;}
+
+                unsigned int getTwinEdge ( const unsigned int e ) const {return twins[e];}
+                unsigned int getStartVertex ( const unsigned int e ) const {return vertices[e];}
+                unsigned int getEndVertex ( const unsigned int e ) const {return vertices[getNextEdge ( e )];}
+                bool isBoundaryEdge ( const unsigned int e ) const {return twins[e] == NO_HALF_EDGE;}
+
+                Node3DCartesian <T> *getVertex ( const unsigned int v ) const {return points[v];}
+                Node3DCartesian <T> *getPoint ( const unsigned int e ) const {return points[vertices[e]];}
+
+        public:
+                unsigned int addPoint ( Node3DCartesian <T> *p ) {points.push_back ( p ); return points.size() - 1;}
+                unsigned int addTriangle ( const unsigned int v1, const unsigned int v2, const unsigned int v3 );
+
+                void setStartVertex ( const unsigned int e, const unsigned int v ) {vertices[e] = v;}
+                void setTwinEdges ( const unsigned int e1, const unsigned int e2 );
+
+                void swapDiagonal ( const unsigned int e );
+
+                void removeTriangles ( const std::vector <bool> & removed_triangles );
+                void removePoints ( const unsigned int n );
+
+                void reserve ( const unsigned int points_count, const unsigned int triangles_count );
+                void clear();
+};
+
+#include "TriangleMesh.hpp"
+
+#endif
@@ -0,0 +1,152 @@
+// Description: Index based triangle mesh (half edges stored in flat arrays)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef TriangleMesh_HPP
+#define TriangleMesh_HPP
+
+
+template <typename T>
+unsigned int TriangleMesh <T> ::addTriangle ( const unsigned int v1, const unsigned int v2, const unsigned int v3 )
+{
+        //Add triangle (v1, v2, v3) given counterclockwise, twins are set later, returns its first half edge (starting at v1)
+        const unsigned int e = vertices.size();
+
+        vertices.push_back ( v1 );
+        vertices.push_back ( v2 );
+        vertices.push_back ( v3 );
+
+        twins.push_back ( NO_HALF_EDGE );
+        twins.push_back ( NO_HALF_EDGE );
+        twins.push_back ( NO_HALF_EDGE );
+
+        return e;
+}
+
+
+template <typename T>
+void TriangleMesh <T> ::setTwinEdges ( const unsigned int e1, const unsigned int e2 )
+{
+        //Link half edges e1 and e2 with the different orientation, any of them may be NO_HALF_EDGE (boundary)
+        if ( e1 != NO_HALF_EDGE ) twins[e1] = e2;
+
+        if ( e2 != NO_HALF_EDGE ) twins[e2] = e1;
+}
+
+
+template <typename T>
+void TriangleMesh <T> ::swapDiagonal ( const unsigned int e )
+{
+        //Swap diagonal e = (a, b) in the convex quadrilateral formed by triangles (a, b, c) and (b, a, d)
+        //Half edge e becomes (d, c), its twin (c, d); triangles are (d, c, a) and (c, d, b)
+        const unsigned int e12 = getNextEdge ( e ), e13 = getPreviousEdge ( e );
+        const unsigned int e21 = twins[e], e22 = getNextEdge ( e21 ), e23 = getPreviousEdge ( e21 );
+
+        //Vertices of the quadrilateral
+        const unsigned int a = vertices[e], b = vertices[e12], c = vertices[e13], d = vertices[e23];
+
+        //Outer twins of the quadrilateral
+        const unsigned int t_bc = twins[e12], t_ca = twins[e13], t_ad = twins[e22], t_db = twins[e23];
+
+        //Triangle (d, c, a)
+        vertices[e] = d;
+        vertices[e12] = c;
+        vertices[e13] = a;
+
+        //Triangle (c, d, b)
+        vertices[e21] = c;
+        vertices[e22] = d;
+        vertices[e23] = b;
+
+        //Relink outer edges
+        setTwinEdges ( e12, t_ca );
+        setTwinEdges ( e13, t_ad );
+        setTwinEdges ( e22, t_db );
+        setTwinEdges ( e23, t_bc );
+}
+
+
+template <typename T>
+void TriangleMesh <T> ::removeTriangles ( const std::vector <bool> & removed_triangles )
+{
+        //Remove marked triangles, half edges of the remaining triangles are renumbered and their twins updated
+        const unsigned int n = getTrianglesCount();
+        std::vector <unsigned int> new_index ( n, NO_HALF_EDGE );
+        unsigned int n_new = 0;
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                if ( !removed_triangles[i] ) new_index[i] = n_new++;
+        }
+
+        //Move half edges of the remaining triangles
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                if ( removed_triangles[i] ) continue;
+
+                for ( unsigned int j = 0; j < 3; j++ )
+                {
+                        const unsigned int t = twins[3 * i + j];
+                        const unsigned int t_triangle = ( t == NO_HALF_EDGE ? NO_HALF_EDGE : new_index[t / 3] );
+
+                        vertices[3 * new_index[i] + j] = vertices[3 * i + j];
+                        twins[3 * new_index[i] + j] = ( t_triangle == NO_HALF_EDGE ? NO_HALF_EDGE : 3 * t_triangle + t % 3 );
+                }
+        }
+
+        vertices.resize ( 3 * n_new );
+        twins.resize ( 3 * n_new );
+}
+
+
+template <typename T>
+void TriangleMesh <T> ::removePoints ( const unsigned int n )
+{
+        //Remove first n points not referenced by any half edge, vertex indices are decreased by n
+        points.erase ( points.begin(), points.begin() + n );
+
+        for ( unsigned int i = 0; i < vertices.size(); i++ )
+        {
+                vertices[i] -= n;
+        }
+}
+
+
+template <typename T>
+void TriangleMesh <T> ::reserve ( const unsigned int points_count, const unsigned int triangles_count )
+{
+        //Reserve space for points and triangles
+        points.reserve ( points_count );
+        vertices.reserve ( 3 * triangles_count );
+        twins.reserve ( 3 * triangles_count );
+}
+
+
+template <typename T>
+void TriangleMesh <T> ::clear()
+{
+        //Remove all points and triangles
+        points.clear();
+        vertices.clear();
+        twins.clear();
+}
+
+#endif
@@ -0,0 +1 @@
+#include "TriangleMeshLocator.h"
@@ -0,0 +1,65 @@
+// Description: Point location in the triangle mesh using the jump-and-walk grid
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef TriangleMeshLocator_H
+#define TriangleMeshLocator_H
+
+#include <vector>
+
+#include "libalgo/source/const/Const.h"
+
+#include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/TriangleMesh.h"
+
+#include "libalgo/source/algorithms/lawsonorientedwalk/LawsonOrientedWalk.h"
+
+
+//Point location in the triangle mesh by the jump-and-walk method (Mucke, Saias, Zhu, 1996)
+//The min-max box of the mesh is covered by a regular grid, each cell stores a seed edge starting at the vertex nearest to the cell center
+//Lawson oriented walk starts from the seed edge of the cell containing the query point
+//The mesh is not owned and it must not be modified while the locator is used
+template <typename T>
+class TriangleMeshLocator
+{
+        private:
+                const TriangleMesh <T> *mesh;			//Triangle mesh
+                T xmin, ymin, xmax, ymax;			//Min-max box of the mesh vertices
+                unsigned int rows, columns;			//Size of the grid
+                T cell_width, cell_height;			//Size of the grid cell
+                std::vector <unsigned int> seeds;		//Seed edge of each grid cell
+
+        public:
+                TriangleMeshLocator ( const TriangleMesh <T> &mesh_, const double points_per_cell = POINT_LOCATION_POINTS_PER_CELL );
+
+        public:
+                unsigned int findTriangle ( const Node3DCartesian <T> *p, short * status, TWalkStatistics * statistics = NULL ) const;
+
+                template <const TDestructable destructable>
+                void findTriangles ( const Container <Node3DCartesian <T> *, destructable> &points, std::vector <unsigned int> &edges, std::vector <short> &statuses, TWalkStatistics * statistics = NULL ) const;
+
+        private:
+                unsigned int getCell ( const T x, const T y ) const;
+                unsigned int findTriangleFromEdge ( const Node3DCartesian <T> *p, short * status, const unsigned int e, TWalkStatistics * statistics ) const;
+};
+
+#include "TriangleMeshLocator.hpp"
+
+#endif
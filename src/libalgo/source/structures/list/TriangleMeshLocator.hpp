@@ -0,0 +1,239 @@
+// Description: Point location in the triangle mesh using the jump-and-walk grid
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef TriangleMeshLocator_HPP
+#define TriangleMeshLocator_HPP
+
+#include <cmath>
+#include <algorithm>
+
+#include "libalgo/source/structures/point/Node3DCartesian.h"
+
+#include "libalgo/source/algorithms/spacefillingcurve/SpaceFillingCurve.h"
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+
+
+template <typename T>
+TriangleMeshLocator <T>::TriangleMeshLocator ( const TriangleMesh <T> &mesh_, const double points_per_cell ) : mesh ( &mesh_ ), xmin ( 0 ), ymin ( 0 ), xmax ( 0 ), ymax ( 0 ), rows ( 1 ), columns ( 1 ), cell_width ( 1 ), cell_height ( 1 )
+{
+        //Create the grid of seed edges, points_per_cell vertices of the mesh fall into one cell in average
+        const unsigned int n = mesh_.getEdgesCount();
+
+        //Empty mesh
+        if ( n == 0 )
+        {
+                throw ErrorBadData ( "ErrorBadData: can not create point location grid, ", "the mesh has no triangles." );
+        }
+
+        //Min-max box of the vertices
+        xmin = xmax = mesh_.getPoint ( 0 )->getX();
+        ymin = ymax = mesh_.getPoint ( 0 )->getY();
+
+        for ( unsigned int e = 1; e < n; e++ )
+        {
+                const Node3DCartesian <T> *p = mesh_.getPoint ( e );
+
+                xmin = ( std::min ) ( xmin, p->getX() );
+                ymin = ( std::min ) ( ymin, p->getY() );
+                xmax = ( std::max ) ( xmax, p->getX() );
+                ymax = ( std::max ) ( ymax, p->getY() );
+        }
+
+        //Size of the grid having nearly square cells
+        const double width = xmax - xmin, height = ymax - ymin;
+        const double cells_count = ( std::max ) ( mesh_.getPointsCount() / points_per_cell, 1.0 );
+
+        if ( ( width > 0 ) && ( height > 0 ) )
+        {
+                columns = ( unsigned int ) ( std::max ) ( sqrt ( cells_count * width / height ), 1.0 );
+                rows = ( unsigned int ) ( std::max ) ( cells_count / columns, 1.0 );
+        }
+
+        cell_width = ( width > 0 ? ( T ) ( width / columns ) : 1 );
+        cell_height = ( height > 0 ? ( T ) ( height / rows ) : 1 );
+
+        //Seed of the cell: edge starting at the vertex nearest to the cell center
+        std::vector <T> distances ( rows * columns );
+        seeds.assign ( rows * columns, NO_HALF_EDGE );
+
+        for ( unsigned int e = 0; e < n; e++ )
+        {
+                const Node3DCartesian <T> *p = mesh_.getPoint ( e );
+                const unsigned int cell = getCell ( p->getX(), p->getY() );
+
+                const T dx = p->getX() - ( xmin + ( cell % columns + 0.5 ) * cell_width );
+                const T dy = p->getY() - ( ymin + ( cell / columns + 0.5 ) * cell_height );
+                const T dist = dx * dx + dy * dy;
+
+                if ( ( seeds[cell] == NO_HALF_EDGE ) || ( dist < distances[cell] ) )
+                {
+                        seeds[cell] = e;
+                        distances[cell] = dist;
+                }
+        }
+
+        //Empty cells get the seed of the nearest non-empty cell (breadth first search over the grid)
+        std::vector <unsigned int> queue;
+        queue.reserve ( rows * columns );
+
+        for ( unsigned int i = 0; i < rows * columns; i++ )
+        {
+                if ( seeds[i] != NO_HALF_EDGE )
+                {
+                        queue.push_back ( i );
+                }
+        }
+
+        for ( unsigned int i = 0; i < queue.size(); i++ )
+        {
+                const unsigned int cell = queue[i], row = cell / columns, column = cell % columns;
+
+                //Neighbouring cells: left, right, bottom, top
+                const unsigned int neighbours[4] = {column > 0 ? cell - 1 : cell, column + 1 < columns ? cell + 1 : cell,
+                                                    row > 0 ? cell - columns : cell, row + 1 < rows ? cell + columns : cell
+                                                   };
+
+                for ( unsigned int j = 0; j < 4; j++ )
+                {
+                        if ( seeds[neighbours[j]] == NO_HALF_EDGE )
+                        {
+                                seeds[neighbours[j]] = seeds[cell];
+                                queue.push_back ( neighbours[j] );
+                        }
+                }
+        }
+}
+
+
+template <typename T>
+unsigned int TriangleMeshLocator <T>::findTriangle ( const Node3DCartesian <T> *p, short * status, TWalkStatistics * statistics ) const
+{
+        /*
+         * Find triangle, inside that lies the point p, the walk starts from the seed of the grid cell containing p ;
+         * status = 0: point lies outside of the mesh, NO_HALF_EDGE is returned,
+         * status = 1: point lies inside the triangle, any half edge of the triangle is returned,
+         * status = 2: point lies on the returned half edge
+         */
+        return findTriangleFromEdge ( p, status, seeds[getCell ( p->getX(), p->getY() )], statistics );
+}
+
+
+template <typename T>
+template <const TDestructable destructable>
+void TriangleMeshLocator <T>::findTriangles ( const Container <Node3DCartesian <T> *, destructable> &points, std::vector <unsigned int> &edges, std::vector <short> &statuses, TWalkStatistics * statistics ) const
+{
+        //Find triangles of all points: edges[i] and statuses[i] are the results of findTriangle for the i-th point
+        //Points are sorted along the Hilbert curve and divided into chunks of consecutive points located in parallel,
+        //the walk starts from the nearer of the previously located point and the seed of the grid cell
+        const int n = points.size();
+        const int chunks = ( n + POINT_LOCATION_CHUNK_SIZE - 1 ) / POINT_LOCATION_CHUNK_SIZE;
+
+        edges.resize ( n );
+        statuses.resize ( n );
+
+        //Order of points along the Hilbert curve
+        std::vector <unsigned int> order;
+        SpaceFillingCurve::getHilbertOrder ( points.begin(), points.end(), xmin, ymin, xmax, ymax, order );
+
+#ifdef _OPENMP
+        #pragma omp parallel for schedule ( dynamic, 1 ) if ( n >= POINT_LOCATION_PARALLEL_QUERY_SIZE )
+#endif
+
+        for ( int i = 0; i < chunks; i++ )
+        {
+                //Statistics of the chunk
+                TWalkStatistics chunk_statistics;
+
+                //Previously located point
+                const Node3DCartesian <T> *p_last = NULL;
+                unsigned int e_last = NO_HALF_EDGE;
+
+                const int end = ( std::min ) ( ( i + 1 ) * POINT_LOCATION_CHUNK_SIZE, n );
+
+                for ( int j = i * POINT_LOCATION_CHUNK_SIZE; j < end; j++ )
+                {
+                        const unsigned int k = order[j];
+                        const Node3DCartesian <T> *p = points [k];
+
+                        //Seed edge of the grid cell
+                        unsigned int e = seeds[getCell ( p->getX(), p->getY() )];
+
+                        //Previously located point is nearer than the start point of the seed edge
+                        if ( e_last != NO_HALF_EDGE )
+                        {
+                                const Node3DCartesian <T> *p_seed = mesh->getPoint ( e );
+                                const T dist_last = ( p->getX() - p_last->getX() ) * ( p->getX() - p_last->getX() ) + ( p->getY() - p_last->getY() ) * ( p->getY() - p_last->getY() );
+                                const T dist_seed = ( p->getX() - p_seed->getX() ) * ( p->getX() - p_seed->getX() ) + ( p->getY() - p_seed->getY() ) * ( p->getY() - p_seed->getY() );
+
+                                if ( dist_last < dist_seed )
+                                {
+                                        e = e_last;
+                                }
+                        }
+
+                        edges[k] = findTriangleFromEdge ( p, &statuses[k], e, ( statistics != NULL ? &chunk_statistics : NULL ) );
+
+                        //Point was located
+                        if ( edges[k] != NO_HALF_EDGE )
+                        {
+                                p_last = p;
+                                e_last = edges[k];
+                        }
+                }
+
+                //Add statistics of the chunk
+                if ( statistics != NULL )
+                {
+#ifdef _OPENMP
+                        #pragma omp critical ( TriangleMeshLocator )
+#endif
+                        {
+                                statistics->walks += chunk_statistics.walks;
+                                statistics->steps += chunk_statistics.steps;
+                                statistics->max_steps = ( std::max ) ( statistics->max_steps, chunk_statistics.max_steps );
+                        }
+                }
+        }
+}
+
+
+template <typename T>
+unsigned int TriangleMeshLocator <T>::getCell ( const T x, const T y ) const
+{
+        //Grid cell containing the point, points outside the min-max box are moved to the border cells
+        const double column = ( std::min ) ( ( std::max ) ( floor ( ( x - xmin ) / ( double ) cell_width ), 0.0 ), ( double ) ( columns - 1 ) );
+        const double row = ( std::min ) ( ( std::max ) ( floor ( ( y - ymin ) / ( double ) cell_height ), 0.0 ), ( double ) ( rows - 1 ) );
+
+        return ( unsigned int ) row * columns + ( unsigned int ) column;
+}
+
+
+template <typename T>
+unsigned int TriangleMeshLocator <T>::findTriangleFromEdge ( const Node3DCartesian <T> *p, short * status, const unsigned int e, TWalkStatistics * statistics ) const
+{
+        //Lawson oriented walk from the edge e, the count of steps is bounded as in the incremental DT
+        const T max_steps = 5 * mesh->getEdgesCount();
+
+        return LawsonOrientedWalk::findFaceWalk2 ( p, status, *mesh, e, max_steps, statistics );
+}
+
+#endif
@@ -23,37 +23,81 @@
 #define Matrix_H
 
 #include <vector>
+#include <utility>
+#include <cstddef>
 #include <ostream>
 #include <iostream>
 #include <iomanip>
 
 
-//New user defined type: items of matrix
+//New user defined type: items of matrix stored row by row in a contiguous block
 template <typename T>
 struct TMatrix
 {
-        typedef std::vector < std::vector <T> > Type;
+        typedef std::vector <T> Type;
 };
 
 
+//Forward declaration
+template <typename E>
+class MatrixExpression;
+
+template <typename T>
+class MatrixView;
+
+
+//Type U is a lazy matrix expression (C++03 replacement of std::is_base_of)
+template <typename U>
+struct TIsMatrixExpression
+{
+        template <typename E>
+        static char test ( const MatrixExpression <E> * );
+        static long test ( ... );
+
+        enum { value = sizeof ( test ( ( U * ) 0 ) ) == sizeof ( char ) };
+};
+
+
+//Enable the overload only if B is true (C++03 replacement of std::enable_if)
+template <bool B, typename R>
+struct TEnableIf
+{
+        typedef R Type;
+};
+
+template <typename R>
+struct TEnableIf <false, R> {};
+
+
 
 //Matrix definition and basic operators
 template <typename T>
 class Matrix
 {
         private:
-                typename TMatrix <T>::Type items;		//Matrix
                 unsigned int rows_count;			//Total rows_count
                 unsigned int columns_count;			//Total columns_count
+                typename TMatrix <T>::Type items;		//Matrix, item (i, j) stored at i * columns_count + j
 
         public:
 
-                Matrix ( const unsigned int rows_count_, const unsigned int columns_count_, const T item = 0 ) : rows_count ( rows_count_ ), columns_count ( columns_count_ ), items ( rows_count_, std::vector <T> ( columns_count_, item ) ) {}
+                Matrix ( const unsigned int rows_count_, const unsigned int columns_count_, const T item = 0 ) : rows_count ( rows_count_ ), columns_count ( columns_count_ ), items ( rows_count_ * columns_count_, item ) {}
                 Matrix ( const unsigned int rows_count_, const unsigned int columns_count_, const T non_diag_item_val, const T diag_val );
 
+                Matrix ( const Matrix <T> &M ) : rows_count ( M.rows_count ), columns_count ( M.columns_count ), items ( M.items ) {}
+
                 template <typename U>
                 Matrix ( const Matrix <U> &M ) ;
 
+#if __cplusplus >= 201103L
+                //Move constructor: items are taken over, M becomes the empty matrix
+                Matrix ( Matrix <T> &&M ) : rows_count ( M.rows_count ), columns_count ( M.columns_count ), items ( std::move ( M.items ) ) { M.rows_count = 0; M.columns_count = 0; }
+#endif
+
+                //Evaluate the lazy expression
+                template <typename E>
+                Matrix ( const MatrixExpression <E> &e );
+
                 ~Matrix();
 
         public:
@@ -67,6 +111,16 @@ class Matrix
                 typename TMatrix <T>::Type const & getItems () const {return items;}
                 typename TMatrix <T>::Type & getItems ()  {return items;}
 
+                //Get pointer to the first item (row-major storage, leading dimension = cols())
+                T * data() {return items.empty() ? NULL : &items[0];}
+                const T * data() const {return items.empty() ? NULL : &items[0];}
+
+                //Get non-owning views of the whole matrix and of the submatrix (r1, r2, c1, c2), O(1), writes go through to the matrix
+                MatrixView <T> view() {return MatrixView <T> ( data(), rows_count, columns_count, columns_count );}
+                MatrixView <const T> view() const {return MatrixView <const T> ( data(), rows_count, columns_count, columns_count );}
+                MatrixView <T> view ( const unsigned int r1, const unsigned int r2, const unsigned int c1, const unsigned int c2 ) {return view() ( r1, r2, c1, c2 );}
+                MatrixView <const T> view ( const unsigned int r1, const unsigned int r2, const unsigned int c1, const unsigned int c2 ) const {return view() ( r1, r2, c1, c2 );}
+
                 //Get row, col
                 Matrix < T > row ( const unsigned int r ) const;
                 Matrix < T > col ( const unsigned int c ) const;
@@ -76,6 +130,10 @@ class Matrix
                 void col ( const Matrix <T> & C, const unsigned int c );
                 void submat ( const Matrix <T> & A, const unsigned int row, const unsigned int col );
                 void res ( const int r, const int c, const T val = 0.0 );
+                void reshape ( const unsigned int r, const unsigned int c );
+
+                //Exchange content of two matrices without copying items
+                void swap ( Matrix <T> &M );
 
                 //Other methods
                 void print ( std::ostream * output = &std::cout ) const;
@@ -84,6 +142,15 @@ class Matrix
 
                 //Matrix operators =, ==, !=
                 Matrix <T> & operator = ( const Matrix <T> &M );
+
+#if __cplusplus >= 201103L
+                //Move assignment: dimensions must be equal, items are exchanged
+                Matrix <T> & operator = ( Matrix <T> &&M );
+#endif
+
+                //Matrix operator = : evaluate the lazy expression into the matrix
+                template <typename E>
+                Matrix <T> & operator = ( const MatrixExpression <E> &e );
                 bool operator == ( const Matrix <T> &M ) const;
                 bool operator != ( const Matrix <T> &M ) const;
 
@@ -96,7 +163,7 @@ class Matrix
 
 		//Matrix operators + : Matrix + scalar
 		template <typename U>
-		Matrix <T> operator + (const U val) const;
+		typename TEnableIf <!TIsMatrixExpression <U>::value, Matrix <T> >::Type operator + (const U val) const;
 
                 //Matrix operators - : Matrix - Matrix
                 template <typename U>
@@ -104,7 +171,7 @@ class Matrix
 
 		//Matrix operators + : Matrix - scalar
 		template <typename U>
-		Matrix <T> operator - (const U val) const;
+		typename TEnableIf <!TIsMatrixExpression <U>::value, Matrix <T> >::Type operator - (const U val) const;
 
                 //Matrix operators += : Matrix += Matrix
                 template <typename U>
@@ -120,7 +187,7 @@ class Matrix
 
                 //Matrix operators * : Matrix * Scalar
                 template <typename U>
-                Matrix <T> operator * ( const U & val ) const;
+                typename TEnableIf <!TIsMatrixExpression <U>::value, Matrix <T> >::Type operator * ( const U & val ) const;
 
                 //Matrix operators *= : Matrix *= Scalar
                 template <typename U>
@@ -164,4 +231,8 @@ Matrix<T> operator * (const T &val, const Matrix <T> & M)
 
 #include "Matrix.hpp"
 
+#include "MatrixExpression.h"
+
+#include "MatrixView.h"
+
 #endif
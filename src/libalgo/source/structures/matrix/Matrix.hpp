@@ -24,8 +24,12 @@
 
 //#include "Matrix.h"
 
+#include <algorithm>
+
 #include "libalgo/source/const/Const.h"
 
+#include "libalgo/source/structures/matrix/MatrixKernels.h"
+
 #include "libalgo/source/exceptions/ErrorBadData.h"
 #include "libalgo/source/exceptions/ErrorIndexOutOfBound.h"
 #include "libalgo/source/exceptions/ErrorMathZeroDevision.h"
@@ -39,12 +43,12 @@ class ErrorMathMatrixDifferentSize;
 //Constructor of the matrix
 template <typename T>
 Matrix <T> :: Matrix ( const unsigned int rows_count_, const unsigned int columns_count_, const T non_diag_item_val, const T diag_val ) :
-        rows_count ( rows_count_ ), columns_count ( columns_count_ ), items ( rows_count_, std::vector <T> ( columns_count_, non_diag_item_val ) )
+        rows_count ( rows_count_ ), columns_count ( columns_count_ ), items ( rows_count_ * columns_count_, non_diag_item_val )
 {
         //Create matrix with eye value on main diagonal
         for ( unsigned int i = 0; i < std::min ( rows_count, columns_count ) ; i++ )
         {
-                items[i][i] = diag_val;
+                items[i * columns_count + i] = diag_val;
         }
 }
 
@@ -53,13 +57,18 @@ Matrix <T> :: Matrix ( const unsigned int rows_count_, const unsigned int column
 template <typename T>
 template <typename U>
 Matrix <T> :: Matrix ( const Matrix <U> &M )
-        : rows_count ( M.rows() ), columns_count ( M.cols() ), items ()
+        : rows_count ( M.rows() ), columns_count ( M.cols() ), items ( M.getItems().begin(), M.getItems().end() )
 {
-        //Create copy of the matrix
-        for ( unsigned int i = 0; i < M.getItems().size(); i++ )
-        {
-                items.push_back ( std::vector <T> ( M.getItems() [i].begin(), M.getItems() [i].end() ) );
-        }
+}
+
+
+//Constructor from the lazy expression: the expression is evaluated directly into the matrix
+template <typename T>
+template <typename E>
+Matrix <T> :: Matrix ( const MatrixExpression <E> &e )
+        : rows_count ( e.derived().rows() ), columns_count ( e.derived().cols() ), items ( rows_count * columns_count )
+{
+        e.derived().evalTo ( *this );
 }
 
 
@@ -87,16 +96,58 @@ Matrix <T> & Matrix <T> ::operator = ( const Matrix <T> &M )
                         throw ErrorMathMatrixDifferentSize <Matrix <T> > ( "ErrorMathMatrixDifferentSize: ", " different columns_count count in operator =. Can not assign matrices.  ", *this, M );
                 }
 
-                //Process all lines
-                for ( unsigned int i = 0; i < rows_count; i++ )
+                //Copy all items, dimensions are equal, no reallocation
+                std::copy ( M.items.begin(), M.items.end(), items.begin() );
+        }
+
+        return *this;
+}
+
+
+#if __cplusplus >= 201103L
+//Move assignment operator =
+template <typename T>
+Matrix <T> & Matrix <T> ::operator = ( Matrix <T> &&M )
+{
+        if ( this != &M )
+        {
+                //Matrix dimemension are invalid, throw exception
+                if ( ( rows_count != M.rows_count ) || ( columns_count != M.columns_count ) )
                 {
-                        //Process columns_count of the actual row
-                        for ( unsigned int j = 0 ; j < columns_count; j++ )
-                        {
-                                //Add to vector
-                                items[i][j] = M.items[i][j];
-                        }
+                        throw ErrorMathMatrixDifferentSize <Matrix <T> > ( "ErrorMathMatrixDifferentSize: ", " different dimensions in operator =. Can not assign matrices.  ", *this, M );
                 }
+
+                //Exchange items, no copy
+                items.swap ( M.items );
+        }
+
+        return *this;
+}
+#endif
+
+
+//Assignment operator = : evaluate the lazy expression
+template <typename T>
+template <typename E>
+Matrix <T> & Matrix <T> ::operator = ( const MatrixExpression <E> &e )
+{
+        //Matrix dimemension are invalid, throw exception
+        if ( ( rows_count != e.derived().rows() ) || ( columns_count != e.derived().cols() ) )
+        {
+                throw ErrorMathMatrixDifferentSize <Matrix <T> > ( "ErrorMathMatrixDifferentSize: ", " different dimensions in operator =. Can not assign expression.  ", *this, Matrix <T> ( e.derived().rows(), e.derived().cols() ) );
+        }
+
+        //Expression refers to this matrix (A = trans ( lazy ( A ) ) * A): evaluate it into the temporary matrix
+        if ( e.derived().references ( this ) )
+        {
+                Matrix <T> R ( e );
+                swap ( R );
+        }
+
+        //Evaluate directly into the matrix
+        else
+        {
+                e.derived().evalTo ( *this );
         }
 
         return *this;
@@ -116,7 +167,7 @@ Matrix <T> Matrix <T> :: operator + ( const Matrix <U> &M ) const
 //Matrix operators + : Matrix + scalar
 template <typename T>
 template <typename U>
-Matrix <T> Matrix <T> :: operator + (const U val) const
+typename TEnableIf <!TIsMatrixExpression <U>::value, Matrix <T> >::Type Matrix <T> :: operator + (const U val) const
 {
 	const unsigned int m = this->rows_count, n = this->columns_count;
 	const Matrix <T> A(m, n, 1, 1);
@@ -138,7 +189,7 @@ Matrix<T> Matrix <T> :: operator - ( const Matrix < U > &M ) const
 //Matrix operators - : Matrix - scalar
 template <typename T>
 template <typename U>
-Matrix <T> Matrix <T> :: operator - (const U val) const
+typename TEnableIf <!TIsMatrixExpression <U>::value, Matrix <T> >::Type Matrix <T> :: operator - (const U val) const
 {
 	const unsigned int m = this->rows_count, n = this->columns_count;
 	const Matrix <T> A(m, n, 1, 1);
@@ -163,21 +214,8 @@ Matrix<T> Matrix <T> :: operator * ( const Matrix < U > &M ) const
         //Create temporary matrix for results
         Matrix <T> C ( rows_count, n2 );
 
-        //Multiplication of matrices
-        for ( unsigned int i = 0; i < rows_count; i++ )
-        {
-                for ( unsigned int j = 0; j < n2; j++ )
-                {
-                        T sum = 0;
-
-                        for ( unsigned int k = 0; k < columns_count; k++ )
-                        {
-                                sum += items[i][k] * M ( k, j );
-                        }
-
-                        C ( i, j ) = sum;
-                }
-        }
+        //Multiplication of matrices: the kernel is selected according to the shape of the matrices
+        MatrixKernels::mult ( rows_count, n2, columns_count, data(), columns_count, M.data(), n2, C.data(), n2 );
 
         return C;
 }
@@ -186,7 +224,7 @@ Matrix<T> Matrix <T> :: operator * ( const Matrix < U > &M ) const
 //Matrix operators * : Matrix * Scalar
 template <typename T>
 template <typename U>
-Matrix<T> Matrix <T> :: operator * ( const U & val ) const
+typename TEnableIf <!TIsMatrixExpression <U>::value, Matrix <T> >::Type Matrix <T> :: operator * ( const U & val ) const
 {
         return Matrix < T > ( *this ).operator *= ( val );
 }
@@ -218,15 +256,12 @@ Matrix <T> & Matrix <T> :: operator += ( const Matrix <U> &M )
                 throw ErrorMathMatrixDifferentSize <Matrix <U> > ( "ErrorMathRange: ", " different columns_count count.  Cannot compute A += B. ", *this, M );
         }
 
-        //Process all lines
-        for ( unsigned int i = 0;  i < rows_count; i++ )
+        //Process all items
+        const U * m_items = M.data();
+
+        for ( unsigned int i = 0; i < items.size(); i++ )
         {
-                //Process columns_count of the actual row
-                for ( unsigned int j = 0 ; j < columns_count; j++ )
-                {
-                        //Add to vector
-                        items[i][j] = items[i][j]  + M ( i, j );
-                }
+                items[i] = items[i] + m_items[i];
         }
 
         return *this;
@@ -250,15 +285,12 @@ Matrix <T> & Matrix <T> :: operator -= ( const Matrix <U> &M )
                 throw ErrorMathMatrixDifferentSize <Matrix <U> > ( "ErrorMathMatrixDifferentSize: ", " different columns_count count.  Cannot compute A -= B. ", *this, M );
         }
 
-        //Process all lines
-        for ( unsigned int i = 0; i < rows_count; i++ )
+        //Process all items
+        const U * m_items = M.data();
+
+        for ( unsigned int i = 0; i < items.size(); i++ )
         {
-                //Process columns_count of the actual row
-                for ( unsigned int j = 0 ; j < columns_count; j++ )
-                {
-                        //Add to vector
-                        items[i][j] = items[i][j] - M ( i, j );
-                }
+                items[i] = items[i] - m_items[i];
         }
 
         return *this;
@@ -270,12 +302,9 @@ template <typename T>
 template <typename U>
 Matrix <T> & Matrix <T> ::operator *= ( const U & val )
 {
-        for ( unsigned int i = 0; i < rows_count; i++ )
+        for ( unsigned int i = 0; i < items.size(); i++ )
         {
-                for ( unsigned int j = 0; j < columns_count; j++ )
-                {
-                        items[i][j] = val * items[i][j];
-                }
+                items[i] = val * items[i];
         }
 
         return *this;
@@ -293,13 +322,10 @@ Matrix <T> & Matrix <T> ::operator /= ( const U & val )
                 throw ErrorMathZeroDevision <T> ( "ErrorMathZeroDevision: divider is zero. ",  "Can not divide matrix by scalar.", val );
         }
 
-        //Multiplication of matrices
-        for ( unsigned int i = 0; i < rows_count; i++ )
+        //Division of items
+        for ( unsigned int i = 0; i < items.size(); i++ )
         {
-                for ( unsigned int j = 0; j < columns_count; j++ )
-                {
-                        items[i][j] = items[i][j] / val;
-                }
+                items[i] = items[i] / val;
         }
 
         return *this;
@@ -330,12 +356,11 @@ Matrix <T> Matrix <T> ::operator % ( const Matrix <U> &M ) const
 	Matrix <T> C(m2, n2);
 
         //Hadamard product
-        for ( unsigned int i = 0; i < rows_count; i++ )
+        const U * m_items = M.data();
+
+        for ( unsigned int i = 0; i < items.size(); i++ )
         {
-                for ( unsigned int j = 0; j < columns_count; j++ )
-                {
-                        C(i, j) = items[i][j] * M ( i, j );
-                }
+                C.items[i] = items[i] * m_items[i];
         }
 
         return C;
@@ -357,10 +382,7 @@ Matrix <T> Matrix <T> ::row ( const unsigned int r ) const
         Matrix <T> m_temp ( 1, columns_count );
 
         //Copy items to the matrix
-        for ( unsigned int i = 0; i < columns_count; i++ )
-        {
-                m_temp ( 0, i ) =  items[r][i];
-        }
+        std::copy ( items.begin() + r * columns_count, items.begin() + ( r + 1 ) * columns_count, m_temp.items.begin() );
 
         //Get matrix
         return m_temp;
@@ -382,7 +404,7 @@ Matrix < T > Matrix <T> :: col ( const unsigned int c ) const
         //Copy items to the matrix
         for ( unsigned int i = 0; i < rows_count; i++ )
         {
-                m_temp ( i, 0 ) = items[i][c];
+                m_temp.items[i] = items[i * columns_count + c];
         }
 
         //Get matrix
@@ -407,10 +429,7 @@ void Matrix <T> ::row ( const Matrix <T> &M, const unsigned int r )
         }
 
         //Copy row
-        for ( unsigned int i = 0; i < columns_count; i++ )
-        {
-                items[r][i] = M ( 0, i );
-        }
+        std::copy ( M.items.begin(), M.items.begin() + columns_count, items.begin() + r * columns_count );
 }
 
 
@@ -433,7 +452,7 @@ void Matrix <T> ::col ( const Matrix <T> &M, const unsigned int c )
         //Copy col
         for ( unsigned int i = 0; i < rows_count; i++ )
         {
-                items[i][c] = M ( i, 0 );
+                items[i * columns_count + c] = M.items[i * M.columns_count];
         }
 }
 
@@ -454,13 +473,10 @@ void Matrix <T> ::submat ( const Matrix <T> & M, const unsigned int row, const u
                 throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: a submatrix does not fit at the specified col position, ", "can not append a submatrix to the matrix." );
         }
 
-        //Copy submatrix
+        //Copy submatrix row by row
         for ( unsigned int i = 0; i < m; i++ )
         {
-                for ( unsigned int j = 0; j < n; j++ )
-                {
-                        items [i + row][j + col] = M ( i, j );
-                }
+                std::copy ( M.items.begin() + i * n, M.items.begin() + ( i + 1 ) * n, items.begin() + ( i + row ) * columns_count + col );
         }
 }
 
@@ -484,11 +500,16 @@ void Matrix <T> ::res ( const int r, const int c, const T val )
         //Matrix dimensions have been changed
         if ( ( r  != rows_count ) || ( c != columns_count ) )
         {
-                //Resize rows
-                items.resize ( r );
+                //Create new items, keep the common part of the matrix
+                typename TMatrix <T>::Type items_new ( r * c, val );
+                const unsigned int m = std::min ( ( unsigned int ) r, rows_count ), n = std::min ( ( unsigned int ) c, columns_count );
 
-                //Resize columns
-                for ( unsigned int i = 0; i < r ; i++ ) items[i].resize ( c, val ) ;
+                for ( unsigned int i = 0; i < m; i++ )
+                {
+                        std::copy ( items.begin() + i * columns_count, items.begin() + i * columns_count + n, items_new.begin() + i * c );
+                }
+
+                items.swap ( items_new );
 
                 //Set new dimensions
                 rows_count = r;
@@ -497,6 +518,31 @@ void Matrix <T> ::res ( const int r, const int c, const T val )
 }
 
 
+//Change dimensions of the matrix, items are kept in the row-major order
+template <typename T>
+void Matrix <T> ::reshape ( const unsigned int r, const unsigned int c )
+{
+        //Total count of items must be kept
+        if ( r * c != rows_count * columns_count )
+        {
+                throw ErrorBadData ( "ErrorBadData: different count of items", "matrix can not be reshaped " );
+        }
+
+        rows_count = r;
+        columns_count = c;
+}
+
+
+//Exchange content of two matrices
+template <typename T>
+void Matrix <T> ::swap ( Matrix <T> &M )
+{
+        std::swap ( rows_count, M.rows_count );
+        std::swap ( columns_count, M.columns_count );
+        items.swap ( M.items );
+}
+
+
 //Matrix operator ()()
 template <typename T>
 T & Matrix <T> :: operator() ( const unsigned int row, unsigned int col )
@@ -513,7 +559,7 @@ T & Matrix <T> :: operator() ( const unsigned int row, unsigned int col )
                 throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "invalid dimension of the matrix (col > columns_count), col = " );
         }
 
-        return items[row][col];
+        return items[row * columns_count + col];
 }
 
 
@@ -533,7 +579,7 @@ T const & Matrix <T> :: operator() ( const unsigned int row, unsigned int col )
                 throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "invalid dimension of the matrix (col > columns_count), col = " );
         }
 
-        return items[row][col];
+        return items[row * columns_count + col];
 }
 
 
@@ -562,10 +608,7 @@ Matrix <T>  Matrix <T> ::operator () ( const unsigned int r1, const unsigned int
 
         for ( unsigned int i = 0; i < ( r2 - r1 + 1 ); i++ )
         {
-                for ( unsigned int j = 0; j < ( c2 - c1 + 1 ); j++ )
-                {
-                        M ( i, j ) = items[i + r1 ][j + c1];
-                }
+                std::copy ( items.begin() + ( i + r1 ) * columns_count + c1, items.begin() + ( i + r1 ) * columns_count + c2 + 1, M.items.begin() + i * ( c2 - c1 + 1 ) );
         }
 
         return M;
@@ -586,7 +629,7 @@ void Matrix <T> ::print ( std::ostream * output ) const
                 for ( unsigned int j = 0; j < columns_count; j++ )
                 {
                         *output <<  std::setw ( 16 ) << std::setprecision ( 7 );
-                        items[i][j] < MAX_FLOAT ? *output << items[i][j] : *output << "---";
+                        items[i * columns_count + j] < MAX_FLOAT ? *output << items[i * columns_count + j] : *output << "---";
                 }
 
                 *output << " |" << '\n';
@@ -0,0 +1 @@
+#include "MatrixExpression.h"
\ No newline at end of file
@@ -0,0 +1,297 @@
+// Description: Lazy matrix expressions (expression templates)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef MatrixExpression_H
+#define MatrixExpression_H
+
+#include <list>
+#include <cstddef>
+#include <vector>
+
+//Forward declaration
+template <typename T>
+class Matrix;
+
+
+//Lazy matrix expressions: operators create a tree of expressions evaluated once into the destination matrix
+//Expression is started by lazy (A) or trans (lazy (A)), e.g.  Matrix <T> H = trans ( lazy ( J ) ) * W * J;
+//Products are collected into a chain of factors (A, transposed flag) multiplied in the optimal order,
+//transposed factors are never created, scalars are applied only once, element-wise operations are fused into one pass
+//Expressions store references to matrices, they must be evaluated in the same statement
+
+
+//Factor of the matrix product
+template <typename T>
+struct TMatrixFactor
+{
+        const Matrix <T> * M;				//Matrix
+        bool transposed;				//Use transposed matrix
+
+        TMatrixFactor ( const Matrix <T> * M_, const bool transposed_ ) : M ( M_ ), transposed ( transposed_ ) {}
+
+        unsigned int rows() const {return transposed ? M->cols() : M->rows();}
+        unsigned int cols() const {return transposed ? M->rows() : M->cols();}
+};
+
+
+//Chain of factors of the matrix product, owns temporary matrices created during the evaluation
+template <typename T>
+class MatrixFactors
+{
+        private:
+                std::vector <TMatrixFactor <T> > factors;	//Factors of the product
+                std::list <Matrix <T> > temporaries;		//Evaluated non-product subexpressions (stable addresses)
+                T scale;					//Scalar multiplying the product
+
+        public:
+                MatrixFactors() : factors(), temporaries(), scale ( 1 ) {}
+
+        public:
+                unsigned int size() const {return factors.size();}
+                void push ( const Matrix <T> * M, const bool transposed ) {factors.push_back ( TMatrixFactor <T> ( M, transposed ) );}
+                void mult ( const T val ) {scale *= val;}
+                void reverse ( const unsigned int start );
+                Matrix <T> & temporary ( const unsigned int rows, const unsigned int cols );
+
+                void evalTo ( Matrix <T> &D );
+
+        private:
+                void multiply ( const TMatrixFactor <T> &A, const TMatrixFactor <T> &B, Matrix <T> &C );
+                TMatrixFactor <T> evalChain ( const unsigned int i, const unsigned int j, const std::vector <unsigned int> &split, Matrix <T> *D );
+};
+
+
+//Base class of all expressions, E is the derived expression
+template <typename E>
+class MatrixExpression
+{
+        public:
+                const E & derived() const {return static_cast <const E &> ( *this );}
+};
+
+
+//Matrix stored in the expression
+template <typename T>
+class MatrixLeafExpression : public MatrixExpression <MatrixLeafExpression <T> >
+{
+        private:
+                const Matrix <T> &M;
+
+        public:
+                typedef T Type;
+                enum { product = 0 };
+
+                MatrixLeafExpression ( const Matrix <T> &M_ ) : M ( M_ ) {}
+
+        public:
+                unsigned int rows() const {return M.rows();}
+                unsigned int cols() const {return M.cols();}
+                T item ( const unsigned int i, const unsigned int j ) const {return M.data() [i * M.cols() + j];}
+
+                void prepare() const {}
+                bool references ( const void * D ) const {return ( const void * ) &M == D;}
+                void factors ( MatrixFactors <T> &f ) const {f.push ( &M, false );}
+                void evalTo ( Matrix <T> &D ) const;
+};
+
+
+//Transposed expression
+template <typename E>
+class MatrixTransExpression : public MatrixExpression <MatrixTransExpression <E> >
+{
+        private:
+                const E e;
+
+        public:
+                typedef typename E::Type Type;
+                enum { product = E::product };
+
+                MatrixTransExpression ( const E &e_ ) : e ( e_ ) {}
+
+        public:
+                unsigned int rows() const {return e.cols();}
+                unsigned int cols() const {return e.rows();}
+                Type item ( const unsigned int i, const unsigned int j ) const {return e.item ( j, i );}
+
+                void prepare() const {e.prepare();}
+                bool references ( const void * D ) const {return e.references ( D );}
+                void factors ( MatrixFactors <Type> &f ) const;
+                void evalTo ( Matrix <Type> &D ) const;
+};
+
+
+//Expression multiplied by a scalar
+template <typename E>
+class MatrixScaleExpression : public MatrixExpression <MatrixScaleExpression <E> >
+{
+        private:
+                const E e;
+                const typename E::Type val;
+
+        public:
+                typedef typename E::Type Type;
+                enum { product = E::product };
+
+                MatrixScaleExpression ( const E &e_, const Type val_ ) : e ( e_ ), val ( val_ ) {}
+
+        public:
+                unsigned int rows() const {return e.rows();}
+                unsigned int cols() const {return e.cols();}
+                Type item ( const unsigned int i, const unsigned int j ) const {return val * e.item ( i, j );}
+
+                void prepare() const {e.prepare();}
+                bool references ( const void * D ) const {return e.references ( D );}
+                void factors ( MatrixFactors <Type> &f ) const {e.factors ( f ); f.mult ( val );}
+                void evalTo ( Matrix <Type> &D ) const;
+};
+
+
+//Element-wise operations: +, -, % (Hadamard product)
+template <typename T>
+struct TMatrixSum { static T apply ( const T a, const T b ) {return a + b;} };
+
+template <typename T>
+struct TMatrixDifference { static T apply ( const T a, const T b ) {return a - b;} };
+
+template <typename T>
+struct TMatrixHadamard { static T apply ( const T a, const T b ) {return a * b;} };
+
+
+//Element-wise binary expression
+template <typename L, typename R, typename Op>
+class MatrixElementExpression : public MatrixExpression <MatrixElementExpression <L, R, Op> >
+{
+        private:
+                const L l;
+                const R r;
+
+        public:
+                typedef typename L::Type Type;
+                enum { product = 0 };
+
+                MatrixElementExpression ( const L &l_, const R &r_ );
+
+        public:
+                unsigned int rows() const {return l.rows();}
+                unsigned int cols() const {return l.cols();}
+                Type item ( const unsigned int i, const unsigned int j ) const {return Op::apply ( l.item ( i, j ), r.item ( i, j ) );}
+
+                void prepare() const {l.prepare(); r.prepare();}
+                bool references ( const void * D ) const {return l.references ( D ) || r.references ( D );}
+                void factors ( MatrixFactors <Type> &f ) const;
+                void evalTo ( Matrix <Type> &D ) const;
+};
+
+
+//Product of two expressions
+template <typename L, typename R>
+class MatrixProductExpression : public MatrixExpression <MatrixProductExpression <L, R> >
+{
+        private:
+                const L l;
+                const R r;
+                mutable Matrix <typename L::Type> * result;		//Result used by the element-wise operations
+
+        public:
+                typedef typename L::Type Type;
+                enum { product = 1 };
+
+                MatrixProductExpression ( const L &l_, const R &r_ );
+                MatrixProductExpression ( const MatrixProductExpression <L, R> &e ) : l ( e.l ), r ( e.r ), result ( NULL ) {}
+                ~MatrixProductExpression();
+
+        public:
+                unsigned int rows() const {return l.rows();}
+                unsigned int cols() const {return r.cols();}
+                Type item ( const unsigned int i, const unsigned int j ) const {return result->data() [i * r.cols() + j];}
+
+                void prepare() const;
+                bool references ( const void * D ) const {return l.references ( D ) || r.references ( D );}
+                void factors ( MatrixFactors <Type> &f ) const {l.factors ( f ); r.factors ( f );}
+                void evalTo ( Matrix <Type> &D ) const;
+
+        private:
+                MatrixProductExpression <L, R> & operator = ( const MatrixProductExpression <L, R> &e );
+};
+
+
+//Create expressions
+template <typename T>
+MatrixLeafExpression <T> lazy ( const Matrix <T> &A ) {return MatrixLeafExpression <T> ( A );}
+
+template <typename E>
+MatrixTransExpression <E> trans ( const MatrixExpression <E> &e ) {return MatrixTransExpression <E> ( e.derived() );}
+
+template <typename E>
+Matrix <typename E::Type> eval ( const MatrixExpression <E> &e ) {return Matrix <typename E::Type> ( e );}
+
+
+//Operator * : product of expressions and matrices
+template <typename L, typename R>
+MatrixProductExpression <L, R> operator * ( const MatrixExpression <L> &l, const MatrixExpression <R> &r );
+
+template <typename L, typename T>
+MatrixProductExpression <L, MatrixLeafExpression <T> > operator * ( const MatrixExpression <L> &l, const Matrix <T> &R );
+
+template <typename T, typename R>
+MatrixProductExpression <MatrixLeafExpression <T>, R> operator * ( const Matrix <T> &L, const MatrixExpression <R> &r );
+
+//Operator * : expression multiplied by a scalar
+template <typename E>
+MatrixScaleExpression <E> operator * ( const MatrixExpression <E> &e, const typename E::Type val ) {return MatrixScaleExpression <E> ( e.derived(), val );}
+
+template <typename E>
+MatrixScaleExpression <E> operator * ( const typename E::Type val, const MatrixExpression <E> &e ) {return MatrixScaleExpression <E> ( e.derived(), val );}
+
+template <typename E>
+MatrixScaleExpression <E> operator / ( const MatrixExpression <E> &e, const typename E::Type val );
+
+//Operators +, -, %
+template <typename L, typename R>
+MatrixElementExpression <L, R, TMatrixSum <typename L::Type> > operator + ( const MatrixExpression <L> &l, const MatrixExpression <R> &r );
+
+template <typename L, typename T>
+MatrixElementExpression <L, MatrixLeafExpression <T>, TMatrixSum <T> > operator + ( const MatrixExpression <L> &l, const Matrix <T> &R );
+
+template <typename T, typename R>
+MatrixElementExpression <MatrixLeafExpression <T>, R, TMatrixSum <T> > operator + ( const Matrix <T> &L, const MatrixExpression <R> &r );
+
+template <typename L, typename R>
+MatrixElementExpression <L, R, TMatrixDifference <typename L::Type> > operator - ( const MatrixExpression <L> &l, const MatrixExpression <R> &r );
+
+template <typename L, typename T>
+MatrixElementExpression <L, MatrixLeafExpression <T>, TMatrixDifference <T> > operator - ( const MatrixExpression <L> &l, const Matrix <T> &R );
+
+template <typename T, typename R>
+MatrixElementExpression <MatrixLeafExpression <T>, R, TMatrixDifference <T> > operator - ( const Matrix <T> &L, const MatrixExpression <R> &r );
+
+template <typename L, typename R>
+MatrixElementExpression <L, R, TMatrixHadamard <typename L::Type> > operator % ( const MatrixExpression <L> &l, const MatrixExpression <R> &r );
+
+template <typename L, typename T>
+MatrixElementExpression <L, MatrixLeafExpression <T>, TMatrixHadamard <T> > operator % ( const MatrixExpression <L> &l, const Matrix <T> &R );
+
+template <typename T, typename R>
+MatrixElementExpression <MatrixLeafExpression <T>, R, TMatrixHadamard <T> > operator % ( const Matrix <T> &L, const MatrixExpression <R> &r );
+
+#include "MatrixExpression.hpp"
+
+#endif
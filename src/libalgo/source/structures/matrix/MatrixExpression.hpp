@@ -0,0 +1,473 @@
+// Description: Lazy matrix expressions (expression templates)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef MatrixExpression_HPP
+#define MatrixExpression_HPP
+
+#include <algorithm>
+
+#include "libalgo/source/structures/matrix/MatrixKernels.h"
+
+#include "libalgo/source/exceptions/ErrorMathZeroDevision.h"
+#include "libalgo/source/exceptions/ErrorMathMatrixDifferentSize.h"
+
+
+template <typename T>
+void MatrixFactors <T> ::reverse ( const unsigned int start )
+{
+        //Transpose the product of factors [start, end): (A * B)' = B' * A'
+        std::reverse ( factors.begin() + start, factors.end() );
+
+        for ( unsigned int i = start; i < factors.size(); i++ )
+        {
+                factors[i].transposed = !factors[i].transposed;
+        }
+}
+
+
+template <typename T>
+Matrix <T> & MatrixFactors <T> ::temporary ( const unsigned int rows, const unsigned int cols )
+{
+        //Create zero matrix owned by the chain, list does not invalidate references
+        temporaries.push_back ( Matrix <T> ( rows, cols ) );
+
+        return temporaries.back();
+}
+
+
+template <typename T>
+void MatrixFactors <T> ::evalTo ( Matrix <T> &D )
+{
+        //Evaluate the product of factors into D
+        const unsigned int n = factors.size();
+        T * d = D.data();
+
+        //Only one factor: copy or transpose the matrix
+        if ( n == 1 )
+        {
+                const Matrix <T> *M = factors[0].M;
+                const unsigned int m1 = M->rows(), n1 = M->cols();
+
+                if ( factors[0].transposed )
+                {
+                        for ( unsigned int i = 0; i < m1; i++ )
+                        {
+                                for ( unsigned int j = 0; j < n1; j++ )
+                                {
+                                        d[j * m1 + i] = M->data() [i * n1 + j];
+                                }
+                        }
+                }
+
+                else
+                {
+                        std::copy ( M->data(), M->data() + m1 * n1, d );
+                }
+        }
+
+        //Product of factors
+        else
+        {
+                //Dimensions of the chain: factor i has p[i] rows and p[i + 1] columns
+                std::vector <double> p ( n + 1 );
+                p[0] = factors[0].rows();
+
+                for ( unsigned int i = 0; i < n; i++ )
+                {
+                        p[i + 1] = factors[i].cols();
+                }
+
+                //Optimal order of multiplications (matrix chain problem), cost[i * n + j] = cost of the product of factors i..j
+                std::vector <double> cost ( n * n, 0 );
+                std::vector <unsigned int> split ( n * n, 0 );
+
+                for ( unsigned int l = 1; l < n; l++ )
+                {
+                        for ( unsigned int i = 0; i + l < n; i++ )
+                        {
+                                const unsigned int j = i + l;
+                                cost[i * n + j] = -1;
+
+                                for ( unsigned int k = i; k < j; k++ )
+                                {
+                                        const double c = cost[i * n + k] + cost[ ( k + 1 ) * n + j] + p[i] * p[k + 1] * p[j + 1];
+
+                                        if ( cost[i * n + j] < 0 || c < cost[i * n + j] )
+                                        {
+                                                cost[i * n + j] = c;
+                                                split[i * n + j] = k;
+                                        }
+                                }
+                        }
+                }
+
+                //Multiply factors, the last product is stored directly in D
+                evalChain ( 0, n - 1, split, &D );
+        }
+
+        //Apply the scalar only once
+        if ( scale != 1 )
+        {
+                for ( unsigned int i = 0; i < D.rows() * D.cols(); i++ )
+                {
+                        d[i] *= scale;
+                }
+        }
+}
+
+
+template <typename T>
+TMatrixFactor <T> MatrixFactors <T> ::evalChain ( const unsigned int i, const unsigned int j, const std::vector <unsigned int> &split, Matrix <T> *D )
+{
+        //Evaluate the product of factors i..j
+        if ( i == j )
+        {
+                return factors[i];
+        }
+
+        const unsigned int k = split[i * factors.size() + j];
+        const TMatrixFactor <T> A = evalChain ( i, k, split, NULL );
+        const TMatrixFactor <T> B = evalChain ( k + 1, j, split, NULL );
+
+        //Result stored in D or in the temporary matrix
+        Matrix <T> *C = D;
+
+        if ( C == NULL )
+        {
+                C = &temporary ( A.rows(), B.cols() );
+        }
+
+        else
+        {
+                std::fill ( C->data(), C->data() + C->rows() * C->cols(), T ( 0 ) );
+        }
+
+        multiply ( A, B, *C );
+
+        return TMatrixFactor <T> ( C, false );
+}
+
+
+template <typename T>
+void MatrixFactors <T> ::multiply ( const TMatrixFactor <T> &A, const TMatrixFactor <T> &B, Matrix <T> &C )
+{
+        //C = C + op(A) * op(B), transposed matrices are not created
+        const unsigned int m = A.rows(), n = B.cols(), k = A.cols();
+        const unsigned int lda = A.M->cols(), ldb = B.M->cols();
+
+        //A * B
+        if ( !A.transposed && !B.transposed )
+        {
+                MatrixKernels::mult ( m, n, k, A.M->data(), lda, B.M->data(), ldb, C.data(), n );
+        }
+
+        //A' * B
+        else if ( A.transposed && !B.transposed )
+        {
+                //A' * A: symmetric result
+                if ( A.M == B.M )
+                {
+                        MatrixKernels::syrkTN ( n, k, A.M->data(), lda, C.data(), n );
+                }
+
+                //A' * v
+                else if ( n == 1 )
+                {
+                        MatrixKernels::gemvTN ( m, k, A.M->data(), lda, B.M->data(), ldb, C.data() );
+                }
+
+                else
+                {
+                        MatrixKernels::gemmTN ( m, n, k, A.M->data(), lda, B.M->data(), ldb, C.data(), n );
+                }
+        }
+
+        //A * B'
+        else if ( !A.transposed && B.transposed )
+        {
+                MatrixKernels::gemmNT ( m, n, k, A.M->data(), lda, B.M->data(), ldb, C.data(), n );
+        }
+
+        //A' * B' = (B * A)'
+        else
+        {
+                Matrix <T> BA ( n, m );
+                MatrixKernels::mult ( n, m, k, B.M->data(), ldb, A.M->data(), lda, BA.data(), m );
+
+                for ( unsigned int i = 0; i < m; i++ )
+                {
+                        for ( unsigned int j = 0; j < n; j++ )
+                        {
+                                C.data() [i * n + j] += BA.data() [j * m + i];
+                        }
+                }
+        }
+}
+
+
+template <typename T>
+void MatrixLeafExpression <T> ::evalTo ( Matrix <T> &D ) const
+{
+        std::copy ( M.data(), M.data() + M.rows() * M.cols(), D.data() );
+}
+
+
+template <typename E>
+void MatrixTransExpression <E> ::factors ( MatrixFactors <Type> &f ) const
+{
+        //Factors of the subexpression are reversed and transposed
+        const unsigned int start = f.size();
+        e.factors ( f );
+        f.reverse ( start );
+}
+
+
+template <typename E>
+void MatrixTransExpression <E> ::evalTo ( Matrix <Type> &D ) const
+{
+        //Transposed product: evaluate the chain of factors
+        if ( product )
+        {
+                MatrixFactors <Type> f;
+                factors ( f );
+                f.evalTo ( D );
+        }
+
+        //Transposed element-wise expression: one pass
+        else
+        {
+                prepare();
+                Type * d = D.data();
+
+                for ( unsigned int i = 0, m = rows(), n = cols(); i < m; i++ )
+                {
+                        for ( unsigned int j = 0; j < n; j++ )
+                        {
+                                d[i * n + j] = item ( i, j );
+                        }
+                }
+        }
+}
+
+
+template <typename E>
+void MatrixScaleExpression <E> ::evalTo ( Matrix <Type> &D ) const
+{
+        //Scaled product: the scalar is applied to the result of the chain
+        if ( product )
+        {
+                MatrixFactors <Type> f;
+                factors ( f );
+                f.evalTo ( D );
+        }
+
+        //Scaled element-wise expression: one pass
+        else
+        {
+                prepare();
+                Type * d = D.data();
+
+                for ( unsigned int i = 0, m = rows(), n = cols(); i < m; i++ )
+                {
+                        for ( unsigned int j = 0; j < n; j++ )
+                        {
+                                d[i * n + j] = item ( i, j );
+                        }
+                }
+        }
+}
+
+
+template <typename L, typename R, typename Op>
+MatrixElementExpression <L, R, Op> ::MatrixElementExpression ( const L &l_, const R &r_ ) : l ( l_ ), r ( r_ )
+{
+        //Matrix dimemension invalid, throw exception
+        if ( ( l.rows() != r.rows() ) || ( l.cols() != r.cols() ) )
+        {
+                throw ErrorMathMatrixDifferentSize <Matrix <Type> > ( "ErrorMathMatrixDifferentSize: ", " different dimensions of the matrices in the element-wise expression. ", Matrix <Type> ( l.rows(), l.cols() ), Matrix <Type> ( r.rows(), r.cols() ) );
+        }
+}
+
+
+template <typename L, typename R, typename Op>
+void MatrixElementExpression <L, R, Op> ::factors ( MatrixFactors <Type> &f ) const
+{
+        //Element-wise expression used as a factor of the product: evaluate it once
+        Matrix <Type> &M = f.temporary ( rows(), cols() );
+        evalTo ( M );
+        f.push ( &M, false );
+}
+
+
+template <typename L, typename R, typename Op>
+void MatrixElementExpression <L, R, Op> ::evalTo ( Matrix <Type> &D ) const
+{
+        //Evaluate products in subexpressions, then all element-wise operations in one pass
+        prepare();
+        Type * d = D.data();
+
+        for ( unsigned int i = 0, m = rows(), n = cols(); i < m; i++ )
+        {
+                for ( unsigned int j = 0; j < n; j++ )
+                {
+                        d[i * n + j] = item ( i, j );
+                }
+        }
+}
+
+
+template <typename L, typename R>
+MatrixProductExpression <L, R> ::MatrixProductExpression ( const L &l_, const R &r_ ) : l ( l_ ), r ( r_ ), result ( NULL )
+{
+        //Matrix dimemension invalid, throw exception
+        if ( l.cols() != r.rows() )
+        {
+                throw ErrorMathMatrixDifferentSize <Matrix <Type> > ( "ErrorMathMatrixDifferentSize: ", " different rows_count count in the product expression. Cannot compute A * B. ", Matrix <Type> ( l.rows(), l.cols() ), Matrix <Type> ( r.rows(), r.cols() ) );
+        }
+}
+
+
+template <typename L, typename R>
+MatrixProductExpression <L, R> ::~MatrixProductExpression()
+{
+        delete result;
+}
+
+
+template <typename L, typename R>
+void MatrixProductExpression <L, R> ::prepare() const
+{
+        //Product inside the element-wise expression: evaluate it only once
+        if ( result == NULL )
+        {
+                result = new Matrix <Type> ( rows(), cols() );
+                evalTo ( *result );
+        }
+}
+
+
+template <typename L, typename R>
+void MatrixProductExpression <L, R> ::evalTo ( Matrix <Type> &D ) const
+{
+        //Collect factors of the product and multiply them in the optimal order
+        MatrixFactors <Type> f;
+        factors ( f );
+        f.evalTo ( D );
+}
+
+
+template <typename L, typename R>
+MatrixProductExpression <L, R> operator * ( const MatrixExpression <L> &l, const MatrixExpression <R> &r )
+{
+        return MatrixProductExpression <L, R> ( l.derived(), r.derived() );
+}
+
+
+template <typename L, typename T>
+MatrixProductExpression <L, MatrixLeafExpression <T> > operator * ( const MatrixExpression <L> &l, const Matrix <T> &R )
+{
+        return MatrixProductExpression <L, MatrixLeafExpression <T> > ( l.derived(), MatrixLeafExpression <T> ( R ) );
+}
+
+
+template <typename T, typename R>
+MatrixProductExpression <MatrixLeafExpression <T>, R> operator * ( const Matrix <T> &L, const MatrixExpression <R> &r )
+{
+        return MatrixProductExpression <MatrixLeafExpression <T>, R> ( MatrixLeafExpression <T> ( L ), r.derived() );
+}
+
+
+template <typename E>
+MatrixScaleExpression <E> operator / ( const MatrixExpression <E> &e, const typename E::Type val )
+{
+        //Throw exception: division by zero
+        if ( val == 0 )
+        {
+                throw ErrorMathZeroDevision <typename E::Type> ( "ErrorMathZeroDevision: divider is zero. ",  "Can not divide matrix expression by scalar.", val );
+        }
+
+        return MatrixScaleExpression <E> ( e.derived(), 1 / val );
+}
+
+
+template <typename L, typename R>
+MatrixElementExpression <L, R, TMatrixSum <typename L::Type> > operator + ( const MatrixExpression <L> &l, const MatrixExpression <R> &r )
+{
+        return MatrixElementExpression <L, R, TMatrixSum <typename L::Type> > ( l.derived(), r.derived() );
+}
+
+
+template <typename L, typename T>
+MatrixElementExpression <L, MatrixLeafExpression <T>, TMatrixSum <T> > operator + ( const MatrixExpression <L> &l, const Matrix <T> &R )
+{
+        return MatrixElementExpression <L, MatrixLeafExpression <T>, TMatrixSum <T> > ( l.derived(), MatrixLeafExpression <T> ( R ) );
+}
+
+
+template <typename T, typename R>
+MatrixElementExpression <MatrixLeafExpression <T>, R, TMatrixSum <T> > operator + ( const Matrix <T> &L, const MatrixExpression <R> &r )
+{
+        return MatrixElementExpression <MatrixLeafExpression <T>, R, TMatrixSum <T> > ( MatrixLeafExpression <T> ( L ), r.derived() );
+}
+
+
+template <typename L, typename R>
+MatrixElementExpression <L, R, TMatrixDifference <typename L::Type> > operator - ( const MatrixExpression <L> &l, const MatrixExpression <R> &r )
+{
+        return MatrixElementExpression <L, R, TMatrixDifference <typename L::Type> > ( l.derived(), r.derived() );
+}
+
+
+template <typename L, typename T>
+MatrixElementExpression <L, MatrixLeafExpression <T>, TMatrixDifference <T> > operator - ( const MatrixExpression <L> &l, const Matrix <T> &R )
+{
+        return MatrixElementExpression <L, MatrixLeafExpression <T>, TMatrixDifference <T> > ( l.derived(), MatrixLeafExpression <T> ( R ) );
+}
+
+
+template <typename T, typename R>
+MatrixElementExpression <MatrixLeafExpression <T>, R, TMatrixDifference <T> > operator - ( const Matrix <T> &L, const MatrixExpression <R> &r )
+{
+        return MatrixElementExpression <MatrixLeafExpression <T>, R, TMatrixDifference <T> > ( MatrixLeafExpression <T> ( L ), r.derived() );
+}
+
+
+template <typename L, typename R>
+MatrixElementExpression <L, R, TMatrixHadamard <typename L::Type> > operator % ( const MatrixExpression <L> &l, const MatrixExpression <R> &r )
+{
+        return MatrixElementExpression <L, R, TMatrixHadamard <typename L::Type> > ( l.derived(), r.derived() );
+}
+
+
+template <typename L, typename T>
+MatrixElementExpression <L, MatrixLeafExpression <T>, TMatrixHadamard <T> > operator % ( const MatrixExpression <L> &l, const Matrix <T> &R )
+{
+        return MatrixElementExpression <L, MatrixLeafExpression <T>, TMatrixHadamard <T> > ( l.derived(), MatrixLeafExpression <T> ( R ) );
+}
+
+
+template <typename T, typename R>
+MatrixElementExpression <MatrixLeafExpression <T>, R, TMatrixHadamard <T> > operator % ( const Matrix <T> &L, const MatrixExpression <R> &r )
+{
+        return MatrixElementExpression <MatrixLeafExpression <T>, R, TMatrixHadamard <T> > ( MatrixLeafExpression <T> ( L ), r.derived() );
+}
+
+#endif
@@ -0,0 +1 @@
+#include "MatrixKernels.h"
\ No newline at end of file
@@ -0,0 +1,72 @@
+// Description: Low level matrix kernels (blocked matrix multiplication)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef MatrixKernels_H
+#define MatrixKernels_H
+
+
+//Low level kernels working over the row-major storage of the matrix
+//Matrix X (r x c) is given by a pointer to the first item and by the leading dimension ldx (distance of two rows)
+//All kernels accumulate into C: C = C + op(A) * op(B), C must be initialized by the caller
+class MatrixKernels
+{
+        public:
+                //Selects the kernel according to the shape of the matrices: C (m x n) += A (m x k) * B (k x n)
+                template <typename T, typename U>
+                static void mult ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc );
+
+                //Cache-blocked kernel: C (m x n) += A (m x k) * B (k x n)
+                template <typename T, typename U>
+                static void gemm ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc );
+
+                //Transposed kernel: C (m x n) += A' * B, A (k x m), B (k x n); A' is not created
+                template <typename T, typename U>
+                static void gemmTN ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc );
+
+                //Transposed kernel: C (m x n) += A * B', A (m x k), B (n x k); B' is not created
+                template <typename T, typename U>
+                static void gemmNT ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc );
+
+                //Skinny symmetric kernel: C (n x n) += A' * A, A (k x n) is a tall Jacobian, only the upper triangle is computed and mirrored
+                template <typename T>
+                static void syrkTN ( const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, T * C, const unsigned int ldc );
+
+                //Skinny vector kernel: y (n x 1) += A' * x, A (k x n), x (k x 1) with the items stored incx apart, y is contiguous
+                template <typename T, typename U>
+                static void gemvTN ( const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * x, const unsigned int incx, T * y );
+
+                //Vector kernel: y (m x 1) += A * x, A (m x k), x (k x 1) with the items stored incx apart, y stored incy apart
+                template <typename T, typename U>
+                static void gemv ( const unsigned int m, const unsigned int k, const T * A, const unsigned int lda, const U * x, const unsigned int incx, T * y, const unsigned int incy );
+
+        private:
+                //Narrow kernel for B having a few columns (J, W * J)
+                template <typename T, typename U>
+                static void gemmNarrow ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc );
+
+                //Register-blocked kernel processing 4 rows of A at once
+                template <typename T, typename U>
+                static void gemmBlock ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc );
+};
+
+#include "MatrixKernels.hpp"
+
+#endif
@@ -0,0 +1,300 @@
+// Description: Low level matrix kernels (blocked matrix multiplication)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef MatrixKernels_HPP
+#define MatrixKernels_HPP
+
+#include <algorithm>
+
+#include "libalgo/source/const/Const.h"
+
+
+template <typename T, typename U>
+void MatrixKernels::mult ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc )
+{
+        //Select the kernel according to the shape of the matrices
+        if ( m == 0 || n == 0 || k == 0 )
+        {
+                return;
+        }
+
+        //B is a column vector: matrix-vector product
+        if ( n == 1 )
+        {
+                gemv ( m, k, A, lda, B, ldb, C, ldc );
+        }
+
+        //B has a few columns (J, W * J): row oriented kernel
+        else if ( n <= MATRIX_MULT_NARROW_COLS )
+        {
+                gemmNarrow ( m, n, k, A, lda, B, ldb, C, ldc );
+        }
+
+        //Small matrices: blocking does not pay off
+        else if ( ( double ) m * n * k <= MATRIX_MULT_SMALL_SIZE )
+        {
+                gemmBlock ( m, n, k, A, lda, B, ldb, C, ldc );
+        }
+
+        //Large matrices: cache blocked kernel
+        else
+        {
+                gemm ( m, n, k, A, lda, B, ldb, C, ldc );
+        }
+}
+
+
+template <typename T, typename U>
+void MatrixKernels::gemm ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc )
+{
+        //Split B into column panels (KC x NC), A into blocks (MC x KC), the panel is reused by all blocks of A
+        for ( unsigned int jc = 0; jc < n; jc += MATRIX_MULT_BLOCK_NC )
+        {
+                const unsigned int nc = std::min ( ( unsigned int ) MATRIX_MULT_BLOCK_NC, n - jc );
+
+                for ( unsigned int pc = 0; pc < k; pc += MATRIX_MULT_BLOCK_KC )
+                {
+                        const unsigned int kc = std::min ( ( unsigned int ) MATRIX_MULT_BLOCK_KC, k - pc );
+
+                        for ( unsigned int ic = 0; ic < m; ic += MATRIX_MULT_BLOCK_MC )
+                        {
+                                const unsigned int mc = std::min ( ( unsigned int ) MATRIX_MULT_BLOCK_MC, m - ic );
+
+                                gemmBlock ( mc, nc, kc, A + ic * lda + pc, lda, B + pc * ldb + jc, ldb, C + ic * ldc + jc, ldc );
+                        }
+                }
+        }
+}
+
+
+template <typename T, typename U>
+void MatrixKernels::gemmBlock ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc )
+{
+        //Process 4 rows of C at once: each item of B is loaded once for 4 multiplications
+        //Inner loops have the unit stride and are vectorized by the compiler
+        unsigned int i = 0;
+
+        for ( ; i + 4 <= m; i += 4 )
+        {
+                T * c0 = C + i * ldc, * c1 = c0 + ldc, * c2 = c1 + ldc, * c3 = c2 + ldc;
+                const T * a0 = A + i * lda, * a1 = a0 + lda, * a2 = a1 + lda, * a3 = a2 + lda;
+
+                for ( unsigned int p = 0; p < k; p++ )
+                {
+                        const T b0 = a0[p], b1 = a1[p], b2 = a2[p], b3 = a3[p];
+                        const U * b = B + p * ldb;
+
+                        for ( unsigned int j = 0; j < n; j++ )
+                        {
+                                const T bj = b[j];
+                                c0[j] += b0 * bj;
+                                c1[j] += b1 * bj;
+                                c2[j] += b2 * bj;
+                                c3[j] += b3 * bj;
+                        }
+                }
+        }
+
+        //Remaining rows
+        for ( ; i < m; i++ )
+        {
+                T * c = C + i * ldc;
+                const T * a = A + i * lda;
+
+                for ( unsigned int p = 0; p < k; p++ )
+                {
+                        const T ap = a[p];
+                        const U * b = B + p * ldb;
+
+                        for ( unsigned int j = 0; j < n; j++ )
+                        {
+                                c[j] += ap * b[j];
+                        }
+                }
+        }
+}
+
+
+template <typename T, typename U>
+void MatrixKernels::gemmNarrow ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc )
+{
+        //Rows of B are short: the row of C stays in cache for all items of the row of A
+        for ( unsigned int i = 0; i < m; i++ )
+        {
+                T * c = C + i * ldc;
+                const T * a = A + i * lda;
+
+                for ( unsigned int p = 0; p < k; p++ )
+                {
+                        const T ap = a[p];
+
+                        const U * b = B + p * ldb;
+
+                        for ( unsigned int j = 0; j < n; j++ )
+                        {
+                                c[j] += ap * b[j];
+                        }
+                }
+        }
+}
+
+
+template <typename T, typename U>
+void MatrixKernels::gemmTN ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc )
+{
+        //C = C + sum_p A(p, :)' * B(p, :): sequence of rank-1 updates over rows of A and B
+        for ( unsigned int jc = 0; jc < n; jc += MATRIX_MULT_BLOCK_NC )
+        {
+                const unsigned int nc = std::min ( ( unsigned int ) MATRIX_MULT_BLOCK_NC, n - jc );
+
+                for ( unsigned int p = 0; p < k; p++ )
+                {
+                        const T * a = A + p * lda;
+                        const U * b = B + p * ldb + jc;
+
+                        for ( unsigned int i = 0; i < m; i++ )
+                        {
+                                const T ai = a[i];
+
+                                T * c = C + i * ldc + jc;
+
+                                for ( unsigned int j = 0; j < nc; j++ )
+                                {
+                                        c[j] += ai * b[j];
+                                }
+                        }
+                }
+        }
+}
+
+
+template <typename T, typename U>
+void MatrixKernels::gemmNT ( const unsigned int m, const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * B, const unsigned int ldb, T * C, const unsigned int ldc )
+{
+        //C(i, j) = C(i, j) + A(i, :) * B(j, :)': dot products of the rows, both have the unit stride
+        for ( unsigned int i = 0; i < m; i++ )
+        {
+                const T * a = A + i * lda;
+                T * c = C + i * ldc;
+
+                for ( unsigned int j = 0; j < n; j++ )
+                {
+                        const U * b = B + j * ldb;
+
+                        //Use 4 partial sums to break the dependency chain
+                        T s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+                        unsigned int p = 0;
+
+                        for ( ; p + 4 <= k; p += 4 )
+                        {
+                                s0 += a[p] * b[p];
+                                s1 += a[p + 1] * b[p + 1];
+                                s2 += a[p + 2] * b[p + 2];
+                                s3 += a[p + 3] * b[p + 3];
+                        }
+
+                        for ( ; p < k; p++ )
+                        {
+                                s0 += a[p] * b[p];
+                        }
+
+                        c[j] += ( s0 + s1 ) + ( s2 + s3 );
+                }
+        }
+}
+
+
+template <typename T>
+void MatrixKernels::syrkTN ( const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, T * C, const unsigned int ldc )
+{
+        //Upper triangle of C = C + sum_p A(p, :)' * A(p, :)
+        for ( unsigned int p = 0; p < k; p++ )
+        {
+                const T * a = A + p * lda;
+
+                for ( unsigned int i = 0; i < n; i++ )
+                {
+                        const T ai = a[i];
+
+                        T * c = C + i * ldc;
+
+                        for ( unsigned int j = i; j < n; j++ )
+                        {
+                                c[j] += ai * a[j];
+                        }
+                }
+        }
+
+        //Mirror the upper triangle
+        for ( unsigned int i = 1; i < n; i++ )
+        {
+                for ( unsigned int j = 0; j < i; j++ )
+                {
+                        C[i * ldc + j] = C[j * ldc + i];
+                }
+        }
+}
+
+
+template <typename T, typename U>
+void MatrixKernels::gemvTN ( const unsigned int n, const unsigned int k, const T * A, const unsigned int lda, const U * x, const unsigned int incx, T * y )
+{
+        //y = y + sum_p x(p) * A(p, :)': rows of A are processed with the unit stride
+        for ( unsigned int p = 0; p < k; p++ )
+        {
+                const T xp = x[p * incx];
+
+                const T * a = A + p * lda;
+
+                for ( unsigned int j = 0; j < n; j++ )
+                {
+                        y[j] += xp * a[j];
+                }
+        }
+}
+
+
+template <typename T, typename U>
+void MatrixKernels::gemv ( const unsigned int m, const unsigned int k, const T * A, const unsigned int lda, const U * x, const unsigned int incx, T * y, const unsigned int incy )
+{
+        //y(i) = y(i) + A(i, :) * x
+        for ( unsigned int i = 0; i < m; i++ )
+        {
+                const T * a = A + i * lda;
+                T s0 = 0, s1 = 0;
+                unsigned int p = 0;
+
+                for ( ; p + 2 <= k; p += 2 )
+                {
+                        s0 += a[p] * x[p * incx];
+                        s1 += a[p + 1] * x[( p + 1 ) * incx];
+                }
+
+                for ( ; p < k; p++ )
+                {
+                        s0 += a[p] * x[p * incx];
+                }
+
+                y[i * incy] += s0 + s1;
+        }
+}
+
+#endif
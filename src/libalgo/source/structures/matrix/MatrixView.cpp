@@ -0,0 +1 @@
+#include "MatrixView.h"
\ No newline at end of file
@@ -0,0 +1,153 @@
+// Description: Non-owning strided view of the matrix items
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef MatrixView_H
+#define MatrixView_H
+
+#include <cstddef>
+#include <algorithm>
+#include <ostream>
+#include <iostream>
+
+
+//Forward declaration
+template <typename T>
+class Matrix;
+
+
+//Type of the item stored in the matrix created from the view: MatrixView <const T> -> Matrix <T>
+template <typename T>
+struct TMatrixViewItem
+{
+        typedef T Type;
+};
+
+template <typename T>
+struct TMatrixViewItem <const T>
+{
+        typedef T Type;
+};
+
+
+//Non-owning view of the matrix items: item (i, j) is stored at items [i * row_stride + j * column_stride]
+//Views are created in O(1) by Matrix::view(), slices, rows, columns and the transposition of a view are views again
+//Items are never copied: writes into the view go through to the viewed matrix
+//The view must not outlive the viewed matrix, resizing or swapping the matrix invalidates the view
+template <typename T>
+class MatrixView
+{
+        private:
+                T * items;					//First item of the view
+                unsigned int rows_count;			//Total rows_count
+                unsigned int columns_count;			//Total columns_count
+                std::size_t row_stride;				//Distance of two rows
+                std::size_t column_stride;			//Distance of two columns
+
+        public:
+
+                MatrixView ( T * items_, const unsigned int rows_count_, const unsigned int columns_count_, const std::size_t row_stride_, const std::size_t column_stride_ = 1 ) :
+                        items ( items_ ), rows_count ( rows_count_ ), columns_count ( columns_count_ ), row_stride ( row_stride_ ), column_stride ( column_stride_ ) {}
+
+                //Writable view converted to the read-only view
+                template <typename U>
+                MatrixView ( const MatrixView <U> &V ) : items ( V.data() ), rows_count ( V.rows() ), columns_count ( V.cols() ), row_stride ( V.rowStride() ), column_stride ( V.colStride() ) {}
+
+        public:
+
+                //Get rows and columns count
+                unsigned int rows() const {return rows_count;}
+                unsigned int cols() const {return columns_count;}
+
+                //Get pointer to the first item and strides
+                T * data() const {return items;}
+                std::size_t rowStride() const {return row_stride;}
+                std::size_t colStride() const {return column_stride;}
+
+                //Items are stored as the row-major matrix with the leading dimension rowStride()
+                bool rowMajor() const {return ( column_stride == 1 ) || ( columns_count <= 1 );}
+
+                //Items are stored as the column-major matrix with the leading dimension colStride()
+                bool colMajor() const {return ( row_stride == 1 ) || ( rows_count <= 1 );}
+
+                //Get views of a row, a column, the diagonal and the transposed view, O(1)
+                MatrixView <T> row ( const unsigned int r ) const;
+                MatrixView <T> col ( const unsigned int c ) const;
+                MatrixView <T> trans() const {return MatrixView <T> ( items, columns_count, rows_count, column_stride, row_stride );}
+                MatrixView <T> diag() const {return MatrixView <T> ( items, std::min ( rows_count, columns_count ), 1, row_stride + column_stride, column_stride );}
+
+                //Copy items into the new matrix
+                Matrix <typename TMatrixViewItem <T>::Type> toMatrix() const;
+
+                //Set all items
+                void fill ( const T val ) const;
+
+                //View and V refer to the same memory block
+                template <typename U>
+                bool overlaps ( const MatrixView <U> &V ) const;
+
+                //Other methods
+                void print ( std::ostream * output = &std::cout ) const;
+
+        public:
+
+                //View operator = : copy items of the view into the viewed matrix, dimensions must be equal
+                const MatrixView <T> & operator = ( const MatrixView <T> &V ) const;
+
+                template <typename U>
+                const MatrixView <T> & operator = ( const MatrixView <U> &V ) const;
+
+                //View operator = : copy items of the matrix into the viewed matrix, dimensions must be equal
+                template <typename U>
+                const MatrixView <T> & operator = ( const Matrix <U> &M ) const;
+
+                //View operators +=, -= : View += View, View -= View
+                template <typename U>
+                const MatrixView <T> & operator += ( const MatrixView <U> &V ) const;
+
+                template <typename U>
+                const MatrixView <T> & operator -= ( const MatrixView <U> &V ) const;
+
+                //View operator *= : View *= Scalar
+                template <typename U>
+                const MatrixView <T> & operator *= ( const U & val ) const;
+
+                //View operator (row, col)
+                T & operator() ( const unsigned int row, const unsigned int col ) const;
+
+                //View operator (r1, r2, c1, c2): get view of the submatrix
+                MatrixView <T> operator () ( const unsigned int r1, const unsigned int r2, const unsigned int c1, const unsigned int c2 ) const;
+
+        private:
+
+                //Update items: item = Op ( item, V item ), V is copied into the temporary matrix if both views share items
+                template <typename Op, typename U>
+                void update ( const MatrixView <U> &V, const char * function_text ) const;
+};
+
+
+//Element-wise operation: assignment
+template <typename T>
+struct TMatrixAssignment { static T apply ( const T a, const T b ) {return b;} };
+
+#include "MatrixView.hpp"
+
+#endif
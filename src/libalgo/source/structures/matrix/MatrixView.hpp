@@ -0,0 +1,301 @@
+// Description: Non-owning strided view of the matrix items
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef MatrixView_HPP
+#define MatrixView_HPP
+
+#include <iomanip>
+#include <algorithm>
+
+#include "libalgo/source/const/Const.h"
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+#include "libalgo/source/exceptions/ErrorIndexOutOfBound.h"
+#include "libalgo/source/exceptions/ErrorMathMatrixDifferentSize.h"
+
+
+//Get view of the row
+template <typename T>
+MatrixView <T> MatrixView <T> ::row ( const unsigned int r ) const
+{
+        //Bad row index
+        if ( r >= rows_count )
+        {
+                throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "invalid dimension of the matrix (row > rows_count), can not create view of the row." );
+        }
+
+        return MatrixView <T> ( items + r * row_stride, 1, columns_count, row_stride, column_stride );
+}
+
+
+//Get view of the column
+template <typename T>
+MatrixView <T> MatrixView <T> ::col ( const unsigned int c ) const
+{
+        //Bad column index
+        if ( c >= columns_count )
+        {
+                throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "invalid dimension of the matrix (col > columns_count), can not create view of the column." );
+        }
+
+        return MatrixView <T> ( items + c * column_stride, rows_count, 1, row_stride, column_stride );
+}
+
+
+//Copy items into the new matrix
+template <typename T>
+Matrix <typename TMatrixViewItem <T>::Type> MatrixView <T> ::toMatrix() const
+{
+        Matrix <typename TMatrixViewItem <T>::Type> M ( rows_count, columns_count );
+        typename TMatrixViewItem <T>::Type * m = M.data();
+
+        for ( unsigned int i = 0; i < rows_count; i++ )
+        {
+                const T * v = items + i * row_stride;
+
+                for ( unsigned int j = 0; j < columns_count; j++ )
+                {
+                        m[i * columns_count + j] = v[j * column_stride];
+                }
+        }
+
+        return M;
+}
+
+
+//Set all items of the view
+template <typename T>
+void MatrixView <T> ::fill ( const T val ) const
+{
+        for ( unsigned int i = 0; i < rows_count; i++ )
+        {
+                T * v = items + i * row_stride;
+
+                for ( unsigned int j = 0; j < columns_count; j++ )
+                {
+                        v[j * column_stride] = val;
+                }
+        }
+}
+
+
+template <typename T>
+void MatrixView <T> ::print ( std::ostream * output ) const
+{
+        //Print view
+        *output << std::showpoint << std::fixed << std::right;
+        *output << '\n';
+
+        for ( unsigned int i = 0; i < rows_count; i++ )
+        {
+                *output << "| ";
+
+                for ( unsigned int j = 0; j < columns_count; j++ )
+                {
+                        const T val = items[i * row_stride + j * column_stride];
+
+                        *output <<  std::setw ( 16 ) << std::setprecision ( 7 );
+                        val < MAX_FLOAT ? *output << val : *output << "---";
+                }
+
+                *output << " |" << '\n';
+        }
+}
+
+
+//View operator = : copy items of the view
+template <typename T>
+const MatrixView <T> & MatrixView <T> ::operator = ( const MatrixView <T> &V ) const
+{
+        update <TMatrixAssignment <T> > ( V, " different dimensions of the views in operator =. Can not assign views. " );
+
+        return *this;
+}
+
+
+//View operator = : copy items of the view
+template <typename T>
+template <typename U>
+const MatrixView <T> & MatrixView <T> ::operator = ( const MatrixView <U> &V ) const
+{
+        update <TMatrixAssignment <T> > ( V, " different dimensions of the views in operator =. Can not assign views. " );
+
+        return *this;
+}
+
+
+//View operator = : copy items of the matrix
+template <typename T>
+template <typename U>
+const MatrixView <T> & MatrixView <T> ::operator = ( const Matrix <U> &M ) const
+{
+        update <TMatrixAssignment <T> > ( M.view(), " different dimensions of the view and the matrix in operator =. Can not assign matrix. " );
+
+        return *this;
+}
+
+
+//View operators += : View += View
+template <typename T>
+template <typename U>
+const MatrixView <T> & MatrixView <T> ::operator += ( const MatrixView <U> &V ) const
+{
+        update <TMatrixSum <T> > ( V, " different dimensions of the views. Cannot compute A += B. " );
+
+        return *this;
+}
+
+
+//View operators -= : View -= View
+template <typename T>
+template <typename U>
+const MatrixView <T> & MatrixView <T> ::operator -= ( const MatrixView <U> &V ) const
+{
+        update <TMatrixDifference <T> > ( V, " different dimensions of the views. Cannot compute A -= B. " );
+
+        return *this;
+}
+
+
+//View operators *= : View *= Scalar
+template <typename T>
+template <typename U>
+const MatrixView <T> & MatrixView <T> ::operator *= ( const U & val ) const
+{
+        for ( unsigned int i = 0; i < rows_count; i++ )
+        {
+                T * v = items + i * row_stride;
+
+                for ( unsigned int j = 0; j < columns_count; j++ )
+                {
+                        v[j * column_stride] *= val;
+                }
+        }
+
+        return *this;
+}
+
+
+//View operator ()()
+template <typename T>
+T & MatrixView <T> :: operator() ( const unsigned int row, const unsigned int col ) const
+{
+        //Matrix dimemension invalid, throw exception
+        if ( row >= rows_count )
+        {
+                throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "invalid dimension of the matrix (row > rows_count), row = " );
+        }
+
+        //Matrix dimemension are invalid, throw exception
+        if ( col >= columns_count )
+        {
+                throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "invalid dimension of the matrix (col > columns_count), col = " );
+        }
+
+        return items[row * row_stride + col * column_stride];
+}
+
+
+//View operator (r1, r2, c1, c2): get view of the submatrix, O(1)
+template <typename T>
+MatrixView <T> MatrixView <T> ::operator () ( const unsigned int r1, const unsigned int r2, const unsigned int c1, const unsigned int c2 ) const
+{
+        //Bad row index
+        if ( r2 >= rows_count )
+                throw ErrorBadData ( "ErrorBadData: row index r2 must be smaller than rows_count. ", " Can not create view of the submatrix. " );
+
+        //Bad col index
+        if ( c2 >= columns_count )
+                throw ErrorBadData ( "ErrorBadData: col index c2 must be smaller than columns_count. ", " Can not create view of the submatrix. " );
+
+        //Bad row index interval
+        if ( r1 > r2 )
+                throw ErrorBadData ( "ErrorBadData: row index r2 must not be smaller then r1. ", " Can not create view of the submatrix. " );
+
+        //Bad col index interval
+        if ( c1 > c2 )
+                throw ErrorBadData ( "ErrorBadData: col index c2 must not be smaller then c1. ", " Can not create view of the submatrix. " );
+
+        return MatrixView <T> ( items + r1 * row_stride + c1 * column_stride, r2 - r1 + 1, c2 - c1 + 1, row_stride, column_stride );
+}
+
+
+//Update items of the view: item = Op ( item, V item )
+template <typename T>
+template <typename Op, typename U>
+void MatrixView <T> ::update ( const MatrixView <U> &V, const char * function_text ) const
+{
+        //Matrix dimemension are invalid, throw exception
+        if ( ( rows_count != V.rows() ) || ( columns_count != V.cols() ) )
+        {
+                throw ErrorMathMatrixDifferentSize <Matrix <typename TMatrixViewItem <T>::Type> > ( "ErrorMathMatrixDifferentSize: ", function_text, toMatrix(), V.toMatrix() );
+        }
+
+        //Views share items (e.g. A' and A, shifted rows): read V before the view is written
+        if ( overlaps ( V ) )
+        {
+                const Matrix <typename TMatrixViewItem <U>::Type> M = V.toMatrix();
+                update <Op> ( M.view(), function_text );
+
+                return;
+        }
+
+        const std::size_t rs = V.rowStride(), cs = V.colStride();
+
+        for ( unsigned int i = 0; i < rows_count; i++ )
+        {
+                T * v = items + i * row_stride;
+                const U * w = V.data() + i * rs;
+
+                for ( unsigned int j = 0; j < columns_count; j++ )
+                {
+                        v[j * column_stride] = Op::apply ( v[j * column_stride], w[j * cs] );
+                }
+        }
+}
+
+
+//View and V refer to the same memory block (the same view is not an overlap for the item-by-item operations)
+template <typename T>
+template <typename U>
+bool MatrixView <T> ::overlaps ( const MatrixView <U> &V ) const
+{
+        //Empty view
+        if ( ( rows_count == 0 ) || ( columns_count == 0 ) || ( V.rows() == 0 ) || ( V.cols() == 0 ) )
+        {
+                return false;
+        }
+
+        //Identical views: each item is read before it is written
+        if ( ( ( const void * ) items == ( const void * ) V.data() ) && ( row_stride == V.rowStride() ) && ( column_stride == V.colStride() ) )
+        {
+                return false;
+        }
+
+        //Address ranges of both views
+        const char * a1 = ( const char * ) items, * a2 = ( const char * ) ( items + ( rows_count - 1 ) * row_stride + ( columns_count - 1 ) * column_stride + 1 );
+        const char * b1 = ( const char * ) V.data(), * b2 = ( const char * ) ( V.data() + ( V.rows() - 1 ) * V.rowStride() + ( V.cols() - 1 ) * V.colStride() + 1 );
+
+        return ( a1 < b2 ) && ( b1 < a2 );
+}
+
+#endif
@@ -0,0 +1 @@
+#include "SymmetricMatrix.h"
\ No newline at end of file
@@ -0,0 +1,85 @@
+// Description: Symmetric matrix stored in the packed form
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef SymmetricMatrix_H
+#define SymmetricMatrix_H
+
+#include <cstddef>
+#include <ostream>
+#include <iostream>
+
+#include "libalgo/source/structures/matrix/Matrix.h"
+#include "libalgo/source/structures/matrix/TriangularMatrix.h"
+
+
+//Square symmetric matrix, only the lower triangle is stored row by row (packed storage, n * (n + 1) / 2 items)
+//Normal matrices J' * W * J, covariance matrices; item (i, j) and (j, i) share the same storage
+template <typename T>
+class SymmetricMatrix
+{
+        private:
+                unsigned int size;				//Rows and columns count
+                typename TMatrix <T>::Type items;		//Packed rows of the lower triangle
+
+        public:
+                SymmetricMatrix ( const unsigned int size_, const T item = 0 ) : size ( size_ ), items ( ( std::size_t ) size_ * ( size_ + 1 ) / 2, item ) {}
+                SymmetricMatrix ( const unsigned int size_, const T non_diag_item_val, const T diag_val );
+                SymmetricMatrix ( const Matrix <T> &A );
+
+        public:
+                unsigned int rows() const {return size;}
+                unsigned int cols() const {return size;}
+
+                //Get pointer to the first item of the packed storage
+                T * data() {return items.empty() ? NULL : &items[0];}
+                const T * data() const {return items.empty() ? NULL : &items[0];}
+
+                //Convert to the dense matrix
+                Matrix <T> full() const;
+
+                //Multiplication: A * B
+                Matrix <T> operator * ( const Matrix <T> &B ) const;
+
+                //Rank-k update: A = A + alpha * B' * B, B (k x n) is not transposed
+                void rankUpdate ( const Matrix <T> &B, const T alpha = 1 );
+
+                //Cholesky decomposition A = L * L', returns false if A is not positive definite
+                bool chol ( TriangularMatrix <T> &L ) const;
+
+                void print ( std::ostream * output = &std::cout ) const;
+
+        public:
+                //Item (row, col) = item (col, row)
+                T & operator() ( const unsigned int row, const unsigned int col );
+                T const & operator() ( const unsigned int row, const unsigned int col ) const;
+
+        private:
+                //Index of the item (row, col) of the lower triangle in the packed storage
+                std::size_t index ( const unsigned int row, const unsigned int col ) const
+                {
+                        return row >= col ? ( std::size_t ) row * ( row + 1 ) / 2 + col : ( std::size_t ) col * ( col + 1 ) / 2 + row;
+                }
+};
+
+#include "SymmetricMatrix.hpp"
+
+#endif
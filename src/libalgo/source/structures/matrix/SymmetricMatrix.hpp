@@ -0,0 +1,249 @@
+// Description: Symmetric matrix stored in the packed form
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef SymmetricMatrix_HPP
+#define SymmetricMatrix_HPP
+
+#include <cmath>
+#include <algorithm>
+
+#include "libalgo/source/exceptions/ErrorIndexOutOfBound.h"
+#include "libalgo/source/exceptions/ErrorMathMatrixNotSquare.h"
+#include "libalgo/source/exceptions/ErrorMathMatrixDifferentSize.h"
+
+
+template <typename T>
+SymmetricMatrix <T> ::SymmetricMatrix ( const unsigned int size_, const T non_diag_item_val, const T diag_val ) :
+        size ( size_ ), items ( ( std::size_t ) size_ * ( size_ + 1 ) / 2, non_diag_item_val )
+{
+        //Create matrix with eye value on main diagonal
+        for ( unsigned int i = 0; i < size; i++ )
+        {
+                items[index ( i, i )] = diag_val;
+        }
+}
+
+
+template <typename T>
+SymmetricMatrix <T> ::SymmetricMatrix ( const Matrix <T> &A ) :
+        size ( A.rows() ), items ( ( std::size_t ) A.rows() * ( A.rows() + 1 ) / 2 )
+{
+        //Rectangular matrix
+        if ( A.rows() != A.cols() )
+        {
+                throw ErrorMathMatrixNotSquare <Matrix <T> > ( "ErrorMathMatrixNotSquare: ", " invalid dimension of the matrix (rectangle matrix), can not create symmetric matrix; (rows_count, columns_count):  ", A );
+        }
+
+        //Copy the lower triangle of A, the upper triangle is ignored
+        const T * a = A.data();
+
+        for ( unsigned int i = 0; i < size; i++ )
+        {
+                std::copy ( a + i * size, a + i * size + i + 1, items.begin() + index ( i, 0 ) );
+        }
+}
+
+
+template <typename T>
+Matrix <T> SymmetricMatrix <T> ::full() const
+{
+        //Create dense matrix, mirror the lower triangle
+        Matrix <T> A ( size, size );
+        T * a = A.data();
+
+        for ( unsigned int i = 0; i < size; i++ )
+        {
+                const T * r = &items[index ( i, 0 )];
+
+                for ( unsigned int j = 0; j <= i; j++ )
+                {
+                        a[i * size + j] = r[j];
+                        a[j * size + i] = r[j];
+                }
+        }
+
+        return A;
+}
+
+
+template <typename T>
+Matrix <T> SymmetricMatrix <T> ::operator * ( const Matrix <T> &B ) const
+{
+        //Matrix dimemension invalid, throw exception
+        if ( B.rows() != size )
+        {
+                throw ErrorMathMatrixDifferentSize <Matrix <T> > ( "ErrorMathMatrixDifferentSize: ", " different rows count. Cannot compute A * B. ", full(), B );
+        }
+
+        //Each stored item A(i, j), j < i, contributes to the rows i and j of C
+        const unsigned int q = B.cols();
+        Matrix <T> C ( size, q );
+        const T * b = B.data();
+        T * c = C.data();
+
+        for ( unsigned int i = 0; i < size; i++ )
+        {
+                const T * r = &items[index ( i, 0 )];
+                const T * bi = b + i * q;
+                T * ci = c + i * q;
+
+                for ( unsigned int j = 0; j < i; j++ )
+                {
+                        const T aij = r[j];
+                        const T * bj = b + j * q;
+                        T * cj = c + j * q;
+
+                        for ( unsigned int l = 0; l < q; l++ )
+                        {
+                                ci[l] += aij * bj[l];
+                                cj[l] += aij * bi[l];
+                        }
+                }
+
+                //Diagonal item
+                const T aii = r[i];
+
+                for ( unsigned int l = 0; l < q; l++ )
+                {
+                        ci[l] += aii * bi[l];
+                }
+        }
+
+        return C;
+}
+
+
+template <typename T>
+void SymmetricMatrix <T> ::rankUpdate ( const Matrix <T> &B, const T alpha )
+{
+        //Matrix dimemension invalid, throw exception
+        if ( B.cols() != size )
+        {
+                throw ErrorMathMatrixDifferentSize <Matrix <T> > ( "ErrorMathMatrixDifferentSize: ", " different columns count. Cannot compute A + B' * B. ", full(), B );
+        }
+
+        //Sequence of rank-1 updates over rows of B: A = A + alpha * B(p, :)' * B(p, :), lower triangle only
+        const unsigned int k = B.rows();
+        const T * b = B.data();
+
+        for ( unsigned int p = 0; p < k; p++ )
+        {
+                const T * bp = b + p * size;
+
+                for ( unsigned int i = 0; i < size; i++ )
+                {
+                        const T bi = alpha * bp[i];
+                        T * r = &items[index ( i, 0 )];
+
+                        for ( unsigned int j = 0; j <= i; j++ )
+                        {
+                                r[j] += bi * bp[j];
+                        }
+                }
+        }
+}
+
+
+template <typename T>
+bool SymmetricMatrix <T> ::chol ( TriangularMatrix <T> &L ) const
+{
+        //Cholesky decomposition row by row (Cholesky-Banachiewicz), rows of both packed matrices are contiguous
+        if ( L.rows() != size || L.getType() != LowerTriangular )
+        {
+                L = TriangularMatrix <T> ( size, LowerTriangular );
+        }
+
+        T * l = L.data();
+
+        for ( unsigned int i = 0; i < size; i++ )
+        {
+                const T * a = &items[index ( i, 0 )];
+                T * li = l + index ( i, 0 );
+
+                for ( unsigned int j = 0; j <= i; j++ )
+                {
+                        const T * lj = l + index ( j, 0 );
+
+                        //Compute sum (L(i, k) * L(j, k))
+                        T sum = a[j];
+
+                        for ( unsigned int k = 0; k < j; k++ )
+                        {
+                                sum -= li[k] * lj[k];
+                        }
+
+                        //Diagonal item: matrix is not positive definite
+                        if ( i == j )
+                        {
+                                if ( sum <= 0 )
+                                {
+                                        return false;
+                                }
+
+                                li[i] = sqrt ( sum );
+                        }
+
+                        //Item bellow the diagonal
+                        else
+                        {
+                                li[j] = sum / lj[j];
+                        }
+                }
+        }
+
+        return true;
+}
+
+
+template <typename T>
+void SymmetricMatrix <T> ::print ( std::ostream * output ) const
+{
+        full().print ( output );
+}
+
+
+template <typename T>
+T & SymmetricMatrix <T> :: operator() ( const unsigned int row, const unsigned int col )
+{
+        //Matrix dimemension invalid, throw exception
+        if ( ( row >= size ) || ( col >= size ) )
+        {
+                throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "invalid dimension of the matrix (row or col > size), row = " );
+        }
+
+        return items[index ( row, col )];
+}
+
+
+template <typename T>
+T const & SymmetricMatrix <T> :: operator() ( const unsigned int row, const unsigned int col ) const
+{
+        //Matrix dimemension invalid, throw exception
+        if ( ( row >= size ) || ( col >= size ) )
+        {
+                throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "invalid dimension of the matrix (row or col > size), row = " );
+        }
+
+        return items[index ( row, col )];
+}
+
+#endif
@@ -0,0 +1 @@
+#include "TriangularMatrix.h"
\ No newline at end of file
@@ -0,0 +1,103 @@
+// Description: Triangular matrix stored in the packed form
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef TriangularMatrix_H
+#define TriangularMatrix_H
+
+#include <cstddef>
+#include <ostream>
+#include <iostream>
+
+#include "libalgo/source/structures/matrix/Matrix.h"
+
+
+//Type of the triangular matrix
+typedef enum
+{
+        LowerTriangular = 0,
+        UpperTriangular
+} TTriangularMatrix;
+
+
+//Square triangular matrix, only the triangle is stored row by row (packed storage, n * (n + 1) / 2 items)
+//Lower: row i holds items (i, 0) .. (i, i), upper: row i holds items (i, i) .. (i, n - 1)
+template <typename T>
+class TriangularMatrix
+{
+        private:
+                unsigned int size;				//Rows and columns count
+                TTriangularMatrix type;				//Lower or upper triangular matrix
+                typename TMatrix <T>::Type items;		//Packed rows of the triangle
+
+        public:
+                TriangularMatrix ( const unsigned int size_, const TTriangularMatrix type_ = LowerTriangular, const T item = 0 ) :
+                        size ( size_ ), type ( type_ ), items ( ( std::size_t ) size_ * ( size_ + 1 ) / 2, item ) {}
+                TriangularMatrix ( const Matrix <T> &A, const TTriangularMatrix type_ = LowerTriangular );
+
+        public:
+                unsigned int rows() const {return size;}
+                unsigned int cols() const {return size;}
+                TTriangularMatrix getType() const {return type;}
+
+                //Get pointer to the first item of the packed storage
+                T * data() {return items.empty() ? NULL : &items[0];}
+                const T * data() const {return items.empty() ? NULL : &items[0];}
+
+                //Get item, zero outside the triangle
+                T item ( const unsigned int row, const unsigned int col ) const;
+
+                //Convert to the dense matrix
+                Matrix <T> full() const;
+
+                //Transposed matrix: lower <-> upper
+                TriangularMatrix <T> trans() const;
+
+                //Multiplication: A * B, A' * B
+                Matrix <T> operator * ( const Matrix <T> &B ) const;
+                Matrix <T> transMult ( const Matrix <T> &B ) const;
+
+                //Solve A * X = B, A' * X = B in place: B is overwritten by X
+                void solve ( Matrix <T> &B ) const;
+                void solveTrans ( Matrix <T> &B ) const;
+
+                void print ( std::ostream * output = &std::cout ) const;
+
+        public:
+                //Item inside the triangle, throws exception outside
+                T & operator() ( const unsigned int row, const unsigned int col );
+                T const & operator() ( const unsigned int row, const unsigned int col ) const;
+
+        private:
+                //Index of the item (row, col) inside the triangle in the packed storage
+                std::size_t index ( const unsigned int row, const unsigned int col ) const
+                {
+                        return type == LowerTriangular ? ( std::size_t ) row * ( row + 1 ) / 2 + col : ( std::size_t ) row * ( 2 * size - row + 1 ) / 2 + ( col - row );
+                }
+
+                bool inside ( const unsigned int row, const unsigned int col ) const {return type == LowerTriangular ? col <= row : col >= row;}
+
+                void checkRows ( const Matrix <T> &B, const char * function_text ) const;
+};
+
+#include "TriangularMatrix.hpp"
+
+#endif
@@ -0,0 +1,311 @@
+// Description: Triangular matrix stored in the packed form
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef TriangularMatrix_HPP
+#define TriangularMatrix_HPP
+
+#include <algorithm>
+#include <iomanip>
+
+#include "libalgo/source/const/Const.h"
+
+#include "libalgo/source/exceptions/ErrorIndexOutOfBound.h"
+#include "libalgo/source/exceptions/ErrorMathMatrixNotSquare.h"
+#include "libalgo/source/exceptions/ErrorMathMatrixSingular.h"
+#include "libalgo/source/exceptions/ErrorMathMatrixDifferentSize.h"
+
+
+template <typename T>
+TriangularMatrix <T> ::TriangularMatrix ( const Matrix <T> &A, const TTriangularMatrix type_ ) :
+        size ( A.rows() ), type ( type_ ), items ( ( std::size_t ) A.rows() * ( A.rows() + 1 ) / 2 )
+{
+        //Rectangular matrix
+        if ( A.rows() != A.cols() )
+        {
+                throw ErrorMathMatrixNotSquare <Matrix <T> > ( "ErrorMathMatrixNotSquare: ", " invalid dimension of the matrix (rectangle matrix), can not create triangular matrix; (rows_count, columns_count):  ", A );
+        }
+
+        //Copy the triangle of A row by row, the rest of A is ignored
+        const T * a = A.data();
+
+        for ( unsigned int i = 0; i < size; i++ )
+        {
+                const unsigned int j1 = ( type == LowerTriangular ? 0 : i ), j2 = ( type == LowerTriangular ? i + 1 : size );
+                std::copy ( a + i * size + j1, a + i * size + j2, items.begin() + index ( i, j1 ) );
+        }
+}
+
+
+template <typename T>
+T TriangularMatrix <T> ::item ( const unsigned int row, const unsigned int col ) const
+{
+        return inside ( row, col ) ? ( *this ) ( row, col ) : T ( 0 );
+}
+
+
+template <typename T>
+Matrix <T> TriangularMatrix <T> ::full() const
+{
+        //Create dense matrix, items outside the triangle are zero
+        Matrix <T> A ( size, size );
+        T * a = A.data();
+
+        for ( unsigned int i = 0; i < size; i++ )
+        {
+                const unsigned int j1 = ( type == LowerTriangular ? 0 : i ), j2 = ( type == LowerTriangular ? i + 1 : size );
+                std::copy ( items.begin() + index ( i, j1 ), items.begin() + index ( i, j1 ) + ( j2 - j1 ), a + i * size + j1 );
+        }
+
+        return A;
+}
+
+
+template <typename T>
+TriangularMatrix <T> TriangularMatrix <T> ::trans() const
+{
+        //Lower matrix becomes upper and vice versa
+        TriangularMatrix <T> A ( size, type == LowerTriangular ? UpperTriangular : LowerTriangular );
+
+        for ( unsigned int i = 0; i < size; i++ )
+        {
+                const unsigned int j1 = ( type == LowerTriangular ? 0 : i ), j2 = ( type == LowerTriangular ? i + 1 : size );
+                const T * r = &items[index ( i, j1 )];
+
+                for ( unsigned int j = j1; j < j2; j++ )
+                {
+                        A.items[A.index ( j, i )] = r[j - j1];
+                }
+        }
+
+        return A;
+}
+
+
+template <typename T>
+Matrix <T> TriangularMatrix <T> ::operator * ( const Matrix <T> &B ) const
+{
+        //C(i, :) = sum A(i, k) * B(k, :) over the stored part of the row i
+        checkRows ( B, " different rows count. Cannot compute A * B. " );
+
+        const unsigned int q = B.cols();
+        Matrix <T> C ( size, q );
+        const T * b = B.data();
+        T * c = C.data();
+
+        for ( unsigned int i = 0; i < size; i++ )
+        {
+                const unsigned int k1 = ( type == LowerTriangular ? 0 : i ), k2 = ( type == LowerTriangular ? i + 1 : size );
+                const T * r = &items[index ( i, k1 )];
+                T * ci = c + i * q;
+
+                for ( unsigned int k = k1; k < k2; k++ )
+                {
+                        const T aik = r[k - k1];
+                        const T * bk = b + k * q;
+
+                        for ( unsigned int j = 0; j < q; j++ )
+                        {
+                                ci[j] += aik * bk[j];
+                        }
+                }
+        }
+
+        return C;
+}
+
+
+template <typename T>
+Matrix <T> TriangularMatrix <T> ::transMult ( const Matrix <T> &B ) const
+{
+        //C(k, :) = C(k, :) + A(i, k) * B(i, :) over the stored part of the row i, A' is not created
+        checkRows ( B, " different rows count. Cannot compute A' * B. " );
+
+        const unsigned int q = B.cols();
+        Matrix <T> C ( size, q );
+        const T * b = B.data();
+        T * c = C.data();
+
+        for ( unsigned int i = 0; i < size; i++ )
+        {
+                const unsigned int k1 = ( type == LowerTriangular ? 0 : i ), k2 = ( type == LowerTriangular ? i + 1 : size );
+                const T * r = &items[index ( i, k1 )];
+                const T * bi = b + i * q;
+
+                for ( unsigned int k = k1; k < k2; k++ )
+                {
+                        const T aik = r[k - k1];
+                        T * ck = c + k * q;
+
+                        for ( unsigned int j = 0; j < q; j++ )
+                        {
+                                ck[j] += aik * bi[j];
+                        }
+                }
+        }
+
+        return C;
+}
+
+
+template <typename T>
+void TriangularMatrix <T> ::solve ( Matrix <T> &B ) const
+{
+        //Forward (lower) or backward (upper) substitution for all columns of B
+        checkRows ( B, " different rows count. Cannot solve A * X = B. " );
+
+        const unsigned int q = B.cols();
+        T * x = B.data();
+
+        for ( unsigned int l = 0; l < size; l++ )
+        {
+                //Lower matrix: rows 0 .. n - 1, upper matrix: rows n - 1 .. 0
+                const unsigned int i = ( type == LowerTriangular ? l : size - l - 1 );
+                const unsigned int k1 = ( type == LowerTriangular ? 0 : i + 1 ), k2 = ( type == LowerTriangular ? i : size );
+                const T * r = &items[index ( i, type == LowerTriangular ? 0 : i )];
+                const T aii = ( type == LowerTriangular ? r[i] : r[0] );
+                T * xi = x + i * q;
+
+                //Singular matrix
+                if ( aii == 0 )
+                {
+                        throw ErrorMathMatrixSingular <Matrix <T> > ( "ErrorMathMatrixSingular: ", " singular triangular matrix, cannot solve A * X = B; (rows_count, columns_count):  ", B );
+                }
+
+                //X(i, :) = (B(i, :) - sum A(i, k) * X(k, :)) / A(i, i)
+                for ( unsigned int k = k1; k < k2; k++ )
+                {
+                        const T aik = ( type == LowerTriangular ? r[k] : r[k - i] );
+                        const T * xk = x + k * q;
+
+                        for ( unsigned int j = 0; j < q; j++ )
+                        {
+                                xi[j] -= aik * xk[j];
+                        }
+                }
+
+                for ( unsigned int j = 0; j < q; j++ )
+                {
+                        xi[j] /= aii;
+                }
+        }
+}
+
+
+template <typename T>
+void TriangularMatrix <T> ::solveTrans ( Matrix <T> &B ) const
+{
+        //Substitution with A' processed by the rows of A: lower matrix from the last row, upper matrix from the first row
+        checkRows ( B, " different rows count. Cannot solve A' * X = B. " );
+
+        const unsigned int q = B.cols();
+        T * x = B.data();
+
+        for ( unsigned int l = 0; l < size; l++ )
+        {
+                const unsigned int i = ( type == LowerTriangular ? size - l - 1 : l );
+                const unsigned int k1 = ( type == LowerTriangular ? 0 : i + 1 ), k2 = ( type == LowerTriangular ? i : size );
+                const T * r = &items[index ( i, type == LowerTriangular ? 0 : i )];
+                const T aii = ( type == LowerTriangular ? r[i] : r[0] );
+                T * xi = x + i * q;
+
+                //Singular matrix
+                if ( aii == 0 )
+                {
+                        throw ErrorMathMatrixSingular <Matrix <T> > ( "ErrorMathMatrixSingular: ", " singular triangular matrix, cannot solve A' * X = B; (rows_count, columns_count):  ", B );
+                }
+
+                //X(i, :) is final, eliminate it from the remaining rows: X(k, :) = X(k, :) - A(i, k) * X(i, :)
+                for ( unsigned int j = 0; j < q; j++ )
+                {
+                        xi[j] /= aii;
+                }
+
+                for ( unsigned int k = k1; k < k2; k++ )
+                {
+                        const T aik = ( type == LowerTriangular ? r[k] : r[k - i] );
+                        T * xk = x + k * q;
+
+                        for ( unsigned int j = 0; j < q; j++ )
+                        {
+                                xk[j] -= aik * xi[j];
+                        }
+                }
+        }
+}
+
+
+template <typename T>
+void TriangularMatrix <T> ::print ( std::ostream * output ) const
+{
+        full().print ( output );
+}
+
+
+template <typename T>
+T & TriangularMatrix <T> :: operator() ( const unsigned int row, const unsigned int col )
+{
+        //Matrix dimemension invalid, throw exception
+        if ( ( row >= size ) || ( col >= size ) )
+        {
+                throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "invalid dimension of the matrix (row or col > size), row = " );
+        }
+
+        //Item outside the triangle is not stored
+        if ( !inside ( row, col ) )
+        {
+                throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "item outside the triangle of the triangular matrix, row = " );
+        }
+
+        return items[index ( row, col )];
+}
+
+
+template <typename T>
+T const & TriangularMatrix <T> :: operator() ( const unsigned int row, const unsigned int col ) const
+{
+        //Matrix dimemension invalid, throw exception
+        if ( ( row >= size ) || ( col >= size ) )
+        {
+                throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "invalid dimension of the matrix (row or col > size), row = " );
+        }
+
+        //Item outside the triangle is not stored
+        if ( !inside ( row, col ) )
+        {
+                throw ErrorIndexOutOfBound ( "ErrorIndexOutOfBound: ", "item outside the triangle of the triangular matrix, row = " );
+        }
+
+        return items[index ( row, col )];
+}
+
+
+template <typename T>
+void TriangularMatrix <T> ::checkRows ( const Matrix <T> &B, const char * function_text ) const
+{
+        //Matrix dimemension invalid, throw exception
+        if ( B.rows() != size )
+        {
+                throw ErrorMathMatrixDifferentSize <Matrix <T> > ( "ErrorMathMatrixDifferentSize: ", function_text, full(), B );
+        }
+}
+
+#endif
@@ -74,7 +74,7 @@ class Node3DCartesian: virtual public Point3DCartesian <T>
         public:
                 //Other functions
                 virtual void print ( std::ostream * file = &std::cout ) const;
-                virtual Node3DCartesian <T> *clone() {return new Node3DCartesian <T> ( this->point_label, this->x, this->y, this->z, this->half_edge, this->face );}
+                virtual Node3DCartesian <T> *clone() {return new Node3DCartesian <T> ( this->getPointLabel(), this->x, this->y, this->z, this->half_edge, this->face );}
 };
 
 #include "Node3DCartesian.hpp"
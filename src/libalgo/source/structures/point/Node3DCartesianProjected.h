@@ -105,7 +105,7 @@ class Node3DCartesianProjected : public Node3DCartesian <T>, public Point3DCarte
 
                 virtual Node3DCartesianProjected <T> *clone()
                 {
-                        return new Node3DCartesianProjected <T> ( this->point_label, this->x, this->y, this->z,
+                        return new Node3DCartesianProjected <T> ( this->getPointLabel(), this->x, this->y, this->z,
                                         this->h, this->k, this->s, this->theta, this->tiss, this->w, this->half_edge, this->face, this->parallel_point_index_prev,
                                         this->parallel_point_index_prev, this->meridian_point_index_prev, this->meridian_point_index_next );
                 }
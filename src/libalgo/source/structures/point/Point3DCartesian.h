@@ -26,17 +26,22 @@
 #include <ostream>
 #include <iomanip>
 
+#include "libalgo/source/structures/list/MemoryPool.h"
+
+#include "PointLabels.h"
+
 
 //2D Point in Cartesian coordinates (x, y)
+//Points and all derived nodes are allocated in the memory pools
 template <typename T>
-class Point3DCartesian
+class Point3DCartesian : public PoolAllocated
 {
         private:
-                static unsigned int points_cart_id_counter;	//Static variable: counter of created points
+                static unsigned int points_cart_id_counter;	//Static variable: counter of created points (incremented atomically)
 
         protected:
                 unsigned int point_id;				//Internal point ID (start from 0)
-                char * point_label;				//Point label ( or point ID ) loaded from file ( may contain alphanumeric characters )
+                unsigned int point_label;			//Handle of the point label ( or point ID ) loaded from file in the table of interned labels ( 0 = no label )
                 T x;						//Point x coordinate
                 T y;						//Point y coordinate
                 T z;						//Point z coordinate
@@ -47,39 +52,44 @@ class Point3DCartesian
 
         public:
                 //Constructors
-                Point3DCartesian () : point_id ( points_cart_id_counter ++ ), point_label ( NULL ), x ( 0 ),  y ( 0 ), z ( 0 ) {}
-                Point3DCartesian ( const T x_, const T y_, const T z_ = 0 ) : point_id ( points_cart_id_counter ++ ), point_label ( NULL ), x ( x_ ), y ( y_ ), z ( z_ ) {}
-                Point3DCartesian ( const char * point_label_, const T x_, const T y_, const T z_ = 0 );
-                Point3DCartesian ( const Point3DCartesian <T> *p );
-                Point3DCartesian ( const Point3DCartesian <T> &p );
-                virtual ~Point3DCartesian();
+                Point3DCartesian () : point_id ( getNewPointIDs() ), point_label ( 0 ), x ( 0 ),  y ( 0 ), z ( 0 ) {}
+                Point3DCartesian ( const T x_, const T y_, const T z_ = 0 ) : point_id ( getNewPointIDs() ), point_label ( 0 ), x ( x_ ), y ( y_ ), z ( z_ ) {}
+                Point3DCartesian ( const char * point_label_, const T x_, const T y_, const T z_ = 0 ) : point_id ( getNewPointIDs() ), point_label ( PointLabels::getHandle ( point_label_ ) ),
+                        x ( x_ ), y ( y_ ), z ( z_ ) {}
+                Point3DCartesian ( const Point3DCartesian <T> *p ) : point_id ( p->point_id ), point_label ( p->point_label ), x ( p->x ), y ( p->y ), z ( p->z ) {}
+                virtual ~Point3DCartesian() {}
 
         public:
                 //Operators
-                Point3DCartesian & operator = ( const Point3DCartesian <T> &p );
                 bool operator == ( const Point3DCartesian <T> &p ) const;
                 bool operator != ( const Point3DCartesian <T> &p ) const {return ! ( *this == p );}
 
         public:
                 //Other functions
                 unsigned int getPointID() const {return point_id; }
-                char * getPointLabel() const {return point_label; }
+                const char * getPointLabel() const {return PointLabels::getLabel ( point_label ); }
+                unsigned int getPointLabelHandle() const {return point_label; }
 
                 T getX() const {return x;}
                 T getY() const {return y;}
                 T getZ() const {return z;}
                 T getCoordinate ( bool swap ) const {return ( swap ? y : x );}
 
-                void updateID () {point_id = points_cart_id_counter ++;}
-                void setPointLabel ( const char * point_label_ );
+                void updateID () {point_id = getNewPointIDs();}
+                void setPointID ( const unsigned int point_id_ ) {point_id = point_id_;}
+                void setPointLabel ( const char * point_label_ ) {point_label = PointLabels::getHandle ( point_label_ );}
                 void setX ( const T x_ ) {x = x_;}
                 void setY ( const T y_ ) {y = y_;}
                 void setZ ( const T z_ ) {z = z_;}
 
+        public:
+                //Reserve n consecutive point IDs, return the first one (thread safe)
+                static unsigned int getNewPointIDs ( const unsigned int n = 1 );
+
         public:
                 //Virtual functions
                 virtual void print ( std::ostream * output = &std::cout ) const;
-                virtual Point3DCartesian <T> *clone() const {return new Point3DCartesian <T> ( this->point_label, this->x, this->y, this->z );}
+                virtual Point3DCartesian <T> *clone() const {return new Point3DCartesian <T> ( this->getPointLabel(), this->x, this->y, this->z );}
 };
 
 
@@ -23,8 +23,6 @@
 #define Point3DCartesian_HPP
 
 
-#include <string.h>
-
 #include "libalgo/source/const/Const.h"
 
 
@@ -34,93 +32,23 @@ unsigned int Point3DCartesian <T>::points_cart_id_counter = 0;
 
 
 template <typename T>
-Point3DCartesian <T>::Point3DCartesian ( const char * point_label_, const T x_, const T y_, const T z_ ) : point_id ( points_cart_id_counter ++ ), x ( x_ ), y ( y_ ), z ( z_ )
+unsigned int Point3DCartesian <T>::getNewPointIDs ( const unsigned int n )
 {
-        if ( point_label_ != NULL )
-        {
-                point_label = new char [ strlen ( point_label_ ) + 1 ];
-                strcpy ( point_label, point_label_ );
-        }
-
-        else
-        {
-                point_label = NULL;
-        }
-}
-
-
-template <typename T>
-Point3DCartesian <T>::Point3DCartesian ( const Point3DCartesian <T> *p ) : point_id ( p->point_id ), x ( p->x ), y ( p->y ), z ( p->z )
-{
-        if ( p->point_label != NULL )
-        {
-                point_label = new char [ strlen ( p->point_label ) + 1 ];
-                strcpy ( point_label, p->point_label );
-        }
+        //Reserve n consecutive IDs, points may be created by several threads
+        unsigned int point_id;
 
-        else
-        {
-                point_label = NULL;
-        }
-}
-
-
-template <typename T>
-Point3DCartesian <T>::Point3DCartesian ( const Point3DCartesian <T> &p ) : point_id ( p.point_id ), x ( p.x ), y ( p.y ), z ( p.z )
-{
-        if ( p.point_label != NULL )
-        {
-                point_label = new char [ strlen ( p.point_label ) + 1 ];
-                strcpy ( point_label, p.point_label );
-        }
-
-        else
-        {
-                point_label = NULL;
-        }
-}
-
-
-template <typename T>
-Point3DCartesian <T> & Point3DCartesian <T> ::operator = ( const Point3DCartesian <T> &p )
-{
-        if ( this != &p )
+#ifdef _OPENMP
+        #pragma omp atomic capture
+#endif
         {
-                point_id = p.point_id;
-
-                if ( point_label != NULL )
-                {
-                        delete [] point_label;
-                        point_label = NULL;
-                }
-
-                if ( p.point_label != NULL )
-                {
-                        point_label = new char [ strlen ( p.point_label ) + 1 ];
-                        strcpy ( point_label, p.point_label );
-                }
-
-                x = p.x;
-                y = p.y;
-                z = p.z;
+                point_id = points_cart_id_counter;
+                points_cart_id_counter += n;
         }
 
-        return *this;
-}
-
-
-template <typename T>
-Point3DCartesian<T>:: ~Point3DCartesian()
-{
-        if ( point_label != NULL )
-        {
-                delete [] point_label;
-                point_label = NULL;
-        }
+        return point_id;
 }
 
 
-
 template <typename T>
 bool Point3DCartesian <T>::operator == ( const Point3DCartesian <T> &p ) const
 {
@@ -128,22 +56,6 @@ bool Point3DCartesian <T>::operator == ( const Point3DCartesian <T> &p ) const
 }
 
 
-template <typename T>
-void Point3DCartesian <T>::setPointLabel ( const char * point_label_ )
-{
-        if ( point_label != NULL )
-        {
-                delete [] point_label;
-        }
-
-        if ( point_label_ != NULL )
-        {
-                point_label = new char [ strlen ( point_label_ ) + 1 ];
-                strcpy ( point_label, point_label_ );
-        }
-}
-
-
 template <typename T>
 void Point3DCartesian <T>::print ( std::ostream * output ) const
 {
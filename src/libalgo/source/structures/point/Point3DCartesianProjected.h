@@ -90,7 +90,7 @@ class Point3DCartesianProjected : virtual public Point3DCartesian <T>
 
                 virtual Point3DCartesianProjected <T> *clone() const
                 {
-                        return new Point3DCartesianProjected <T> ( this->point_label, this->x, this->y, this->z,
+                        return new Point3DCartesianProjected <T> ( this->getPointLabel(), this->x, this->y, this->z,
                                         this->h, this->k, this->s, this->theta, this->tiss, this->w ) ;
                 }
 };
@@ -28,17 +28,19 @@
 #include <ostream>
 #include <iomanip>
 
+#include "PointLabels.h"
+
 
 //3D geographic point (lat, lon, elevation)
 template <typename T>
 class Point3DGeographic
 {
         private:
-                static unsigned int points_geo_id_counter;	//Static variable: counter of created points
+                static unsigned int points_geo_id_counter;	//Static variable: counter of created points (incremented atomically)
 
         protected:
                 unsigned int point_id;				//Internal point ID (start from 0)
-                char * point_label;				//Point label ( or point ID ) loaded from file ( may contain alphanumeric characters )
+                unsigned int point_label;			//Handle of the point label ( or point ID ) loaded from file in the table of interned labels ( 0 = no label )
                 T lat;						//Point latitude
                 T lon;						//Point longitude
                 T H;						//Point height
@@ -49,37 +51,41 @@ class Point3DGeographic
 
         public:
                 //Constructors
-                Point3DGeographic() : point_id ( points_geo_id_counter ++ ), point_label ( NULL ), lat ( 0 ), lon ( 0 ), H ( 0 ) {}
-                Point3DGeographic ( const T lat_, const T lon_, const T H_ = 0 ) : point_id ( points_geo_id_counter ++ ), point_label ( NULL ), lat ( lat_ ), lon ( lon_ ), H ( H_ ) { }
-                Point3DGeographic ( const char * point_label_, const T lat_, const T lon_, const T H_ = 0 );
-                Point3DGeographic ( const Point3DGeographic <T> *p );
-                Point3DGeographic ( const Point3DGeographic <T> &p );
-                virtual ~Point3DGeographic();
+                Point3DGeographic() : point_id ( getNewPointIDs() ), point_label ( 0 ), lat ( 0 ), lon ( 0 ), H ( 0 ) {}
+                Point3DGeographic ( const T lat_, const T lon_, const T H_ = 0 ) : point_id ( getNewPointIDs() ), point_label ( 0 ), lat ( lat_ ), lon ( lon_ ), H ( H_ ) { }
+                Point3DGeographic ( const char * point_label_, const T lat_, const T lon_, const T H_ = 0 ) : point_id ( getNewPointIDs() ), point_label ( PointLabels::getHandle ( point_label_ ) ),
+                        lat ( lat_ ), lon ( lon_ ), H ( H_ ) { }
+                Point3DGeographic ( const Point3DGeographic <T> *p ) : point_id ( p->point_id ), point_label ( p->point_label ), lat ( p->lat ), lon ( p->lon ), H ( p->H ) { }
+                virtual ~Point3DGeographic() {}
 
         public:
                 //Operators
-                Point3DGeographic & operator = ( const Point3DGeographic <T> &p );
                 bool operator == ( const Point3DGeographic <T> &p ) const;
                 bool operator != ( const Point3DGeographic <T> &p ) const {return ! ( *this == p );}
 
         public:
                 //Other methods
-                unsigned short getPointID() const {return point_id;}
-                char * getPointLabel() const {return point_label; }
+                unsigned int getPointID() const {return point_id;}
+                const char * getPointLabel() const {return PointLabels::getLabel ( point_label ); }
+                unsigned int getPointLabelHandle() const {return point_label; }
                 T getLat() const {return lat;}
                 T getLon() const {return lon;}
                 T getH() const {return H;}
 
-                void updateID () {point_id = points_geo_id_counter ++;}
+                void updateID () {point_id = getNewPointIDs();}
                 void setPointID ( const unsigned int point_id_ )  {point_id = point_id_;}
-                void setPointLabel ( const char * point_label_ );
+                void setPointLabel ( const char * point_label_ ) {point_label = PointLabels::getHandle ( point_label_ );}
                 void setLat ( const T lat_ ) {lat = lat_;}
                 void setLon ( const T lon_ ) {lon = lon_;}
                 void setH ( const T H_ ) {H = H_;}
 
+        public:
+                //Reserve n consecutive point IDs, return the first one (thread safe)
+                static unsigned int getNewPointIDs ( const unsigned int n = 1 );
+
         public:
                 virtual void print ( std::ostream * output = &std::cout ) const;
-                virtual Point3DGeographic <T> *clone() const {return new Point3DGeographic <T> ( this->point_label, this->lat, this->lon, this->H ) ;}
+                virtual Point3DGeographic <T> *clone() const {return new Point3DGeographic <T> ( this->getPointLabel(), this->lat, this->lon, this->H ) ;}
 };
 
 #include "Point3DGeographic.hpp"
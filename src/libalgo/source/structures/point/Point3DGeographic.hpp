@@ -22,8 +22,6 @@
 #ifndef Point3DGeographic_HPP
 #define Point3DGeographic_HPP
 
-#include <string.h>
-
 #include "libalgo/source/const/Const.h"
 
 
@@ -33,78 +31,20 @@ unsigned int Point3DGeographic <T>::points_geo_id_counter = 0;
 
 
 template <typename T>
-Point3DGeographic <T> ::Point3DGeographic ( const char * point_label_, const T lat_, const T lon_, const T H_ ) : point_id ( points_geo_id_counter ++ ), lat ( lat_ ), lon ( lon_ ), H ( H_ )
-{
-        if ( point_label_ != NULL )
-        {
-                point_label = new char [ strlen ( point_label_ ) + 1 ];
-                strcpy ( point_label, point_label_ );
-        }
-
-        else
-        {
-                point_label = NULL;
-        }
-}
-
-
-template <typename T>
-Point3DGeographic <T> ::Point3DGeographic ( const Point3DGeographic <T> *p ) : point_id ( p->point_id ), lat ( p->lat ), lon ( p->lon ), H ( p->H )
-{
-        if ( p->point_label != NULL )
-        {
-                point_label = new char [ strlen ( p->point_label ) + 1 ];
-                strcpy ( point_label, p->point_label );
-        }
-
-        else
-        {
-                point_label = NULL;
-        }
-}
-
-
-template <typename T>
-Point3DGeographic <T> ::Point3DGeographic ( const Point3DGeographic <T> &p ) : point_id ( p.point_id ), lat ( p.lat ), lon ( p.lon ), H ( p.H )
+unsigned int Point3DGeographic <T>::getNewPointIDs ( const unsigned int n )
 {
-        if ( p.point_label != NULL )
-        {
-                point_label = new char [ strlen ( p.point_label ) + 1 ];
-                strcpy ( point_label, p.point_label );
-        }
-
-        else
-        {
-                point_label = NULL;
-        }
-}
+        //Reserve n consecutive IDs, points may be created by several threads
+        unsigned int point_id;
 
-
-template <typename T>
-Point3DGeographic <T> & Point3DGeographic <T> ::operator = ( const Point3DGeographic <T> &p )
-{
-        if ( this != &p )
+#ifdef _OPENMP
+        #pragma omp atomic capture
+#endif
         {
-                point_id = p.point_id;
-
-                if ( point_label != NULL )
-                {
-                        delete [] point_label;
-                        point_label = NULL;
-                }
-
-                if ( p.point_label != NULL )
-                {
-                        point_label = new char [ strlen ( p.point_label ) + 1 ];
-                        strcpy ( point_label, p.point_label );
-                }
-
-                lat = p.lat;
-                lon = p.lon;
-                H = p.H;
+                point_id = points_geo_id_counter;
+                points_geo_id_counter += n;
         }
 
-        return *this;
+        return point_id;
 }
 
 
@@ -115,17 +55,6 @@ bool Point3DGeographic <T> ::operator == ( const Point3DGeographic <T> &p ) cons
 }
 
 
-template <typename T>
-Point3DGeographic<T>:: ~Point3DGeographic()
-{
-        if ( point_label != NULL )
-        {
-                delete point_label;
-                point_label = NULL;
-        }
-}
-
-
 template <typename T>
 void Point3DGeographic <T>::print ( std::ostream * output ) const
 {
@@ -134,20 +63,4 @@ void Point3DGeographic <T>::print ( std::ostream * output ) const
         *output << point_id << "   "  << lat << "   " << lon  << "   " << H << '\n';
 }
 
-
-template <typename T>
-void Point3DGeographic <T>::setPointLabel ( const char * point_label_ )
-{
-        if ( point_label != NULL )
-        {
-                delete [] point_label;
-        }
-
-        if ( point_label_ != NULL )
-        {
-                point_label = new char [ strlen ( point_label_ ) + 1 ];
-                strcpy ( point_label, point_label_ );
-        }
-}
-
 #endif
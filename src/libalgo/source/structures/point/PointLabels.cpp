@@ -0,0 +1,104 @@
+#include "PointLabels.h"
+
+#include <deque>
+#include <map>
+#include <string>
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+
+
+//Interned labels (references to stored strings remain valid when the deque grows) and their handles
+//Tables are created on the first use, they may be used by constructors of static points
+static std::deque <std::string> & getLabels()
+{
+        static std::deque <std::string> labels ( 1 );
+        return labels;
+}
+
+
+static std::map <std::string, unsigned int> & getHandles()
+{
+        static std::map <std::string, unsigned int> handles;
+        return handles;
+}
+
+
+unsigned int PointLabels::getHandle ( const char * label )
+{
+        //Get handle of the label, store the label if it has not been interned yet
+        if ( label == NULL )
+        {
+                return 0;
+        }
+
+        unsigned int handle = 0;
+
+        //Tables are shared by all threads
+#ifdef _OPENMP
+        #pragma omp critical ( PointLabels )
+#endif
+        {
+                std::deque <std::string> &labels = getLabels();
+                std::map <std::string, unsigned int> &handles = getHandles();
+
+                std::pair <std::map <std::string, unsigned int>::iterator, bool> result = handles.insert ( std::make_pair ( std::string ( label ), ( unsigned int ) labels.size() ) );
+
+                //New label
+                if ( result.second )
+                {
+                        labels.push_back ( result.first->first );
+                }
+
+                handle = result.first->second;
+        }
+
+        return handle;
+}
+
+
+const char * PointLabels::getLabel ( const unsigned int handle )
+{
+        //Get interned label, no label for the handle 0
+        if ( handle == 0 )
+        {
+                return NULL;
+        }
+
+        const char * label = NULL;
+
+#ifdef _OPENMP
+        #pragma omp critical ( PointLabels )
+#endif
+        {
+                const std::deque <std::string> &labels = getLabels();
+
+                if ( handle < labels.size() )
+                {
+                        label = labels[handle].c_str();
+                }
+        }
+
+        //Throw exception
+        if ( label == NULL )
+        {
+                throw ErrorBadData ( "ErrorBadData: can not get point label, ", "invalid handle." );
+        }
+
+        return label;
+}
+
+
+unsigned int PointLabels::getLabelsCount()
+{
+        //Count of interned labels
+        unsigned int count = 0;
+
+#ifdef _OPENMP
+        #pragma omp critical ( PointLabels )
+#endif
+        {
+                count = getLabels().size() - 1;
+        }
+
+        return count;
+}
@@ -0,0 +1,38 @@
+// Description: Table of interned point labels shared by all points
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef PointLabels_H
+#define PointLabels_H
+
+
+//Table of interned point labels: each distinct label is stored only once and referenced by a 32-bit handle
+//Handle 0 represents no label, interned labels are never released
+//Points copy handles only, a copy of the point does not allocate any memory
+class PointLabels
+{
+        public:
+                static unsigned int getHandle ( const char * label );
+                static const char * getLabel ( const unsigned int handle );
+                static unsigned int getLabelsCount();
+};
+
+#endif
@@ -0,0 +1 @@
+#include "FlatKDTree.h"
\ No newline at end of file
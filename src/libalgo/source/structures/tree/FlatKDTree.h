@@ -0,0 +1,102 @@
+// Description: Flat array-backed KD-tree (2D) with leaf buckets
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef FlatKDTree2D_H
+#define FlatKDTree2D_H
+
+#include <vector>
+#include <utility>
+
+#include "libalgo/source/const/Const.h"
+
+#include "libalgo/source/structures/list/Container.h"
+
+
+//Node of the flat KD tree: nodes are stored in the array in the build order (pre-order), the left child follows its parent
+//Each node covers the continuous range of points [begin, end), leaves (right = 0) store buckets of at most bucket_size points
+template <typename T>
+struct TFlatKDNode
+{
+        T split_value;				//Splitting value
+        unsigned int begin;			//First point of the subtree
+        unsigned int end;			//Behind the last point of the subtree
+        unsigned int right;			//Index of the right child, 0 for the leaf
+        unsigned int split_axis;		//Splitting coordinate: 0 = x, 1 = y
+
+        TFlatKDNode ( const unsigned int begin_, const unsigned int end_ ) : split_value ( 0 ), begin ( begin_ ), end ( end_ ), right ( 0 ), split_axis ( 0 ) {}
+
+        bool isLeaf() const {return right == 0;}
+};
+
+
+//Class storing KD tree 2D in the flat arrays: drop-in alternative to KDTree2D for findNN/findAllKNN
+//Nodes do not store points: coordinates of points are copied into contiguous arrays x, y ordered by leaves,
+//leaf buckets are scanned sequentially, the traversal uses an explicit stack instead of the recursion
+template <typename Point>
+class FlatKDTree2D
+{
+        private:
+                std::vector <TFlatKDNode <typename Point::Type> > nodes;	//Nodes in the pre-order, root at the index 0
+                std::vector <typename Point::Type> x;				//X coordinates of points ordered by leaves
+                std::vector <typename Point::Type> y;				//Y coordinates of points ordered by leaves
+                std::vector <Point *> points;					//Points ordered by leaves
+                std::vector <unsigned int> indices;				//Indices of points in the source container ordered by leaves
+                std::vector <typename Point::Type> boxes;			//Bounding boxes of nodes (x_min, y_min, x_max, y_max)
+                unsigned int bucket_size;					//Maximum points in the leaf
+
+                template <typename Point2>
+                friend class FlatKDTree2D;
+
+        public:
+                FlatKDTree2D ( const unsigned int bucket_size_ = KD_TREE_BUCKET_SIZE ) : nodes(), x(), y(), points(), indices(), boxes(), bucket_size ( bucket_size_ > 0 ? bucket_size_ : 1 ) {}
+
+        public:
+                void createKDTree2D ( const Container <Point *> &pl, const bool print_exception = true );
+                void clearKDTree2D();
+                unsigned int getNodesCount() const { return nodes.size();}
+                unsigned int getPointsCount() const { return points.size();}
+
+        public:
+                template <typename Point2>
+                Point * findNN ( const Point2 * point ) const;
+
+                template <typename Point2>
+                void findAllKNN ( const Point2 * point, Container <Point *, NonDestructable> &knn, unsigned int k ) const;
+
+                template <typename Point2>
+                void findAllNN ( const FlatKDTree2D <Point2> &tree, std::vector <Point *> &nn, std::vector <typename Point::Type> *distances = NULL ) const;
+
+        private:
+                unsigned int buildNode ( std::vector <unsigned int> &indices, const std::vector <typename Point::Type> *coordinates, const unsigned int begin, const unsigned int end );
+
+                void buildBox ( const unsigned int node );
+
+                typename Point::Type getBoxDist2 ( const unsigned int node, const typename Point::Type * box ) const;
+
+                template <typename Point2>
+                void findAllNNNodes ( const FlatKDTree2D <Point2> &tree, const unsigned int query_node, const unsigned int node, std::vector <typename Point::Type> &nn_dist,
+                                      std::vector <unsigned int> &nn, std::vector <typename Point::Type> &bounds ) const;
+};
+
+#include "FlatKDTree.hpp"
+
+#endif
@@ -0,0 +1,492 @@
+// Description: Flat array-backed KD-tree (2D) with leaf buckets
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef FlatKDTree2D_HPP
+#define FlatKDTree2D_HPP
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+#include "libalgo/source/comparators/indexComp.h"
+
+#include "libalgo/source/exceptions/ErrorBadOutput.h"
+
+
+template <typename Point>
+void FlatKDTree2D <Point> ::createKDTree2D ( const Container <Point *> &pl, const bool )
+{
+        //Create flat KD tree, the container is not reordered (the build throws no exception, nothing is printed)
+        const unsigned int n = pl.size();
+
+        clearKDTree2D();
+
+        if ( n == 0 )
+        {
+                return;
+        }
+
+        //Copy coordinates into contiguous arrays
+        std::vector <typename Point::Type> coordinates[2];
+        coordinates[0].resize ( n );
+        coordinates[1].resize ( n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                coordinates[0][i] = pl [i]->getX();
+                coordinates[1][i] = pl [i]->getY();
+        }
+
+        //Indices of points, permuted during the build
+        std::vector <unsigned int> indices ( n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                indices[i] = i;
+        }
+
+        //Balanced tree: (2 * n / bucket_size) nodes at most
+        nodes.reserve ( 2 * ( n / bucket_size + 1 ) );
+
+        //Build KD tree
+        buildNode ( indices, coordinates, 0, n );
+
+        //Store points and coordinates in the order of leaves
+        x.resize ( n );
+        y.resize ( n );
+        points.resize ( n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                x[i] = coordinates[0][indices[i]];
+                y[i] = coordinates[1][indices[i]];
+                points[i] = pl [indices[i]];
+        }
+
+        this->indices.swap ( indices );
+
+        //Compute bounding boxes of nodes
+        boxes.resize ( 4 * nodes.size() );
+        buildBox ( 0 );
+}
+
+
+template <typename Point>
+void FlatKDTree2D <Point> ::buildBox ( const unsigned int node )
+{
+        //Compute bounding box of the subtree
+        typename Point::Type * box = &boxes[4 * node];
+
+        //Leaf: bounding box of its points
+        if ( nodes[node].isLeaf() )
+        {
+                box[0] = box[2] = x[nodes[node].begin];
+                box[1] = box[3] = y[nodes[node].begin];
+
+                for ( unsigned int i = nodes[node].begin + 1; i < nodes[node].end; i++ )
+                {
+                        box[0] = std::min ( box[0], x[i] );
+                        box[1] = std::min ( box[1], y[i] );
+                        box[2] = std::max ( box[2], x[i] );
+                        box[3] = std::max ( box[3], y[i] );
+                }
+
+                return;
+        }
+
+        //Join bounding boxes of the left and right subtrees
+        buildBox ( node + 1 );
+        buildBox ( nodes[node].right );
+
+        const typename Point::Type * box_left = &boxes[4 * ( node + 1 )], *box_right = &boxes[4 * nodes[node].right];
+
+        box[0] = std::min ( box_left[0], box_right[0] );
+        box[1] = std::min ( box_left[1], box_right[1] );
+        box[2] = std::max ( box_left[2], box_right[2] );
+        box[3] = std::max ( box_left[3], box_right[3] );
+}
+
+
+template <typename Point>
+unsigned int FlatKDTree2D <Point> ::buildNode ( std::vector <unsigned int> &indices, const std::vector <typename Point::Type> *coordinates, const unsigned int begin, const unsigned int end )
+{
+        //Build the subtree of points [begin, end), return its index
+        const unsigned int node = nodes.size();
+        nodes.push_back ( TFlatKDNode <typename Point::Type> ( begin, end ) );
+
+        //Create leaf
+        if ( end - begin <= bucket_size )
+        {
+                return node;
+        }
+
+        //Find the bounding box of points
+        typename Point::Type x_min = coordinates[0][indices[begin]], x_max = x_min, y_min = coordinates[1][indices[begin]], y_max = y_min;
+
+        for ( unsigned int i = begin + 1; i < end; i++ )
+        {
+                const typename Point::Type xi = coordinates[0][indices[i]], yi = coordinates[1][indices[i]];
+
+                if ( xi < x_min ) x_min = xi;
+                else if ( xi > x_max ) x_max = xi;
+
+                if ( yi < y_min ) y_min = yi;
+                else if ( yi > y_max ) y_max = yi;
+        }
+
+        //Split by the coordinate of the larger extent
+        const unsigned int axis = ( x_max - x_min >= y_max - y_min ? 0 : 1 );
+
+        //Find median: points [begin, median) <= split value <= points [median, end)
+        const unsigned int median = begin + ( end - begin ) / 2;
+        std::nth_element ( indices.begin() + begin, indices.begin() + median, indices.begin() + end,
+                           indexComp <typename std::vector <typename Point::Type>::const_iterator> ( coordinates[axis].begin(), coordinates[axis].end() ) );
+
+        nodes[node].split_axis = axis;
+        nodes[node].split_value = coordinates[axis][indices[median]];
+
+        //Build left subtree, it follows the node
+        buildNode ( indices, coordinates, begin, median );
+
+        //Build right subtree
+        const unsigned int right = buildNode ( indices, coordinates, median, end );
+        nodes[node].right = right;
+
+        return node;
+}
+
+
+template <typename Point>
+void FlatKDTree2D <Point> ::clearKDTree2D()
+{
+        //Clear KD tree
+        nodes.clear();
+        x.clear();
+        y.clear();
+        points.clear();
+        indices.clear();
+        boxes.clear();
+}
+
+
+template <typename Point>
+template <typename Point2>
+Point * FlatKDTree2D <Point>::findNN ( const Point2 * point ) const
+{
+        //Find nearest neighbour and return containing point
+
+        //No KD-tree constructed
+        if ( nodes.empty() )
+        {
+                throw ErrorBadOutput ( "ErrorBadOutput: can not find nearest neighbour, ", "no KD-Tree has been constructed." );
+        }
+
+        const typename Point::Type qx = point->getX(), qy = point->getY();
+        typename Point::Type min_dist = std::numeric_limits <typename Point::Type>::max();
+        unsigned int nearest = 0;
+
+        //Stack of subtrees to be processed and the lower bound of the squared distance to their points, depth of the balanced tree <= 32
+        unsigned int stack_nodes[64];
+        typename Point::Type stack_dist[64];
+        unsigned int top = 0;
+
+        stack_nodes[top] = 0;
+        stack_dist[top++] = 0;
+
+        while ( top > 0 )
+        {
+                unsigned int node = stack_nodes[--top];
+
+                //Subtree is further than the nearest point
+                if ( stack_dist[top] >= min_dist )
+                {
+                        continue;
+                }
+
+                //Descend into the leaf containing q, remember further subtrees
+                while ( !nodes[node].isLeaf() )
+                {
+                        const TFlatKDNode <typename Point::Type> &n = nodes[node];
+                        const typename Point::Type diff = ( n.split_axis == 0 ? qx : qy ) - n.split_value;
+
+                        stack_nodes[top] = ( diff < 0 ? n.right : node + 1 );
+                        stack_dist[top++] = diff * diff;
+
+                        node = ( diff < 0 ? node + 1 : n.right );
+                }
+
+                //Scan points of the leaf
+                for ( unsigned int i = nodes[node].begin; i < nodes[node].end; i++ )
+                {
+                        const typename Point::Type dx = x[i] - qx, dy = y[i] - qy, dist = dx * dx + dy * dy;
+
+                        if ( dist < min_dist )
+                        {
+                                min_dist = dist;
+                                nearest = i;
+                        }
+                }
+        }
+
+        return points[nearest];
+}
+
+
+template <typename Point>
+template <typename Point2>
+void FlatKDTree2D <Point>::findAllKNN ( const Point2 * point, Container <Point *, NonDestructable > &knn, unsigned int k ) const
+{
+        //Find all k-nearest neighbours to the specified point, sorted by the distance
+
+        //No KD-tree constructed
+        if ( nodes.empty() )
+        {
+                throw ErrorBadOutput ( "ErrorBadOutput: can not find all k-nearest neighbour nodes, ", "no KD-Tree has been constructed." );
+        }
+
+        //Set new k
+        k = std::min ( k, ( unsigned int ) points.size() - 1 );
+
+        if ( k == 0 )
+        {
+                return;
+        }
+
+        const typename Point::Type qx = point->getX(), qy = point->getY();
+
+        //Max-heap of k nearest points (squared distance, index), the furthest one is on the top
+        std::vector <std::pair <typename Point::Type, unsigned int> > heap;
+        heap.reserve ( k );
+
+        //Stack of subtrees to be processed and the lower bound of the squared distance to their points
+        unsigned int stack_nodes[64];
+        typename Point::Type stack_dist[64];
+        unsigned int top = 0;
+
+        stack_nodes[top] = 0;
+        stack_dist[top++] = 0;
+
+        while ( top > 0 )
+        {
+                unsigned int node = stack_nodes[--top];
+
+                //Subtree is further than k-th nearest point
+                if ( ( heap.size() == k ) && ( stack_dist[top] >= heap.front().first ) )
+                {
+                        continue;
+                }
+
+                //Descend into the leaf containing q, remember further subtrees
+                while ( !nodes[node].isLeaf() )
+                {
+                        const TFlatKDNode <typename Point::Type> &n = nodes[node];
+                        const typename Point::Type diff = ( n.split_axis == 0 ? qx : qy ) - n.split_value;
+
+                        stack_nodes[top] = ( diff < 0 ? n.right : node + 1 );
+                        stack_dist[top++] = diff * diff;
+
+                        node = ( diff < 0 ? node + 1 : n.right );
+                }
+
+                //Scan points of the leaf
+                for ( unsigned int i = nodes[node].begin; i < nodes[node].end; i++ )
+                {
+                        const typename Point::Type dx = x[i] - qx, dy = y[i] - qy, dist = dx * dx + dy * dy;
+
+                        //There are free positions in the heap
+                        if ( heap.size() < k )
+                        {
+                                heap.push_back ( std::make_pair ( dist, i ) );
+                                std::push_heap ( heap.begin(), heap.end() );
+                        }
+
+                        //Replace the furthest point
+                        else if ( dist < heap.front().first )
+                        {
+                                std::pop_heap ( heap.begin(), heap.end() );
+                                heap.back() = std::make_pair ( dist, i );
+                                std::push_heap ( heap.begin(), heap.end() );
+                        }
+                }
+        }
+
+        //Copy nearest neighbours to the list, ascending distances
+        std::sort_heap ( heap.begin(), heap.end() );
+
+        for ( unsigned int i = 0; i < heap.size(); i++ )
+        {
+                knn.push_back ( points[heap[i].second] );
+        }
+}
+
+template <typename Point>
+template <typename Point2>
+void FlatKDTree2D <Point>::findAllNN ( const FlatKDTree2D <Point2> &tree, std::vector <Point *> &nn, std::vector <typename Point::Type> *distances ) const
+{
+        //Find nearest neighbour to each point of the other tree using the dual tree search: pairs of nodes are pruned by the distance of
+        //bounding boxes, results are stored in the order of the source container of the other tree, subtrees are processed in parallel
+        const unsigned int n = tree.points.size();
+
+        //No KD-tree constructed
+        if ( nodes.empty() || tree.nodes.empty() )
+        {
+                throw ErrorBadOutput ( "ErrorBadOutput: can not find all nearest neighbours, ", "no KD-Tree has been constructed." );
+        }
+
+        //Squared distances and indices of the nearest neighbours (query points ordered by leaves), upper bounds of nodes distances
+        std::vector <typename Point::Type> nn_dist ( n, std::numeric_limits <typename Point::Type>::max() );
+        std::vector <unsigned int> nn_index ( n, 0 );
+        std::vector <typename Point::Type> bounds ( tree.nodes.size(), std::numeric_limits <typename Point::Type>::max() );
+
+        //Split the query tree into independent subtrees
+        std::vector <unsigned int> subtrees, stack ( 1, 0 );
+        const unsigned int subtree_size = std::max ( bucket_size, n / KD_TREE_PARALLEL_SUBTREES );
+
+        while ( !stack.empty() )
+        {
+                const unsigned int node = stack.back();
+                stack.pop_back();
+
+                if ( tree.nodes[node].isLeaf() || tree.nodes[node].end - tree.nodes[node].begin <= subtree_size )
+                {
+                        subtrees.push_back ( node );
+                }
+
+                else
+                {
+                        stack.push_back ( tree.nodes[node].right );
+                        stack.push_back ( node + 1 );
+                }
+        }
+
+        //Process all subtrees
+        const int n_subtrees = subtrees.size();
+
+#ifdef _OPENMP
+        #pragma omp parallel for schedule ( dynamic, 1 ) if ( n >= KD_TREE_PARALLEL_QUERY_SIZE )
+#endif
+
+        for ( int i = 0; i < n_subtrees; i++ )
+        {
+                findAllNNNodes ( tree, subtrees[i], 0, nn_dist, nn_index, bounds );
+        }
+
+        //Copy results
+        nn.resize ( n );
+
+        if ( distances != NULL ) distances->resize ( n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                nn[tree.indices[i]] = points[nn_index[i]];
+
+                if ( distances != NULL ) ( *distances ) [tree.indices[i]] = sqrt ( nn_dist[i] );
+        }
+}
+
+
+template <typename Point>
+typename Point::Type FlatKDTree2D <Point>::getBoxDist2 ( const unsigned int node, const typename Point::Type * box ) const
+{
+        //Squared distance of the bounding box of the node and the box
+        const typename Point::Type * node_box = &boxes[4 * node];
+        const typename Point::Type dx = std::max ( std::max ( node_box[0] - box[2], box[0] - node_box[2] ), ( typename Point::Type ) 0 );
+        const typename Point::Type dy = std::max ( std::max ( node_box[1] - box[3], box[1] - node_box[3] ), ( typename Point::Type ) 0 );
+
+        return dx * dx + dy * dy;
+}
+
+
+template <typename Point>
+template <typename Point2>
+void FlatKDTree2D <Point>::findAllNNNodes ( const FlatKDTree2D <Point2> &tree, const unsigned int query_node, const unsigned int node, std::vector <typename Point::Type> &nn_dist,
+                std::vector <unsigned int> &nn, std::vector <typename Point::Type> &bounds ) const
+{
+        //Dual tree search for the pair (query node, node): bound of the query node is the largest distance to the nearest neighbour of its points
+        const typename Point::Type * query_box = &tree.boxes[4 * query_node];
+
+        //Nodes are too far: no point of the node is closer than the current nearest neighbours
+        if ( getBoxDist2 ( node, query_box ) >= bounds[query_node] )
+        {
+                return;
+        }
+
+        const TFlatKDNode <typename Point2::Type> &q = tree.nodes[query_node];
+        const TFlatKDNode <typename Point::Type> &r = nodes[node];
+
+        //Both nodes are leaves: compare all pairs of points
+        if ( q.isLeaf() && r.isLeaf() )
+        {
+                typename Point::Type bound = 0;
+
+                for ( unsigned int i = q.begin; i < q.end; i++ )
+                {
+                        const typename Point::Type qx = tree.x[i], qy = tree.y[i];
+                        typename Point::Type min_dist = nn_dist[i];
+
+                        for ( unsigned int j = r.begin; j < r.end; j++ )
+                        {
+                                const typename Point::Type dx = x[j] - qx, dy = y[j] - qy, dist = dx * dx + dy * dy;
+
+                                if ( dist < min_dist )
+                                {
+                                        min_dist = dist;
+                                        nn[i] = j;
+                                }
+                        }
+
+                        nn_dist[i] = min_dist;
+                        bound = std::max ( bound, min_dist );
+                }
+
+                bounds[query_node] = bound;
+        }
+
+        //Split the node: the query node is a leaf or it is smaller, the closer subtree is processed first
+        else if ( q.isLeaf() || ( !r.isLeaf() && r.end - r.begin >= q.end - q.begin ) )
+        {
+                const unsigned int left = node + 1, right = r.right;
+
+                if ( getBoxDist2 ( left, query_box ) <= getBoxDist2 ( right, query_box ) )
+                {
+                        findAllNNNodes ( tree, query_node, left, nn_dist, nn, bounds );
+                        findAllNNNodes ( tree, query_node, right, nn_dist, nn, bounds );
+                }
+
+                else
+                {
+                        findAllNNNodes ( tree, query_node, right, nn_dist, nn, bounds );
+                        findAllNNNodes ( tree, query_node, left, nn_dist, nn, bounds );
+                }
+        }
+
+        //Split the query node
+        else
+        {
+                findAllNNNodes ( tree, query_node + 1, node, nn_dist, nn, bounds );
+                findAllNNNodes ( tree, q.right, node, nn_dist, nn, bounds );
+
+                bounds[query_node] = std::max ( bounds[query_node + 1], bounds[q.right] );
+        }
+}
+
+#endif
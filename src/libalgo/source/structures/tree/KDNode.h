@@ -34,14 +34,15 @@ class KDNode
                 KDNode <Point> *right;			//Pointer to the right node
                 unsigned int depth;                     //Depth of the recursion
                 typename Point::Type split_value;       //Splitting value
+                bool erased;                            //Node is erased, it is kept only to split the space
 
         public:
-                KDNode() : data ( NULL ), left ( NULL ), right ( NULL ), depth ( 0 ), split_value ( 0 ) {}
-                KDNode ( Point * data_ ) : data ( data_ ), left ( NULL ), right ( NULL ), depth ( 0 ), split_value ( 0 )  {}
-                KDNode ( Point * data_, const unsigned int depth_ ) : data ( data_ ), left ( NULL ), right ( NULL ), depth ( depth_ ), split_value ( 0 )  {}
-                KDNode ( Point * data_, KDNode <Point> *left_, KDNode <Point> *right_ ) : data ( data_ ), left ( left_ ), right ( right_ ), depth ( 0 ), split_value ( 0 )  {}
+                KDNode() : data ( NULL ), left ( NULL ), right ( NULL ), depth ( 0 ), split_value ( 0 ), erased ( false ) {}
+                KDNode ( Point * data_ ) : data ( data_ ), left ( NULL ), right ( NULL ), depth ( 0 ), split_value ( 0 ), erased ( false ) {}
+                KDNode ( Point * data_, const unsigned int depth_ ) : data ( data_ ), left ( NULL ), right ( NULL ), depth ( depth_ ), split_value ( 0 ), erased ( false ) {}
+                KDNode ( Point * data_, KDNode <Point> *left_, KDNode <Point> *right_ ) : data ( data_ ), left ( left_ ), right ( right_ ), depth ( 0 ), split_value ( 0 ), erased ( false ) {}
                 KDNode ( Point * data_, KDNode <Point> *left_, KDNode <Point> *right_, const unsigned int depth_, const typename Point::Type split_value_ )
-                        : data ( data_ ), left ( left_ ), right ( right_ ), depth ( depth_ ), split_value ( split_value_ ) {}
+                        : data ( data_ ), left ( left_ ), right ( right_ ), depth ( depth_ ), split_value ( split_value_ ), erased ( false ) {}
                 ~KDNode() {data = NULL; left = NULL; right = NULL;}
 
         public:
@@ -50,12 +51,14 @@ class KDNode
                 KDNode <Point> *getRight() const {return right;}
                 unsigned int getDepth() const {return depth;}
                 typename Point::Type getSplitValue() const {return split_value;}
+                bool isErased() const {return erased;}
 
         public:
                 void setLeft ( KDNode <Point> *left_ ) {left = left_;}
                 void setRight ( KDNode <Point> *right_ ) {right = right_;}
                 void setDepth ( const unsigned int depth_ ) {depth = depth_;}
                 void setSplitValue ( const typename Point::Type split_value_ ) {split_value = split_value_;}
+                void setErased ( const bool erased_ ) {erased = erased_;}
 };
 
 #endif
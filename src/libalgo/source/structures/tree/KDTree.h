@@ -22,7 +22,8 @@
 #ifndef KDTree2D_H
 #define KDTree2D_H
 
-#include <set>
+#include <deque>
+#include <vector>
 #include <ostream>
 #include <iostream>
 
@@ -32,8 +33,6 @@
 template <typename T>
 class KDNode;
 
-class TIndexList;
-
 //Structure for the BFS/DFS processing of the KD tree, storing KD node and its priority
 template <typename Point>
 struct TKDNodePriority
@@ -52,11 +51,11 @@ struct TKDNodePriority
 };
 
 
-//New user type, multiset of sorted nearest points ( some points could have same distances from q )
+//New user type, bounded max-heap of k nearest points ( the furthest one is on the top, capacity reserved before the search )
 template <typename Point>
 struct TNNeighboursList
 {
-        typedef std::multiset < TKDNodePriority <Point> > Type;
+        typedef std::vector < TKDNodePriority <Point> > Type;
 };
 
 
@@ -75,19 +74,24 @@ class KDTree2D
 {
         private:
                 KDNode <Point> *root;				//Root of the KD tree
-                unsigned int nodes_count;       		//Nodes count of the KD tree
+                unsigned int nodes_count;       		//Nodes count of the KD tree (erased nodes are not counted)
+                unsigned int erased_count;			//Nodes marked as erased, still present in the tree
+                std::deque <KDNode <Point> > nodes;		//Storage of the KD nodes (allocated at once, addresses are stable)
 
         public:
-                KDTree2D () : root ( NULL ), nodes_count ( 0 ) {}
+                KDTree2D () : root ( NULL ), nodes_count ( 0 ), erased_count ( 0 ) {}
                 ~KDTree2D() { clearKDTree2D(); }
 
         public:
-                void createKDTree2D ( Container <Point *> &pl, const bool print_exception = true );
+                void createKDTree2D ( const Container <Point *> &pl, const bool print_exception = true );
                 KDNode <Point> *findParentKDNode ( const Point * point ) const;
                 void clearKDTree2D();
                 void printKDTree2D ( const TPrintKDTreeMethod & method = PostOrder, std::ostream * output = &std::cout ) const;
                 unsigned int getNodesCount() const { return nodes_count;}
 
+                void insertPoint ( Point * point );
+                bool erasePoint ( const Point * point );
+
         public:
                 template <typename Point2>
                 KDNode <Point> *findKDNode ( const Point2 * point, KDNode <Point> **nearest_neighbour ) const;
@@ -98,16 +102,30 @@ class KDTree2D
                 template <typename Point2>
                 void findAllKNN ( const Point2 * point, Container <Point *, NonDestructable> &knn, unsigned int k ) const;
 
+                template <typename Point2, const TDestructable destructable>
+                unsigned int findAllKNN ( const Container <Point2 *, destructable> &points, std::vector <Point *> &knn, unsigned int k ) const;
+
+                template <typename Point2>
+                void findInRadius ( const Point2 * point, const typename Point::Type radius, Container <Point *, NonDestructable> &points ) const;
+
+                template <typename Point2>
+                unsigned int countInRadius ( const Point2 * point, const typename Point::Type radius ) const;
+
+                void findInBox ( const typename Point::Type x_min, const typename Point::Type y_min, const typename Point::Type x_max, const typename Point::Type y_max,
+                                 Container <Point *, NonDestructable> &points ) const;
 
         private:
 
-                KDNode <Point> *buildKDTree2D ( Container <Point *> &pl, TIndexList & kd_index_list_x, TIndexList & kd_index_list_y, const unsigned int n, const unsigned int depth );
+                KDNode <Point> *buildKDTree2D ( const std::vector <Point *> &points, const std::vector <KDNode <Point> *> &slots, const unsigned int depth );
 
-                void splitLists ( const unsigned int median_index_point, const typename Point::Type median_split_value, Container <Point *> &pl,
-                                  const TIndexList & kd_index_list_x, const TIndexList & kd_index_list_y, TIndexList & kd_index_list1_x, TIndexList & kd_index_list1_y,
-                                  TIndexList & kd_index_list2_x, TIndexList & kd_index_list2_y, const unsigned int n, unsigned int & n1, unsigned int & n2, const unsigned int depth );
+                KDNode <Point> *buildKDTree2D ( const std::vector <Point *> &points, const std::vector <KDNode <Point> *> &slots, const std::vector <typename Point::Type> *coordinates,
+                                                std::vector <unsigned int> &indices, const unsigned int begin, const unsigned int end, const unsigned int depth );
 
-                void clearAllNodes ( const KDNode <Point> *node );
+                void rebuildKDTree2D();
+
+                void collectNodes ( KDNode <Point> *node, std::vector <Point *> &points, std::vector <KDNode <Point> *> &slots, unsigned int &erased ) const;
+
+                unsigned int countNodes ( const KDNode <Point> *node ) const;
 
                 void inOrder ( const KDNode <Point> *node, std::ostream * output ) const;
                 void preOrder ( const KDNode <Point> *node, std::ostream * output ) const;
@@ -121,8 +139,16 @@ class KDTree2D
                 template <typename Point2>
                 void findNNNode ( const Point2 * point, KDNode <Point> *node, KDNode <Point> **parent, const unsigned int depth, typename Point::Type & min_dist_q_node ) const; // nove
 
+                template <typename Point2>
+                void findAllKNNNodes ( const Point2 * point, typename TNNeighboursList <Point>::Type & knn, const unsigned int k ) const;
+
                 template <typename Point2>
                 void findAllKNNNodes ( const Point2 * point, typename TNNeighboursList <Point>::Type & knn, unsigned int k, KDNode <Point> *node, const unsigned int depth ) const;
+
+                template <typename Point2>
+                unsigned int findInRadiusNodes ( const Point2 * point, const typename Point::Type radius, const KDNode <Point> *node, Container <Point *, NonDestructable> *points ) const;
+
+                unsigned int findInBoxNodes ( const typename Point::Type * box_min, const typename Point::Type * box_max, const KDNode <Point> *node, Container <Point *, NonDestructable> *points ) const;
 };
 
 #include "KDTree.hpp"
@@ -31,193 +31,352 @@
 
 #include "KDNode.h"
 #include "libalgo/source/structures/point/Point3DCartesian.h"
-#include "libalgo/source/structures/list/IndexLists.h"
 
-#include "libalgo/source/comparators/sortPointsByX.h"
-#include "libalgo/source/comparators/sortPointsByY.h"
-#include "libalgo/source/comparators/sortPointsByID.h"
+#include "libalgo/source/comparators/indexComp.h"
+#include "libalgo/source/comparators/sortKDNodesByPriority.h"
 
 #include "libalgo/source/exceptions/ErrorBadOutput.h"
 
 
 template <typename Point>
-void KDTree2D <Point> ::createKDTree2D ( Container <Point *> &pl, const bool print_exception )
+void KDTree2D <Point> ::createKDTree2D ( const Container <Point *> &pl, const bool )
 {
-        //Create KD tree
+        //Create KD tree: the points are partitioned in place using the median selection (O(n log n)),
+        //the order of points in the input container is preserved, the build throws no exception (nothing is printed)
         const unsigned int n = pl.size();
 
-        //Create indices lists for sorted sets
-        TIndexList kd_index_list_x, kd_index_list_y;
+        //Remove old tree
+        clearKDTree2D();
 
-        //Sort points by x
-        std::sort ( pl.begin(), pl.end(), sortPointsByX() );
-        pl.toIndexList ( kd_index_list_x );
+        //Allocate all nodes at once
+        std::vector <Point *> points ( pl.begin(), pl.end() );
+        std::vector <KDNode <Point> *> slots ( n );
 
-        //Sort points by y
-        std::sort ( pl.begin(), pl.end(), sortPointsByY () );
-        pl.toIndexList ( kd_index_list_y );
+        nodes.resize ( n );
 
-        //Sort points by point id
-        std::sort ( pl.begin(), pl.end(), sortPointsByID <Point>() );
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                slots[i] = &nodes[i];
+        }
+
+        nodes_count = n;
 
         //Build KD Tree
-        root = buildKDTree2D ( pl, kd_index_list_x, kd_index_list_y, n, 1 );
+        root = buildKDTree2D ( points, slots, 1 );
+}
+
+
+template <typename Point>
+KDNode <Point> * KDTree2D <Point>::buildKDTree2D ( const std::vector <Point *> &points, const std::vector <KDNode <Point> *> &slots, const unsigned int depth )
+{
+        //Build KD (sub)tree of the points, its root has the given depth: nodes are stored in the preallocated slots
+        const unsigned int n = points.size();
+
+        //Copy coordinates of points into contiguous arrays
+        std::vector <typename Point::Type> coordinates[2];
+        coordinates[0].resize ( n );
+        coordinates[1].resize ( n );
+
+        std::vector <unsigned int> indices ( n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                coordinates[0][i] = points[i]->getX();
+                coordinates[1][i] = points[i]->getY();
+                indices[i] = i;
+        }
+
+        KDNode <Point> *node = NULL;
+
+        //Build KD Tree, large trees are built by the parallel tasks
+#ifdef _OPENMP
+        #pragma omp parallel if ( n >= 2 * KD_TREE_PARALLEL_BUILD_SIZE )
+        #pragma omp single
+#endif
+        node = buildKDTree2D ( points, slots, coordinates, indices, 0, n, depth );
+
+        return node;
 }
 
 
 template <typename Point>
-KDNode <Point> * KDTree2D <Point>::buildKDTree2D ( Container <Point *> &pl, TIndexList & kd_index_list_x, TIndexList & kd_index_list_y, const unsigned int n, const unsigned int depth )
+KDNode <Point> * KDTree2D <Point>::buildKDTree2D ( const std::vector <Point *> &points, const std::vector <KDNode <Point> *> &slots, const std::vector <typename Point::Type> *coordinates,
+                std::vector <unsigned int> &indices, const unsigned int begin, const unsigned int end, const unsigned int depth )
 {
-        //Build 2D KD Tree using recursive approach
+        //Build 2D KD Tree over the points indices [begin, end) using recursive approach, the node is stored in the slot begin
+        //	depth = even: split according to x coordinate
+        //	depth = odd: split according to y coordinate
+        //
 
         //No leaf will be created
-        if ( n == 0 )
+        if ( begin == end )
         {
                 return NULL;
         }
 
-        //Only one point: create leaf of KD Tree
-        else if ( n == 1 )
-        {
-                //Increment nodes count
-                nodes_count++;
+        const unsigned int axis = depth % 2;
+        const std::vector <typename Point::Type> &c = coordinates[axis];
 
-                //Create one leaft: even depth of recursion
-                if ( depth % 2 == 0 )
-                {
-                        return new KDNode <Point> ( pl [ kd_index_list_x [0]] , depth );
-                }
+        //Find median point and move it to the first position: left part <= median, right part >= median
+        const unsigned int median_index = begin + ( end - begin ) / 2;
+        std::nth_element ( indices.begin() + begin, indices.begin() + median_index, indices.begin() + end,
+                           indexComp <typename std::vector <typename Point::Type>::const_iterator> ( c.begin(), c.end() ) );
+        std::swap ( indices[begin], indices[median_index] );
 
-                //Create one leaft: odd depth of recursion
-                else
+        //Create median node
+        const typename Point::Type split_value = c [indices[begin]];
+        KDNode <Point> *node_median = slots[begin];
+        *node_median = KDNode <Point> ( points [indices[begin]], depth );
+        node_median->setSplitValue ( split_value );
+
+        //Move points equal to the median from the right part to the left one: left subtree <= median, right subtree > median
+        unsigned int split = median_index + 1;
+
+        for ( unsigned int i = median_index + 1; i < end; i++ )
+        {
+                if ( c [indices[i]] <= split_value )
                 {
-                        return new KDNode <Point> ( pl [ kd_index_list_y [0]] , depth );
+                        std::swap ( indices[i], indices[split++] );
                 }
         }
 
-        //At least 2 points: create one leaf, split tree into left and right subtree
+        KDNode <Point> *left = NULL, *right = NULL;
+
+#ifdef _OPENMP
+        //Large subtree: build left subtree by a separate task
+        if ( split - begin - 1 >= KD_TREE_PARALLEL_BUILD_SIZE )
+        {
+                #pragma omp task default ( shared )
+                left = buildKDTree2D ( points, slots, coordinates, indices, begin + 1, split, depth + 1 );
+
+                right = buildKDTree2D ( points, slots, coordinates, indices, split, end, depth + 1 );
+
+                #pragma omp taskwait
+        }
+
         else
+#endif
         {
-                //New KD node
-                KDNode <Point> *node_median = NULL;
+                //Build left subtree
+                left = buildKDTree2D ( points, slots, coordinates, indices, begin + 1, split, depth + 1 );
 
-                //Increment nodes count
-                nodes_count++;
+                //Build right subtree
+                right = buildKDTree2D ( points, slots, coordinates, indices, split, end, depth + 1 );
+        }
 
-                //Get median index
-                const unsigned int median_index = n / 2;
+        node_median->setLeft ( left );
+        node_median->setRight ( right );
 
-                //Create new KD Lists
-                TIndexList kd_index_list1_x, kd_index_list2_x, kd_index_list1_y, kd_index_list2_y;
+        //Return new node
+        return node_median;
+}
 
-                //Initialize median point
-                Point * p_median = NULL;
 
-                //The depth is even, process by x coordinate
-                unsigned int median_index_point = 0;
+template <typename Point>
+void KDTree2D <Point>::rebuildKDTree2D()
+{
+        //Rebuild whole KD tree from its points, erased nodes are removed
+        std::vector <Point *> points;
+        std::vector <KDNode <Point> *> slots;
+        unsigned int erased = 0;
 
-                if ( depth % 2 == 0 )
-                {
-                        //Get median point index
-                        median_index_point = kd_index_list_x [median_index];
+        collectNodes ( root, points, slots, erased );
 
-                        //Get median point
-                        p_median = pl [median_index_point];
-                }
+        //Allocate all nodes at once
+        const unsigned int n = points.size();
 
-                //The depth is odd, process by y coordinates
-                else
-                {
-                        //Get median point index
-                        median_index_point = kd_index_list_y [median_index];
+        nodes.clear();
+        nodes.resize ( n );
+        slots.resize ( n );
 
-                        //Get median point
-                        p_median = pl [median_index_point] ;
-                }
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                slots[i] = &nodes[i];
+        }
 
-                //Create median node
-                node_median = new KDNode <Point> ( p_median, depth );
+        nodes_count = n;
+        erased_count = 0;
 
-                //Set split value for the node
-                const typename Point::Type split_value = p_median->getCoordinate ( depth % 2 );
-                node_median->setSplitValue ( split_value );
+        root = buildKDTree2D ( points, slots, 1 );
+}
 
-                //Split list (n itemd) into two sublists (n1, n2 items)
-                unsigned int n1 = 0, n2 = 0;
-                splitLists ( median_index_point, split_value, pl, kd_index_list_x, kd_index_list_y, kd_index_list1_x, kd_index_list1_y, kd_index_list2_x, kd_index_list2_y, n, n1, n2, depth );
 
-                //Build left subtree
-                node_median->setLeft ( buildKDTree2D ( pl,  kd_index_list1_x, kd_index_list1_y, n1, depth + 1 ) );
+template <typename Point>
+void KDTree2D <Point>::collectNodes ( KDNode <Point> *node, std::vector <Point *> &points, std::vector <KDNode <Point> *> &slots, unsigned int &erased ) const
+{
+        //Collect all nodes of the subtree and points of the nodes which are not erased
+        if ( node == NULL )
+        {
+                return;
+        }
 
-                //Build right subtree
-                node_median->setRight ( buildKDTree2D ( pl, kd_index_list2_x, kd_index_list2_y, n2, depth + 1 ) );
+        slots.push_back ( node );
 
-                //Return new node
-                return node_median;
+        if ( node->isErased() )
+        {
+                erased++;
+        }
+
+        else
+        {
+                points.push_back ( node->getData() );
         }
+
+        collectNodes ( node->getLeft(), points, slots, erased );
+        collectNodes ( node->getRight(), points, slots, erased );
 }
 
 
 template <typename Point>
-void KDTree2D <Point>::splitLists ( const unsigned int median_index_point, const typename Point::Type median_split_value, Container <Point*>  &pl,
-                                    const TIndexList & kd_index_list_x, const TIndexList & kd_index_list_y, TIndexList & kd_index_list1_x, TIndexList & kd_index_list1_y,
-                                    TIndexList & kd_index_list2_x, TIndexList & kd_index_list2_y, const unsigned int n, unsigned int & n1, unsigned int & n2, const unsigned int depth )
+unsigned int KDTree2D <Point>::countNodes ( const KDNode <Point> *node ) const
 {
-        //Split KD lists:
-        //		depth = even: split according to x coordinate
-        //		depth = odd: split according to y coordinate
-        //
-
-        //Split list according to median coordinate
-        for ( unsigned int i = 0; i < n; i++ )
+        //Count nodes of the subtree
+        if ( node == NULL )
         {
-                //***** Process first list *****
+                return 0;
+        }
+
+        return 1 + countNodes ( node->getLeft() ) + countNodes ( node->getRight() );
+}
+
 
-                //Get actual point from the list sorted by x
-                const unsigned int point_index_x = kd_index_list_x [i];
-                const Point * p_x = pl [point_index_x];
+template <typename Point>
+void KDTree2D <Point>::insertPoint ( Point * point )
+{
+        //Insert point into the KD tree: the new leaf is created, the subtree is rebuilt when the tree becomes too deep (scapegoat tree)
+        nodes.push_back ( KDNode <Point> ( point ) );
+        KDNode <Point> *node = &nodes.back();
+        nodes_count++;
+
+        //Find the parent of the new leaf, remember the path
+        std::vector <KDNode <Point> *> path;
+        unsigned int depth = 1;
+
+        for ( KDNode <Point> *parent = root; parent != NULL; depth++ )
+        {
+                path.push_back ( parent );
 
-                //Do not process median point again
-                if ( point_index_x != median_index_point )
+                //Search left subtree
+                if ( point->getCoordinate ( depth % 2 ) <= parent->getData()->getCoordinate ( depth % 2 ) )
                 {
-                        //Add point to the first list: x <= median.x (for old depth of recursion)
-                        if ( p_x->getCoordinate ( depth % 2 ) <= median_split_value )
+                        if ( parent->getLeft() == NULL )
                         {
-                                kd_index_list1_x.push_back ( point_index_x );
-                                n1++;
+                                parent->setLeft ( node );
+                                parent = NULL;
                         }
 
-                        //Add point to the second list: x < median.x (for old depth of recursion)
-                        else if ( p_x->getCoordinate ( depth % 2 ) > median_split_value )
+                        else parent = parent->getLeft();
+                }
+
+                //Search right subtree
+                else
+                {
+                        if ( parent->getRight() == NULL )
                         {
-                                kd_index_list2_x.push_back ( point_index_x );
-                                n2++;
+                                parent->setRight ( node );
+                                parent = NULL;
                         }
+
+                        else parent = parent->getRight();
                 }
+        }
 
-                // ***** Process second list *****
+        node->setDepth ( depth );
+        node->setSplitValue ( point->getCoordinate ( depth % 2 ) );
 
-                //Get actual point from the list sorted by y
-                const unsigned int point_index_y = kd_index_list_y [i];
-                const Point * p_y = pl [point_index_y];
+        //The first node
+        if ( root == NULL )
+        {
+                root = node;
+                return;
+        }
+
+        //Too many orphaned and erased nodes: rebuild whole tree
+        if ( nodes.size() > 2 * nodes_count )
+        {
+                rebuildKDTree2D();
+                return;
+        }
 
-                //Do not process median point again
-                if ( point_index_y != median_index_point )
+        //New leaf is too deep: find the scapegoat (subtree unbalanced by the inserted node) and rebuild its subtree
+        if ( depth > log ( ( double ) ( nodes_count + erased_count ) ) / log ( 1.0 / KD_TREE_SCAPEGOAT_ALPHA ) + 1 )
+        {
+                unsigned int size = 1;
+                KDNode <Point> *child = node;
+
+                for ( int i = path.size() - 1; i >= 0; i-- )
                 {
-                        //Add point to the first list: y < median.y (for old depth of recursion)
-                        if ( p_y->getCoordinate ( depth % 2 ) <= median_split_value )
+                        KDNode <Point> *parent = path[i];
+                        const unsigned int size_parent = size + 1 + countNodes ( parent->getLeft() == child ? parent->getRight() : parent->getLeft() );
+
+                        //Scapegoat found
+                        if ( size > KD_TREE_SCAPEGOAT_ALPHA * size_parent )
                         {
-                                kd_index_list1_y.push_back ( point_index_y );
+                                //Rebuild subtree, its nodes are reused, nodes of the erased points are orphaned
+                                std::vector <Point *> points;
+                                std::vector <KDNode <Point> *> slots;
+                                unsigned int erased = 0;
+
+                                collectNodes ( parent, points, slots, erased );
+                                KDNode <Point> *subtree = buildKDTree2D ( points, slots, parent->getDepth() );
+                                erased_count -= erased;
+
+                                //Connect subtree
+                                if ( i == 0 )
+                                {
+                                        root = subtree;
+                                }
+
+                                else if ( path[i - 1]->getLeft() == parent )
+                                {
+                                        path[i - 1]->setLeft ( subtree );
+                                }
+
+                                else
+                                {
+                                        path[i - 1]->setRight ( subtree );
+                                }
+
+                                break;
                         }
 
-                        //Add point to the second list: y < median.y (for old depth of recursion)
-                        else if ( p_y->getCoordinate ( depth % 2 ) > median_split_value )
+                        size = size_parent;
+                        child = parent;
+                }
+        }
+}
+
+
+template <typename Point>
+bool KDTree2D <Point>::erasePoint ( const Point * point )
+{
+        //Erase point from the KD tree: the node is marked as erased, the tree is rebuilt when the erased nodes prevail
+        unsigned int depth = 1;
+
+        for ( KDNode <Point> *node = root; node != NULL; depth++ )
+        {
+                //Point found
+                if ( ( node->getData() == point ) && ( !node->isErased() ) )
+                {
+                        node->setErased ( true );
+                        nodes_count--;
+                        erased_count++;
+
+                        //Too many orphaned and erased nodes: rebuild whole tree
+                        if ( nodes.size() > 2 * nodes_count )
                         {
-                                kd_index_list2_y.push_back ( point_index_y );
+                                rebuildKDTree2D();
                         }
+
+                        return true;
                 }
+
+                //Continue with left or right subtree
+                node = ( point->getCoordinate ( depth % 2 ) <= node->getData()->getCoordinate ( depth % 2 ) ? node->getLeft() : node->getRight() );
         }
 
+        //Point is not present in KD tree
+        return false;
 }
 
 
@@ -272,7 +431,7 @@ KDNode <Point> *KDTree2D <Point>::findNode ( const Point2 * point, KDNode <Point
         }
 
         //Tested point has same coordinates as found node
-        if ( ( point->getX() - node->getData()->getX() ) * ( point->getX() - node->getData()->getX() ) +
+        if ( !node->isErased() && ( point->getX() - node->getData()->getX() ) * ( point->getX() - node->getData()->getX() ) +
                         ( point->getY() - node->getData()->getY() ) * ( point->getY() - node->getData()->getY() ) < MIN_POSITION_DIFF * MIN_POSITION_DIFF )
         {
                 return node;
@@ -301,6 +460,13 @@ Point * KDTree2D <Point>::findNN ( const Point2 * point ) const
 {
         //Find nearest Neighbour node and return containing point
         typename Point::Type min_dist_q_node = MAX_FLOAT;
+
+        //No KD-tree constructed
+        if ( root == NULL )
+        {
+                throw ErrorBadOutput ( "ErrorBadOutput: can not find nearest neighbour, ", "no KD-Tree has been constructed." );
+        }
+
         KDNode <Point> *nearest_neighbour = NULL;
         findNNNode ( point, root, &nearest_neighbour, 1, min_dist_q_node );
         return nearest_neighbour->getData();
@@ -334,7 +500,7 @@ void KDTree2D <Point> ::findNNNode ( const Point2 * point, KDNode <Point> *node,
         typename Point::Type dist_q_node = ( node->getData()->getX() - point->getX() ) * ( node->getData()->getX() - point->getX() ) +
                                            ( node->getData()->getY() - point->getY() ) * ( node->getData()->getY() - point->getY() );
 
-        if ( dist_q_node < min_dist_q_node )
+        if ( ( dist_q_node < min_dist_q_node ) && ( !node->isErased() ) )
         {
                 min_dist_q_node = dist_q_node;
                 *nearest_neighbour = node;
@@ -368,7 +534,7 @@ template <typename Point>
 template <typename Point2>
 void KDTree2D <Point>::findAllKNN ( const Point2 * point, Container <Point *, NonDestructable > &knn, unsigned int k ) const
 {
-        //Find all k-nearest neighbours to the specified point
+        //Find all k-nearest neighbours to the specified point, sorted by the distance
         typename TNNeighboursList <Point>::Type nn;
 
         //No KD-tree constructed
@@ -380,16 +546,80 @@ void KDTree2D <Point>::findAllKNN ( const Point2 * point, Container <Point *, No
         //Set new k
         k = std::min ( k, nodes_count - 1 );
 
-        //Start from root
-        findAllKNNNodes ( point, nn, k, root, 1 );
+        //Find nearest neighbours
+        findAllKNNNodes ( point, nn, k );
 
         //Copy nearest neighbours to the list
-        typename TNNeighboursList <Point>::Type ::reverse_iterator i_knn = nn.rbegin();
+        for ( unsigned int i = 0; i < nn.size(); i++ )
+        {
+                knn.push_back ( nn[i].node->getData() );
+        }
+}
 
-        for ( unsigned int i = 0; i < k; ++i_knn, ++i )
+
+template <typename Point>
+template <typename Point2, const TDestructable destructable>
+unsigned int KDTree2D <Point>::findAllKNN ( const Container <Point2 *, destructable> &points, std::vector <Point *> &knn, unsigned int k ) const
+{
+        //Find all k-nearest neighbours to each point of the container, the queries are processed in parallel
+        //Neighbours of the i-th point sorted by the distance are stored in knn[i * k, (i + 1) * k), the corrected k is returned
+        const int n = points.size();
+
+        //No KD-tree constructed
+        if ( root == NULL )
         {
-                knn.push_back ( ( ( i_knn )->node->getData() ) );
+                throw ErrorBadOutput ( "ErrorBadOutput: can not find all k-nearest neighbour nodes, ", "no KD-Tree has been constructed." );
         }
+
+        //Set new k
+        k = std::min ( k, nodes_count - 1 );
+
+        knn.resize ( n * k );
+
+#ifdef _OPENMP
+        #pragma omp parallel if ( n >= KD_TREE_PARALLEL_QUERY_SIZE )
+#endif
+        {
+                //Heap reused by all queries of the thread
+                typename TNNeighboursList <Point>::Type nn;
+
+#ifdef _OPENMP
+                #pragma omp for schedule ( dynamic, 256 )
+#endif
+
+                for ( int i = 0; i < n; i++ )
+                {
+                        findAllKNNNodes ( points [i], nn, k );
+
+                        for ( unsigned int j = 0; j < k; j++ )
+                        {
+                                knn[i * k + j] = nn[j].node->getData();
+                        }
+                }
+        }
+
+        return k;
+}
+
+
+template <typename Point>
+template <typename Point2>
+void KDTree2D <Point>::findAllKNNNodes ( const Point2 * point, typename TNNeighboursList <Point>::Type & knn, const unsigned int k ) const
+{
+        //Find k nearest neighbours and sort them by the distance, the heap is cleared and its capacity is reused
+        knn.clear();
+        knn.reserve ( k );
+
+        if ( k == 0 )
+        {
+                return;
+        }
+
+        //Start from root
+        findAllKNNNodes ( point, knn, k, root, 1 );
+
+        //Ascending distances
+        std::sort_heap ( knn.begin(), knn.end(), sortKDNodesByPriority() );
 }
 
 
@@ -397,7 +627,7 @@ template <typename Point>
 template <typename Point2>
 void KDTree2D <Point>::findAllKNNNodes ( const Point2 * point, typename TNNeighboursList <Point>::Type & knn, unsigned int k, KDNode <Point> *node, const unsigned int depth ) const
 {
-        //Find all k nearest neighbours using recursive search and store in Priority Queue (PQ)
+        //Find all k nearest neighbours using recursive search and store in the bounded max-heap
 
         //Point is not present in KD Tree
         if ( node == NULL )
@@ -421,35 +651,31 @@ void KDTree2D <Point>::findAllKNNNodes ( const Point2 * point, typename TNNeighb
         typename Point::Type dist_q_node = ( node->getData()->getX() - point->getX() ) * ( node->getData()->getX() - point->getX() ) +
                                            ( node->getData()->getY() - point->getY() ) * ( node->getData()->getY() - point->getY() );
 
-        //PQ does not have any free position: remove item on the top or do not do anything?
-        if ( knn.size() == k )
+        //Erased node is not a neighbour
+        if ( !node->isErased() )
         {
-                //We add to PQ only a node closer to q than node on the top
-                if ( dist_q_node < knn.begin()->priority )
+                //There are free positions in the heap
+                if ( knn.size() < k )
                 {
-                        //Remove element from the top: removed node is further to q than added
-                        knn.erase ( knn.begin() );
-
-                        //Add node closer to Q to PQ
-                        knn.insert ( TKDNodePriority <Point> ( node,  dist_q_node ) );
+                        knn.push_back ( TKDNodePriority <Point> ( node,  dist_q_node ) );
+                        std::push_heap ( knn.begin(), knn.end(), sortKDNodesByPriority() );
                 }
-        }
 
-        //There are free positions in PQ
-        else
-        {
-                //Add node to PQ
-                knn.insert ( TKDNodePriority <Point> ( node,  dist_q_node ) );
+                //Heap does not have any free position: replace the node on the top, if it is further to q than added
+                else if ( dist_q_node < knn.front().priority )
+                {
+                        std::pop_heap ( knn.begin(), knn.end(), sortKDNodesByPriority() );
+                        knn.back() = TKDNodePriority <Point> ( node,  dist_q_node );
+                        std::push_heap ( knn.begin(), knn.end(), sortKDNodesByPriority() );
+                }
         }
 
         //Test intersection of the hypersphere and hyperrectangle
         typename Point::Type dist_q_node_straight = ( point->getCoordinate ( node->getDepth() % 2 ) - node->getData()->getCoordinate ( node->getDepth() % 2 ) ) *
                         ( point->getCoordinate ( node->getDepth() % 2 ) - node->getData()->getCoordinate ( node->getDepth() % 2 ) ) ;
 
-        //We stil have not found enough neighbours or there is an itersection of the largest hypersphere (top of the PQ) and hyperrectangle
-        typename Point::Type top_priority =  knn.begin()->priority;
-
-        if ( ( knn.size() < k ) || ( dist_q_node_straight ) < ( top_priority ) )
+        //We stil have not found enough neighbours or there is an itersection of the largest hypersphere (top of the heap) and hyperrectangle
+        if ( ( knn.size() < k ) || ( dist_q_node_straight ) < ( knn.front().priority ) )
         {
                 //Point is in the left halfplane (subtree)
                 if ( point->getCoordinate ( node->getDepth() % 2 ) <= node->getData()->getCoordinate ( node->getDepth() % 2 ) )
@@ -469,29 +695,121 @@ void KDTree2D <Point>::findAllKNNNodes ( const Point2 * point, typename TNNeighb
 
 
 template <typename Point>
-void KDTree2D <Point> ::clearKDTree2D()
+template <typename Point2>
+void KDTree2D <Point>::findInRadius ( const Point2 * point, const typename Point::Type radius, Container <Point *, NonDestructable > &points ) const
 {
-        //Clear KD tree
-        clearAllNodes ( root );
+        //Find all points with the distance to the specified point <= radius
+        findInRadiusNodes ( point, radius, root, &points );
 }
 
 
 template <typename Point>
-void KDTree2D <Point> ::clearAllNodes ( const KDNode <Point> *node )
+template <typename Point2>
+unsigned int KDTree2D <Point>::countInRadius ( const Point2 * point, const typename Point::Type radius ) const
 {
-        //Clear all nodes in KD Tree
-        if ( node != NULL )
+        //Count all points with the distance to the specified point <= radius
+        return findInRadiusNodes ( point, radius, root, ( Container <Point *, NonDestructable > * ) NULL );
+}
+
+
+template <typename Point>
+void KDTree2D <Point>::findInBox ( const typename Point::Type x_min, const typename Point::Type y_min, const typename Point::Type x_max, const typename Point::Type y_max,
+                                   Container <Point *, NonDestructable > &points ) const
+{
+        //Find all points inside the axis aligned box (including its boundary)
+        const typename Point::Type box_min[2] = {x_min, y_min}, box_max[2] = {x_max, y_max};
+
+        findInBoxNodes ( box_min, box_max, root, &points );
+}
+
+
+template <typename Point>
+template <typename Point2>
+unsigned int KDTree2D <Point>::findInRadiusNodes ( const Point2 * point, const typename Point::Type radius, const KDNode <Point> *node, Container <Point *, NonDestructable > *points ) const
+{
+        //Find (or count, if no output container is given) points inside the circle using recursive search
+        if ( node == NULL )
+        {
+                return 0;
+        }
+
+        unsigned int count = 0;
+
+        //Test the point of the node
+        const typename Point::Type dx = node->getData()->getX() - point->getX(), dy = node->getData()->getY() - point->getY();
+
+        if ( ( !node->isErased() ) && ( dx * dx + dy * dy <= radius * radius ) )
+        {
+                if ( points != NULL ) points->push_back ( node->getData() );
+
+                count++;
+        }
+
+        //Circle intersects the left halfplane (subtree)
+        const typename Point::Type diff = point->getCoordinate ( node->getDepth() % 2 ) - node->getData()->getCoordinate ( node->getDepth() % 2 );
+
+        if ( diff - radius <= 0 )
+        {
+                count += findInRadiusNodes ( point, radius, node->getLeft(), points );
+        }
+
+        //Circle intersects the right halfplane (subtree)
+        if ( diff + radius > 0 )
+        {
+                count += findInRadiusNodes ( point, radius, node->getRight(), points );
+        }
+
+        return count;
+}
+
+
+template <typename Point>
+unsigned int KDTree2D <Point>::findInBoxNodes ( const typename Point::Type * box_min, const typename Point::Type * box_max, const KDNode <Point> *node, Container <Point *, NonDestructable > *points ) const
+{
+        //Find (or count, if no output container is given) points inside the box using recursive search
+        if ( node == NULL )
         {
-                //Clear left sub tree
-                clearAllNodes ( node->getLeft() );
+                return 0;
+        }
 
-                //Clear right sub tree
-                clearAllNodes ( node->getRight() );
+        unsigned int count = 0;
 
-                //Call destructor for KD node
-                delete node;
-                node = NULL;
+        //Test the point of the node
+        const typename Point::Type x = node->getData()->getX(), y = node->getData()->getY();
+
+        if ( ( !node->isErased() ) && ( x >= box_min[0] ) && ( x <= box_max[0] ) && ( y >= box_min[1] ) && ( y <= box_max[1] ) )
+        {
+                if ( points != NULL ) points->push_back ( node->getData() );
+
+                count++;
         }
+
+        //Box intersects the left halfplane (subtree)
+        const unsigned int axis = node->getDepth() % 2;
+
+        if ( box_min[axis] <= node->getData()->getCoordinate ( axis ) )
+        {
+                count += findInBoxNodes ( box_min, box_max, node->getLeft(), points );
+        }
+
+        //Box intersects the right halfplane (subtree)
+        if ( box_max[axis] > node->getData()->getCoordinate ( axis ) )
+        {
+                count += findInBoxNodes ( box_min, box_max, node->getRight(), points );
+        }
+
+        return count;
+}
+
+
+template <typename Point>
+void KDTree2D <Point> ::clearKDTree2D()
+{
+        //Clear KD tree
+        nodes.clear();
+        root = NULL;
+        nodes_count = 0;
+        erased_count = 0;
 }
 
 
@@ -0,0 +1 @@
+#include "KDTreeGeographic.h"
\ No newline at end of file
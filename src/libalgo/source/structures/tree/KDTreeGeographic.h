@@ -0,0 +1,72 @@
+// Description: KD-tree of geographic points, great circle distances
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef KDTreeGeographic_H
+#define KDTreeGeographic_H
+
+#include <vector>
+
+#include "KDTreeND.h"
+
+
+//Class storing KD tree of geographic points (lat, lon): points are mapped onto the unit sphere and stored in the 3D KD tree,
+//all distances are great circle distances (central angles in degrees), the chord distance is monotonous in the central angle
+template <typename T>
+class KDTreeGeographic
+{
+        private:
+                KDTree <T, 3> tree;				//KD tree of points on the unit sphere
+
+        public:
+                KDTreeGeographic ( const unsigned int bucket_size = KD_TREE_BUCKET_SIZE ) : tree ( bucket_size ) {}
+
+        public:
+                template <typename Point>
+                void createKDTree ( const Container <Point *> &pl );
+
+                void clearKDTree() { tree.clearKDTree(); }
+                unsigned int getNodesCount() const { return tree.getNodesCount();}
+                unsigned int getPointsCount() const { return tree.getPointsCount();}
+
+        public:
+                template <typename Point>
+                unsigned int findNN ( const Point * point, T * distance = NULL ) const;
+
+                template <typename Point>
+                void findAllKNN ( const Point * point, unsigned int k, TIndexList &knn, std::vector <T> *distances = NULL ) const;
+
+                template <typename Point>
+                void findInRadius ( const Point * point, const T radius, TIndexList &points, std::vector <T> *distances = NULL ) const;
+
+                template <typename Point>
+                unsigned int countInRadius ( const Point * point, const T radius ) const;
+
+                template <typename Point>
+                static void getCoordinates ( const Point * point, T * c );
+
+                static T chordToAngle ( const T chord );
+                static T angleToChord ( const T angle );
+};
+
+#include "KDTreeGeographic.hpp"
+
+#endif
@@ -0,0 +1,146 @@
+// Description: KD-tree of geographic points, great circle distances
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef KDTreeGeographic_HPP
+#define KDTreeGeographic_HPP
+
+#include <cmath>
+#include <algorithm>
+
+
+template <typename T>
+template <typename Point>
+void KDTreeGeographic <T> ::createKDTree ( const Container <Point *> &pl )
+{
+        //Create KD tree of geographic points, the container is not reordered
+        const unsigned int n = pl.size();
+
+        std::vector <T> c ( 3 * n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                getCoordinates ( pl [i], &c[3 * i] );
+        }
+
+        tree.createKDTree ( n > 0 ? &c[0] : NULL, n );
+}
+
+
+template <typename T>
+template <typename Point>
+void KDTreeGeographic <T> ::getCoordinates ( const Point * point, T * c )
+{
+        //Convert geographic coordinates (lat, lon) to the cartesian coordinates on the unit sphere
+        const T lat = point->getLat() * M_PI / 180, lon = point->getLon() * M_PI / 180;
+
+        c[0] = cos ( lat ) * cos ( lon );
+        c[1] = cos ( lat ) * sin ( lon );
+        c[2] = sin ( lat );
+}
+
+
+template <typename T>
+T KDTreeGeographic <T> ::chordToAngle ( const T chord )
+{
+        //Convert chord of the unit sphere to the central angle (degrees)
+        return 2 * asin ( std::min ( chord / 2, ( T ) 1 ) ) * 180 / M_PI;
+}
+
+
+template <typename T>
+T KDTreeGeographic <T> ::angleToChord ( const T angle )
+{
+        //Convert central angle (degrees) to the chord of the unit sphere, angles >= 180 deg cover whole sphere
+        return ( angle >= 180 ? ( T ) 2 : 2 * sin ( angle * M_PI / 360 ) );
+}
+
+
+template <typename T>
+template <typename Point>
+unsigned int KDTreeGeographic <T> ::findNN ( const Point * point, T * distance ) const
+{
+        //Find nearest neighbour, return its index in the source data
+        T c[3];
+        getCoordinates ( point, c );
+
+        const unsigned int nearest = tree.findNN ( c, distance );
+
+        if ( distance != NULL ) *distance = chordToAngle ( *distance );
+
+        return nearest;
+}
+
+
+template <typename T>
+template <typename Point>
+void KDTreeGeographic <T> ::findAllKNN ( const Point * point, unsigned int k, TIndexList &knn, std::vector <T> *distances ) const
+{
+        //Find all k-nearest neighbours to the specified point, sorted by the great circle distance
+        T c[3];
+        getCoordinates ( point, c );
+
+        const unsigned int n = ( distances != NULL ? distances->size() : 0 );
+        tree.findAllKNN ( c, k, knn, distances );
+
+        if ( distances != NULL )
+        {
+                for ( unsigned int i = n; i < distances->size(); i++ )
+                {
+                        ( *distances ) [i] = chordToAngle ( ( *distances ) [i] );
+                }
+        }
+}
+
+
+template <typename T>
+template <typename Point>
+void KDTreeGeographic <T> ::findInRadius ( const Point * point, const T radius, TIndexList &points, std::vector <T> *distances ) const
+{
+        //Find all points with the great circle distance to the specified point <= radius (degrees)
+        T c[3];
+        getCoordinates ( point, c );
+
+        const unsigned int n = ( distances != NULL ? distances->size() : 0 );
+        tree.findInRadius ( c, angleToChord ( radius ), points, distances );
+
+        if ( distances != NULL )
+        {
+                for ( unsigned int i = n; i < distances->size(); i++ )
+                {
+                        ( *distances ) [i] = chordToAngle ( ( *distances ) [i] );
+                }
+        }
+}
+
+
+template <typename T>
+template <typename Point>
+unsigned int KDTreeGeographic <T> ::countInRadius ( const Point * point, const T radius ) const
+{
+        //Count all points with the great circle distance to the specified point <= radius (degrees)
+        T c[3];
+        getCoordinates ( point, c );
+
+        return tree.countInRadius ( c, angleToChord ( radius ) );
+}
+
+#endif
@@ -0,0 +1 @@
+#include "KDTreeND.h"
\ No newline at end of file
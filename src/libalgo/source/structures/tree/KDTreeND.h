@@ -0,0 +1,88 @@
+// Description: KD-tree implementation (N-dimensional, compile-time dimension)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef KDTreeND_H
+#define KDTreeND_H
+
+#include <vector>
+
+#include "libalgo/source/const/Const.h"
+
+#include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/IndexLists.h"
+#include "libalgo/source/structures/list/PointArray.h"
+#include "libalgo/source/structures/matrix/Matrix.h"
+
+#include "FlatKDTree.h"
+
+
+//Class storing KD tree of Dim-dimensional points (parameter vectors, 3D points) in the flat arrays
+//The tree is built over coordinates: points are rows of the matrix, cartesian points (x, y, z) of the container or of the point array,
+//queries return indices of points in the source data
+template <typename T, const unsigned int Dim>
+class KDTree
+{
+        private:
+                std::vector <TFlatKDNode <T> > nodes;		//Nodes in the pre-order, root at the index 0
+                std::vector <T> coordinates;			//Coordinates of points ordered by leaves, Dim values for each point
+                std::vector <unsigned int> indices;		//Indices of points in the source data ordered by leaves
+                unsigned int bucket_size;			//Maximum points in the leaf
+
+        public:
+                KDTree ( const unsigned int bucket_size_ = KD_TREE_BUCKET_SIZE ) : nodes(), coordinates(), indices(), bucket_size ( bucket_size_ > 0 ? bucket_size_ : 1 ) {}
+
+        public:
+                void createKDTree ( const T * points, const unsigned int n );
+                void createKDTree ( const Matrix <T> &points );
+
+                template <typename Point>
+                void createKDTree ( const Container <Point *> &pl );
+
+                void createKDTree ( const PointArray <T> &pa );
+
+                void clearKDTree();
+                unsigned int getNodesCount() const { return nodes.size();}
+                unsigned int getPointsCount() const { return indices.size();}
+                unsigned int getPointIndex ( const unsigned int i ) const { return indices[i];}	//Index of the i-th point in the order of leaves (spatially coherent order)
+
+        public:
+                unsigned int findNN ( const T * point, T * distance = NULL ) const;
+                void findAllKNN ( const T * point, unsigned int k, TIndexList &knn, std::vector <T> *distances = NULL ) const;
+                void findInRadius ( const T * point, const T radius, TIndexList &points, std::vector <T> *distances = NULL ) const;
+                unsigned int countInRadius ( const T * point, const T radius ) const;
+
+                template <typename Point>
+                static void getCoordinates ( const Point * point, T * c );
+
+        private:
+                void buildKDTree ( std::vector <T> * axis_coordinates, const unsigned int n );
+                unsigned int buildNode ( std::vector <unsigned int> &indices, const std::vector <T> *coordinates, const unsigned int begin, const unsigned int end );
+
+                unsigned int findInRadiusNodes ( const T * point, const T radius, TIndexList *points, std::vector <T> *distances ) const;
+
+                void descendKDTree ( const T * point, unsigned int &node, const T dist_box, T * offsets, unsigned int * stack_nodes, T * stack_dist, T ( *stack_offsets ) [Dim], unsigned int &top ) const;
+                T getDist2 ( const T * point, const unsigned int i ) const;
+};
+
+#include "KDTreeND.hpp"
+
+#endif
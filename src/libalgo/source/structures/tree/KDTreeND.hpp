@@ -0,0 +1,506 @@
+// Description: KD-tree implementation (N-dimensional, compile-time dimension)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+
+#ifndef KDTreeND_HPP
+#define KDTreeND_HPP
+
+#include <algorithm>
+#include <limits>
+#include <cmath>
+
+#include "libalgo/source/comparators/indexComp.h"
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+#include "libalgo/source/exceptions/ErrorBadOutput.h"
+
+
+template <typename T, const unsigned int Dim>
+void KDTree <T, Dim> ::createKDTree ( const T * points, const unsigned int n )
+{
+        //Create KD tree of n points, coordinates of the i-th point are stored in points [i * Dim, (i + 1) * Dim)
+        clearKDTree();
+
+        if ( n == 0 )
+        {
+                return;
+        }
+
+        //Copy coordinates into contiguous arrays, one for each dimension
+        std::vector <T> axis_coordinates[Dim];
+
+        for ( unsigned int d = 0; d < Dim; d++ )
+        {
+                axis_coordinates[d].resize ( n );
+
+                for ( unsigned int i = 0; i < n; i++ )
+                {
+                        axis_coordinates[d][i] = points[i * Dim + d];
+                }
+        }
+
+        buildKDTree ( axis_coordinates, n );
+}
+
+
+template <typename T, const unsigned int Dim>
+void KDTree <T, Dim> ::createKDTree ( const PointArray <T> &pa )
+{
+        //Create KD tree of points stored in the point array, coordinates are copied without interleaving
+        const unsigned int n = pa.size();
+
+        clearKDTree();
+
+        if ( n == 0 )
+        {
+                return;
+        }
+
+        const T * xyz[3] = {pa.getX(), pa.getY(), pa.getZ() };
+        std::vector <T> axis_coordinates[Dim];
+
+        for ( unsigned int d = 0; d < Dim; d++ )
+        {
+                //Remaining coordinates are zero
+                if ( d < 3 ) axis_coordinates[d].assign ( xyz[d], xyz[d] + n );
+                else axis_coordinates[d].assign ( n, 0 );
+        }
+
+        buildKDTree ( axis_coordinates, n );
+}
+
+
+template <typename T, const unsigned int Dim>
+void KDTree <T, Dim> ::buildKDTree ( std::vector <T> * axis_coordinates, const unsigned int n )
+{
+        //Build KD tree over the coordinates stored in Dim contiguous arrays
+        //Indices of points, permuted during the build
+        indices.resize ( n );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                indices[i] = i;
+        }
+
+        //Balanced tree: (2 * n / bucket_size) nodes at most
+        nodes.reserve ( 2 * ( n / bucket_size + 1 ) );
+
+        //Build KD tree
+        buildNode ( indices, axis_coordinates, 0, n );
+
+        //Store coordinates in the order of leaves
+        coordinates.resize ( n * Dim );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                for ( unsigned int d = 0; d < Dim; d++ )
+                {
+                        coordinates[i * Dim + d] = axis_coordinates[d][indices[i]];
+                }
+        }
+}
+
+
+template <typename T, const unsigned int Dim>
+void KDTree <T, Dim> ::createKDTree ( const Matrix <T> &points )
+{
+        //Create KD tree of points stored in rows of the matrix
+        const unsigned int n = points.rows();
+
+        if ( points.cols() != Dim )
+        {
+                throw ErrorBadData ( "ErrorBadData: can not create KD tree, ", "count of matrix columns differs from the dimension of the tree." );
+        }
+
+        std::vector <T> c ( n * Dim );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                for ( unsigned int d = 0; d < Dim; d++ )
+                {
+                        c[i * Dim + d] = points ( i, d );
+                }
+        }
+
+        createKDTree ( n > 0 ? &c[0] : NULL, n );
+}
+
+
+template <typename T, const unsigned int Dim>
+template <typename Point>
+void KDTree <T, Dim> ::createKDTree ( const Container <Point *> &pl )
+{
+        //Create KD tree of cartesian points, the container is not reordered
+        const unsigned int n = pl.size();
+
+        std::vector <T> c ( n * Dim );
+
+        for ( unsigned int i = 0; i < n; i++ )
+        {
+                getCoordinates ( pl [i], &c[i * Dim] );
+        }
+
+        createKDTree ( n > 0 ? &c[0] : NULL, n );
+}
+
+
+template <typename T, const unsigned int Dim>
+template <typename Point>
+void KDTree <T, Dim> ::getCoordinates ( const Point * point, T * c )
+{
+        //Get coordinates x, y, z of the cartesian point, remaining coordinates are zero
+        const T xyz[3] = {point->getX(), point->getY(), point->getZ() };
+
+        for ( unsigned int d = 0; d < Dim; d++ )
+        {
+                c[d] = ( d < 3 ? xyz[d] : 0 );
+        }
+}
+
+
+template <typename T, const unsigned int Dim>
+unsigned int KDTree <T, Dim> ::buildNode ( std::vector <unsigned int> &indices, const std::vector <T> *coordinates, const unsigned int begin, const unsigned int end )
+{
+        //Build the subtree of points [begin, end), return its index
+        const unsigned int node = nodes.size();
+        nodes.push_back ( TFlatKDNode <T> ( begin, end ) );
+
+        //Create leaf
+        if ( end - begin <= bucket_size )
+        {
+                return node;
+        }
+
+        //Split by the coordinate of the largest extent of the bounding box
+        unsigned int axis = 0;
+        T max_extent = -1;
+
+        for ( unsigned int d = 0; d < Dim; d++ )
+        {
+                T c_min = coordinates[d][indices[begin]], c_max = c_min;
+
+                for ( unsigned int i = begin + 1; i < end; i++ )
+                {
+                        const T ci = coordinates[d][indices[i]];
+
+                        if ( ci < c_min ) c_min = ci;
+                        else if ( ci > c_max ) c_max = ci;
+                }
+
+                if ( c_max - c_min > max_extent )
+                {
+                        max_extent = c_max - c_min;
+                        axis = d;
+                }
+        }
+
+        //Find median: points [begin, median) <= split value <= points [median, end)
+        const unsigned int median = begin + ( end - begin ) / 2;
+        std::nth_element ( indices.begin() + begin, indices.begin() + median, indices.begin() + end,
+                           indexComp <typename std::vector <T>::const_iterator> ( coordinates[axis].begin(), coordinates[axis].end() ) );
+
+        nodes[node].split_axis = axis;
+        nodes[node].split_value = coordinates[axis][indices[median]];
+
+        //Build left subtree, it follows the node
+        buildNode ( indices, coordinates, begin, median );
+
+        //Build right subtree
+        const unsigned int right = buildNode ( indices, coordinates, median, end );
+        nodes[node].right = right;
+
+        return node;
+}
+
+
+template <typename T, const unsigned int Dim>
+void KDTree <T, Dim> ::clearKDTree()
+{
+        //Clear KD tree
+        nodes.clear();
+        coordinates.clear();
+        indices.clear();
+}
+
+
+template <typename T, const unsigned int Dim>
+void KDTree <T, Dim> ::descendKDTree ( const T * point, unsigned int &node, const T dist_box, T * offsets, unsigned int * stack_nodes, T * stack_dist, T ( *stack_offsets ) [Dim], unsigned int &top ) const
+{
+        //Descend from the node into the leaf containing q, push further subtrees to the stack
+        //Lower bound of the further subtree: squared distance to its box, the offset along the split axis is replaced (incremental distance)
+        while ( !nodes[node].isLeaf() )
+        {
+                const TFlatKDNode <T> &n = nodes[node];
+                const unsigned int axis = n.split_axis;
+                const T diff = point[axis] - n.split_value;
+
+                stack_nodes[top] = ( diff < 0 ? n.right : node + 1 );
+                stack_dist[top] = dist_box - offsets[axis] * offsets[axis] + diff * diff;
+                std::copy ( offsets, offsets + Dim, stack_offsets[top] );
+                stack_offsets[top][axis] = diff;
+                top++;
+
+                node = ( diff < 0 ? node + 1 : n.right );
+        }
+}
+
+
+template <typename T, const unsigned int Dim>
+T KDTree <T, Dim> ::getDist2 ( const T * point, const unsigned int i ) const
+{
+        //Squared distance of the point and the i-th point of the tree
+        const T * c = &coordinates[i * Dim];
+        T dist = 0;
+
+        for ( unsigned int d = 0; d < Dim; d++ )
+        {
+                dist += ( c[d] - point[d] ) * ( c[d] - point[d] );
+        }
+
+        return dist;
+}
+
+
+template <typename T, const unsigned int Dim>
+unsigned int KDTree <T, Dim> ::findNN ( const T * point, T * distance ) const
+{
+        //Find nearest neighbour, return its index in the source data
+
+        //No KD-tree constructed
+        if ( nodes.empty() )
+        {
+                throw ErrorBadOutput ( "ErrorBadOutput: can not find nearest neighbour, ", "no KD-Tree has been constructed." );
+        }
+
+        T min_dist = std::numeric_limits <T>::max();
+        unsigned int nearest = 0;
+
+        //Stack of subtrees to be processed, the lower bound of the squared distance to their points and offsets of q from their boxes along axes
+        //Depth of the balanced tree <= 32
+        unsigned int stack_nodes[64];
+        T stack_dist[64];
+        T stack_offsets[64][Dim];
+        unsigned int top = 0;
+
+        stack_nodes[top] = 0;
+        stack_dist[top] = 0;
+        std::fill ( stack_offsets[top], stack_offsets[top] + Dim, ( T ) 0 );
+        top++;
+
+        while ( top > 0 )
+        {
+                unsigned int node = stack_nodes[--top];
+                T dist_box = stack_dist[top];
+
+                //Subtree is further than the nearest point
+                if ( dist_box >= min_dist )
+                {
+                        continue;
+                }
+
+                T offsets[Dim];
+                std::copy ( stack_offsets[top], stack_offsets[top] + Dim, offsets );
+
+                //Descend into the leaf containing q, remember further subtrees
+                descendKDTree ( point, node, dist_box, offsets, stack_nodes, stack_dist, stack_offsets, top );
+
+                //Scan points of the leaf
+                for ( unsigned int i = nodes[node].begin; i < nodes[node].end; i++ )
+                {
+                        const T dist = getDist2 ( point, i );
+
+                        if ( dist < min_dist )
+                        {
+                                min_dist = dist;
+                                nearest = i;
+                        }
+                }
+        }
+
+        if ( distance != NULL ) *distance = sqrt ( min_dist );
+
+        return indices[nearest];
+}
+
+
+template <typename T, const unsigned int Dim>
+void KDTree <T, Dim> ::findAllKNN ( const T * point, unsigned int k, TIndexList &knn, std::vector <T> *distances ) const
+{
+        //Find all k-nearest neighbours to the specified point, sorted by the distance
+
+        //No KD-tree constructed
+        if ( nodes.empty() )
+        {
+                throw ErrorBadOutput ( "ErrorBadOutput: can not find all k-nearest neighbour nodes, ", "no KD-Tree has been constructed." );
+        }
+
+        //Set new k
+        k = std::min ( k, ( unsigned int ) indices.size() );
+
+        if ( k == 0 )
+        {
+                return;
+        }
+
+        //Max-heap of k nearest points (squared distance, index), the furthest one is on the top
+        std::vector <std::pair <T, unsigned int> > heap;
+        heap.reserve ( k );
+
+        //Stack of subtrees to be processed, the lower bound of the squared distance to their points and offsets of q from their boxes along axes
+        unsigned int stack_nodes[64];
+        T stack_dist[64];
+        T stack_offsets[64][Dim];
+        unsigned int top = 0;
+
+        stack_nodes[top] = 0;
+        stack_dist[top] = 0;
+        std::fill ( stack_offsets[top], stack_offsets[top] + Dim, ( T ) 0 );
+        top++;
+
+        while ( top > 0 )
+        {
+                unsigned int node = stack_nodes[--top];
+                T dist_box = stack_dist[top];
+
+                //Subtree is further than k-th nearest point
+                if ( ( heap.size() == k ) && ( dist_box >= heap.front().first ) )
+                {
+                        continue;
+                }
+
+                T offsets[Dim];
+                std::copy ( stack_offsets[top], stack_offsets[top] + Dim, offsets );
+
+                //Descend into the leaf containing q, remember further subtrees
+                descendKDTree ( point, node, dist_box, offsets, stack_nodes, stack_dist, stack_offsets, top );
+
+                //Scan points of the leaf
+                for ( unsigned int i = nodes[node].begin; i < nodes[node].end; i++ )
+                {
+                        const T dist = getDist2 ( point, i );
+
+                        //There are free positions in the heap
+                        if ( heap.size() < k )
+                        {
+                                heap.push_back ( std::make_pair ( dist, i ) );
+                                std::push_heap ( heap.begin(), heap.end() );
+                        }
+
+                        //Replace the furthest point
+                        else if ( dist < heap.front().first )
+                        {
+                                std::pop_heap ( heap.begin(), heap.end() );
+                                heap.back() = std::make_pair ( dist, i );
+                                std::push_heap ( heap.begin(), heap.end() );
+                        }
+                }
+        }
+
+        //Copy nearest neighbours to the list, ascending distances
+        std::sort_heap ( heap.begin(), heap.end() );
+
+        for ( unsigned int i = 0; i < heap.size(); i++ )
+        {
+                knn.push_back ( indices[heap[i].second] );
+
+                if ( distances != NULL ) distances->push_back ( sqrt ( heap[i].first ) );
+        }
+}
+
+
+template <typename T, const unsigned int Dim>
+void KDTree <T, Dim> ::findInRadius ( const T * point, const T radius, TIndexList &points, std::vector <T> *distances ) const
+{
+        //Find all points with the distance to the specified point <= radius
+        findInRadiusNodes ( point, radius, &points, distances );
+}
+
+
+template <typename T, const unsigned int Dim>
+unsigned int KDTree <T, Dim> ::countInRadius ( const T * point, const T radius ) const
+{
+        //Count all points with the distance to the specified point <= radius
+        return findInRadiusNodes ( point, radius, NULL, NULL );
+}
+
+
+template <typename T, const unsigned int Dim>
+unsigned int KDTree <T, Dim> ::findInRadiusNodes ( const T * point, const T radius, TIndexList *points, std::vector <T> *distances ) const
+{
+        //Find (or count, if no output list is given) points inside the hypersphere
+        if ( nodes.empty() )
+        {
+                return 0;
+        }
+
+        unsigned int count = 0;
+        const T radius2 = radius * radius;
+
+        //Stack of subtrees intersecting the hypersphere
+        unsigned int stack_nodes[64];
+        unsigned int top = 0;
+
+        stack_nodes[top++] = 0;
+
+        while ( top > 0 )
+        {
+                const unsigned int node = stack_nodes[--top];
+                const TFlatKDNode <T> &n = nodes[node];
+
+                //Scan points of the leaf
+                if ( n.isLeaf() )
+                {
+                        for ( unsigned int i = n.begin; i < n.end; i++ )
+                        {
+                                const T dist = getDist2 ( point, i );
+
+                                if ( dist <= radius2 )
+                                {
+                                        if ( points != NULL ) points->push_back ( indices[i] );
+
+                                        if ( distances != NULL ) distances->push_back ( sqrt ( dist ) );
+
+                                        count++;
+                                }
+                        }
+
+                        continue;
+                }
+
+                //Hypersphere intersects the right halfspace
+                const T diff = point[n.split_axis] - n.split_value;
+
+                if ( diff + radius >= 0 )
+                {
+                        stack_nodes[top++] = n.right;
+                }
+
+                //Hypersphere intersects the left halfspace
+                if ( diff - radius <= 0 )
+                {
+                        stack_nodes[top++] = node + 1;
+                }
+        }
+
+        return count;
+}
+
+#endif
@@ -0,0 +1,220 @@
+// Description: Checks of the constrained Delaunay triangulation: constrained edges are present, the remaining edges are locally Delaunay
+
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <set>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include <sstream>
+
+#include "libalgo/source/structures/point/Node3DCartesian.h"
+#include "libalgo/source/structures/line/Edge.h"
+#include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/TriangleMesh.h"
+#include "libalgo/source/algorithms/triangulations2D/CDT2D.h"
+#include "libalgo/source/algorithms/robustpredicates/RobustPredicates.h"
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+
+#include "Test.h"
+
+
+typedef Node3DCartesian <double> TNode;
+typedef std::set <std::pair <const TNode *, const TNode *> > TEdgesSet;
+
+
+static std::pair <const TNode *, const TNode *> getEdge ( const TNode * p1, const TNode * p2 )
+{
+        return std::make_pair ( std::min ( p1, p2 ), std::max ( p1, p2 ) );
+}
+
+
+//Segments (p1, p2), (p3, p4) cross in a point inside both of them
+static bool crossSegments ( const TNode * p1, const TNode * p2, const TNode * p3, const TNode * p4 )
+{
+        return ( RobustPredicates::getOrientation2D ( p1, p2, p3 ) * RobustPredicates::getOrientation2D ( p1, p2, p4 ) < 0 ) &&
+               ( RobustPredicates::getOrientation2D ( p3, p4, p1 ) * RobustPredicates::getOrientation2D ( p3, p4, p2 ) < 0 );
+}
+
+
+//Parts of the constrained edge between the points lying on it, sorted from its start point
+static std::vector <std::pair <const TNode *, const TNode *> > splitConstrainedEdge ( const Container <TNode *> &nl, const TNode * p1, const TNode * p2 )
+{
+        std::vector <std::pair <double, const TNode *> > points;
+
+        for ( unsigned int i = 0; i < nl.size(); i++ )
+        {
+                const double dx = p2->getX() - p1->getX(), dy = p2->getY() - p1->getY();
+                const double t = ( ( nl[i]->getX() - p1->getX() ) * dx + ( nl[i]->getY() - p1->getY() ) * dy ) / ( dx * dx + dy * dy );
+
+                if ( ( RobustPredicates::getOrientation2D ( p1, p2, nl[i] ) == 0 ) && ( t >= 0 ) && ( t <= 1 ) ) points.push_back ( std::make_pair ( t, nl[i] ) );
+        }
+
+        std::sort ( points.begin(), points.end() );
+
+        std::vector <std::pair <const TNode *, const TNode *> > parts;
+
+        for ( unsigned int i = 1; i < points.size(); i++ ) parts.push_back ( getEdge ( points[i - 1].second, points[i].second ) );
+
+        return parts;
+}
+
+
+//Triangulate points with the constrained edges; check the mesh, presence of all constrained edges and the Delaunay property of the remaining edges
+static void checkCDT ( Container <TNode *> &nl, const Container <Edge <TNode> *> &constrained_edges )
+{
+        TriangleMesh <double> mesh;
+        std::ostringstream output;
+
+        CDT2D::CDT ( nl, mesh, constrained_edges, false, true, &output );
+
+        TEST_CHECK ( mesh.getPointsCount() == nl.size() );
+
+        //Constrained edges, split in the points lying on them
+        TEdgesSet constrained;
+
+        for ( unsigned int i = 0; i < constrained_edges.size(); i++ )
+        {
+                const std::vector <std::pair <const TNode *, const TNode *> > parts = splitConstrainedEdge ( nl, constrained_edges[i]->getP1(), constrained_edges[i]->getP2() );
+                constrained.insert ( parts.begin(), parts.end() );
+        }
+
+        TEdgesSet edges;
+        bool valid = true, delaunay = true;
+
+        for ( unsigned int e = 0; e < mesh.getEdgesCount(); e++ )
+        {
+                const TNode * p1 = mesh.getPoint ( e ), * p2 = mesh.getPoint ( TriangleMesh <double>::getNextEdge ( e ) ), * p3 = mesh.getPoint ( TriangleMesh <double>::getPreviousEdge ( e ) );
+
+                edges.insert ( getEdge ( p1, p2 ) );
+
+                //Triangle is counterclockwise
+                valid = valid && RobustPredicates::getOrientation2D ( p1, p2, p3 ) > 0;
+
+                if ( mesh.isBoundaryEdge ( e ) ) continue;
+
+                //Twin edge has the opposite direction
+                const unsigned int t = mesh.getTwinEdge ( e );
+                valid = valid && mesh.getTwinEdge ( t ) == e && mesh.getStartVertex ( t ) == mesh.getEndVertex ( e ) && mesh.getEndVertex ( t ) == mesh.getStartVertex ( e );
+
+                //Edge, which is not constrained, is locally Delaunay
+                if ( constrained.find ( getEdge ( p1, p2 ) ) == constrained.end() )
+                {
+                        delaunay = delaunay && RobustPredicates::getInCircle ( p1, p2, p3, mesh.getPoint ( TriangleMesh <double>::getPreviousEdge ( t ) ) ) <= 0;
+                }
+        }
+
+        TEST_CHECK ( valid );
+        TEST_CHECK ( delaunay );
+
+        //All constrained edges are present
+        bool present = true;
+
+        for ( TEdgesSet::const_iterator i_edge = constrained.begin(); i_edge != constrained.end(); ++i_edge ) present = present && edges.find ( *i_edge ) != edges.end();
+
+        TEST_CHECK ( present );
+}
+
+
+int main()
+{
+        srand ( 1 );
+
+        //Random points, long constrained edges not crossing each other
+        Container <TNode *> nl;
+
+        for ( unsigned int i = 0; i < 1000; i++ ) nl.push_back ( new TNode ( testRandom ( 0, 1000 ), testRandom ( 0, 1000 ), 0 ) );
+
+        Container <Edge <TNode> *> constrained_edges;
+
+        for ( unsigned int i = 0; ( i < 5000 ) && ( constrained_edges.size() < 100 ); i++ )
+        {
+                TNode * p1 = nl[rand() % nl.size()], * p2 = nl[rand() % nl.size()];
+
+                bool crossing = ( p1 == p2 );
+
+                for ( unsigned int j = 0; ( j < constrained_edges.size() ) && !crossing; j++ ) crossing = crossSegments ( p1, p2, constrained_edges[j]->getP1(), constrained_edges[j]->getP2() );
+
+                if ( !crossing ) constrained_edges.push_back ( new Edge <TNode> ( p1, p2 ) );
+        }
+
+        TEST_CHECK ( constrained_edges.size() == 100 );
+
+        //Already inserted edge, reversed edge, degenerated edge
+        constrained_edges.push_back ( new Edge <TNode> ( constrained_edges[0]->getP1(), constrained_edges[0]->getP2() ) );
+        constrained_edges.push_back ( new Edge <TNode> ( constrained_edges[1]->getP2(), constrained_edges[1]->getP1() ) );
+        constrained_edges.push_back ( new Edge <TNode> ( nl[0], nl[0] ) );
+
+        checkCDT ( nl, constrained_edges );
+
+        //Points on the grid: constrained edges pass through the vertices and meet in them
+        Container <TNode *> nl_grid;
+
+        for ( unsigned int i = 0; i < 15; i++ )
+        {
+                for ( unsigned int j = 0; j < 15; j++ ) nl_grid.push_back ( new TNode ( i, j, 0 ) );
+        }
+
+        Container <Edge <TNode> *> constrained_edges_grid;
+        constrained_edges_grid.push_back ( new Edge <TNode> ( nl_grid[0], nl_grid[15 * 15 - 1] ) );
+        constrained_edges_grid.push_back ( new Edge <TNode> ( nl_grid[7], nl_grid[14 * 15 + 7] ) );
+        constrained_edges_grid.push_back ( new Edge <TNode> ( nl_grid[3 * 15], nl_grid[3 * 15 + 14] ) );
+        constrained_edges_grid.push_back ( new Edge <TNode> ( nl_grid[14], nl_grid[14 * 15] ) );
+        constrained_edges_grid.push_back ( new Edge <TNode> ( nl_grid[1], nl_grid[2 * 15 + 3] ) );
+
+        //Crosses the last constrained edge
+        Edge <TNode> * crossing_grid = new Edge <TNode> ( nl_grid[2], nl_grid[15 + 1] );
+
+        checkCDT ( nl_grid, constrained_edges_grid );
+
+        //Constrained edges crossing each other
+        Container <Edge <TNode> *> constrained_edges_crossing;
+
+        for ( unsigned int i = 1; i < nl.size() && constrained_edges_crossing.empty(); i++ )
+        {
+                for ( unsigned int j = 1; j < i && constrained_edges_crossing.empty(); j++ )
+                {
+                        if ( crossSegments ( constrained_edges[0]->getP1(), constrained_edges[0]->getP2(), nl[i], nl[j] ) )
+                        {
+                                constrained_edges_crossing.push_back ( new Edge <TNode> ( constrained_edges[0]->getP1(), constrained_edges[0]->getP2() ) );
+                                constrained_edges_crossing.push_back ( new Edge <TNode> ( nl[i], nl[j] ) );
+                        }
+                }
+        }
+
+        TriangleMesh <double> mesh;
+        TEST_CHECK ( constrained_edges_crossing.size() == 2 );
+        TEST_THROWS ( CDT2D::CDT ( nl, mesh, constrained_edges_crossing, false, false ), ErrorBadData );
+        TEST_CHECK ( mesh.empty() );
+
+        //Constrained edges crossing each other in the grid
+        constrained_edges_grid.push_back ( crossing_grid );
+        TEST_THROWS ( CDT2D::CDT ( nl_grid, mesh, constrained_edges_grid, false, false ), ErrorBadData );
+
+        //End point of the constrained edge is not a point of the triangulation
+        Container <Edge <TNode> *> constrained_edges_outside;
+        TNode outside ( 2000, 2000, 0 );
+        constrained_edges_outside.push_back ( new Edge <TNode> ( nl[0], &outside ) );
+        TEST_THROWS ( CDT2D::CDT ( nl, mesh, constrained_edges_outside, false, false ), ErrorBadData );
+
+        return testResult ( "CDT2DTest" );
+}
@@ -0,0 +1,200 @@
+// Description: Checks of the convex hull against the monotone chain algorithm
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+#include "libalgo/source/structures/point/Point3DCartesian.h"
+#include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/PointArray.h"
+#include "libalgo/source/structures/list/IndexLists.h"
+#include "libalgo/source/algorithms/convexhull/ConvexHull.h"
+#include "libalgo/source/algorithms/robustpredicates/RobustPredicates.h"
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+
+#include "Test.h"
+
+
+typedef std::pair <double, double> TPoint;
+
+
+static bool isNotLeftTurn ( const TPoint & p1, const TPoint & p2, const TPoint & p3 )
+{
+        return RobustPredicates::getOrientation2D ( p1.first, p1.second, p2.first, p2.second, p3.first, p3.second ) <= 0;
+}
+
+
+//Convex hull using the monotone chain algorithm: counterclockwise, starts at the lexicographically smallest point, no collinear vertices
+static std::vector <TPoint> monotoneChain ( const PointArray <double> &pa )
+{
+        std::vector <TPoint> p, hull;
+
+        for ( unsigned int i = 0; i < pa.size(); i++ ) p.push_back ( TPoint ( pa.getX ( i ), pa.getY ( i ) ) );
+
+        std::sort ( p.begin(), p.end() );
+        p.erase ( std::unique ( p.begin(), p.end() ), p.end() );
+
+        if ( p.size() < 3 ) return p;
+
+        //Lower hull
+        for ( unsigned int i = 0; i < p.size(); i++ )
+        {
+                while ( hull.size() >= 2 && isNotLeftTurn ( hull[hull.size() - 2], hull.back(), p[i] ) ) hull.pop_back();
+
+                hull.push_back ( p[i] );
+        }
+
+        //Upper hull
+        const unsigned int lower_size = hull.size() + 1;
+
+        for ( int i = p.size() - 2; i >= 0; i-- )
+        {
+                while ( hull.size() >= lower_size && isNotLeftTurn ( hull[hull.size() - 2], hull.back(), p[i] ) ) hull.pop_back();
+
+                hull.push_back ( p[i] );
+        }
+
+        hull.pop_back();
+
+        return hull;
+}
+
+
+//Compare the hull with the monotone chain, points given by the array of coordinates
+static bool checkHull ( const double * coords, const unsigned int n )
+{
+        PointArray <double> pa;
+
+        for ( unsigned int i = 0; i < n; i++ ) pa.push_back ( coords[2 * i], coords[2 * i + 1] );
+
+        TIndexList il;
+
+        try
+        {
+                ConvexHull::getConvexHull ( pa, il, false );
+        }
+
+        catch ( ErrorBadData & )
+        {
+                //Hull can not be created only for collinear points
+                return monotoneChain ( pa ).size() < 3;
+        }
+
+        std::vector <TPoint> hull;
+
+        for ( unsigned int i = 0; i < il.size(); i++ ) hull.push_back ( TPoint ( pa.getX ( il[i] ), pa.getY ( il[i] ) ) );
+
+        return hull == monotoneChain ( pa );
+}
+
+
+int main()
+{
+        srand ( 1 );
+
+        //Extremal points share the vertex (x_min = y_min), the MBR edge is degenerate
+        const double p1[] = {0, 0, 2, 1, 1, 2, 1, 0.5};
+        TEST_CHECK ( checkHull ( p1, 4 ) );
+
+        //Extremal points on the same MBR edge are collinear
+        const double p2[] = {1, 0, 0, 0, 2, 0, 1, 1, 2, 0};
+        TEST_CHECK ( checkHull ( p2, 5 ) );
+
+        //Square with the points in the middle of its edges and duplicate vertices
+        const double p3[] = {0, 1, 1, 0, 2, 1, 1, 2, 0, 0, 2, 0, 2, 2, 0, 2, 0, 0, 2, 2, 1, 1};
+        TEST_CHECK ( checkHull ( p3, 11 ) );
+
+        //Two extremal points only, the rest is on one side
+        const double p4[] = {0, 0, 2, 2, 1, 0.5, 1.5, 0.25};
+        TEST_CHECK ( checkHull ( p4, 4 ) );
+
+        //Collinear and identical points, not enough points
+        const double p5[] = {0, 0, 1, 1, 2, 2, 3, 3};
+        const double p6[] = {1, 1, 1, 1, 1, 1};
+        PointArray <double> pa5, pa6, pa7;
+
+        for ( unsigned int i = 0; i < 4; i++ ) pa5.push_back ( p5[2 * i], p5[2 * i + 1] );
+
+        for ( unsigned int i = 0; i < 3; i++ ) pa6.push_back ( p6[2 * i], p6[2 * i + 1] );
+
+        pa7.push_back ( 0, 0 ); pa7.push_back ( 1, 0 );
+
+        TIndexList il;
+        TEST_THROWS ( ConvexHull::getConvexHull ( pa5, il, false ), ErrorBadData );
+        TEST_THROWS ( ConvexHull::getConvexHull ( pa6, il, false ), ErrorBadData );
+        TEST_THROWS ( ConvexHull::getConvexHull ( pa7, il, false ), ErrorBadData );
+
+        //Small sets on the coarse grid: many ties of the extremal points, collinear and identical points
+        bool grid_ok = true;
+
+        for ( unsigned int i = 0; i < 300; i++ )
+        {
+                const unsigned int n = 3 + rand() % 18;
+                std::vector <double> p ( 2 * n );
+
+                for ( unsigned int j = 0; j < 2 * n; j++ ) p[j] = rand() % 4 * 0.5;
+
+                grid_ok = grid_ok && checkHull ( &p[0], n );
+        }
+
+        TEST_CHECK ( grid_ok );
+
+        //Random points
+        bool random_ok = true;
+
+        for ( unsigned int i = 0; i < 100; i++ )
+        {
+                const unsigned int n = 3 + rand() % 1000;
+                std::vector <double> p ( 2 * n );
+
+                for ( unsigned int j = 0; j < 2 * n; j++ ) p[j] = testRandom ( -1, 1 );
+
+                random_ok = random_ok && checkHull ( &p[0], n );
+        }
+
+        TEST_CHECK ( random_ok );
+
+        //Full grid
+        std::vector <double> g;
+
+        for ( unsigned int i = 0; i < 10; i++ )
+        {
+                for ( unsigned int j = 0; j < 10; j++ )
+                {
+                        g.push_back ( ( i * 7 ) % 10 ); g.push_back ( ( j * 3 ) % 10 );
+                }
+        }
+
+        TEST_CHECK ( checkHull ( &g[0], 100 ) );
+
+        //Hull of the container of points
+        Container <Point3DCartesian <double> *> pl;
+        Container <Point3DCartesian <double> *, NonDestructable> hull;
+
+        for ( unsigned int i = 0; i < 4; i++ ) pl.push_back ( new Point3DCartesian <double> ( p1[2 * i], p1[2 * i + 1] ) );
+
+        ConvexHull::getConvexHull ( pl, hull, false );
+        TEST_CHECK ( hull.size() == 3 && hull[0] == pl[0] && hull[1] == pl[1] && hull[2] == pl[2] );
+
+        return testResult ( "ConvexHullTest" );
+}
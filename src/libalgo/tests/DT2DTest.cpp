@@ -0,0 +1,185 @@
+// Description: Checks of the Delaunay triangulation methods and insertion orders, validity of the triangle mesh
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <set>
+#include <vector>
+#include <utility>
+#include <sstream>
+
+#include "libalgo/source/structures/point/Node3DCartesian.h"
+#include "libalgo/source/structures/line/HalfEdge.h"
+#include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/TriangleMesh.h"
+#include "libalgo/source/algorithms/triangulations2D/DT2D.h"
+#include "libalgo/source/algorithms/robustpredicates/RobustPredicates.h"
+#include "libalgo/source/algorithms/lawsonorientedwalk/LawsonOrientedWalk.h"
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+
+#include "Test.h"
+
+
+typedef std::set <std::pair <const Node3DCartesian <double> *, const Node3DCartesian <double> *> > TEdgesSet;
+
+
+//Check the mesh: counterclockwise triangles, consistent twins, all points used, Delaunay edges, count of triangles; store its edges
+static bool checkMesh ( const TriangleMesh <double> &mesh, const unsigned int n, TEdgesSet &edges )
+{
+        bool valid = mesh.getPointsCount() == n;
+        unsigned int boundary_edges = 0;
+        std::vector <bool> used_points ( mesh.getPointsCount(), false );
+
+        edges.clear();
+
+        for ( unsigned int e = 0; e < mesh.getEdgesCount(); e++ )
+        {
+                const Node3DCartesian <double> * p1 = mesh.getPoint ( e ), * p2 = mesh.getPoint ( TriangleMesh <double>::getNextEdge ( e ) ), * p3 = mesh.getPoint ( TriangleMesh <double>::getPreviousEdge ( e ) );
+
+                used_points[mesh.getStartVertex ( e )] = true;
+
+                //Triangle is counterclockwise
+                valid = valid && RobustPredicates::getOrientation2D ( p1, p2, p3 ) > 0;
+
+                if ( mesh.isBoundaryEdge ( e ) )
+                {
+                        boundary_edges++;
+                        edges.insert ( std::make_pair ( std::min ( p1, p2 ), std::max ( p1, p2 ) ) );
+                        continue;
+                }
+
+                //Twin edge has the opposite direction
+                const unsigned int t = mesh.getTwinEdge ( e );
+                valid = valid && mesh.getTwinEdge ( t ) == e && mesh.getStartVertex ( t ) == mesh.getEndVertex ( e ) && mesh.getEndVertex ( t ) == mesh.getStartVertex ( e );
+
+                //Opposite vertex of the adjacent triangle is not inside the circumcircle
+                valid = valid && RobustPredicates::getInCircle ( p1, p2, p3, mesh.getPoint ( TriangleMesh <double>::getPreviousEdge ( t ) ) ) <= 0;
+
+                edges.insert ( std::make_pair ( std::min ( p1, p2 ), std::max ( p1, p2 ) ) );
+        }
+
+        for ( unsigned int i = 0; i < used_points.size(); i++ ) valid = valid && used_points[i];
+
+        //Count of triangles of the triangulation of the convex hull, boundary edges connect all hull points
+        return valid && mesh.getTrianglesCount() == 2 * n - 2 - boundary_edges;
+}
+
+
+//Triangulate points by all methods and insertion orders, compare the edges if the triangulation is unique
+static void checkDT ( Container <Node3DCartesian <double> *> &nl, const bool unique )
+{
+        const TDTMethod methods[] = {IncrementalInsertion, IncrementalInsertion, IncrementalInsertion, DivideAndConquer};
+        const TDTInsertionOrder orders[] = {BinsOrder, HilbertOrder, BRIOOrder, BinsOrder};
+
+        TEdgesSet edges_first;
+        unsigned int triangles_count_first = 0;
+
+        for ( unsigned int i = 0; i < 4; i++ )
+        {
+                TriangleMesh <double> mesh;
+                TWalkStatistics walk_statistics;
+                std::ostringstream output;
+
+                DT2D::DT ( nl, mesh, false, true, &output, methods[i], orders[i], &walk_statistics );
+
+                TEdgesSet edges;
+                TEST_CHECK ( checkMesh ( mesh, nl.size(), edges ) );
+
+                //Each incremental insertion performs one walk
+                if ( methods[i] == IncrementalInsertion ) TEST_CHECK ( walk_statistics.walks == nl.size() );
+
+                if ( i == 0 )
+                {
+                        edges_first = edges;
+                        triangles_count_first = mesh.getTrianglesCount();
+                }
+
+                //All methods create the same triangulation
+                else
+                {
+                        TEST_CHECK ( mesh.getTrianglesCount() == triangles_count_first );
+
+                        if ( unique ) TEST_CHECK ( edges == edges_first );
+                }
+        }
+}
+
+
+int main()
+{
+        srand ( 1 );
+
+        //Random points, larger set is triangulated by the parallel divide and conquer
+        const unsigned int counts[] = {3, 10, 1000, 2 * DT_PARALLEL_BUILD_SIZE + 100};
+
+        for ( unsigned int i = 0; i < 4; i++ )
+        {
+                Container <Node3DCartesian <double> *> nl;
+
+                for ( unsigned int j = 0; j < counts[i]; j++ ) nl.push_back ( new Node3DCartesian <double> ( testRandom ( 0, 1000 ), testRandom ( 0, 1000 ), 0 ) );
+
+                checkDT ( nl, true );
+        }
+
+        //Points on the grid: cocircular points, the triangulation is not unique
+        Container <Node3DCartesian <double> *> nl_grid;
+
+        for ( unsigned int i = 0; i < 20; i++ )
+        {
+                for ( unsigned int j = 0; j < 20; j++ ) nl_grid.push_back ( new Node3DCartesian <double> ( i, j, 0 ) );
+        }
+
+        checkDT ( nl_grid, false );
+
+        //Duplicate points are removed
+        Container <Node3DCartesian <double> *> nl_duplicate;
+
+        for ( unsigned int i = 0; i < 50; i++ ) nl_duplicate.push_back ( new Node3DCartesian <double> ( testRandom ( 0, 10 ), testRandom ( 0, 10 ), 0 ) );
+
+        for ( unsigned int i = 0; i < 10; i++ ) nl_duplicate.push_back ( new Node3DCartesian <double> ( nl_duplicate[i]->getX(), nl_duplicate[i]->getY(), 0 ) );
+
+        checkDT ( nl_duplicate, true );
+        TEST_CHECK ( nl_duplicate.size() == 50 );
+
+        //Half edges created from the mesh
+        Container <HalfEdge <double> *> half_edges;
+        TriangleMesh <double> mesh;
+        DT2D::DT ( nl_duplicate, mesh );
+        DT2D::DT ( nl_duplicate, half_edges );
+        TEST_CHECK ( half_edges.size() == mesh.getEdgesCount() );
+
+        //Collinear points: divide and conquer throws, incremental insertion creates no triangle
+        Container <Node3DCartesian <double> *> nl_collinear, nl_vertical;
+
+        for ( unsigned int i = 0; i < 10; i++ )
+        {
+                nl_collinear.push_back ( new Node3DCartesian <double> ( i, 2 * i, 0 ) );
+                nl_vertical.push_back ( new Node3DCartesian <double> ( 1, i, 0 ) );
+        }
+
+        std::ostringstream output;
+        TEST_THROWS ( DT2D::DT ( nl_collinear, mesh, false, false, &output, DivideAndConquer ), ErrorBadData );
+        TEST_THROWS ( DT2D::DT ( nl_vertical, mesh, false, false, &output, DivideAndConquer ), ErrorBadData );
+
+        DT2D::DT ( nl_collinear, mesh, false, false, &output, IncrementalInsertion );
+        TEST_CHECK ( mesh.empty() );
+
+        return testResult ( "DT2DTest" );
+}
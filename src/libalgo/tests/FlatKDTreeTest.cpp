@@ -0,0 +1,157 @@
+// Description: Checks of FlatKDTree2D against the brute force search (NN, k-NN, all NN of the other tree)
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "libalgo/source/structures/point/Point3DCartesian.h"
+#include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/tree/FlatKDTree.h"
+
+#include "libalgo/source/exceptions/ErrorBadOutput.h"
+
+#include "Test.h"
+
+
+typedef Point3DCartesian <double> TPoint;
+
+
+static double dist2 ( const TPoint * p1, const TPoint * p2 )
+{
+        return ( p1->getX() - p2->getX() ) * ( p1->getX() - p2->getX() ) + ( p1->getY() - p2->getY() ) * ( p1->getY() - p2->getY() );
+}
+
+
+//Sorted squared distances of all points of the list to q
+static std::vector <double> bruteForce ( const Container <TPoint *> &pl, const TPoint * q )
+{
+        std::vector <double> d ( pl.size() );
+
+        for ( unsigned int i = 0; i < pl.size(); i++ ) d[i] = dist2 ( pl[i], q );
+
+        std::sort ( d.begin(), d.end() );
+
+        return d;
+}
+
+
+static void checkTree ( const Container <TPoint *> &pl, const Container <TPoint *> &ql, const unsigned int bucket_size, const unsigned int k )
+{
+        FlatKDTree2D <TPoint> tree ( bucket_size );
+        tree.createKDTree2D ( pl );
+
+        TEST_CHECK ( tree.getPointsCount() == pl.size() );
+
+        for ( unsigned int i = 0; i < ql.size(); i++ )
+        {
+                const std::vector <double> d = bruteForce ( pl, ql[i] );
+
+                //Nearest neighbour: equidistant points may be returned, compare distances
+                const TPoint * nn = tree.findNN ( ql[i] );
+                TEST_CHECK ( nn != NULL && dist2 ( nn, ql[i] ) == d[0] );
+
+                //k nearest neighbours sorted by the distance
+                Container <TPoint *, NonDestructable> knn;
+                tree.findAllKNN ( ql[i], knn, k );
+
+                const unsigned int kk = std::min ( k, ( unsigned int ) pl.size() - 1 );
+                TEST_CHECK ( knn.size() == kk );
+
+                for ( unsigned int j = 0; j < knn.size() && j < kk; j++ )
+                {
+                        TEST_CHECK ( dist2 ( knn[j], ql[i] ) == d[j] );
+                }
+        }
+
+        //Nearest neighbours to all points of the query tree, results in the order of the query list
+        FlatKDTree2D <TPoint> query_tree ( bucket_size );
+        query_tree.createKDTree2D ( ql );
+
+        std::vector <TPoint *> nn;
+        std::vector <double> distances;
+        tree.findAllNN ( query_tree, nn, &distances );
+
+        TEST_CHECK ( nn.size() == ql.size() && distances.size() == ql.size() );
+
+        for ( unsigned int i = 0; i < nn.size(); i++ )
+        {
+                const double d0 = bruteForce ( pl, ql[i] ) [0];
+                TEST_CHECK ( dist2 ( nn[i], ql[i] ) == d0 );
+                TEST_CHECK ( fabs ( distances[i] - sqrt ( d0 ) ) <= 1.0e-12 * ( 1.0 + sqrt ( d0 ) ) );
+        }
+}
+
+
+int main()
+{
+        srand ( 1 );
+
+        Container <TPoint *> random_points, grid_points, duplicate_points, strip_points, queries;
+
+        //Uniformly distributed points
+        for ( unsigned int i = 0; i < 2000; i++ ) random_points.push_back ( new TPoint ( testRandom ( 0, 100 ), testRandom ( 0, 100 ) ) );
+
+        //Regular grid: many equidistant neighbours
+        for ( unsigned int i = 0; i < 40; i++ )
+        {
+                for ( unsigned int j = 0; j < 40; j++ ) grid_points.push_back ( new TPoint ( i, j ) );
+        }
+
+        //Repeated points: splitting values equal to the coordinates of many points
+        for ( unsigned int i = 0; i < 500; i++ ) duplicate_points.push_back ( new TPoint ( i % 3, ( i % 5 ) * 0.5 ) );
+
+        //Collinear points
+        for ( unsigned int i = 0; i < 500; i++ ) strip_points.push_back ( new TPoint ( 0.1 * i, 7.0 ) );
+
+        //Query points: random, on the grid and outside the data
+        for ( unsigned int i = 0; i < 150; i++ ) queries.push_back ( new TPoint ( testRandom ( -10, 110 ), testRandom ( -10, 110 ) ) );
+        for ( unsigned int i = 0; i < 50; i++ ) queries.push_back ( new TPoint ( i % 40, ( 7 * i ) % 40 ) );
+
+        const unsigned int bucket_sizes[] = { 1, 16 };
+
+        for ( unsigned int i = 0; i < 2; i++ )
+        {
+                checkTree ( random_points, queries, bucket_sizes[i], 10 );
+                checkTree ( grid_points, queries, bucket_sizes[i], 8 );
+                checkTree ( duplicate_points, queries, bucket_sizes[i], 20 );
+                checkTree ( strip_points, queries, bucket_sizes[i], 5 );
+        }
+
+        //Single point: no neighbour except the point itself
+        Container <TPoint *> single_point;
+        single_point.push_back ( new TPoint ( 1, 2 ) );
+
+        FlatKDTree2D <TPoint> single_tree;
+        single_tree.createKDTree2D ( single_point );
+        TEST_CHECK ( single_tree.findNN ( queries[0] ) == single_point[0] );
+
+        Container <TPoint *, NonDestructable> knn;
+        single_tree.findAllKNN ( queries[0], knn, 5 );
+        TEST_CHECK ( knn.size() == 0 );
+
+        //Empty tree
+        FlatKDTree2D <TPoint> empty_tree;
+        TEST_THROWS ( empty_tree.findNN ( queries[0] ), ErrorBadOutput );
+        TEST_THROWS ( empty_tree.findAllKNN ( queries[0], knn, 5 ), ErrorBadOutput );
+
+        return testResult ( "FlatKDTree2D" );
+}
@@ -0,0 +1,230 @@
+// Description: Checks of the N-dimensional KD tree and of the geographic KD tree against the brute force search
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "libalgo/source/structures/point/Point3DCartesian.h"
+#include "libalgo/source/structures/point/Point3DGeographic.h"
+#include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/matrix/Matrix.h"
+#include "libalgo/source/structures/tree/KDTreeND.h"
+#include "libalgo/source/structures/tree/KDTreeGeographic.h"
+
+#include "libalgo/source/exceptions/ErrorBadOutput.h"
+
+#include "Test.h"
+
+
+//Distances of all points (rows of P) to q, sorted, and the sorted indices of points inside the radius
+template <const unsigned int Dim>
+static void bruteForce ( const Matrix <double> &P, const double * q, const double radius, std::vector <double> &d, TIndexList &in_radius )
+{
+        d.clear(); in_radius.clear();
+
+        for ( unsigned int i = 0; i < P.rows(); i++ )
+        {
+                double s = 0;
+
+                for ( unsigned int j = 0; j < Dim; j++ ) s += ( P ( i, j ) - q[j] ) * ( P ( i, j ) - q[j] );
+
+                d.push_back ( sqrt ( s ) );
+
+                if ( sqrt ( s ) <= radius ) in_radius.push_back ( i );
+        }
+
+        std::sort ( d.begin(), d.end() );
+}
+
+
+template <const unsigned int Dim>
+static void checkTree ( const Matrix <double> &P, const unsigned int bucket_size )
+{
+        KDTree <double, Dim> tree ( bucket_size );
+        tree.createKDTree ( P );
+
+        TEST_CHECK ( tree.getPointsCount() == P.rows() );
+
+        for ( unsigned int i = 0; i < 100; i++ )
+        {
+                double q[Dim];
+
+                for ( unsigned int j = 0; j < Dim; j++ ) q[j] = testRandom ( -0.1, 1.1 );
+
+                std::vector <double> d;
+                TIndexList in_radius;
+                bruteForce <Dim> ( P, q, 0.3, d, in_radius );
+
+                //Nearest neighbour
+                double nn_dist = -1;
+                const unsigned int nn = tree.findNN ( q, &nn_dist );
+                TEST_CHECK ( nn < P.rows() && fabs ( nn_dist - d[0] ) < 1.0e-12 );
+
+                //k nearest neighbours sorted by the distance, k is limited by the points count
+                TIndexList knn;
+                std::vector <double> knn_dist;
+                tree.findAllKNN ( q, 7, knn, &knn_dist );
+                TEST_CHECK ( knn.size() == std::min ( 7u, P.rows() ) && knn_dist.size() == knn.size() );
+
+                for ( unsigned int j = 0; j < knn.size(); j++ )
+                {
+                        TEST_CHECK ( knn[j] < P.rows() && fabs ( knn_dist[j] - d[j] ) < 1.0e-12 );
+                }
+
+                //Points inside the hypersphere
+                TIndexList found;
+                tree.findInRadius ( q, 0.3, found );
+                std::sort ( found.begin(), found.end() );
+                TEST_CHECK ( found == in_radius );
+                TEST_CHECK ( tree.countInRadius ( q, 0.3 ) == in_radius.size() );
+        }
+}
+
+
+//Great circle distance (degrees) computed by the haversine formula
+static double greatCircle ( const double lat1, const double lon1, const double lat2, const double lon2 )
+{
+        const double r = M_PI / 180, dlat = ( lat2 - lat1 ) * r, dlon = ( lon2 - lon1 ) * r;
+        const double h = sin ( dlat / 2 ) * sin ( dlat / 2 ) + cos ( lat1 * r ) * cos ( lat2 * r ) * sin ( dlon / 2 ) * sin ( dlon / 2 );
+
+        return 2 * asin ( std::min ( sqrt ( h ), 1.0 ) ) / r;
+}
+
+
+static void checkGeographicTree()
+{
+        //Random points including the neighbourhood of poles and of the meridian 180 deg
+        Container <Point3DGeographic <double> *> pl, ql;
+
+        for ( unsigned int i = 0; i < 1500; i++ ) pl.push_back ( new Point3DGeographic <double> ( testRandom ( -90, 90 ), testRandom ( -180, 180 ) ) );
+        for ( unsigned int i = 0; i < 100; i++ ) pl.push_back ( new Point3DGeographic <double> ( testRandom ( 88, 90 ), testRandom ( -180, 180 ) ) );
+        for ( unsigned int i = 0; i < 100; i++ ) pl.push_back ( new Point3DGeographic <double> ( testRandom ( -5, 5 ), testRandom ( 179, 180 ) ) );
+
+        for ( unsigned int i = 0; i < 100; i++ ) ql.push_back ( new Point3DGeographic <double> ( testRandom ( -90, 90 ), testRandom ( -180, 180 ) ) );
+
+        ql.push_back ( new Point3DGeographic <double> ( 90, 0 ) );
+        ql.push_back ( new Point3DGeographic <double> ( 0, -179.99 ) );
+
+        KDTreeGeographic <double> tree;
+        tree.createKDTree ( pl );
+
+        for ( unsigned int i = 0; i < ql.size(); i++ )
+        {
+                std::vector <double> d;
+                TIndexList in_radius;
+
+                for ( unsigned int j = 0; j < pl.size(); j++ )
+                {
+                        d.push_back ( greatCircle ( ql[i]->getLat(), ql[i]->getLon(), pl[j]->getLat(), pl[j]->getLon() ) );
+
+                        if ( d.back() <= 5.0 ) in_radius.push_back ( j );
+                }
+
+                std::sort ( d.begin(), d.end() );
+
+                double nn_dist = -1;
+                const unsigned int nn = tree.findNN ( ql[i], &nn_dist );
+                TEST_CHECK ( fabs ( nn_dist - d[0] ) < 1.0e-9 );
+                TEST_CHECK ( fabs ( greatCircle ( ql[i]->getLat(), ql[i]->getLon(), pl[nn]->getLat(), pl[nn]->getLon() ) - d[0] ) < 1.0e-9 );
+
+                TIndexList knn;
+                std::vector <double> knn_dist;
+                tree.findAllKNN ( ql[i], 5, knn, &knn_dist );
+                TEST_CHECK ( knn.size() == 5 );
+
+                for ( unsigned int j = 0; j < knn.size(); j++ )
+                {
+                        TEST_CHECK ( fabs ( knn_dist[j] - d[j] ) < 1.0e-9 );
+                }
+
+                TIndexList found;
+                tree.findInRadius ( ql[i], 5.0, found );
+                std::sort ( found.begin(), found.end() );
+                TEST_CHECK ( found == in_radius );
+                TEST_CHECK ( tree.countInRadius ( ql[i], 5.0 ) == in_radius.size() );
+        }
+}
+
+
+int main()
+{
+        srand ( 1 );
+
+        //Parameter vectors
+        Matrix <double> P2 ( 3000, 2 ), P4 ( 3000, 4 ), P3 ( 3, 3 ), G ( 400, 3 );
+
+        for ( unsigned int i = 0; i < P4.rows(); i++ )
+        {
+                for ( unsigned int j = 0; j < 2; j++ ) P2 ( i, j ) = testRandom ( 0, 1 );
+                for ( unsigned int j = 0; j < 4; j++ ) P4 ( i, j ) = testRandom ( 0, 1 );
+        }
+
+        //Fewer points than k
+        for ( unsigned int i = 0; i < 3; i++ )
+        {
+                for ( unsigned int j = 0; j < 3; j++ ) P3 ( i, j ) = testRandom ( 0, 1 );
+        }
+
+        //Points on the coarse grid: repeated coordinates on all axes
+        for ( unsigned int i = 0; i < G.rows(); i++ )
+        {
+                G ( i, 0 ) = 0.2 * ( i % 5 ); G ( i, 1 ) = 0.25 * ( ( i / 5 ) % 4 ); G ( i, 2 ) = 0.5 * ( i % 3 );
+        }
+
+        const unsigned int bucket_sizes[] = { 1, 16 };
+
+        for ( unsigned int i = 0; i < 2; i++ )
+        {
+                checkTree <2> ( P2, bucket_sizes[i] );
+                checkTree <4> ( P4, bucket_sizes[i] );
+                checkTree <3> ( P3, bucket_sizes[i] );
+                checkTree <3> ( G, bucket_sizes[i] );
+        }
+
+        //Tree of cartesian points uses x, y, z
+        Container <Point3DCartesian <double> *> pl;
+
+        for ( unsigned int i = 0; i < 500; i++ ) pl.push_back ( new Point3DCartesian <double> ( testRandom ( 0, 1 ), testRandom ( 0, 1 ), testRandom ( 0, 1 ) ) );
+
+        KDTree <double, 3> tree;
+        tree.createKDTree ( pl );
+
+        for ( unsigned int i = 0; i < pl.size(); i += 50 )
+        {
+                const double q[3] = { pl[i]->getX(), pl[i]->getY(), pl[i]->getZ() };
+                double dist = -1;
+                TEST_CHECK ( tree.findNN ( q, &dist ) == i && dist == 0 );
+        }
+
+        //Geographic tree
+        checkGeographicTree();
+
+        //Empty tree
+        KDTree <double, 3> empty_tree;
+        const double q[3] = { 0, 0, 0 };
+        TIndexList knn;
+        TEST_THROWS ( empty_tree.findNN ( q ), ErrorBadOutput );
+        TEST_THROWS ( empty_tree.findAllKNN ( q, 3, knn ), ErrorBadOutput );
+        TEST_CHECK ( empty_tree.countInRadius ( q, 1 ) == 0 );
+
+        return testResult ( "KDTree" );
+}
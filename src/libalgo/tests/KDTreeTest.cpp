@@ -0,0 +1,243 @@
+// Description: Checks of the dynamic KD tree (insertions, erasures, scapegoat rebuilds) against the brute force search
+
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <cmath>
+#include <vector>
+#include <algorithm>
+
+#include "libalgo/source/const/Const.h"
+#include "libalgo/source/structures/point/Point3DCartesian.h"
+#include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/tree/KDNode.h"
+#include "libalgo/source/structures/tree/KDTree.h"
+
+#include "libalgo/source/exceptions/ErrorBadOutput.h"
+
+#include "Test.h"
+
+
+typedef Point3DCartesian <double> TPoint;
+
+
+static double dist2 ( const TPoint * p1, const TPoint * p2 )
+{
+        return ( p1->getX() - p2->getX() ) * ( p1->getX() - p2->getX() ) + ( p1->getY() - p2->getY() ) * ( p1->getY() - p2->getY() );
+}
+
+
+//Sorted squared distances of all points to q
+static std::vector <double> bruteForce ( const std::vector <TPoint *> &points, const TPoint * q )
+{
+        std::vector <double> d ( points.size() );
+
+        for ( unsigned int i = 0; i < points.size(); i++ ) d[i] = dist2 ( points[i], q );
+
+        std::sort ( d.begin(), d.end() );
+
+        return d;
+}
+
+
+//Sorted addresses of the found points
+static std::vector <TPoint *> sorted ( const Container <TPoint *, NonDestructable> &pl )
+{
+        std::vector <TPoint *> s ( pl.begin(), pl.end() );
+        std::sort ( s.begin(), s.end() );
+
+        return s;
+}
+
+
+//Compare queries of the tree storing the points with the brute force search
+static void checkQueries ( const KDTree2D <TPoint> &tree, const std::vector <TPoint *> &points, const unsigned int k )
+{
+        TEST_CHECK ( tree.getNodesCount() == points.size() );
+
+        for ( unsigned int i = 0; i < 20; i++ )
+        {
+                const TPoint q ( testRandom ( -10, 110 ), testRandom ( -10, 110 ) );
+                const std::vector <double> d = bruteForce ( points, &q );
+
+                //Nearest neighbour: equidistant points may be returned, compare distances
+                TEST_CHECK ( dist2 ( tree.findNN ( &q ), &q ) == d[0] );
+
+                //k nearest neighbours sorted by the distance
+                Container <TPoint *, NonDestructable> knn;
+                tree.findAllKNN ( &q, knn, k );
+
+                const unsigned int kk = std::min ( k, ( unsigned int ) points.size() - 1 );
+                TEST_CHECK ( knn.size() == kk );
+
+                for ( unsigned int j = 0; j < knn.size() && j < kk; j++ )
+                {
+                        TEST_CHECK ( dist2 ( knn[j], &q ) == d[j] );
+                }
+
+                //Points in the circle and in the box, including their boundaries
+                const double radius = testRandom ( 0, 20 );
+                const double x_min = q.getX(), y_min = q.getY(), x_max = x_min + testRandom ( 0, 20 ), y_max = y_min + testRandom ( 0, 20 );
+                std::vector <TPoint *> in_radius, in_box;
+
+                for ( unsigned int j = 0; j < points.size(); j++ )
+                {
+                        if ( dist2 ( points[j], &q ) <= radius * radius ) in_radius.push_back ( points[j] );
+
+                        if ( ( points[j]->getX() >= x_min ) && ( points[j]->getX() <= x_max ) && ( points[j]->getY() >= y_min ) && ( points[j]->getY() <= y_max ) ) in_box.push_back ( points[j] );
+                }
+
+                std::sort ( in_radius.begin(), in_radius.end() );
+                std::sort ( in_box.begin(), in_box.end() );
+
+                Container <TPoint *, NonDestructable> found_radius, found_box;
+                tree.findInRadius ( &q, radius, found_radius );
+                tree.findInBox ( x_min, y_min, x_max, y_max, found_box );
+
+                TEST_CHECK ( sorted ( found_radius ) == in_radius );
+                TEST_CHECK ( tree.countInRadius ( &q, radius ) == in_radius.size() );
+                TEST_CHECK ( sorted ( found_box ) == in_box );
+        }
+
+        //k nearest neighbours of all points processed at once: the point itself is the first one
+        Container <TPoint *, NonDestructable> queries;
+
+        for ( unsigned int i = 0; i < points.size(); i += 7 ) queries.push_back ( points[i] );
+
+        std::vector <TPoint *> knn;
+        const unsigned int k_nn = tree.findAllKNN ( queries, knn, k + 1 );
+
+        TEST_CHECK ( k_nn == std::min ( k + 1, ( unsigned int ) points.size() - 1 ) && knn.size() == queries.size() * k_nn );
+
+        for ( unsigned int i = 0; i < queries.size(); i++ )
+        {
+                const std::vector <double> d = bruteForce ( points, queries[i] );
+
+                for ( unsigned int j = 0; j < k_nn; j++ )
+                {
+                        TEST_CHECK ( dist2 ( knn[i * k_nn + j], queries[i] ) == d[j] );
+                }
+        }
+}
+
+
+//Depth of the deepest point
+static unsigned int getMaxDepth ( const KDTree2D <TPoint> &tree, const std::vector <TPoint *> &points )
+{
+        unsigned int depth = 0;
+
+        for ( unsigned int i = 0; i < points.size(); i++ )
+        {
+                const KDNode <TPoint> *node = tree.findParentKDNode ( points[i] );
+                depth = std::max ( depth, node->getDepth() );
+        }
+
+        return depth;
+}
+
+
+int main()
+{
+        srand ( 1 );
+
+        Container <TPoint *> initial_points, inserted_points;
+        std::vector <TPoint *> points;
+
+        for ( unsigned int i = 0; i < 500; i++ )
+        {
+                initial_points.push_back ( new TPoint ( testRandom ( 0, 100 ), testRandom ( 0, 100 ) ) );
+                points.push_back ( initial_points[i] );
+        }
+
+        KDTree2D <TPoint> tree;
+        tree.createKDTree2D ( initial_points );
+        checkQueries ( tree, points, 10 );
+
+        //Random mix of insertions and erasures: scapegoat rebuilds of subtrees, erased nodes and rebuilds of the whole tree
+        for ( unsigned int i = 0; i < 6000; i++ )
+        {
+                //Insert new point, some of them on the grid or equal to present points
+                if ( ( points.size() < 2 ) || ( rand() % 5 < ( i < 3000 ? 3 : 1 ) ) )
+                {
+                        TPoint * point = NULL;
+
+                        if ( i % 3 == 0 ) point = new TPoint ( rand() % 101, rand() % 101 );
+                        else if ( i % 7 == 0 ) point = new TPoint ( *points[rand() % points.size()] );
+                        else point = new TPoint ( testRandom ( 0, 100 ), testRandom ( 0, 100 ) );
+
+                        inserted_points.push_back ( point );
+                        tree.insertPoint ( point );
+                        points.push_back ( point );
+                }
+
+                //Erase present point, it can not be erased twice
+                else
+                {
+                        const unsigned int j = rand() % points.size();
+                        TPoint * point = points[j];
+
+                        points[j] = points.back();
+                        points.pop_back();
+
+                        TEST_CHECK ( tree.erasePoint ( point ) );
+                        TEST_CHECK ( !tree.erasePoint ( point ) );
+                }
+
+                if ( i % 500 == 0 ) checkQueries ( tree, points, 10 );
+        }
+
+        checkQueries ( tree, points, 10 );
+
+        //Points sorted by x are inserted: the depth remains logarithmic
+        KDTree2D <TPoint> sorted_tree;
+        std::vector <TPoint *> sorted_points;
+
+        for ( unsigned int i = 0; i < 4000; i++ )
+        {
+                TPoint * point = new TPoint ( 0.025 * i, testRandom ( 0, 100 ) );
+                inserted_points.push_back ( point );
+                sorted_tree.insertPoint ( point );
+                sorted_points.push_back ( point );
+        }
+
+        TEST_CHECK ( getMaxDepth ( sorted_tree, sorted_points ) <= log ( 4000.0 ) / log ( 1.0 / KD_TREE_SCAPEGOAT_ALPHA ) + 2 );
+        checkQueries ( sorted_tree, sorted_points, 5 );
+
+        //Erase three quarters of points
+        for ( unsigned int i = 0; i < 4000; i++ )
+        {
+                if ( i % 4 != 0 ) TEST_CHECK ( sorted_tree.erasePoint ( inserted_points[inserted_points.size() - 4000 + i] ) );
+        }
+
+        sorted_points.clear();
+
+        for ( unsigned int i = 0; i < 4000; i += 4 ) sorted_points.push_back ( inserted_points[inserted_points.size() - 4000 + i] );
+
+        checkQueries ( sorted_tree, sorted_points, 5 );
+
+        //Empty tree
+        KDTree2D <TPoint> empty_tree;
+        Container <TPoint *, NonDestructable> knn;
+        TEST_THROWS ( empty_tree.findNN ( points[0] ), ErrorBadOutput );
+        TEST_THROWS ( empty_tree.findAllKNN ( points[0], knn, 5 ), ErrorBadOutput );
+        TEST_CHECK ( empty_tree.countInRadius ( points[0], 10.0 ) == 0 );
+
+        return testResult ( "KDTree2D" );
+}
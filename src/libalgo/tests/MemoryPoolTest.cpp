@@ -0,0 +1,204 @@
+// Description: Checks of the memory arenas and of the pool allocated points
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <new>
+#include <vector>
+
+#include "libalgo/source/structures/point/Point3DCartesian.h"
+#include "libalgo/source/structures/point/Node3DCartesian.h"
+#include "libalgo/source/structures/list/MemoryPool.h"
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+
+#include "Test.h"
+
+
+//Object larger than MEMORY_POOL_MAX_ITEM_SIZE, allocated by the global operator
+class LargeItem : public PoolAllocated
+{
+        public:
+                char data[MEMORY_POOL_MAX_ITEM_SIZE + 1];
+};
+
+
+int main()
+{
+        srand ( 1 );
+
+        //Items of the arena: released items are reused, blocks are released by reset
+        {
+                MemoryArena arena;
+                MemoryArenaScope scope ( arena );
+
+                std::vector <Node3DCartesian <double> *> nl;
+
+                for ( unsigned int i = 0; i < 3 * MEMORY_POOL_BLOCK_ITEMS; i++ ) nl.push_back ( new Node3DCartesian <double> ( i, 2.0 * i, 3.0 * i ) );
+
+                TEST_CHECK ( arena.getItemsCount() == nl.size() );
+
+                bool values_kept = true;
+
+                for ( unsigned int i = 0; i < nl.size(); i++ ) values_kept = values_kept && nl[i]->getX() == i && nl[i]->getY() == 2.0 * i && nl[i]->getZ() == 3.0 * i;
+
+                TEST_CHECK ( values_kept );
+
+                //Items are still used
+                TEST_THROWS ( arena.reset(), ErrorBadData );
+
+                Node3DCartesian <double> * released = nl.back();
+                delete released; nl.pop_back();
+
+                TEST_CHECK ( arena.getItemsCount() == nl.size() );
+
+                //The released item is reused
+                Node3DCartesian <double> * n = new Node3DCartesian <double> ( 1, 2, 3 );
+                TEST_CHECK ( n == released );
+                nl.push_back ( n );
+
+                for ( unsigned int i = 0; i < nl.size(); i++ ) delete nl[i];
+
+                TEST_CHECK ( arena.getItemsCount() == 0 );
+
+                arena.reset();
+
+                //Arena is used again after the reset
+                n = new Node3DCartesian <double> ( 1, 2, 3 );
+                TEST_CHECK ( arena.getItemsCount() == 1 && n->getX() == 1 );
+                delete n;
+        }
+
+        //Scopes are nested, items are released in their own arena
+        {
+                MemoryArena arena_outer, arena_inner;
+                Point3DCartesian <double> * p_outer = NULL, * p_inner = NULL;
+
+                {
+                        MemoryArenaScope scope_outer ( arena_outer );
+                        p_outer = new Point3DCartesian <double> ( 1, 1, 1 );
+
+                        {
+                                MemoryArenaScope scope_inner ( arena_inner );
+                                p_inner = new Point3DCartesian <double> ( 2, 2, 2 );
+
+                                TEST_CHECK ( MemoryArena::getCurrent() == &arena_inner );
+                        }
+
+                        TEST_CHECK ( MemoryArena::getCurrent() == &arena_outer );
+
+                        delete p_inner;
+                }
+
+                TEST_CHECK ( arena_outer.getItemsCount() == 1 && arena_inner.getItemsCount() == 0 );
+
+                delete p_outer;
+
+                TEST_CHECK ( arena_outer.getItemsCount() == 0 );
+        }
+
+        //Items allocated in the arena are released by other threads
+        {
+                MemoryArena arena;
+                MemoryArenaScope scope ( arena );
+
+                std::vector <Point3DCartesian <double> *> pl;
+
+                for ( unsigned int i = 0; i < 10000; i++ ) pl.push_back ( new Point3DCartesian <double> ( testRandom ( 0, 1 ), testRandom ( 0, 1 ), 0 ) );
+
+#ifdef _OPENMP
+                #pragma omp parallel for
+#endif
+                for ( int i = 0; i < ( int ) pl.size(); i++ ) delete pl[i];
+
+                TEST_CHECK ( arena.getItemsCount() == 0 );
+
+                arena.reset();
+        }
+
+        //Items allocated by other threads in their default arenas are released by this thread
+        {
+                std::vector <Point3DCartesian <double> *> pl ( 10000 );
+
+#ifdef _OPENMP
+                #pragma omp parallel for
+#endif
+                for ( int i = 0; i < ( int ) pl.size(); i++ ) pl[i] = new Point3DCartesian <double> ( i, i, i );
+
+                bool values_kept = true;
+
+                for ( unsigned int i = 0; i < pl.size(); i++ ) values_kept = values_kept && pl[i]->getX() == i;
+
+                TEST_CHECK ( values_kept );
+
+                for ( unsigned int i = 0; i < pl.size(); i++ ) delete pl[i];
+        }
+
+        //Items outlive their arena: they remain valid, the orphaned pool is deleted with the last item
+        {
+                std::vector <Point3DCartesian <double> *> pl;
+                Node3DCartesian <double> * n = NULL;
+
+                {
+                        MemoryArena arena;
+                        MemoryArenaScope scope ( arena );
+
+                        for ( unsigned int i = 0; i < 10000; i++ ) pl.push_back ( new Point3DCartesian <double> ( i, i, i ) );
+
+                        n = new Node3DCartesian <double> ( 1, 2, 3 );
+                }
+
+                bool values_kept = true;
+
+                for ( unsigned int i = 0; i < pl.size(); i++ ) values_kept = values_kept && pl[i]->getX() == i;
+
+                TEST_CHECK ( values_kept && n->getZ() == 3 );
+
+#ifdef _OPENMP
+                #pragma omp parallel for
+#endif
+                for ( int i = 0; i < ( int ) pl.size(); i++ ) delete pl[i];
+
+                delete n;
+        }
+
+        //Nothrow and placement forms, large objects
+        {
+                MemoryArena arena;
+                MemoryArenaScope scope ( arena );
+
+                Point3DCartesian <double> * p = new ( std::nothrow ) Point3DCartesian <double> ( 1, 2, 3 );
+                TEST_CHECK ( p != NULL && p->getY() == 2 && arena.getItemsCount() == 1 );
+                delete p;
+
+                char buffer[sizeof ( Point3DCartesian <double> ) + 16];
+                void * place = buffer + ( 16 - ( std::size_t ) buffer % 16 ) % 16;
+                Point3DCartesian <double> * q = new ( place ) Point3DCartesian <double> ( 4, 5, 6 );
+                TEST_CHECK ( ( void * ) q == place && q->getZ() == 6 && arena.getItemsCount() == 0 );
+                q->~Point3DCartesian <double>();
+
+                LargeItem * l = new LargeItem();
+                TEST_CHECK ( arena.getItemsCount() == 0 );
+                delete l;
+
+                TEST_CHECK ( arena.getItemsCount() == 0 );
+        }
+
+        return testResult ( "MemoryPoolTest" );
+}
@@ -0,0 +1,115 @@
+// Description: Checks of the exact signs of the robust orientation and in-circle predicates on near-degenerate inputs
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <cmath>
+
+#include "libalgo/source/structures/point/Point3DCartesian.h"
+#include "libalgo/source/algorithms/robustpredicates/RobustPredicates.h"
+
+#include "Test.h"
+
+
+static int sign ( const double x )
+{
+        return ( x > 0 ) - ( x < 0 );
+}
+
+
+int main()
+{
+        //Unit roundoff of 0.5: points 0.5 + i * u are exactly representable
+        const double u = ldexp ( 1.0, -53 );
+
+        RobustPredicates::resetExactCounts();
+
+        //Points near the line y = x (Kettner et al., 2008): the sign is the sign of y - x, the floating point determinant fails for many of them
+        bool orientation_ok = true, antisymmetry_ok = true;
+
+        for ( int i = 0; i < 64; i++ )
+        {
+                for ( int j = 0; j < 64; j++ )
+                {
+                        const double x = 0.5 + i * u, y = 0.5 + j * u;
+                        const double o = RobustPredicates::getOrientation2D ( 12.0, 12.0, 24.0, 24.0, x, y );
+
+                        orientation_ok = orientation_ok && sign ( o ) == sign ( j - i );
+                        antisymmetry_ok = antisymmetry_ok && sign ( RobustPredicates::getOrientation2D ( 24.0, 24.0, 12.0, 12.0, x, y ) ) == - sign ( o );
+                }
+        }
+
+        TEST_CHECK ( orientation_ok );
+        TEST_CHECK ( antisymmetry_ok );
+
+        //Near-degenerate points were evaluated exactly
+        const unsigned long exact_orientations_count = RobustPredicates::getExactOrientationsCount();
+        TEST_CHECK ( exact_orientations_count > 0 );
+
+        //Counts of all threads are summed
+#ifdef _OPENMP
+        #pragma omp parallel for
+#endif
+        for ( int i = 0; i < 64; i++ )
+        {
+                for ( int j = 0; j < 64; j++ )
+                {
+                        RobustPredicates::getOrientation2D ( 12.0, 12.0, 24.0, 24.0, 0.5 + i * u, 0.5 + j * u );
+                        RobustPredicates::getOrientation2D ( 24.0, 24.0, 12.0, 12.0, 0.5 + i * u, 0.5 + j * u );
+                }
+        }
+
+        TEST_CHECK ( RobustPredicates::getExactOrientationsCount() == 2 * exact_orientations_count );
+
+        RobustPredicates::resetExactCounts();
+        TEST_CHECK ( RobustPredicates::getExactOrientationsCount() == 0 && RobustPredicates::getExactInCirclesCount() == 0 );
+
+        //Collinear points with the large coordinates
+        const double c = ldexp ( 1.0, 30 );
+        TEST_CHECK ( RobustPredicates::getOrientation2D ( c, c + 1, c + 1, c + 3, c + 3, c + 7 ) == 0 );
+        TEST_CHECK ( RobustPredicates::getOrientation2D ( c, c + 1, c + 1, c + 3, c + 3, c + 7 + ldexp ( 1.0, -22 ) ) > 0 );
+        TEST_CHECK ( RobustPredicates::getOrientation2D ( c, c + 1, c + 1, c + 3, c + 3, c + 7 - ldexp ( 1.0, -22 ) ) < 0 );
+
+        //Cocircular points on the circle of radius 5 shifted far from the origin, the fourth point is moved by one ulp
+        const double ulp = ldexp ( 1.0, -22 );
+
+        TEST_CHECK ( RobustPredicates::getInCircle ( c + 5, c, c + 3, c + 4, c - 4, c + 3, c, c - 5 ) == 0 );
+        TEST_CHECK ( RobustPredicates::getInCircle ( c + 5, c, c + 3, c + 4, c - 4, c + 3, c, c - 5 + ulp ) > 0 );
+        TEST_CHECK ( RobustPredicates::getInCircle ( c + 5, c, c + 3, c + 4, c - 4, c + 3, c, c - 5 - ulp ) < 0 );
+        TEST_CHECK ( RobustPredicates::getInCircle ( c + 5, c, c + 3, c + 4, c - 4, c + 3, c - 3, c - 4 ) == 0 );
+        TEST_CHECK ( RobustPredicates::getInCircle ( c + 5, c, c + 3, c + 4, c - 4, c + 3, c - 3 + ulp, c - 4 + ulp ) > 0 );
+        TEST_CHECK ( RobustPredicates::getExactInCirclesCount() > 0 );
+
+        //Clockwise triangle inverts the sign
+        TEST_CHECK ( RobustPredicates::getInCircle ( c + 3, c + 4, c + 5, c, c - 4, c + 3, c, c - 5 + ulp ) < 0 );
+
+        //Points far inside and outside
+        TEST_CHECK ( RobustPredicates::getInCircle ( 1.0, 0.0, 0.0, 1.0, -1.0, 0.0, 0.0, 0.0 ) > 0 );
+        TEST_CHECK ( RobustPredicates::getInCircle ( 1.0, 0.0, 0.0, 1.0, -1.0, 0.0, 2.0, 2.0 ) < 0 );
+
+        //Points of the cartesian type
+        Point3DCartesian <double> p1 ( 12, 12 ), p2 ( 24, 24 ), p3 ( 0.5 + 3 * u, 0.5 + 2 * u ), p4 ( 0.5 + 2 * u, 0.5 + 3 * u );
+        TEST_CHECK ( RobustPredicates::getOrientation2D ( &p1, &p2, &p3 ) < 0 );
+        TEST_CHECK ( RobustPredicates::getOrientation2D ( &p1, &p2, &p4 ) > 0 );
+
+        Point3DCartesian <double> q1 ( c + 5, c ), q2 ( c + 3, c + 4 ), q3 ( c - 4, c + 3 ), q4 ( c, c - 5 );
+        TEST_CHECK ( RobustPredicates::getInCircle ( &q1, &q2, &q3, &q4 ) == 0 );
+
+        return testResult ( "RobustPredicatesTest" );
+}
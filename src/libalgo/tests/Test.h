@@ -0,0 +1,73 @@
+// Description: Minimal checks shared by the test programs, run by "make check"
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#ifndef Test_H
+#define Test_H
+
+#include <cstdio>
+#include <cstdlib>
+
+
+//Count of failed checks of the test program
+static unsigned int test_failures_count = 0;
+
+
+//Check the condition, print the failed one
+#define TEST_CHECK(condition) testCheck ( ( condition ), #condition, __FILE__, __LINE__ )
+
+//Check that the statement throws the exception of the given type
+#define TEST_THROWS(statement, exception) \
+        do { bool thrown = false; try { statement; } catch ( exception & ) { thrown = true; } catch ( ... ) {} testCheck ( thrown, #statement " throws " #exception, __FILE__, __LINE__ ); } while ( 0 )
+
+
+inline bool testCheck ( const bool condition, const char * text, const char * file, const int line )
+{
+        if ( !condition )
+        {
+                fprintf ( stderr, "%s:%d: check failed: %s\n", file, line, text );
+                test_failures_count++;
+        }
+
+        return condition;
+}
+
+
+//Uniformly distributed random number in [min, max]
+inline double testRandom ( const double min, const double max )
+{
+        return min + ( max - min ) * rand() / ( double ) RAND_MAX;
+}
+
+
+//Print the summary, the result is the exit code of the test program
+inline int testResult ( const char * name )
+{
+        if ( test_failures_count > 0 )
+        {
+                fprintf ( stderr, "%s: %u checks failed\n", name, test_failures_count );
+                return 1;
+        }
+
+        printf ( "%s: all checks passed\n", name );
+        return 0;
+}
+
+#endif
@@ -0,0 +1,159 @@
+// Description: Checks of the point location in the triangle mesh against the brute force search
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <vector>
+#include <sstream>
+
+#include "libalgo/source/structures/point/Node3DCartesian.h"
+#include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/TriangleMesh.h"
+#include "libalgo/source/structures/list/TriangleMeshLocator.h"
+#include "libalgo/source/algorithms/triangulations2D/DT2D.h"
+#include "libalgo/source/algorithms/robustpredicates/RobustPredicates.h"
+#include "libalgo/source/algorithms/lawsonorientedwalk/LawsonOrientedWalk.h"
+
+#include "libalgo/source/exceptions/ErrorBadData.h"
+
+#include "Test.h"
+
+
+//Point lies on the closed segment of the half edge e
+static bool isOnEdge ( const TriangleMesh <double> &mesh, const Node3DCartesian <double> *p, const unsigned int e )
+{
+        const Node3DCartesian <double> * p1 = mesh.getPoint ( e ), * p2 = mesh.getPoint ( TriangleMesh <double>::getNextEdge ( e ) );
+
+        return ( RobustPredicates::getOrientation2D ( p1, p2, p ) == 0 ) && ( ( p->getX() - p1->getX() ) * ( p->getX() - p2->getX() ) <= 0 ) && ( ( p->getY() - p1->getY() ) * ( p->getY() - p2->getY() ) <= 0 );
+}
+
+
+//Compare the result of the point location with the brute force search over all triangles
+static bool checkLocation ( const TriangleMesh <double> &mesh, const Node3DCartesian <double> *p, const unsigned int e, const short status )
+{
+        bool on_edge = false;
+
+        for ( unsigned int t = 0; t < mesh.getTrianglesCount(); t++ )
+        {
+                const double o1 = RobustPredicates::getOrientation2D ( mesh.getPoint ( 3 * t ), mesh.getPoint ( 3 * t + 1 ), p );
+                const double o2 = RobustPredicates::getOrientation2D ( mesh.getPoint ( 3 * t + 1 ), mesh.getPoint ( 3 * t + 2 ), p );
+                const double o3 = RobustPredicates::getOrientation2D ( mesh.getPoint ( 3 * t + 2 ), mesh.getPoint ( 3 * t ), p );
+
+                //Point lies inside the triangle
+                if ( ( o1 > 0 ) && ( o2 > 0 ) && ( o3 > 0 ) )
+                {
+                        return ( status == 1 ) && ( TriangleMesh <double>::getTriangle ( e ) == t );
+                }
+
+                //Point lies on the edge of the triangle
+                if ( ( o1 >= 0 ) && ( o2 >= 0 ) && ( o3 >= 0 ) ) on_edge = true;
+        }
+
+        //Point lies on the returned edge
+        if ( on_edge )
+        {
+                return ( status == 2 ) && ( e != NO_HALF_EDGE ) && isOnEdge ( mesh, p, e );
+        }
+
+        //Point lies outside of the mesh
+        return ( status == 0 ) && ( e == NO_HALF_EDGE );
+}
+
+
+//Locate the points one by one and in the batch, compare both with the brute force search
+static void checkLocator ( const TriangleMesh <double> &mesh, const Container <Node3DCartesian <double> *> &queries )
+{
+        TriangleMeshLocator <double> locator ( mesh );
+
+        //Single points
+        bool single_ok = true;
+        TWalkStatistics statistics;
+
+        for ( unsigned int i = 0; i < queries.size(); i++ )
+        {
+                short status = -1;
+                const unsigned int e = locator.findTriangle ( queries[i], &status, &statistics );
+
+                single_ok = single_ok && checkLocation ( mesh, queries[i], e, status );
+        }
+
+        TEST_CHECK ( single_ok );
+        TEST_CHECK ( statistics.walks == queries.size() );
+
+        //All points at once
+        std::vector <unsigned int> edges;
+        std::vector <short> statuses;
+        TWalkStatistics batch_statistics;
+
+        locator.findTriangles ( queries, edges, statuses, &batch_statistics );
+
+        bool batch_ok = ( edges.size() == queries.size() ) && ( statuses.size() == queries.size() );
+
+        for ( unsigned int i = 0; batch_ok && ( i < queries.size() ); i++ ) batch_ok = checkLocation ( mesh, queries[i], edges[i], statuses[i] );
+
+        TEST_CHECK ( batch_ok );
+        TEST_CHECK ( batch_statistics.walks == queries.size() );
+}
+
+
+int main()
+{
+        srand ( 1 );
+
+        std::ostringstream output;
+
+        //Random points, queries inside and outside of the mesh, larger batch is located in parallel
+        Container <Node3DCartesian <double> *> nl, queries;
+
+        for ( unsigned int i = 0; i < 1000; i++ ) nl.push_back ( new Node3DCartesian <double> ( testRandom ( 0, 1000 ), testRandom ( 0, 1000 ), 0 ) );
+
+        for ( unsigned int i = 0; i < POINT_LOCATION_PARALLEL_QUERY_SIZE + 1000; i++ ) queries.push_back ( new Node3DCartesian <double> ( testRandom ( -200, 1200 ), testRandom ( -200, 1200 ), 0 ) );
+
+        //Vertices of the mesh
+        for ( unsigned int i = 0; i < 100; i++ ) queries.push_back ( new Node3DCartesian <double> ( nl[i]->getX(), nl[i]->getY(), 0 ) );
+
+        TriangleMesh <double> mesh;
+        DT2D::DT ( nl, mesh, false, true, &output );
+        checkLocator ( mesh, queries );
+
+        //Points on the grid, queries on the edges and vertices of the mesh and inside the triangles
+        Container <Node3DCartesian <double> *> nl_grid, queries_grid;
+
+        for ( unsigned int i = 0; i < 10; i++ )
+        {
+                for ( unsigned int j = 0; j < 10; j++ ) nl_grid.push_back ( new Node3DCartesian <double> ( i, j, 0 ) );
+        }
+
+        for ( unsigned int i = 0; i < 24; i++ )
+        {
+                for ( unsigned int j = 0; j < 24; j++ ) queries_grid.push_back ( new Node3DCartesian <double> ( -1.0 + 0.5 * i, -1.0 + 0.5 * j, 0 ) );
+        }
+
+        for ( unsigned int i = 0; i < 200; i++ ) queries_grid.push_back ( new Node3DCartesian <double> ( testRandom ( -1, 10 ), testRandom ( -1, 10 ), 0 ) );
+
+        TriangleMesh <double> mesh_grid;
+        DT2D::DT ( nl_grid, mesh_grid, false, true, &output, DivideAndConquer );
+        checkLocator ( mesh_grid, queries_grid );
+
+        //Empty mesh
+        TriangleMesh <double> mesh_empty;
+        TEST_THROWS ( TriangleMeshLocator <double> locator ( mesh_empty ), ErrorBadData );
+
+        return testResult ( "TriangleMeshLocatorTest" );
+}
@@ -0,0 +1,149 @@
+// Description: Checks of the Voronoi diagram constructed over the triangle mesh: topology of cells, vertices nearest to their generators
+
+
+// Copyright (c) 2010 - 2013
+// Tomas Bayer
+// Charles University in Prague, Faculty of Science
+// bayertom@natur.cuni.cz
+
+// This library is free software: you can redistribute it and/or modify
+// it under the terms of the GNU Lesser General Public License as published
+// by the Free Software Foundation, either version 3 of the License, or
+// (at your option) any later version.
+//
+// This library is distributed in the hope that it will be useful,
+// but WITHOUT ANY WARRANTY; without even the implied warranty of
+// MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+// GNU Lesser General Public License for more details.
+//
+// You should have received a copy of the GNU Lesser General Public License
+// along with this library. If not, see <http://www.gnu.org/licenses/>.
+
+
+#include <set>
+#include <cmath>
+#include <sstream>
+
+#include "libalgo/source/const/Const.h"
+#include "libalgo/source/structures/point/Node3DCartesian.h"
+#include "libalgo/source/structures/line/HalfEdge.h"
+#include "libalgo/source/structures/face/VoronoiCell.h"
+#include "libalgo/source/structures/list/Container.h"
+#include "libalgo/source/structures/list/TriangleMesh.h"
+#include "libalgo/source/algorithms/voronoi2D/Voronoi2D.h"
+
+#include "Test.h"
+
+
+typedef Node3DCartesian <double> TNode;
+
+
+static double dist ( const TNode * p1, const TNode * p2 )
+{
+        return sqrt ( ( p1->getX() - p2->getX() ) * ( p1->getX() - p2->getX() ) + ( p1->getY() - p2->getY() ) * ( p1->getY() - p2->getY() ) );
+}
+
+
+//Construct Voronoi diagram; check the count of cells, the topology of cells and that their vertices are nearest to their generators
+static void checkVD ( Container <TNode *> &nl, const TVoronoiCellsType cells_type, const TVoronoiDiagramMethod method )
+{
+        Container <TNode *> vor_points;
+        Container <HalfEdge <double> *> hl_vor;
+        Container <VoronoiCell <double> *> vl;
+        TriangleMesh <double> dt;
+        std::ostringstream output;
+
+        Voronoi2D::VD ( nl, vor_points, dt, hl_vor, vl, cells_type, method, false, true, &output );
+
+        //Points of the convex hull have unbounded cells
+        unsigned int boundary_edges = 0;
+
+        for ( unsigned int e = 0; e < dt.getEdgesCount(); e++ )
+        {
+                if ( dt.isBoundaryEdge ( e ) ) boundary_edges++;
+        }
+
+        TEST_CHECK ( vl.size() == ( cells_type == AllCells ? nl.size() : nl.size() - boundary_edges ) );
+
+        std::set <const TNode *> generators;
+        bool valid = true, nearest = true;
+
+        for ( unsigned int i = 0; i < vl.size(); i++ )
+        {
+                const VoronoiCell <double> *cell = vl[i];
+                const TNode * generator = cell->getGenerator();
+
+                //One cell of each generator
+                valid = valid && generators.insert ( generator ).second && generator->getFace() == cell;
+
+                //Unbounded cell is not closed
+                if ( !cell->getBounded() ) continue;
+
+                //Edges of the cell form a cycle, twin edges have the opposite direction
+                const HalfEdge <double> *e = cell->getHalfEdge();
+                unsigned int vertices_count = 0;
+
+                do
+                {
+                        const HalfEdge <double> *e_twin = e->getTwinEdge();
+
+                        valid = valid && e->getFace() == cell && e->getNextEdge()->getPreviousEdge() == e;
+                        valid = valid && ( e_twin == NULL || ( e_twin->getTwinEdge() == e && e_twin->getPoint() == e->getNextEdge()->getPoint() ) );
+
+                        //Voronoi vertex is equidistant from its nearest points, the generator is one of them
+                        double dist_min = dist ( e->getPoint(), nl[0] );
+
+                        for ( unsigned int j = 1; j < nl.size(); j++ ) dist_min = std::min ( dist_min, dist ( e->getPoint(), nl[j] ) );
+
+                        nearest = nearest && dist ( e->getPoint(), generator ) - dist_min <= 2 * MIN_POSITION_DIFF;
+
+                        e = e->getNextEdge();
+                        vertices_count++;
+                }
+                while ( ( e != cell->getHalfEdge() ) && ( vertices_count <= cell->getVerticesCount() ) );
+
+                valid = valid && vertices_count == cell->getVerticesCount();
+        }
+
+        TEST_CHECK ( valid );
+        TEST_CHECK ( nearest );
+}
+
+
+int main()
+{
+        srand ( 1 );
+
+        //Random points
+        Container <TNode *> nl;
+
+        for ( unsigned int i = 0; i < 1000; i++ ) nl.push_back ( new TNode ( testRandom ( 0, 1000 ), testRandom ( 0, 1000 ), 0 ) );
+
+        checkVD ( nl, AllCells, TopologicApproach );
+        checkVD ( nl, BoundedCells, TopologicApproach );
+        checkVD ( nl, BoundedCells, ErrorFreeApproach );
+
+        //Points on the grid: Voronoi vertices shared by 4 cells
+        Container <TNode *> nl_grid;
+
+        for ( unsigned int i = 0; i < 20; i++ )
+        {
+                for ( unsigned int j = 0; j < 20; j++ ) nl_grid.push_back ( new TNode ( 10.0 * i, 10.0 * j, 0.0 ) );
+        }
+
+        checkVD ( nl_grid, AllCells, TopologicApproach );
+
+        //Less than 3 points: no cell
+        Container <TNode *> nl_pair, vor_points;
+        Container <HalfEdge <double> *> hl_vor;
+        Container <VoronoiCell <double> *> vl;
+        TriangleMesh <double> dt;
+
+        nl_pair.push_back ( new TNode ( 0.0, 0.0, 0.0 ) );
+        nl_pair.push_back ( new TNode ( 1.0, 1.0, 0.0 ) );
+
+        Voronoi2D::VD ( nl_pair, vor_points, dt, hl_vor, vl );
+        TEST_CHECK ( vl.empty() && vor_points.empty() );
+
+        return testResult ( "Voronoi2DTest" );
+}